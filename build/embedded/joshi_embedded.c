@@ -0,0 +1,7253 @@
+/* Generated by `make embedded` from library sources */
+#include "joshi_embedded.h"
+
+static const unsigned char file_0[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x07, 0x01,
+	0xab, 0x00, 0x00, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x01,
+	0xab, 0x00, 0x01, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07, 0x01,
+	0xab, 0x00, 0x02, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x04, 0x00, 0x03, 0x00, 0x07,
+	0x6e, 0x04, 0x07, 0x08, 0x2a, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x03, 0x00, 0x09,
+	0x6e, 0x05, 0x09, 0x08, 0x22, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x04, 0x08,
+	0x00, 0x06, 0x08, 0x07, 0xd2, 0x00, 0x07, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x08, 0x00,
+	0xa0, 0x00, 0x00, 0x07, 0x00, 0x09, 0x07, 0x05, 0x6e, 0x03, 0x00, 0x07, 0x6e, 0x04, 0x07, 0x08,
+	0x22, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x09, 0x00, 0x04, 0x09, 0x08,
+	0x6e, 0x80, 0x00, 0x06, 0x02, 0x00, 0x05, 0x0b, 0x00, 0x0a, 0x0b, 0x0a, 0xd2, 0x0c, 0x0b, 0x0c,
+	0x97, 0x00, 0x0d, 0x0d, 0x03, 0x00, 0x0a, 0x02, 0xb0, 0x0e, 0x0a, 0x08, 0x36, 0x00, 0x08, 0x06,
+	0x00, 0x00, 0x03, 0x08, 0x00, 0x0f, 0x08, 0x07, 0xd2, 0x00, 0x06, 0x09, 0x00, 0x00, 0x02, 0x0b,
+	0x00, 0x10, 0x0b, 0x0a, 0xd2, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x81, 0xed, 0x0b,
+	0x04, 0x00, 0x07, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x75,
+	0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01,
+	0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00,
+	0x00, 0x00, 0x2c, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x20,
+	0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20,
+	0x5b, 0x3c, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x3e, 0x5d, 0x01,
+	0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x2e, 0x02, 0x6a, 0x02, 0x73, 0x11, 0x0b, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x2e, 0x6a, 0x73, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x2e, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x16, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x20, 0x48,
+	0x08, 0x11, 0x49, 0x00, 0x04, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_1[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x02,
+	0x98, 0x00, 0x03, 0x03, 0x98, 0x00, 0x04, 0x04, 0x98, 0x00, 0x09, 0x00, 0xab, 0x00, 0x00, 0x0b,
+	0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x05, 0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x01, 0x0b,
+	0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x06, 0x00, 0x03, 0x02, 0x09, 0x97, 0x00, 0x09, 0x07,
+	0x00, 0x00, 0x09, 0x00, 0xc0, 0x00, 0x09, 0x08, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x0a,
+	0x98, 0x0a, 0x04, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x98, 0x0a, 0x05, 0x09,
+	0x71, 0x00, 0x08, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x06,
+	0x0b, 0x00, 0x12, 0x02, 0x72, 0x02, 0x65, 0x02, 0x71, 0x02, 0x75, 0x02, 0x69, 0x02, 0x72, 0x02,
+	0x65, 0x0a, 0x00, 0xfe, 0x83, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x01, 0x76, 0x04, 0x0b, 0x09, 0x0d,
+	0x20, 0x20, 0xc2, 0xa0, 0xc2, 0xa0, 0xe1, 0x9a, 0x80, 0xe1, 0x9a, 0x80, 0xe1, 0xa0, 0x8e, 0xe1,
+	0xa0, 0x8e, 0xe2, 0x80, 0x80, 0xe2, 0x80, 0x8a, 0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa9, 0xe2, 0x80,
+	0xaf, 0xe2, 0x80, 0xaf, 0xe2, 0x81, 0x9f, 0xe2, 0x81, 0x9f, 0xe3, 0x80, 0x80, 0xe3, 0x80, 0x80,
+	0xef, 0xbb, 0xbf, 0xef, 0xbb, 0xbf, 0x01, 0x02, 0x28, 0x0a, 0x00, 0xfe, 0x83, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0x01, 0x76, 0x04, 0x0b, 0x09, 0x0d, 0x20, 0x20, 0xc2, 0xa0, 0xc2, 0xa0, 0xe1, 0x9a,
+	0x80, 0xe1, 0x9a, 0x80, 0xe1, 0xa0, 0x8e, 0xe1, 0xa0, 0x8e, 0xe2, 0x80, 0x80, 0xe2, 0x80, 0x8a,
+	0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa9, 0xe2, 0x80, 0xaf, 0xe2, 0x80, 0xaf, 0xe2, 0x81, 0x9f, 0xe2,
+	0x81, 0x9f, 0xe3, 0x80, 0x80, 0xe3, 0x80, 0x80, 0xef, 0xbb, 0xbf, 0xef, 0xbb, 0xbf, 0x01, 0x0b,
+	0x02, 0x04, 0x02, 0x27, 0x27, 0x22, 0x22, 0x0b, 0x03, 0x0b, 0x04, 0x0a, 0x01, 0xfe, 0x83, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf, 0x01, 0x0e, 0x05, 0x02, 0x27, 0x27, 0x22, 0x22, 0x01, 0x0b, 0x05, 0x0f,
+	0x01, 0x0a, 0x00, 0xfe, 0x83, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x01, 0x76, 0x04, 0x0b, 0x09, 0x0d,
+	0x20, 0x20, 0xc2, 0xa0, 0xc2, 0xa0, 0xe1, 0x9a, 0x80, 0xe1, 0x9a, 0x80, 0xe1, 0xa0, 0x8e, 0xe1,
+	0xa0, 0x8e, 0xe2, 0x80, 0x80, 0xe2, 0x80, 0x8a, 0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa9, 0xe2, 0x80,
+	0xaf, 0xe2, 0x80, 0xaf, 0xe2, 0x81, 0x9f, 0xe2, 0x81, 0x9f, 0xe3, 0x80, 0x80, 0xe3, 0x80, 0x80,
+	0xef, 0xbb, 0xbf, 0xef, 0xbb, 0xbf, 0x01, 0x02, 0x29, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x26, 0x5c, 0x62, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x5c, 0x73, 0x2a, 0x5c, 0x28, 0x5c,
+	0x73, 0x2a, 0x28, 0x5b, 0x27, 0x22, 0x5d, 0x29, 0x28, 0x5b, 0x5e, 0x27, 0x22, 0x5d, 0x2b, 0x29,
+	0x5c, 0x31, 0x5c, 0x73, 0x2a, 0x5c, 0x29, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x63, 0x72, 0x69,
+	0x70, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x00, 0x00,
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00,
+	0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x01, 0x09, 0x08, 0xd2, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x08,
+	0x01, 0xb0, 0x00, 0x08, 0x02, 0x00, 0x00, 0x07, 0x00, 0xc0, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07,
+	0x00, 0xc1, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x00, 0xc1, 0x00, 0x07, 0x05, 0x00, 0x00, 0x07,
+	0x01, 0xab, 0x00, 0x02, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x00, 0xc1, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x03, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x09,
+	0x0b, 0x00, 0x04, 0x0b, 0x0a, 0xd2, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x0a, 0x05,
+	0x0a, 0x35, 0x06, 0x0a, 0x09, 0x36, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08,
+	0x07, 0xd2, 0x00, 0x07, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x04, 0x08, 0x00, 0x08, 0x08,
+	0x07, 0xd2, 0x00, 0x01, 0x09, 0x98, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08,
+	0x07, 0xd2, 0x00, 0x09, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08,
+	0x07, 0xd2, 0x00, 0x0a, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0b, 0x0b, 0x0a, 0xd2, 0x00, 0x05,
+	0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x0a, 0x0c, 0x0a, 0x35, 0x0d, 0x0a, 0x09, 0x36, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x0e, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x0f, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x10, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x11, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x12, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x13, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x14, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x15, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x16, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x17, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x18, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x19, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x1a, 0x08, 0x07, 0xd2, 0x00, 0x1b, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x14, 0x23, 0x21, 0x2f, 0x75,
+	0x73, 0x72, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x65, 0x6e, 0x76, 0x20, 0x6a, 0x6f, 0x73, 0x68, 0x69,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x62, 0x61, 0x73, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x1e, 0x2f, 0x2f, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62,
+	0x79, 0x20, 0x60, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x20, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+	0x20, 0x5f, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5d,
+	0x3b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4a, 0x53, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x63, 0x6f, 0x6e,
+	0x73, 0x74, 0x20, 0x5f, 0x5f, 0x64, 0x65, 0x70, 0x73, 0x20, 0x3d, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x13, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x63,
+	0x61, 0x63, 0x68, 0x65, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x66,
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5f, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+	0x65, 0x28, 0x69, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x09, 0x72, 0x65, 0x74,
+	0x75, 0x72, 0x6e, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x6d, 0x6f,
+	0x64, 0x75, 0x6c, 0x65, 0x29, 0x20, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x21, 0x09, 0x09, 0x63, 0x6f,
+	0x6e, 0x73, 0x74, 0x20, 0x64, 0x65, 0x70, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x64, 0x65, 0x70, 0x73,
+	0x5b, 0x69, 0x64, 0x5d, 0x5b, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5d, 0x3b, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x64, 0x65, 0x70, 0x20, 0x3d, 0x3d, 0x3d, 0x20,
+	0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+	0x6e, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x28, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+	0x29, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x21, 0x28, 0x64,
+	0x65, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x5f, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x29, 0x29, 0x00,
+	0x00, 0x00, 0x00, 0x31, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5b, 0x64,
+	0x65, 0x70, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x5b,
+	0x64, 0x65, 0x70, 0x5d, 0x28, 0x5f, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x28, 0x64,
+	0x65, 0x70, 0x29, 0x29, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75,
+	0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5b, 0x64, 0x65, 0x70, 0x5d, 0x3b,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x7d, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x6d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x28, 0x61, 0x72, 0x67, 0x76, 0x2c, 0x20, 0x5f, 0x5f, 0x72,
+	0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x28, 0x30, 0x29, 0x29, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x05, 0x0b, 0x00,
+	0x05, 0x05, 0x6c, 0x00, 0x01, 0x06, 0x0b, 0x06, 0x05, 0x05, 0x1c, 0x00, 0x05, 0x00, 0x30, 0x80,
+	0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x05, 0x6c, 0x00, 0x05, 0x00, 0x9d, 0x00,
+	0x02, 0x05, 0x0b, 0x03, 0x05, 0x01, 0x6e, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x01,
+	0x06, 0x05, 0x70, 0x00, 0x02, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x04, 0x07, 0x06, 0xd2, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x05, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x04,
+	0x07, 0x06, 0xd2, 0x00, 0x08, 0x00, 0xc0, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x05, 0x0b, 0x00,
+	0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00,
+	0x06, 0x02, 0x00, 0x00, 0x08, 0x05, 0x0b, 0x0a, 0x09, 0x05, 0x73, 0x00, 0x05, 0x00, 0xc1, 0x00,
+	0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00,
+	0x08, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x0b, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x00,
+	0x06, 0x01, 0xb0, 0x00, 0x06, 0x03, 0x00, 0x00, 0x07, 0x00, 0x08, 0x07, 0x06, 0x06, 0x1c, 0x00,
+	0x06, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x04, 0x06, 0x00, 0x04, 0x06, 0x05, 0xd2, 0x00,
+	0x03, 0x07, 0x00, 0x0c, 0x07, 0x07, 0x6e, 0x00, 0x05, 0x01, 0xb0, 0x7f, 0xff, 0xf0, 0x02, 0x00,
+	0x00, 0x00, 0xa2, 0x00, 0x04, 0x06, 0x00, 0x0d, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x98, 0x00,
+	0x05, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x69, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x61, 0x74, 0x68, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x64, 0x65, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x52, 0x45, 0x51, 0x55, 0x49, 0x52, 0x45, 0x5f, 0x52, 0x45, 0x47, 0x45, 0x58, 0x50,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x65, 0x63,
+	0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f,
+	0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x02, 0xad, 0x00, 0x01, 0x04, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x02,
+	0xb0, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x08, 0x02, 0x01, 0x02, 0x1c, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x03, 0x03, 0x0b, 0x03, 0x02, 0x02,
+	0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x05, 0xad, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01,
+	0xb0, 0x05, 0x04, 0x02, 0x70, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
+	0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x64, 0x65, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x09, 0x10, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64,
+	0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1a, 0x3c,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x14, 0x92, 0x02, 0x02,
+	0x41, 0x49, 0x09, 0x00, 0x40, 0x42, 0x5a, 0x19, 0x30, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x05, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x6f,
+	0x64, 0x75, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+	0xb0, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x0d,
+	0x02, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x04, 0x05, 0x03, 0x00, 0x03, 0x01,
+	0xb0, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x02, 0x05, 0x02, 0x35, 0x00, 0x06, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x08, 0x06, 0x03, 0x00, 0x04, 0x01,
+	0xb0, 0x80, 0x00, 0x05, 0x02, 0x00, 0x06, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x07, 0x05, 0x04,
+	0xd2, 0x00, 0x09, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x06, 0x03, 0x0b, 0x00, 0x03, 0x05,
+	0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x06, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x0a, 0x06, 0x03, 0x00, 0x04, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x23, 0x21, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0x2f,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70,
+	0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+	0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x2c, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x29,
+	0x20, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+	0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x29, 0x20, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x7d, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75,
+	0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x15, 0x26, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x90, 0x08,
+	0xa0, 0x88, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2e, 0x6c, 0x00, 0x00,
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+	0x00, 0x02, 0x50, 0x86, 0xa3, 0x25, 0x22, 0x00, 0x10, 0x25, 0xa3, 0xd2, 0x20, 0x01, 0x02, 0x04,
+	0x00, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x90, 0x80, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x63, 0x72, 0x69, 0x70, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x61, 0x64, 0x64,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x70, 0x61, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x69, 0x64, 0x73, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x05, 0x70, 0x61, 0x74, 0x68, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x04, 0x64, 0x65, 0x70, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e,
+	0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0x06, 0x03, 0x00, 0x03, 0x02, 0xb0, 0x00, 0x03, 0x05, 0x00, 0x02, 0x05,
+	0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc1, 0x00, 0x03,
+	0x02, 0x00, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x04, 0x05, 0x03, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x05, 0x03, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x01, 0x05, 0x03, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x01, 0x04, 0x00, 0x06, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x98, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x07, 0x01, 0x05, 0x6e, 0x05, 0x08,
+	0x05, 0x35, 0x09, 0x05, 0x05, 0x36, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04,
+	0x03, 0xd2, 0x00, 0x0a, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x01, 0x04, 0x00, 0x06, 0x04,
+	0x03, 0xd2, 0x00, 0x01, 0x05, 0x98, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04,
+	0x03, 0xd2, 0x00, 0x0b, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04,
+	0x03, 0xd2, 0x00, 0x01, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x0c, 0x04,
+	0x03, 0xd2, 0x00, 0x0d, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x6a, 0x73, 0x5f, 0x66,
+	0x69, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x6f,
+	0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x37,
+	0x2f, 0x2a, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+	0x60, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x60, 0x20,
+	0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x73, 0x20, 0x2a, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x23, 0x69, 0x6e, 0x63,
+	0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x5f, 0x65, 0x6d, 0x62, 0x65,
+	0x64, 0x64, 0x65, 0x64, 0x2e, 0x68, 0x22, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45,
+	0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x24, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x5f,
+	0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5f, 0x63,
+	0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x00,
+	0x00, 0x2e, 0x4a, 0x4f, 0x53, 0x48, 0x49, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 0x44, 0x45, 0x44,
+	0x5f, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x5f, 0x65, 0x6d, 0x62, 0x65,
+	0x64, 0x64, 0x65, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5b, 0x5d, 0x20, 0x3d, 0x20, 0x7b,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x7d, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x01, 0x0a, 0x09, 0xd2, 0x00, 0x02,
+	0x0b, 0x0b, 0x03, 0x0b, 0x0b, 0x36, 0x00, 0x0b, 0x0b, 0x34, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09,
+	0x02, 0x00, 0x04, 0x00, 0x08, 0x1a, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00,
+	0x13, 0x02, 0x00, 0x00, 0x09, 0x00, 0x05, 0x09, 0x08, 0xd2, 0x00, 0x03, 0x0a, 0x03, 0x00, 0x08,
+	0x01, 0xb0, 0x06, 0x08, 0x08, 0x1a, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x02,
+	0x09, 0x00, 0x07, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x0a, 0x03, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08,
+	0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x02, 0x09, 0x02, 0x35, 0x02, 0x0a, 0x08, 0x35, 0x0b, 0x08,
+	0x02, 0x36, 0x80, 0x00, 0x02, 0x02, 0x02, 0x0c, 0x08, 0x35, 0x0b, 0x08, 0x02, 0x36, 0x00, 0x0d,
+	0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0e, 0x0a, 0x09, 0xd2, 0x00, 0x0d, 0x0b, 0x0b, 0x00, 0x0b,
+	0x0d, 0x00, 0x0f, 0x0d, 0x0c, 0xd2, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c,
+	0x02, 0xb0, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x03, 0x00, 0x00, 0x10,
+	0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x11, 0x0a, 0x09, 0xd2, 0x01, 0x12, 0x0b, 0x35, 0x13, 0x0b,
+	0x0b, 0x36, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x38, 0x02, 0x80, 0x00,
+	0x06, 0x02, 0x80, 0x00, 0x04, 0x04, 0x14, 0x03, 0x08, 0x6e, 0x08, 0x04, 0x08, 0x28, 0x00, 0x08,
+	0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x31, 0x02, 0x15, 0x04, 0x04, 0x36, 0x7f, 0xff,
+	0xf9, 0x02, 0x00, 0x08, 0x00, 0xc1, 0x00, 0x08, 0x05, 0x00, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00,
+	0x1f, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x04, 0x06, 0x00, 0x15, 0x04, 0x08, 0x36, 0x08, 0x06,
+	0x09, 0x28, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x14, 0x03, 0x0a, 0x6e, 0x0a, 0x06,
+	0x09, 0x28, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x14, 0x02, 0x00, 0x06,
+	0x08, 0x7a, 0x7f, 0xff, 0xf5, 0x02, 0x00, 0x03, 0x08, 0x00, 0x06, 0x08, 0x07, 0x6c, 0x00, 0x05,
+	0x09, 0x00, 0x11, 0x09, 0x08, 0xd2, 0x15, 0x07, 0x0a, 0x2a, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x00, 0x16, 0x0a, 0x03, 0x80, 0x00, 0x01, 0x02, 0x00, 0x17, 0x0a, 0x03, 0x0a, 0x18,
+	0x0a, 0x35, 0x00, 0x07, 0x0c, 0x00, 0x19, 0x0c, 0x0b, 0xd2, 0x80, 0x10, 0x0d, 0x04, 0x00, 0x0b,
+	0x01, 0xb0, 0x0b, 0x0a, 0x0a, 0x34, 0x00, 0x08, 0x01, 0xb0, 0x7f, 0xff, 0xec, 0x02, 0x00, 0x01,
+	0x00, 0xa2, 0x00, 0x10, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x11, 0x0a, 0x09, 0xd2, 0x00, 0x05,
+	0x0c, 0x00, 0x1a, 0x0c, 0x0b, 0xd2, 0x00, 0x1b, 0x0d, 0x03, 0x00, 0x0b, 0x01, 0xb0, 0x0b, 0x1c,
+	0x0b, 0x35, 0x1d, 0x0b, 0x0b, 0x36, 0x00, 0x09, 0x01, 0xb0, 0x7f, 0xff, 0xcf, 0x02, 0x00, 0x00,
+	0x00, 0xa2, 0x00, 0x10, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x11, 0x0a, 0x09, 0xd2, 0x00, 0x1e,
+	0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x10, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x11, 0x0a,
+	0x09, 0xd2, 0x00, 0x17, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66,
+	0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6c, 0x69, 0x62, 0x5f, 0x64, 0x69, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x01, 0xbf, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x74, 0x61, 0x72, 0x74,
+	0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x23, 0x21, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x19, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+	0x28, 0x61, 0x72, 0x67, 0x76, 0x2c, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x29, 0x7b,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3b, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x16, 0x66, 0x75,
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x2c, 0x20,
+	0x6a, 0x29, 0x7b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64,
+	0x75, 0x6d, 0x70, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5b, 0x5d,
+	0x20, 0x3d, 0x20, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01,
+	0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7d, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2c, 0x77, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x24, 0x80,
+	0x80, 0x45, 0x22, 0x14, 0x00, 0x24, 0x02, 0x40, 0x40, 0x00, 0x90, 0x01, 0x09, 0x00, 0x02, 0x12,
+	0x00, 0x84, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04,
+	0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x02, 0x05, 0x35, 0x03, 0x05, 0x05, 0x36, 0x01, 0x05, 0x05,
+	0x34, 0x04, 0x05, 0x05, 0x36, 0x01, 0x05, 0x05, 0x34, 0x05, 0x05, 0x05, 0x36, 0x00, 0x03, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x7b, 0x20,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x66, 0x69, 0x6c, 0x65,
+	0x5f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x29, 0x20, 0x7d, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64,
+	0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x19, 0x36,
+	0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x29, 0x10, 0x20, 0x4b,
+	0x50, 0xa4, 0x10, 0x25, 0x69, 0x10, 0x24, 0x20, 0x00, 0x00, 0x00, 0x07, 0x6c, 0x69, 0x62, 0x5f,
+	0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x00, 0xc1, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+	0xb0, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x98, 0x00, 0x05, 0x01,
+	0xb0, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x36, 0x00, 0x02, 0x01,
+	0x34, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x01, 0x05,
+	0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x02,
+	0x0b, 0x00, 0x02, 0x04, 0x00, 0x05, 0x04, 0x03, 0xd2, 0x00, 0x06, 0x05, 0xad, 0x00, 0x01, 0x07,
+	0x00, 0x00, 0x07, 0x08, 0x0b, 0x00, 0x08, 0x08, 0x34, 0x01, 0x08, 0x08, 0x36, 0x00, 0x05, 0x02,
+	0xb0, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x04, 0x03, 0x9b, 0x80, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x03,
+	0x00, 0x08, 0x03, 0x02, 0xd2, 0x00, 0x09, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x04, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x0a, 0x04, 0x03,
+	0xd2, 0x00, 0x07, 0x05, 0x0b, 0x00, 0x05, 0x05, 0x34, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x69, 0x73, 0x5f, 0x64, 0x69,
+	0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6e, 0x61, 0x6d, 0x65,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x6a, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6e,
+	0x64, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x23, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x24, 0x08, 0x00, 0x20, 0x08, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x6a, 0x73,
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0d, 0x00, 0x00,
+	0x00, 0xb1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x1a, 0x21, 0x30, 0x00, 0x00, 0x00,
+	0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x70, 0x72, 0x65, 0x66,
+	0x69, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x79, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x06, 0xd2, 0x00,
+	0x01, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x06, 0x0d, 0x00, 0x06, 0x07, 0x00, 0x00,
+	0x07, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x01, 0x09, 0x00, 0x00, 0x09, 0x08, 0xd2, 0x00,
+	0x02, 0x0a, 0x03, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x08, 0x0d, 0x00, 0x08, 0x07, 0x00, 0x00,
+	0x07, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x03, 0x01, 0x01, 0x36, 0x00, 0x01, 0x07, 0x00, 0x00,
+	0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x9d, 0x00, 0x01, 0x06, 0x00, 0x04,
+	0x06, 0x06, 0x6e, 0x05, 0x06, 0x06, 0x1a, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x0d, 0x02, 0x00,
+	0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x07, 0x08, 0x07, 0xd2, 0x00, 0x06, 0x09, 0x0b, 0x00,
+	0x09, 0x0b, 0x00, 0x08, 0x0b, 0x0a, 0xd2, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x09,
+	0x0a, 0x0a, 0x36, 0x01, 0x0a, 0x09, 0x34, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x02, 0x00, 0x80,
+	0x00, 0x43, 0x02, 0x00, 0x01, 0x06, 0x00, 0x04, 0x06, 0x06, 0x6e, 0x09, 0x06, 0x06, 0x1a, 0x00,
+	0x06, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x07,
+	0x08, 0x07, 0xd2, 0x00, 0x01, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x02, 0x00, 0x80,
+	0x00, 0x37, 0x02, 0x00, 0x0a, 0x06, 0x0b, 0x0b, 0x06, 0x07, 0x6e, 0x00, 0x07, 0x00, 0x30, 0x80,
+	0x00, 0x03, 0x02, 0x00, 0x0a, 0x08, 0x0b, 0x0b, 0x08, 0x08, 0x6e, 0x01, 0x08, 0x07, 0x6c, 0x00,
+	0x07, 0x09, 0x00, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00, 0x07, 0x02, 0x00, 0x0c, 0x0a, 0xad, 0x00,
+	0x0a, 0x0c, 0x0b, 0x0d, 0x0c, 0x0c, 0x6e, 0x09, 0x0c, 0x0c, 0x36, 0x01, 0x0c, 0x0c, 0x34, 0x00,
+	0x0a, 0x01, 0xb0, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa1, 0x80,
+	0x00, 0x1c, 0x02, 0x80, 0x00, 0x08, 0x02, 0x80, 0x00, 0x04, 0x04, 0x00, 0x0e, 0x06, 0x0b, 0x0f,
+	0x06, 0x06, 0x6e, 0x10, 0x06, 0x06, 0x6e, 0x06, 0x04, 0x06, 0x28, 0x00, 0x06, 0x00, 0x32, 0x80,
+	0x00, 0x03, 0x02, 0x80, 0x00, 0x13, 0x02, 0x00, 0x04, 0x06, 0x7a, 0x7f, 0xff, 0xf7, 0x02, 0x00,
+	0x0e, 0x06, 0x0b, 0x0f, 0x06, 0x06, 0x6e, 0x04, 0x06, 0x06, 0x6c, 0x09, 0x06, 0x06, 0x36, 0x01,
+	0x06, 0x05, 0x34, 0x00, 0x0c, 0x06, 0xad, 0x00, 0x05, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00,
+	0x06, 0x00, 0x30, 0x7f, 0xff, 0xf4, 0x02, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x11,
+	0x08, 0x07, 0xd2, 0x00, 0x05, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x7f,
+	0xff, 0xed, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x9d, 0x00,
+	0x0c, 0x06, 0xad, 0x00, 0x02, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x07, 0x00, 0x00,
+	0x07, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x07, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00,
+	0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x65, 0x6e, 0x64, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x64, 0x69, 0x72, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6d, 0x62, 0x65,
+	0x64, 0x64, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x07, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64,
+	0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2d, 0x79,
+	0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x08, 0x68, 0x50, 0x80, 0x01, 0x00, 0x80, 0x44, 0x80, 0x00,
+	0x80, 0x12, 0x84, 0x12, 0x00, 0x80, 0x90, 0x80, 0x4a, 0x54, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02,
+	0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x03, 0x00, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x78, 0x69, 0x73,
+	0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x18, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0xb4, 0x2b, 0x47, 0xed, 0x16, 0x8c, 0xd7, 0x2d,
+	0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0x69,
+	0x73, 0x74, 0x5f, 0x6a, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x07, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x07, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x52, 0x45, 0x51, 0x55, 0x49, 0x52, 0x45, 0x5f, 0x52,
+	0x45, 0x47, 0x45, 0x58, 0x50, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x62, 0x75, 0x6e,
+	0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_2[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04,
+	0x0b, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x04, 0x00, 0xb2, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x00,
+	0xc0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x05, 0x98, 0x05, 0x01, 0x04,
+	0x71, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x05, 0x98, 0x05, 0x02, 0x04, 0x71, 0x00, 0x03, 0x04,
+	0x00, 0x00, 0x02, 0x05, 0x98, 0x05, 0x03, 0x04, 0x71, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x72, 0x79, 0x70, 0x74, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x67, 0x65, 0x74, 0x5f, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01,
+	0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb1, 0x00,
+	0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x63, 0x72, 0x79, 0x70, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x06, 0x00, 0xc0,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb2, 0x00, 0x05, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x02, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x80, 0x00, 0x0a, 0x04, 0x00, 0x06, 0x03, 0xb0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x02, 0x05, 0x18,
+	0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x05, 0x0b,
+	0x00, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb2, 0x00, 0x05, 0x03, 0x00,
+	0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x80, 0x00, 0x07, 0x04, 0x00, 0x01, 0x08, 0x00,
+	0x00, 0x05, 0x02, 0xb0, 0x02, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x17, 0x02,
+	0x80, 0x00, 0x00, 0x02, 0x04, 0x04, 0x05, 0x22, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02,
+	0x00, 0x01, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x02, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x08, 0x00,
+	0x00, 0x04, 0x09, 0x00, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x06, 0x03, 0xb0, 0x00, 0x06, 0x02, 0x00,
+	0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x04, 0x00, 0x07, 0x38, 0x00, 0x01, 0x09, 0x00,
+	0x05, 0x09, 0x08, 0xd2, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x08, 0x02, 0xb0,
+	0x00, 0x05, 0x02, 0xb0, 0x02, 0x04, 0x04, 0x38, 0x7f, 0xff, 0xea, 0x02, 0x00, 0x00, 0x00, 0xa2,
+	0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e,
+	0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x67, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x73, 0x65, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x18, 0x38, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x09, 0x01, 0x24, 0x50, 0x48, 0x48, 0x92, 0x00, 0x48, 0x04, 0xc2, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0x99, 0x00, 0x06, 0x01, 0x1a, 0x00, 0x01, 0x00, 0x30,
+	0x80, 0x00, 0x06, 0x02, 0x00, 0x01, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x06, 0x0b,
+	0x00, 0x06, 0x08, 0x00, 0x04, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00, 0x0a, 0x6e,
+	0x00, 0x07, 0x02, 0xb0, 0x00, 0x07, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x21, 0x02,
+	0x00, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x19, 0x02, 0x80, 0x00, 0x06, 0x02,
+	0x80, 0x00, 0x04, 0x04, 0x05, 0x02, 0x06, 0x6e, 0x06, 0x04, 0x06, 0x28, 0x00, 0x06, 0x00, 0x32,
+	0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x12, 0x02, 0x00, 0x04, 0x06, 0x7a, 0x7f, 0xff, 0xf9, 0x02,
+	0x00, 0x07, 0x06, 0xad, 0x00, 0x02, 0x08, 0x00, 0x04, 0x08, 0x08, 0x6c, 0x00, 0x06, 0x01, 0xb0,
+	0x00, 0x06, 0x08, 0x00, 0x08, 0x08, 0x07, 0xd2, 0x80, 0x10, 0x09, 0x04, 0x00, 0x07, 0x01, 0xb0,
+	0x00, 0x07, 0x05, 0x00, 0x05, 0x05, 0x06, 0x6e, 0x09, 0x06, 0x06, 0x2a, 0x00, 0x06, 0x00, 0x30,
+	0x80, 0x00, 0x01, 0x02, 0x0a, 0x03, 0x03, 0x36, 0x05, 0x03, 0x03, 0x34, 0x7f, 0xff, 0xee, 0x02,
+	0x00, 0x00, 0x00, 0xa2, 0x00, 0x03, 0x07, 0x00, 0x0b, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0,
+	0x00, 0x06, 0x02, 0x00, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x63, 0x6f,
+	0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x74, 0x6f, 0x55, 0x70, 0x70,
+	0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x4a, 0x01, 0x40, 0x4a, 0x04, 0x80, 0x80, 0x09, 0x11, 0x50, 0x91, 0x50, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x17, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x1a, 0x15, 0xa2, 0xa5, 0xa2, 0x74, 0xc3, 0x46, 0xe9, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x72,
+	0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_3[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x11, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x1a, 0x02,
+	0x98, 0x00, 0x1b, 0x03, 0x98, 0x00, 0x0a, 0x00, 0xab, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x0a, 0x01,
+	0xb0, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x0a, 0x00, 0xab, 0x00, 0x01, 0x0c, 0x03, 0x00, 0x0a, 0x01,
+	0xb0, 0x00, 0x0a, 0x05, 0x00, 0x02, 0x05, 0x06, 0x6e, 0x00, 0x07, 0x00, 0x0a, 0x80, 0x00, 0x08,
+	0x04, 0xea, 0x60, 0x08, 0x05, 0x00, 0x0a, 0x03, 0xc0, 0x00, 0x03, 0x0b, 0x03, 0x80, 0x00, 0x0c,
+	0x04, 0x00, 0x04, 0x0d, 0x03, 0x80, 0x01, 0x0e, 0x04, 0x00, 0x05, 0x0f, 0x03, 0x80, 0x02, 0x10,
+	0x04, 0x06, 0x0b, 0x0a, 0xc2, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x0b,
+	0x98, 0x0b, 0x06, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x98, 0x0b, 0x07, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x98, 0x0b, 0x08, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x03, 0x0b, 0x98, 0x0b, 0x09, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x04, 0x0b,
+	0x98, 0x0b, 0x0a, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x05, 0x0b, 0x98, 0x0b, 0x0b, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x06, 0x0b, 0x98, 0x0b, 0x0c, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x07, 0x0b, 0x98, 0x0b, 0x0d, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x08, 0x0b,
+	0x98, 0x0b, 0x0e, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x09, 0x0b, 0x98, 0x0b, 0x0f, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x0a, 0x0b, 0x98, 0x0b, 0x10, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x0b, 0x0b, 0x98, 0x0b, 0x11, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x0c, 0x0b,
+	0x98, 0x0b, 0x12, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x0d, 0x0b, 0x98, 0x0b, 0x13, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x0e, 0x0b, 0x98, 0x0b, 0x14, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x0f, 0x0b, 0x98, 0x0b, 0x15, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x10, 0x0b,
+	0x98, 0x0b, 0x16, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x11, 0x0b, 0x98, 0x0b, 0x17, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x12, 0x0b, 0x98, 0x0b, 0x18, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x13, 0x0b, 0x98, 0x0b, 0x19, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x14, 0x0b,
+	0x98, 0x0b, 0x1a, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x15, 0x0b, 0x98, 0x0b, 0x1b, 0x0a,
+	0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x16, 0x0b, 0x98, 0x0b, 0x1c, 0x0a, 0x71, 0x00, 0x09, 0x0a,
+	0x00, 0x00, 0x17, 0x0b, 0x98, 0x0b, 0x1d, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x18, 0x0b,
+	0x98, 0x0b, 0x1e, 0x0a, 0x71, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x19, 0x0b, 0x98, 0x0b, 0x1f, 0x0a,
+	0x71, 0x00, 0x09, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x6a, 0x6f,
+	0x73, 0x68, 0x69, 0x5f, 0x64, 0x62, 0x75, 0x73, 0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x42, 0x55, 0x53, 0x5f, 0x53, 0x45, 0x53, 0x53, 0x49, 0x4f, 0x4e,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x55, 0x53, 0x5f, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4d, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x42, 0x55, 0x53, 0x5f, 0x53, 0x54, 0x41, 0x52, 0x54, 0x45, 0x52, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x41, 0x52, 0x52, 0x41, 0x59, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x4f,
+	0x4f, 0x4c, 0x45, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x59, 0x54, 0x45, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x44, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0x44, 0x4f, 0x55, 0x42,
+	0x4c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54, 0x36, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x48,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x54,
+	0x52, 0x55, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54, 0x31, 0x36, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55,
+	0x49, 0x4e, 0x54, 0x36, 0x34, 0x00, 0x00, 0x00, 0x00, 0x07, 0x55, 0x4e, 0x49, 0x58, 0x5f, 0x46,
+	0x44, 0x00, 0x00, 0x00, 0x00, 0x07, 0x56, 0x41, 0x52, 0x49, 0x41, 0x4e, 0x54, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72,
+	0x74, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65,
+	0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x73, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x73,
+	0x65, 0x74, 0x5f, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x73, 0x65, 0x74, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x0f, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x98, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x03, 0xc0, 0x00,
+	0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x05, 0x03, 0x04, 0x00, 0x06, 0x6e, 0x00,
+	0x05, 0x07, 0x03, 0x00, 0x01, 0x08, 0x00, 0x06, 0x03, 0x02, 0xc2, 0x00, 0x02, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x52, 0x52, 0x41, 0x59, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x69, 0x74, 0x65, 0x6d, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0xad, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x2d,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x44, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x0d,
+	0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x11, 0x0f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x49, 0x30, 0x84,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x5f, 0x54, 0x59, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03,
+	0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x05, 0x0d, 0x04, 0x02, 0x01,
+	0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79,
+	0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x4f, 0x4f, 0x4c, 0x45, 0x41, 0x4e, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07,
+	0x42, 0x4f, 0x4f, 0x4c, 0x45, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00,
+	0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00,
+	0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x59, 0x54,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x04, 0x42, 0x59, 0x54, 0x45, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00,
+	0x4b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00,
+	0x02, 0x05, 0x6e, 0x01, 0x05, 0x05, 0x46, 0x02, 0x05, 0x05, 0x1e, 0x00, 0x05, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x03, 0x05, 0x0b, 0x00, 0x06, 0x00, 0xc0, 0x00, 0x04, 0x07, 0x03, 0x00,
+	0x05, 0x01, 0xb2, 0x00, 0x05, 0x00, 0xa9, 0x00, 0x05, 0x00, 0xc1, 0x00, 0x05, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0xa1, 0x80, 0x00, 0x21, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x04, 0x04, 0x00,
+	0x02, 0x05, 0x6e, 0x05, 0x04, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80,
+	0x00, 0x1a, 0x02, 0x01, 0x04, 0x04, 0x36, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x03, 0x06, 0x00, 0x05,
+	0x06, 0x05, 0xd2, 0x00, 0x07, 0x03, 0xc0, 0x00, 0x06, 0x08, 0x03, 0x07, 0x00, 0x09, 0x6e, 0x09,
+	0x08, 0x09, 0x35, 0x09, 0x09, 0x09, 0x36, 0x07, 0x01, 0x0a, 0x6e, 0x0a, 0x09, 0x09, 0x34, 0x0a,
+	0x09, 0x09, 0x36, 0x00, 0x0b, 0x0a, 0x03, 0x00, 0x0b, 0x00, 0xab, 0x00, 0x02, 0x0d, 0x00, 0x04,
+	0x0d, 0x0d, 0x6c, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0c, 0x0c, 0x03, 0x00, 0x0d, 0x01, 0xab, 0x00,
+	0x02, 0x0f, 0x00, 0x0d, 0x04, 0x10, 0x36, 0x10, 0x0f, 0x0f, 0x6c, 0x00, 0x0d, 0x01, 0xb0, 0x06,
+	0x08, 0x07, 0xc2, 0x00, 0x05, 0x01, 0xb0, 0x7f, 0xff, 0xe6, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00,
+	0x05, 0x03, 0xc0, 0x00, 0x06, 0x06, 0x03, 0x00, 0x0e, 0x07, 0x03, 0x00, 0x0f, 0x08, 0x03, 0x07,
+	0x00, 0x09, 0x6e, 0x09, 0x08, 0x09, 0x35, 0x09, 0x09, 0x09, 0x36, 0x07, 0x01, 0x0a, 0x6e, 0x0a,
+	0x09, 0x09, 0x34, 0x0a, 0x09, 0x09, 0x36, 0x00, 0x10, 0x0a, 0x03, 0x00, 0x03, 0x0b, 0x00, 0x06,
+	0x06, 0x05, 0xc2, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72,
+	0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x21, 0x45, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6d, 0x75, 0x73, 0x74,
+	0x20, 0x62, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6e,
+	0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x44, 0x49, 0x43, 0x54, 0x5f, 0x45, 0x4e, 0x54,
+	0x52, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75,
+	0x65, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41,
+	0x52, 0x52, 0x41, 0x59, 0x00, 0x00, 0x00, 0x00, 0x09, 0x69, 0x74, 0x65, 0x6d, 0x5f, 0x74, 0x79,
+	0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x04, 0x44, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1a, 0x3f, 0x00, 0x00,
+	0x00, 0x61, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x09, 0x01, 0x04, 0x01, 0x01,
+	0x00, 0x44, 0x26, 0x10, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00,
+	0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04,
+	0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x44, 0x4f, 0x55, 0x42, 0x4c, 0x45, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x06, 0x44, 0x4f, 0x55, 0x42, 0x4c, 0x45, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00,
+	0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00,
+	0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54,
+	0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54, 0x31, 0x36, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00,
+	0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b,
+	0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04,
+	0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x49,
+	0x4e, 0x54, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x00, 0x00, 0x00, 0x0d, 0x64,
+	0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f,
+	0x08, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00,
+	0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x49, 0x4e, 0x54, 0x36, 0x34, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x49, 0x4e, 0x54, 0x36, 0x34, 0x00, 0x00, 0x00,
+	0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03,
+	0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b,
+	0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x00, 0x00, 0x00, 0x0d, 0x64,
+	0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f,
+	0x08, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00,
+	0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76,
+	0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x53, 0x49, 0x47, 0x4e,
+	0x41, 0x54, 0x55, 0x52, 0x45, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0xbe, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02,
+	0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05,
+	0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4e,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00,
+	0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b,
+	0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x03, 0x04, 0x03, 0x00, 0x02, 0x01,
+	0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x05, 0x03, 0x02,
+	0xd2, 0x00, 0x00, 0x04, 0x98, 0x00, 0x02, 0x01, 0xb0, 0x06, 0x01, 0x01, 0x36, 0x00, 0x02, 0x02,
+	0xc0, 0x00, 0x07, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x00, 0x08, 0x05, 0x03, 0x00, 0x00, 0x06,
+	0x00, 0x04, 0x03, 0x02, 0xc2, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x41, 0x72,
+	0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x2d, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+	0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x44, 0x2d, 0x42,
+	0x75, 0x73, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x73, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x02,
+	0x22, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x0b, 0x02, 0x02, 0x02,
+	0x36, 0x00, 0x01, 0x02, 0x9b, 0x00, 0x01, 0x02, 0x0b, 0x01, 0x00, 0x03, 0x6e, 0x03, 0x02, 0x02,
+	0x34, 0x00, 0x01, 0x02, 0x9b, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00,
+	0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0xa1, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x53, 0x54, 0x52,
+	0x55, 0x43, 0x54, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x52, 0xd0, 0xc9, 0x98, 0x41, 0x10, 0x00, 0x00, 0x00, 0x06,
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79,
+	0x70, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00,
+	0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02,
+	0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74,
+	0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54, 0x31, 0x36, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+	0x55, 0x49, 0x4e, 0x54, 0x31, 0x36, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0xf7,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01,
+	0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00,
+	0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54,
+	0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54, 0x33, 0x32, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62,
+	0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08,
+	0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c,
+	0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02,
+	0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x55, 0x49, 0x4e, 0x54, 0x36, 0x34, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x55, 0x49, 0x4e, 0x54, 0x36, 0x34, 0x00, 0x00,
+	0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01,
+	0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x02, 0x01, 0xc2, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x79, 0x70, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x55, 0x4e, 0x49, 0x58, 0x5f, 0x46, 0x44, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x55, 0x4e, 0x49,
+	0x58, 0x5f, 0x46, 0x44, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0xc0,
+	0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00,
+	0x04, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x56, 0x41, 0x52, 0x49, 0x41, 0x4e,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x07, 0x56, 0x41, 0x52, 0x49, 0x41, 0x4e, 0x54, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62,
+	0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08,
+	0x00, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x84, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14,
+	0x0b, 0x80, 0x00, 0x00, 0x07, 0x0b, 0x01, 0x07, 0x07, 0x6e, 0x02, 0x07, 0x07, 0x6e, 0x00, 0x07,
+	0x09, 0x00, 0x03, 0x09, 0x08, 0xd2, 0x00, 0x04, 0x0a, 0x0b, 0x80, 0x05, 0x0b, 0x04, 0x00, 0x08,
+	0x02, 0xb0, 0x00, 0x08, 0x05, 0x00, 0x00, 0x05, 0x07, 0x0b, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00,
+	0x1d, 0x02, 0x00, 0x06, 0x07, 0xad, 0x00, 0x07, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06,
+	0x07, 0xad, 0x00, 0x08, 0x09, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x07,
+	0x03, 0xb0, 0x00, 0x06, 0x07, 0xad, 0x00, 0x09, 0x09, 0x03, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x04,
+	0x0b, 0x00, 0x00, 0x07, 0x03, 0xb0, 0x00, 0x06, 0x07, 0xad, 0x00, 0x0a, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x06, 0x07, 0xad, 0x00, 0x0b, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0c, 0x0b,
+	0x0a, 0xd2, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x08, 0x80, 0x02, 0x0e, 0x04, 0x00, 0x0a,
+	0x03, 0xb0, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06, 0x07, 0xad, 0x00, 0x07,
+	0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x0d, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x03, 0x09,
+	0x08, 0xd2, 0x00, 0x0e, 0x0a, 0x0b, 0x0f, 0x00, 0x0b, 0x6e, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x02,
+	0x0d, 0x00, 0x00, 0x03, 0x0e, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x08,
+	0x07, 0xb0, 0x00, 0x08, 0x06, 0x00, 0x00, 0x10, 0x07, 0xad, 0x00, 0x06, 0x09, 0x00, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x07, 0x06, 0x00, 0x00, 0x05, 0x07, 0x0b, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00,
+	0x10, 0x02, 0x00, 0x06, 0x07, 0xad, 0x00, 0x11, 0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06,
+	0x07, 0xad, 0x00, 0x0b, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0c, 0x0b, 0x0a, 0xd2, 0x00, 0x06,
+	0x0c, 0x00, 0x00, 0x0d, 0x00, 0x08, 0x80, 0x02, 0x0e, 0x04, 0x00, 0x0a, 0x03, 0xb0, 0x00, 0x0a,
+	0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x06, 0x07, 0xad, 0x00, 0x07, 0x09, 0x03, 0x00, 0x07,
+	0x01, 0xb0, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x12, 0x09, 0x08, 0xd2, 0x00, 0x06,
+	0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x09, 0x00, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x13, 0x06, 0x0a, 0x6e, 0x14, 0x0a, 0x09, 0x1a, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x0b,
+	0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x06, 0x0c, 0x00, 0x15, 0x0c, 0x0b, 0x6e, 0x80, 0x00,
+	0x01, 0x02, 0x00, 0x06, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f,
+	0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72,
+	0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75,
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x3d, 0x3d, 0x3d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x4d, 0x65, 0x73, 0x73, 0x61,
+	0x67, 0x65, 0x20, 0x74, 0x6f, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4d, 0x65, 0x74, 0x68, 0x6f,
+	0x64, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x4a, 0x53, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61,
+	0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x75, 0x6e, 0x6d, 0x61, 0x72, 0x73, 0x68,
+	0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x52, 0x65, 0x70, 0x6c, 0x79, 0x3a, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x29, 0x5f, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x59, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x92, 0x08, 0x08, 0x08, 0x20, 0x01, 0x05,
+	0x11, 0x11, 0x11, 0x11, 0x09, 0x12, 0x41, 0x00, 0x00, 0x82, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x04, 0x63, 0x6f, 0x6e, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x65, 0x73,
+	0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x69, 0x66, 0x61, 0x63,
+	0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x63, 0x6f, 0x6e, 0x6e, 0x00, 0x00, 0x00,
+	0x0b, 0x64, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x05, 0x69, 0x66, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x06, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x02,
+	0x00, 0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x6a, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x01, 0x09,
+	0x08, 0xd2, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x02,
+	0x0d, 0x03, 0x00, 0x03, 0x0e, 0x03, 0x00, 0x08, 0x05, 0xb0, 0x00, 0x08, 0x03, 0x00, 0x00, 0x04,
+	0x07, 0x0b, 0x00, 0x08, 0x00, 0xc0, 0x00, 0x05, 0x09, 0x03, 0x00, 0x06, 0x0a, 0x03, 0x00, 0x07,
+	0x02, 0xb2, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x00, 0xc1, 0x00, 0x07, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0xa1, 0x80, 0x00, 0x0e, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x04, 0x08, 0x00, 0x07, 0x08,
+	0x07, 0xd2, 0x00, 0x03, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x06, 0x00, 0x00, 0x07,
+	0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x05, 0x08, 0x00, 0x08, 0x08, 0x07, 0xd2, 0x00, 0x06,
+	0x09, 0x00, 0x09, 0x09, 0x09, 0x6e, 0x00, 0x07, 0x01, 0xb0, 0x7f, 0xff, 0xf3, 0x02, 0x00, 0x00,
+	0x00, 0xa2, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64,
+	0x62, 0x75, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x6f, 0x72, 0x67, 0x2e, 0x66, 0x72, 0x65, 0x65, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70,
+	0x2e, 0x44, 0x42, 0x75, 0x73, 0x2e, 0x49, 0x6e, 0x74, 0x72, 0x6f, 0x73, 0x70, 0x65, 0x63, 0x74,
+	0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x49, 0x6e, 0x74, 0x72, 0x6f, 0x73, 0x70,
+	0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x16, 0x3c, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x28,
+	0x5b, 0x5e, 0x22, 0x5d, 0x2b, 0x29, 0x22, 0x2f, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x65, 0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73,
+	0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x25, 0x00, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x12, 0x08, 0x41, 0x20, 0x40, 0x42, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x01, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x0a, 0x03, 0x00, 0x05, 0x04,
+	0xb0, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x03, 0x04,
+	0x0b, 0x00, 0x05, 0x00, 0xc0, 0x01, 0x04, 0x06, 0x35, 0x05, 0x06, 0x06, 0x36, 0x02, 0x06, 0x06,
+	0x34, 0x06, 0x06, 0x06, 0x36, 0x00, 0x04, 0x01, 0xb2, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x08,
+	0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x0a, 0x03, 0x00, 0x08, 0x0b, 0x03, 0x00, 0x00, 0x0c,
+	0x0b, 0x00, 0x0c, 0x0e, 0x00, 0x09, 0x0e, 0x0d, 0xd2, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x0d, 0x01,
+	0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x05, 0x06, 0xb1, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x62, 0x75, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69,
+	0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x6f, 0x72,
+	0x67, 0x2e, 0x66, 0x72, 0x65, 0x65, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70, 0x2e, 0x44, 0x42,
+	0x75, 0x73, 0x2e, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x61, 0x74, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x1c, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+	0x72, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x47, 0x65, 0x74, 0x41, 0x6c,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x91, 0x01, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x4a, 0x62, 0x22, 0x14, 0x44, 0x44, 0x44, 0x02,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x01, 0x08, 0x07,
+	0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x02, 0x0c,
+	0x03, 0x00, 0x03, 0x0d, 0x03, 0x00, 0x07, 0x05, 0xb0, 0x00, 0x07, 0x04, 0x00, 0x00, 0x04, 0x06,
+	0x0b, 0x00, 0x07, 0x00, 0xc0, 0x03, 0x05, 0x08, 0x35, 0x06, 0x08, 0x08, 0x36, 0x00, 0x06, 0x01,
+	0xb2, 0x00, 0x06, 0x05, 0x00, 0x00, 0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x04, 0x08,
+	0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x06, 0x0d, 0x00, 0x06, 0x06, 0x0d, 0x00, 0x06, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x62, 0x75, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x23, 0x6f, 0x72, 0x67, 0x2e,
+	0x66, 0x72, 0x65, 0x65, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70, 0x2e, 0x44, 0x42, 0x75, 0x73,
+	0x2e, 0x49, 0x6e, 0x74, 0x72, 0x6f, 0x73, 0x70, 0x65, 0x63, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x49, 0x6e, 0x74, 0x72, 0x6f, 0x73, 0x70, 0x65, 0x63, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x00, 0x00, 0x00, 0x00, 0x11, 0x3c, 0x69,
+	0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x22, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x65, 0x63, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x18, 0x00, 0x00, 0x00,
+	0xb5, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x12, 0x09, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x02, 0xc0, 0x00,
+	0x02, 0x03, 0x03, 0x00, 0x03, 0x04, 0x03, 0x00, 0x04, 0x05, 0x03, 0x00, 0x01, 0x06, 0x00, 0x04,
+	0x03, 0x02, 0xc2, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x6a, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x44, 0x42, 0x75, 0x73, 0x43, 0x6f, 0x6e,
+	0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64,
+	0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62,
+	0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0e,
+	0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x08, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x01, 0x08, 0x07, 0xd2, 0x00,
+	0x00, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x02, 0x0c, 0x03, 0x00,
+	0x07, 0x04, 0xb0, 0x00, 0x07, 0x07, 0x0d, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00,
+	0x03, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0, 0x01, 0x04, 0x08, 0x35, 0x05, 0x08, 0x08, 0x36, 0x02,
+	0x08, 0x08, 0x34, 0x06, 0x08, 0x08, 0x36, 0x00, 0x06, 0x01, 0xb2, 0x00, 0x06, 0x00, 0xa9, 0x00,
+	0x00, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x07, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00,
+	0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x02, 0x0c, 0x03, 0x00, 0x08, 0x0d, 0x03, 0x00,
+	0x00, 0x0e, 0x0b, 0x00, 0x0e, 0x10, 0x00, 0x09, 0x10, 0x0f, 0xd2, 0x00, 0x03, 0x11, 0x00, 0x00,
+	0x0f, 0x01, 0xb0, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x0f, 0x11, 0x00, 0x09,
+	0x11, 0x10, 0xd2, 0x00, 0x04, 0x12, 0x00, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x0f, 0x00, 0x00,
+	0x00, 0x10, 0x0b, 0x00, 0x10, 0x12, 0x00, 0x0a, 0x12, 0x11, 0xd2, 0x00, 0x05, 0x13, 0x00, 0x00,
+	0x11, 0x01, 0xb0, 0x00, 0x11, 0x10, 0x00, 0x00, 0x07, 0x08, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x62, 0x75, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	0x6f, 0x72, 0x67, 0x2e, 0x66, 0x72, 0x65, 0x65, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70, 0x2e,
+	0x44, 0x42, 0x75, 0x73, 0x2e, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x61, 0x74, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x1c, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70,
+	0x70, 0x6f, 0x72, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x53, 0x65, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x56, 0x41, 0x52, 0x49, 0x41, 0x4e, 0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x1b, 0x30, 0x00, 0x00, 0x00, 0xeb, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x22, 0x22, 0x20, 0x4a, 0x62, 0x22, 0x14, 0x44, 0x44, 0x44, 0x02, 0x01, 0x00, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03,
+	0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x02,
+	0x6e, 0x03, 0x02, 0x02, 0x1e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00,
+	0x0a, 0x00, 0x02, 0x00, 0x9d, 0x04, 0x00, 0x02, 0x6e, 0x00, 0x02, 0x02, 0x0d, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x9d, 0x04, 0x00, 0x02,
+	0x6e, 0x05, 0x02, 0x02, 0x1e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00,
+	0x0a, 0x00, 0x02, 0x00, 0x9d, 0x06, 0x00, 0x02, 0x6e, 0x00, 0x07, 0x03, 0x0b, 0x03, 0x02, 0x02,
+	0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00,
+	0x9d, 0x08, 0x00, 0x02, 0x6e, 0x00, 0x07, 0x03, 0x0b, 0x03, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x02, 0x00,
+	0x09, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x44,
+	0x49, 0x43, 0x54, 0x5f, 0x45, 0x4e, 0x54, 0x52, 0x59, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x65,
+	0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0d, 0x69, 0x73, 0x5f, 0x64, 0x69, 0x63, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x00,
+	0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x16, 0x29, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04,
+	0x88, 0x50, 0x85, 0x08, 0x50, 0x42, 0x82, 0x14, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01,
+	0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01,
+	0xb0, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x09, 0x02, 0x02, 0x00, 0x04,
+	0x6e, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x03, 0x05, 0xad, 0x00, 0x00, 0x07,
+	0x00, 0x04, 0x07, 0x07, 0x6e, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x03,
+	0x00, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x00, 0x02, 0x00, 0x05, 0x02, 0x01,
+	0xd2, 0x00, 0x00, 0x03, 0x98, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x01, 0x02, 0xb1, 0x00, 0x01, 0x00,
+	0x9d, 0x80, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02,
+	0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x00, 0x02, 0x00, 0x06, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x03, 0x98, 0x00, 0x01, 0x01,
+	0xb1, 0x00, 0x01, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x69, 0x73, 0x5f, 0x64, 0x69, 0x63, 0x74, 0x5f, 0x65,
+	0x6e, 0x74, 0x72, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x70,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0x03, 0x6e, 0x01, 0x01, 0x04, 0x6e, 0x04, 0x03, 0x02, 0x70, 0x00, 0x00, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01,
+	0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x75, 0x6e,
+	0x6d, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x0a, 0x75, 0x6e, 0x6d, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x0d,
+	0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x15, 0x29, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x42, 0x00, 0x42, 0x48, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6f, 0x62, 0x6a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x62, 0x75, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x04, 0x09, 0xd1, 0x10, 0xd0, 0xf2,
+	0xa5, 0x11, 0xa3, 0xb4, 0x53, 0x44, 0x68, 0x56, 0x88, 0xd0, 0xad, 0x23, 0xa5, 0x1a, 0x23, 0x42,
+	0xb4, 0x46, 0x85, 0x68, 0x8d, 0x0a, 0xd1, 0x1a, 0x15, 0xa2, 0x34, 0x2b, 0x44, 0x68, 0x56, 0x88,
+	0xd0, 0xad, 0x15, 0xa5, 0x5a, 0x23, 0x42, 0xb4, 0x46, 0x85, 0x00, 0xd1, 0x1a, 0x15, 0xa2, 0x34,
+	0x2b, 0x45, 0x68, 0x56, 0x8e, 0xd3, 0xed, 0x11, 0x2d, 0x15, 0xa4, 0x9a, 0x2f, 0x4d, 0x34, 0x5e,
+	0x8c, 0x68, 0xbd, 0x0e, 0xd1, 0x12, 0xd1, 0xba, 0x71, 0xa2, 0x25, 0xae, 0x20, 0x00, 0x00, 0x00,
+	0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x69, 0x73, 0x5f, 0x64, 0x69, 0x63, 0x74,
+	0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x75, 0x6e,
+	0x6d, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	0x6a, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x07, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x04, 0x64, 0x62, 0x75, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff,
+};
+
+static const unsigned char file_4[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x04, 0x22,
+	0xc0, 0x00, 0x00, 0x05, 0x03, 0x80, 0x01, 0x06, 0x04, 0x00, 0x01, 0x07, 0x03, 0x80, 0x02, 0x08,
+	0x04, 0x00, 0x02, 0x09, 0x03, 0x80, 0x03, 0x0a, 0x04, 0x00, 0x03, 0x0b, 0x03, 0x80, 0x04, 0x0c,
+	0x04, 0x00, 0x04, 0x0d, 0x03, 0x80, 0x05, 0x0e, 0x04, 0x00, 0x05, 0x0f, 0x03, 0x80, 0x06, 0x10,
+	0x04, 0x00, 0x06, 0x11, 0x03, 0x80, 0x07, 0x12, 0x04, 0x00, 0x07, 0x13, 0x03, 0x80, 0x08, 0x14,
+	0x04, 0x00, 0x08, 0x15, 0x03, 0x80, 0x09, 0x16, 0x04, 0x00, 0x09, 0x17, 0x03, 0x80, 0x0a, 0x18,
+	0x04, 0x14, 0x05, 0x04, 0xc2, 0x00, 0x0a, 0x05, 0x03, 0x80, 0x0b, 0x06, 0x04, 0x00, 0x0b, 0x07,
+	0x03, 0x80, 0x0c, 0x08, 0x04, 0x00, 0x0c, 0x09, 0x03, 0x80, 0x0d, 0x0a, 0x04, 0x00, 0x0d, 0x0b,
+	0x03, 0x80, 0x0e, 0x0c, 0x04, 0x00, 0x0e, 0x0d, 0x03, 0x80, 0x0f, 0x0e, 0x04, 0x00, 0x0f, 0x0f,
+	0x03, 0x80, 0x10, 0x10, 0x04, 0x00, 0x10, 0x11, 0x03, 0x80, 0x11, 0x12, 0x04, 0x00, 0x11, 0x13,
+	0x03, 0x80, 0x12, 0x14, 0x04, 0x00, 0x12, 0x15, 0x03, 0x80, 0x13, 0x16, 0x04, 0x00, 0x13, 0x17,
+	0x03, 0x80, 0x14, 0x18, 0x04, 0x14, 0x05, 0x04, 0xc2, 0x00, 0x14, 0x05, 0x03, 0x80, 0x15, 0x06,
+	0x04, 0x00, 0x15, 0x07, 0x03, 0x80, 0x16, 0x08, 0x04, 0x00, 0x16, 0x09, 0x03, 0x80, 0x17, 0x0a,
+	0x04, 0x00, 0x17, 0x0b, 0x03, 0x80, 0x18, 0x0c, 0x04, 0x00, 0x18, 0x0d, 0x03, 0x80, 0x19, 0x0e,
+	0x04, 0x00, 0x19, 0x0f, 0x03, 0x80, 0x1a, 0x10, 0x04, 0x00, 0x1a, 0x11, 0x03, 0x80, 0x1b, 0x12,
+	0x04, 0x00, 0x1b, 0x13, 0x03, 0x80, 0x1c, 0x14, 0x04, 0x00, 0x1c, 0x15, 0x03, 0x80, 0x1d, 0x16,
+	0x04, 0x00, 0x1d, 0x17, 0x03, 0x80, 0x1e, 0x18, 0x04, 0x14, 0x05, 0x04, 0xc2, 0x00, 0x1e, 0x05,
+	0x03, 0x80, 0x1f, 0x06, 0x04, 0x00, 0x1f, 0x07, 0x03, 0x80, 0x20, 0x08, 0x04, 0x00, 0x20, 0x09,
+	0x03, 0x80, 0x21, 0x0a, 0x04, 0x00, 0x21, 0x0b, 0x03, 0x80, 0x22, 0x0c, 0x04, 0x08, 0x05, 0x04,
+	0xc2, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x22, 0xc0, 0x80, 0x01, 0x05, 0x04, 0x00, 0x22, 0x06,
+	0x03, 0x80, 0x02, 0x07, 0x04, 0x00, 0x23, 0x08, 0x03, 0x80, 0x03, 0x09, 0x04, 0x00, 0x24, 0x0a,
+	0x03, 0x80, 0x04, 0x0b, 0x04, 0x00, 0x25, 0x0c, 0x03, 0x80, 0x05, 0x0d, 0x04, 0x00, 0x26, 0x0e,
+	0x03, 0x80, 0x06, 0x0f, 0x04, 0x00, 0x27, 0x10, 0x03, 0x80, 0x07, 0x11, 0x04, 0x00, 0x28, 0x12,
+	0x03, 0x80, 0x08, 0x13, 0x04, 0x00, 0x29, 0x14, 0x03, 0x80, 0x09, 0x15, 0x04, 0x00, 0x2a, 0x16,
+	0x03, 0x80, 0x0a, 0x17, 0x04, 0x00, 0x2b, 0x18, 0x03, 0x14, 0x05, 0x04, 0xc2, 0x80, 0x0b, 0x05,
+	0x04, 0x00, 0x2c, 0x06, 0x03, 0x80, 0x0c, 0x07, 0x04, 0x00, 0x2d, 0x08, 0x03, 0x80, 0x0d, 0x09,
+	0x04, 0x00, 0x2e, 0x0a, 0x03, 0x80, 0x0e, 0x0b, 0x04, 0x00, 0x2f, 0x0c, 0x03, 0x80, 0x0f, 0x0d,
+	0x04, 0x00, 0x30, 0x0e, 0x03, 0x80, 0x10, 0x0f, 0x04, 0x00, 0x31, 0x10, 0x03, 0x80, 0x11, 0x11,
+	0x04, 0x00, 0x32, 0x12, 0x03, 0x80, 0x12, 0x13, 0x04, 0x00, 0x33, 0x14, 0x03, 0x80, 0x13, 0x15,
+	0x04, 0x00, 0x34, 0x16, 0x03, 0x80, 0x14, 0x17, 0x04, 0x00, 0x35, 0x18, 0x03, 0x14, 0x05, 0x04,
+	0xc2, 0x80, 0x15, 0x05, 0x04, 0x00, 0x36, 0x06, 0x03, 0x80, 0x16, 0x07, 0x04, 0x00, 0x37, 0x08,
+	0x03, 0x80, 0x17, 0x09, 0x04, 0x00, 0x38, 0x0a, 0x03, 0x80, 0x18, 0x0b, 0x04, 0x00, 0x39, 0x0c,
+	0x03, 0x80, 0x19, 0x0d, 0x04, 0x00, 0x3a, 0x0e, 0x03, 0x80, 0x1a, 0x0f, 0x04, 0x00, 0x3b, 0x10,
+	0x03, 0x80, 0x1b, 0x11, 0x04, 0x00, 0x3c, 0x12, 0x03, 0x80, 0x1c, 0x13, 0x04, 0x00, 0x3d, 0x14,
+	0x03, 0x80, 0x1d, 0x15, 0x04, 0x00, 0x3e, 0x16, 0x03, 0x80, 0x1e, 0x17, 0x04, 0x00, 0x3f, 0x18,
+	0x03, 0x14, 0x05, 0x04, 0xc2, 0x80, 0x1f, 0x05, 0x04, 0x00, 0x40, 0x06, 0x03, 0x80, 0x20, 0x07,
+	0x04, 0x00, 0x41, 0x08, 0x03, 0x80, 0x21, 0x09, 0x04, 0x00, 0x42, 0x0a, 0x03, 0x80, 0x22, 0x0b,
+	0x04, 0x00, 0x43, 0x0c, 0x03, 0x08, 0x05, 0x04, 0xc2, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 0x04,
+	0x00, 0x00, 0x00, 0x05, 0x98, 0x05, 0x44, 0x04, 0x71, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x50, 0x45, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x45, 0x4e, 0x4f, 0x45, 0x4e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x53, 0x52, 0x43, 0x48,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x49, 0x4e, 0x54, 0x52, 0x00, 0x00, 0x00, 0x00, 0x03, 0x45,
+	0x49, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x4e, 0x58, 0x49, 0x4f, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x45, 0x32, 0x42, 0x49, 0x47, 0x00, 0x00, 0x00, 0x00, 0x07, 0x45, 0x4e, 0x4f, 0x45, 0x58,
+	0x45, 0x43, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x42, 0x41, 0x44, 0x46, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x45, 0x43, 0x48, 0x49, 0x4c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x41, 0x47, 0x41,
+	0x49, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4e, 0x4f, 0x4d, 0x45, 0x4d, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x45, 0x41, 0x43, 0x43, 0x45, 0x53, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x46, 0x41,
+	0x55, 0x4c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x45, 0x4e, 0x4f, 0x54, 0x42, 0x4c, 0x4b, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x45, 0x42, 0x55, 0x53, 0x59, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x45,
+	0x58, 0x49, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x58, 0x44, 0x45, 0x56, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x45, 0x4e, 0x4f, 0x44, 0x45, 0x56, 0x00, 0x00, 0x00, 0x00, 0x07, 0x45, 0x4e,
+	0x4f, 0x54, 0x44, 0x49, 0x52, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x49, 0x53, 0x44, 0x49, 0x52,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x45, 0x4e, 0x46, 0x49, 0x4c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4d, 0x46, 0x49, 0x4c,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4e, 0x4f, 0x54, 0x54, 0x59, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x45, 0x54, 0x58, 0x54, 0x42, 0x53, 0x59, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x46, 0x42,
+	0x49, 0x47, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4e, 0x4f, 0x53, 0x50, 0x43, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x45, 0x53, 0x50, 0x49, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x52, 0x4f,
+	0x46, 0x53, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4d, 0x4c, 0x49, 0x4e, 0x4b, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x45, 0x50, 0x49, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x04, 0x45, 0x44, 0x4f, 0x4d,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x52, 0x41, 0x4e, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x17,
+	0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x65,
+	0x72, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x19, 0x4e, 0x6f, 0x20, 0x73,
+	0x75, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65,
+	0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63,
+	0x68, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x17, 0x49, 0x6e,
+	0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+	0x20, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x09, 0x49, 0x2f, 0x4f, 0x20, 0x65, 0x72,
+	0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x19, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20,
+	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x16, 0x41, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6c,
+	0x69, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x45, 0x78, 0x65, 0x63, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x65, 0x72, 0x72,
+	0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20,
+	0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4e, 0x6f, 0x20, 0x63, 0x68,
+	0x69, 0x6c, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x54, 0x72, 0x79, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x4f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x50, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x6e,
+	0x69, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x42, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x64, 0x65,
+	0x76, 0x69, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x17, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x73, 0x6f,
+	0x75, 0x72, 0x63, 0x65, 0x20, 0x62, 0x75, 0x73, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x46, 0x69,
+	0x6c, 0x65, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x11, 0x43, 0x72,
+	0x6f, 0x73, 0x73, 0x2d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x64, 0x65, 0x76, 0x69,
+	0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72,
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x49, 0x73, 0x20, 0x61, 0x20,
+	0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x10, 0x49, 0x6e,
+	0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x76,
+	0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x13, 0x54, 0x6f, 0x6f, 0x20, 0x6d,
+	0x61, 0x6e, 0x79, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x4e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x65, 0x77, 0x72, 0x69,
+	0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x54, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6c,
+	0x65, 0x20, 0x62, 0x75, 0x73, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x46, 0x69, 0x6c, 0x65, 0x20,
+	0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x17, 0x4e, 0x6f,
+	0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x64,
+	0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61,
+	0x6c, 0x20, 0x73, 0x65, 0x65, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x15, 0x52, 0x65, 0x61, 0x64, 0x2d,
+	0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x54, 0x6f, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x6c, 0x69,
+	0x6e, 0x6b, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x70,
+	0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x61, 0x74, 0x68, 0x20, 0x61, 0x72, 0x67,
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x6f, 0x6d,
+	0x61, 0x69, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	0x4d, 0x61, 0x74, 0x68, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+	0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x66, 0x61, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x03, 0x6c, 0x00, 0x03, 0x00, 0x32, 0x80, 0x00,
+	0x01, 0x02, 0x00, 0x01, 0x03, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02,
+	0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x04, 0x05, 0x0b, 0x00, 0x06, 0x00, 0xc0, 0x05, 0x01,
+	0x07, 0x36, 0x00, 0x07, 0x07, 0x34, 0x06, 0x07, 0x07, 0x36, 0x00, 0x05, 0x01, 0xb2, 0x00, 0x06,
+	0x01, 0xc0, 0x00, 0x07, 0x07, 0x03, 0x00, 0x00, 0x08, 0x00, 0x02, 0x07, 0x06, 0xc2, 0x00, 0x03,
+	0x02, 0xb0, 0x00, 0x03, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4d,
+	0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x6e, 0x6f, 0x20, 0x64,
+	0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x73, 0x73, 0x69, 0x67,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x20, 0x28, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x20, 0x3d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x16, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x04, 0x80, 0x20, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x65, 0x72, 0x72,
+	0x6e, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x4e, 0x99,
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x94, 0xa5, 0x29, 0x4a, 0x52,
+	0x94, 0xa4, 0x94, 0xa5, 0x29, 0x4a, 0x52, 0x94, 0x92, 0x94, 0xa5, 0x29, 0x4a, 0x52, 0x90, 0x4a,
+	0x52, 0x44, 0xc2, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x08,
+	0x42, 0x10, 0x80, 0x84, 0x21, 0x08, 0x21, 0x08, 0x23, 0x46, 0x68, 0x64, 0xc0, 0x00, 0x00, 0x00,
+	0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x4d, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_5[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x1a, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x1f, 0x02,
+	0x98, 0x00, 0x09, 0x00, 0xab, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x03,
+	0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x01, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x04,
+	0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x02, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x05,
+	0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x03, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x06,
+	0x00, 0x00, 0x04, 0x09, 0x0b, 0x00, 0x0a, 0x00, 0xc0, 0x00, 0x09, 0x00, 0xb2, 0x00, 0x09, 0x07,
+	0x00, 0x00, 0x09, 0x08, 0xc0, 0x00, 0x05, 0x0a, 0x03, 0x80, 0x00, 0x0b, 0x04, 0xf0, 0x00, 0x0b,
+	0x05, 0x00, 0x06, 0x0c, 0x03, 0xe0, 0x00, 0x0d, 0x04, 0x00, 0x07, 0x0e, 0x03, 0xa0, 0x00, 0x0f,
+	0x04, 0x00, 0x08, 0x10, 0x03, 0xc0, 0x00, 0x11, 0x04, 0x00, 0x09, 0x12, 0x03, 0x90, 0x00, 0x13,
+	0x04, 0x00, 0x0a, 0x14, 0x03, 0x80, 0x00, 0x15, 0x04, 0xa0, 0x00, 0x15, 0x05, 0x00, 0x0b, 0x16,
+	0x03, 0x80, 0x00, 0x17, 0x04, 0x80, 0x00, 0x17, 0x05, 0x00, 0x0c, 0x18, 0x03, 0x80, 0x00, 0x19,
+	0x04, 0xc0, 0x00, 0x19, 0x05, 0x10, 0x0a, 0x09, 0xc2, 0x00, 0x09, 0x08, 0x00, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x00, 0x0a, 0x98, 0x0a, 0x0d, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x01, 0x0a,
+	0x98, 0x0a, 0x0e, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x02, 0x0a, 0x98, 0x0a, 0x0f, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x03, 0x0a, 0x98, 0x0a, 0x10, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x04, 0x0a, 0x98, 0x0a, 0x11, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x05, 0x0a,
+	0x98, 0x0a, 0x12, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x06, 0x0a, 0x98, 0x0a, 0x13, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x07, 0x0a, 0x98, 0x0a, 0x14, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x08, 0x0a, 0x98, 0x0a, 0x15, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x09, 0x0a,
+	0x98, 0x0a, 0x16, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x98, 0x0a, 0x17, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0b, 0x0a, 0x98, 0x0a, 0x18, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x0c, 0x0a, 0x98, 0x0a, 0x19, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0d, 0x0a,
+	0x98, 0x0a, 0x1a, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0e, 0x0a, 0x98, 0x0a, 0x1b, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0f, 0x0a, 0x98, 0x0a, 0x1c, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x10, 0x0a, 0x98, 0x0a, 0x1d, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x11, 0x0a,
+	0x98, 0x0a, 0x1e, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x12, 0x0a, 0x98, 0x0a, 0x1f, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x13, 0x0a, 0x98, 0x0a, 0x20, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x14, 0x0a, 0x98, 0x0a, 0x21, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x15, 0x0a,
+	0x98, 0x0a, 0x22, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x16, 0x0a, 0x98, 0x0a, 0x23, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x17, 0x0a, 0x98, 0x0a, 0x24, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x18, 0x0a, 0x98, 0x0a, 0x25, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x19, 0x0a,
+	0x98, 0x0a, 0x26, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x1a, 0x0a, 0x98, 0x0a, 0x27, 0x09,
+	0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x1b, 0x0a, 0x98, 0x0a, 0x28, 0x09, 0x71, 0x00, 0x08, 0x09,
+	0x00, 0x00, 0x1c, 0x0a, 0x98, 0x0a, 0x29, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x1d, 0x0a,
+	0x98, 0x0a, 0x2a, 0x09, 0x71, 0x00, 0x08, 0x09, 0x00, 0x00, 0x1e, 0x0a, 0x98, 0x0a, 0x2b, 0x09,
+	0x71, 0x00, 0x08, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72,
+	0x79, 0x70, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f,
+	0x49, 0x46, 0x42, 0x4c, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x43, 0x48,
+	0x52, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x44, 0x49, 0x52, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x49, 0x46, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f,
+	0x49, 0x46, 0x4c, 0x4e, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x52, 0x45,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x53, 0x4f, 0x43, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x62, 0x61, 0x73, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63,
+	0x68, 0x6f, 0x77, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x66, 0x69,
+	0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x74, 0x65,
+	0x6d, 0x70, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x69, 0x72, 0x6e,
+	0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x69, 0x73, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x64, 0x65, 0x76, 0x69,
+	0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x69, 0x73, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x64,
+	0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x69, 0x73, 0x5f, 0x64, 0x69, 0x72,
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x69, 0x73, 0x5f, 0x65, 0x78,
+	0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f,
+	0x66, 0x69, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x69, 0x73, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x69, 0x73, 0x5f, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69,
+	0x73, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a,
+	0x6f, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x64, 0x69, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6d,
+	0x6b, 0x64, 0x69, 0x72, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6d, 0x6b, 0x66, 0x69, 0x66, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x5f, 0x70,
+	0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6c, 0x69, 0x6e,
+	0x6b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0x6d, 0x64, 0x69,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73,
+	0x79, 0x6d, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x6e, 0x6c, 0x69, 0x6e,
+	0x6b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x02, 0x01, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x02, 0x05, 0x03,
+	0x00, 0x03, 0x01, 0xb0, 0x03, 0x03, 0x03, 0x35, 0x00, 0x01, 0x01, 0xb1, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78,
+	0x4f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x03, 0x0b, 0x03, 0x02, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x01,
+	0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x02, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04,
+	0x01, 0xb0, 0x03, 0x04, 0x02, 0x6e, 0x00, 0x04, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x05, 0x05,
+	0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04,
+	0x03, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75,
+	0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x67, 0x69, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x63, 0x68, 0x6f, 0x77,
+	0x6e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x13, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x07, 0x0b, 0x07, 0x02, 0x07, 0x18, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02,
+	0x00, 0x01, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x02, 0x09, 0x08, 0xd2, 0x00, 0x00, 0x0a, 0x00,
+	0x00, 0x08, 0x01, 0xb0, 0x03, 0x08, 0x08, 0x6e, 0x04, 0x08, 0x02, 0x4e, 0x00, 0x0e, 0x07, 0x03,
+	0x00, 0x07, 0x07, 0xa5, 0x80, 0x00, 0x2c, 0x02, 0x80, 0x00, 0x2f, 0x02, 0x00, 0x05, 0x09, 0x0b,
+	0x00, 0x09, 0x0b, 0x00, 0x06, 0x0b, 0x0a, 0xd2, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x07, 0x0d, 0x03,
+	0x00, 0x0a, 0x02, 0xb0, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x05, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00,
+	0x08, 0x0b, 0x0a, 0xd2, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x0a, 0x02, 0xb0,
+	0x00, 0x0a, 0x04, 0x00, 0x00, 0x09, 0x09, 0x0b, 0x00, 0x0a, 0x00, 0xc0, 0x90, 0x00, 0x0b, 0x04,
+	0x00, 0x09, 0x01, 0xb2, 0x00, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x14, 0x02,
+	0x80, 0x00, 0x00, 0x02, 0x00, 0x05, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0a, 0x0b, 0x0a, 0xd2,
+	0x00, 0x03, 0x0c, 0x00, 0x00, 0x05, 0x0d, 0x00, 0x0b, 0x05, 0x0e, 0x6e, 0x00, 0x0a, 0x03, 0xb0,
+	0x00, 0x0a, 0x06, 0x00, 0x0c, 0x0a, 0x0a, 0x1e, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02,
+	0x00, 0x05, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0d, 0x0b, 0x0a, 0xd2, 0x00, 0x04, 0x0c, 0x00,
+	0x00, 0x05, 0x0d, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x0a, 0x03, 0xb0, 0x7f, 0xff, 0xed, 0x02,
+	0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x0e, 0x07, 0x9b, 0x00, 0x0e, 0x09, 0x0b,
+	0x00, 0x09, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00,
+	0x0f, 0x0b, 0x0a, 0xd2, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0a, 0x02, 0xb0,
+	0x00, 0x05, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0f, 0x0b, 0x0a, 0xd2, 0x00, 0x04, 0x0c, 0x00,
+	0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0a, 0x02, 0xb0, 0x00, 0x00, 0x07, 0xa8, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x01, 0x40, 0xaf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x72, 0x75, 0x6e, 0x63,
+	0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72,
+	0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x25, 0x4c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x06, 0x86, 0x10, 0x04, 0x01,
+	0x21, 0x24, 0x00, 0x10, 0x04, 0x21, 0x08, 0x80, 0x10, 0x08, 0x80, 0x00, 0x00, 0x00, 0x04, 0x66,
+	0x72, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0x6f, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x66, 0x64, 0x46, 0x72, 0x6f, 0x6d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x66,
+	0x64, 0x54, 0x6f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x62, 0x75, 0x66, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x99, 0x00, 0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x04, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x03, 0x04, 0xad, 0x00, 0x01, 0x06, 0x00, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x81,
+	0x80, 0x06, 0x04, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x04, 0x0b, 0x00,
+	0x04, 0x06, 0x00, 0x05, 0x06, 0x05, 0xd2, 0x80, 0x04, 0x07, 0x04, 0x00, 0x05, 0x01, 0xb0, 0x00,
+	0x05, 0x02, 0x00, 0x00, 0x06, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00,
+	0x05, 0x00, 0xb0, 0x00, 0x05, 0x07, 0x00, 0x08, 0x07, 0x06, 0xd2, 0x80, 0x10, 0x08, 0x04, 0x00,
+	0x06, 0x01, 0xb0, 0x06, 0x09, 0x06, 0x35, 0x0a, 0x06, 0x06, 0x36, 0x00, 0x02, 0x07, 0x00, 0x0b,
+	0x07, 0x07, 0x6e, 0x00, 0x07, 0x09, 0x00, 0x08, 0x09, 0x08, 0xd2, 0x80, 0x10, 0x0a, 0x04, 0x00,
+	0x08, 0x01, 0xb0, 0x08, 0x06, 0x06, 0x34, 0x00, 0x02, 0x09, 0x00, 0x0c, 0x09, 0x09, 0x6e, 0x00,
+	0x09, 0x0b, 0x00, 0x08, 0x0b, 0x0a, 0xd2, 0x80, 0x10, 0x0c, 0x04, 0x00, 0x0a, 0x01, 0xb0, 0x0a,
+	0x06, 0x06, 0x34, 0x00, 0x02, 0x0b, 0x00, 0x0d, 0x0b, 0x0b, 0x6e, 0x00, 0x0b, 0x0d, 0x00, 0x08,
+	0x0d, 0x0c, 0xd2, 0x80, 0x10, 0x0e, 0x04, 0x00, 0x0c, 0x01, 0xb0, 0x0c, 0x06, 0x06, 0x34, 0x00,
+	0x02, 0x0d, 0x00, 0x0e, 0x0d, 0x0d, 0x6e, 0x00, 0x0d, 0x0f, 0x00, 0x08, 0x0f, 0x0e, 0xd2, 0x80,
+	0x10, 0x10, 0x04, 0x00, 0x0e, 0x01, 0xb0, 0x0e, 0x06, 0x03, 0x34, 0x00, 0x0f, 0x04, 0x0b, 0x00,
+	0x04, 0x06, 0x00, 0x10, 0x06, 0x05, 0xd2, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x01, 0x09, 0x00, 0x00, 0x05, 0x03, 0xb0, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75,
+	0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x79,
+	0x70, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x67, 0x65, 0x74, 0x5f, 0x72, 0x61, 0x6e, 0x64,
+	0x6f, 0x6d, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2f, 0x74,
+	0x6d, 0x70, 0x2f, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x77,
+	0x72, 0x69, 0x74, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x23, 0x47, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xa8, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0x14, 0x10, 0x04, 0x82, 0x80, 0x22, 0x00,
+	0x80, 0x20, 0x08, 0x02, 0x40, 0x09, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x03, 0x02, 0xd2, 0x00, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x01, 0x00, 0x02,
+	0x01, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x00, 0x9f, 0x80,
+	0x00, 0x0b, 0x02, 0x04, 0x01, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x01, 0x00, 0x9f, 0x80, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x00, 0x05, 0x03, 0x02, 0xd2, 0x80,
+	0x00, 0x04, 0x04, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x02, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65,
+	0x78, 0x4f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x01, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x16, 0x00, 0x00, 0x00, 0xb4, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x22, 0x04, 0x44, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x02, 0x01, 0x03, 0x00, 0x01, 0x05, 0xa5, 0x80, 0x00, 0x09, 0x02, 0x80, 0x00, 0x15, 0x02,
+	0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x04, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa6,
+	0x00, 0x02, 0x01, 0x9b, 0x00, 0x02, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x00, 0x03, 0x04, 0x0b,
+	0x04, 0x04, 0x04, 0x6e, 0x04, 0x03, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x03, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x03, 0x00, 0xa9,
+	0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45,
+	0x4e, 0x4f, 0x45, 0x4e, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13,
+	0x1a, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x12, 0x84, 0x01,
+	0x0a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01,
+	0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00,
+	0x00, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04,
+	0x04, 0x04, 0x6e, 0x04, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x5f, 0x49,
+	0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x42, 0x4c, 0x4b, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0xdc, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01,
+	0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01,
+	0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02,
+	0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x04, 0x04, 0x6e, 0x04, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f,
+	0x49, 0x46, 0x43, 0x48, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f,
+	0x0e, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x0b, 0x03,
+	0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x04, 0x04, 0x6e, 0x04,
+	0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d, 0x54, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x44, 0x49, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x03,
+	0x00, 0x80, 0x01, 0x04, 0x04, 0x00, 0x01, 0x02, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x5f, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00,
+	0x00, 0xfe, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x02, 0x01, 0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03,
+	0x02, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x04, 0x04, 0x6e, 0x04, 0x02, 0x02, 0x18, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x53, 0x5f, 0x49, 0x46, 0x49, 0x46, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02,
+	0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00, 0x00, 0x03,
+	0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x04, 0x04,
+	0x6e, 0x04, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46, 0x52, 0x45, 0x47, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02,
+	0x02, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x4c, 0x00,
+	0x00, 0x04, 0x0b, 0x04, 0x04, 0x04, 0x6e, 0x04, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73,
+	0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x53, 0x5f, 0x49, 0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x5f, 0x49, 0x46,
+	0x4c, 0x4e, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00,
+	0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x03, 0x00, 0x80, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02,
+	0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x61,
+	0x74, 0x63, 0x68, 0x65, 0x73, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01,
+	0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02, 0x02, 0x02, 0x6e, 0x00,
+	0x00, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x4c, 0x00, 0x00, 0x04, 0x0b, 0x04,
+	0x04, 0x04, 0x6e, 0x04, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x74, 0x61, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x5f, 0x49,
+	0x46, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x5f, 0x49, 0x46, 0x53, 0x4f, 0x43, 0x4b,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x36,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x01, 0xad, 0x00, 0x00, 0x03, 0x00, 0x80, 0x02, 0x04, 0x04, 0x00, 0x01, 0x02, 0xb1, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x61, 0x74, 0x63, 0x68,
+	0x65, 0x73, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xa1,
+	0x80, 0x00, 0x23, 0x02, 0x80, 0x00, 0x07, 0x02, 0x80, 0x01, 0x01, 0x04, 0x00, 0x00, 0x02, 0x0b,
+	0x02, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x02, 0x28, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02,
+	0x80, 0x00, 0x1b, 0x02, 0x00, 0x01, 0x02, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x02, 0x0b,
+	0x01, 0x02, 0x02, 0x6c, 0x01, 0x02, 0x02, 0x6e, 0x03, 0x02, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30,
+	0x80, 0x00, 0x06, 0x02, 0x00, 0x04, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x05, 0x04, 0x03, 0xd2,
+	0x00, 0x04, 0x05, 0x0b, 0x06, 0x05, 0x05, 0x6e, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x00, 0x03, 0x00,
+	0x07, 0x03, 0x02, 0xd2, 0x00, 0x03, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x02, 0x0d,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x36, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x03, 0x0b, 0x01, 0x03, 0x03, 0x6c, 0x03, 0x02, 0x00, 0x34, 0x7f, 0xff, 0xe5, 0x02,
+	0x00, 0x00, 0x00, 0xa2, 0x00, 0x08, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x09, 0x04, 0x03, 0xd2,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72,
+	0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x61, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x45, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6e, 0x64, 0x73, 0x57,
+	0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x6e,
+	0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x80, 0x40, 0x28, 0x08, 0xa1, 0x09, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x5b, 0x00,
+	0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x08, 0x00, 0x00, 0x08, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x00, 0x08, 0x0b, 0x80, 0x00, 0x02, 0x02, 0x00, 0x09, 0x00, 0xc1, 0x00,
+	0x09, 0x08, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x07, 0x08, 0x03, 0x00,
+	0x08, 0x07, 0xa5, 0x80, 0x00, 0x30, 0x02, 0x80, 0x00, 0x3e, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x00,
+	0x0a, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x00, 0x0b, 0x98, 0x00, 0x0b, 0x0a, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x01, 0x0a, 0x0b, 0x00,
+	0x0a, 0x0c, 0x00, 0x02, 0x0c, 0x0b, 0xd2, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0b, 0x01, 0xb0, 0x00,
+	0x0b, 0x04, 0x00, 0x80, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1c, 0x02, 0x80,
+	0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x18, 0x02, 0x00,
+	0x01, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x03, 0x0c, 0x0b, 0xd2, 0x00, 0x04, 0x0d, 0x00, 0x00,
+	0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x07, 0x00, 0x04, 0x07, 0x00, 0x6e, 0x05, 0x00, 0x0a, 0x1a, 0x00,
+	0x0a, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x06, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x00, 0x30, 0x80,
+	0x00, 0x01, 0x02, 0x7f, 0xff, 0xef, 0x02, 0x00, 0x0a, 0x05, 0xab, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x06, 0x0d, 0x7a, 0x00, 0x0a, 0x02, 0xb0, 0x00, 0x0b, 0x00, 0x0a, 0x0b, 0x0a, 0x0a, 0x18, 0x00,
+	0x0a, 0x00, 0x30, 0x7f, 0xff, 0xe7, 0x02, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0xe5, 0x02, 0x00,
+	0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x07, 0x08, 0x9b, 0x00, 0x07, 0x0a, 0x0b, 0x08,
+	0x0a, 0x0a, 0x6e, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x07, 0x0a, 0x0b, 0x09,
+	0x0a, 0x0b, 0x6e, 0x00, 0x0a, 0x0c, 0x35, 0x0b, 0x0c, 0x0c, 0x36, 0x0c, 0x0b, 0x0b, 0x34, 0x0b,
+	0x09, 0x0a, 0x71, 0x00, 0x07, 0x0a, 0x0b, 0x00, 0x0a, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x09, 0x00,
+	0x00, 0x00, 0xa7, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x0a, 0x0b, 0x00,
+	0x0a, 0x0c, 0x00, 0x0c, 0x0c, 0x0b, 0xd2, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x0b, 0x01, 0xb0, 0x00,
+	0x00, 0x08, 0xa8, 0x00, 0x01, 0x08, 0x00, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x03, 0x08, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00, 0x02, 0x08, 0x00, 0x00, 0x08, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x70, 0x65, 0x6e,
+	0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x61, 0x64, 0x64, 0x69, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65,
+	0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x29, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x69, 0x72, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0e, 0x06, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x2a, 0x5b, 0x00, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8d, 0x01,
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x01, 0x16, 0x24, 0x44, 0x92, 0x09, 0x10, 0x40, 0x22, 0x41,
+	0x14, 0x02, 0x25, 0x08, 0x00, 0x80, 0x42, 0xa2, 0x10, 0x13, 0x20, 0x40, 0x00, 0x00, 0x00, 0x04,
+	0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x61, 0x6c, 0x6c,
+	0x62, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d,
+	0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x64, 0x69, 0x72, 0x70, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x02, 0x63, 0x62, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x64, 0x69, 0x72, 0x65,
+	0x6e, 0x74, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x02, 0x01,
+	0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x81, 0xed, 0x01, 0x04, 0x00, 0x03,
+	0x02, 0x03, 0x00, 0x02, 0x05, 0xa5, 0x80, 0x00, 0x09, 0x02, 0x80, 0x00, 0x12, 0x02, 0x00, 0x01,
+	0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01,
+	0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x03,
+	0x02, 0x9b, 0x00, 0x03, 0x04, 0x0b, 0x04, 0x04, 0x05, 0x6e, 0x00, 0x05, 0x06, 0x35, 0x06, 0x06,
+	0x06, 0x36, 0x06, 0x05, 0x05, 0x34, 0x05, 0x04, 0x04, 0x71, 0x00, 0x03, 0x04, 0x0b, 0x00, 0x04,
+	0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75,
+	0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x13, 0x1c, 0x00, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x11, 0x42, 0x00, 0x84, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x74, 0x68, 0x6e,
+	0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x03, 0x80, 0x01, 0x03, 0x04, 0x00,
+	0x00, 0x07, 0x00, 0x01, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00,
+	0x06, 0x06, 0x0d, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x02, 0x03, 0x80,
+	0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x03, 0x00,
+	0x06, 0x01, 0xb0, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x2c, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x00, 0x03, 0x05, 0x00, 0x05, 0x04, 0x06, 0x6e, 0x06, 0x05, 0x06, 0x28, 0x00,
+	0x06, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x25, 0x02, 0x00, 0x05, 0x06, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x00, 0x02, 0x06, 0x00, 0x00, 0x04, 0x07, 0x00, 0x05, 0x07, 0x07, 0x6c, 0x07,
+	0x02, 0x07, 0x35, 0x07, 0x06, 0x02, 0x34, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x07,
+	0x08, 0x07, 0xd2, 0x00, 0x02, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x07, 0x0d, 0x00,
+	0x07, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x08,
+	0x08, 0x07, 0xd2, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0, 0x7f,
+	0xff, 0xea, 0x02, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x09, 0x08, 0x07, 0xd2, 0x00,
+	0x02, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x07, 0x0d, 0x00, 0x07, 0x00, 0x30, 0x7f,
+	0xff, 0xe2, 0x02, 0x00, 0x0a, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x0b, 0x08, 0x07, 0xd2, 0x00,
+	0x0a, 0x09, 0x0b, 0x0c, 0x09, 0x09, 0x6e, 0x00, 0x07, 0x01, 0xb0, 0x7f, 0xff, 0xdb, 0x02, 0x00,
+	0x00, 0x00, 0xa2, 0x00, 0x0d, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x73, 0x70, 0x6c, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x78, 0x69, 0x73,
+	0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x69, 0x73, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x61, 0x69, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x45, 0x4e, 0x4f, 0x54, 0x44, 0x49, 0x52, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x22,
+	0x41, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x89, 0x02, 0x22, 0x80, 0x48, 0x08, 0x09, 0x01, 0x00, 0x80, 0x08, 0x04,
+	0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02,
+	0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x81, 0xa4, 0x01, 0x04, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x02,
+	0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03,
+	0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75,
+	0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x6d, 0x6b, 0x66, 0x69, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0f, 0x0d, 0x00, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x11, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x6e, 0x01,
+	0x02, 0x02, 0x1e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x02, 0x02, 0x0b, 0x00,
+	0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x04, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb0, 0x01,
+	0x03, 0x03, 0x36, 0x00, 0x03, 0x00, 0x34, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x02, 0x01, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x05, 0x03, 0x02, 0xd2, 0x00, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x02, 0x04, 0x00, 0x06, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x98, 0x00, 0x03, 0x01, 0xb0, 0x00,
+	0x03, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x06, 0x98, 0x00, 0x04, 0x01, 0xb0, 0x00,
+	0x01, 0x03, 0x00, 0x08, 0x03, 0x02, 0xd2, 0x00, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb1, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66,
+	0x69, 0x6c, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0,
+	0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x03, 0x03, 0x02, 0xd2,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x70, 0x6f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x00, 0xfa, 0x01,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x44, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x20, 0x00, 0x00,
+	0x00, 0xef, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x02, 0x92, 0x21, 0x28, 0x68, 0x64,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x6e, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x06, 0x0b, 0x06, 0x01, 0x06, 0x18, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02,
+	0x00, 0x01, 0x00, 0x09, 0x00, 0x01, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0, 0x81, 0x80, 0x08, 0x04,
+	0x00, 0x06, 0x01, 0xb2, 0x00, 0x06, 0x02, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00,
+	0x03, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x04, 0x02, 0x0b, 0x6e,
+	0x00, 0x07, 0x03, 0xb0, 0x00, 0x07, 0x03, 0x00, 0x00, 0x02, 0x07, 0x00, 0x05, 0x07, 0x06, 0xd2,
+	0x80, 0x00, 0x08, 0x04, 0x00, 0x03, 0x09, 0x00, 0x00, 0x06, 0x02, 0xb0, 0x00, 0x06, 0x02, 0x00,
+	0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x07, 0x08, 0x07, 0xd2, 0x00, 0x02, 0x09, 0x00,
+	0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x04, 0x00, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x06, 0x6e,
+	0x09, 0x06, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x08, 0x0d,
+	0x00, 0x08, 0x07, 0x00, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x04, 0x00, 0x9d,
+	0x00, 0x0a, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x0b, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x05, 0x00, 0x09, 0x05, 0x06, 0x1a, 0x00, 0x06, 0x00, 0x30,
+	0x80, 0x00, 0x02, 0x02, 0x00, 0x0c, 0x06, 0x03, 0x80, 0x00, 0x01, 0x02, 0x00, 0x05, 0x06, 0x00,
+	0x09, 0x06, 0x06, 0x36, 0x04, 0x06, 0x06, 0x34, 0x00, 0x06, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x6b,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63,
+	0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x69, 0x72, 0x6e, 0x61, 0x6d,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x17, 0x38, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x61, 0x20,
+	0x24, 0x12, 0x09, 0x00, 0x8a, 0x04, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b,
+	0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x03,
+	0x00, 0x03, 0x02, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x02, 0x02, 0xa5,
+	0x00, 0x00, 0x00, 0xce, 0x80, 0x00, 0x07, 0x02, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00,
+	0x03, 0x06, 0x05, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x04, 0x06, 0x05, 0xd2,
+	0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x19, 0x00, 0x00, 0x00, 0x2f,
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x44, 0x02, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x64, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01,
+	0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65,
+	0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0e, 0x07, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65,
+	0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08,
+	0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01,
+	0x02, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x07,
+	0x02, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x02, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x04, 0x0d, 0x00, 0x04, 0x02, 0x00, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0xa0, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x06, 0x98, 0x00, 0x03, 0x02, 0xb0, 0x00, 0x05, 0x02, 0x0b, 0x00, 0x02, 0x04,
+	0x00, 0x06, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb1, 0x00, 0x03, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+	0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65,
+	0x78, 0x69, 0x73, 0x74, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0x6d, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x17, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x36, 0x00,
+	0x02, 0x01, 0x34, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00,
+	0x01, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00,
+	0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2, 0x00, 0x01, 0x05, 0x00, 0x00,
+	0x06, 0x00, 0x09, 0x00, 0x03, 0x02, 0xb0, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x02, 0x0b, 0x00,
+	0x02, 0x04, 0x00, 0x05, 0x04, 0x03, 0xd2, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x69, 0x73,
+	0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72,
+	0x6d, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x17, 0x00, 0x00, 0x00, 0x66, 0x02,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x24, 0x08, 0x04, 0x40, 0x48, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x21, 0x00,
+	0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x40, 0x02, 0x29, 0x03, 0x44,
+	0x28, 0x10, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x02, 0x03, 0x01, 0x6e, 0x00, 0x02, 0x05, 0xc0, 0x00,
+	0x03, 0x03, 0x03, 0x04, 0x01, 0x04, 0x6e, 0x00, 0x05, 0x05, 0x03, 0x06, 0x01, 0x06, 0x6e, 0x00,
+	0x07, 0x07, 0x03, 0x08, 0x01, 0x08, 0x6e, 0x00, 0x09, 0x09, 0x03, 0x00, 0x0a, 0x04, 0xc0, 0x00,
+	0x0a, 0x0b, 0x03, 0x0b, 0x01, 0x0c, 0x6e, 0x0c, 0x0c, 0x0c, 0x6e, 0x00, 0x0d, 0x0d, 0x03, 0x0e,
+	0x01, 0x0e, 0x6e, 0x0c, 0x0e, 0x0e, 0x6e, 0x00, 0x0f, 0x0f, 0x03, 0x0e, 0x01, 0x10, 0x6e, 0x0c,
+	0x10, 0x10, 0x6e, 0x00, 0x10, 0x11, 0x03, 0x11, 0x01, 0x12, 0x6e, 0x0c, 0x12, 0x12, 0x6e, 0x08,
+	0x0b, 0x0a, 0xc2, 0x00, 0x12, 0x0b, 0x03, 0x13, 0x01, 0x0c, 0x6e, 0x0a, 0x03, 0x02, 0xc2, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x6c, 0x73, 0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x61, 0x74,
+	0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x73, 0x74, 0x5f, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x63,
+	0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x5f, 0x61, 0x74, 0x69, 0x6d,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x74, 0x76, 0x5f, 0x73, 0x65, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x5f, 0x63, 0x74,
+	0x69, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x74, 0x5f, 0x6d, 0x74, 0x69, 0x6d, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x75, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x5f, 0x75, 0x69, 0x64, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x21, 0x00, 0x00, 0x00, 0x7b, 0x02,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x10, 0x84, 0x10, 0x41, 0x02, 0x48, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x79,
+	0x6d, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00,
+	0x01, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00, 0x03, 0x02, 0x03, 0x00, 0x02, 0x05, 0xa5, 0x80, 0x00,
+	0x08, 0x02, 0x80, 0x00, 0x1d, 0x02, 0x00, 0x01, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06,
+	0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0xa6, 0x00, 0x03, 0x02, 0x9b, 0x00, 0x01, 0x04, 0x0d, 0x00, 0x04, 0x05, 0x00, 0x00, 0x05,
+	0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x03, 0x06, 0x0b, 0x04, 0x06, 0x06, 0x6e, 0x00, 0x04,
+	0x07, 0x0b, 0x05, 0x07, 0x07, 0x6e, 0x07, 0x06, 0x05, 0x18, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00,
+	0x01, 0x02, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x03, 0x04, 0x0b, 0x07, 0x04, 0x05, 0x6e, 0x00, 0x08,
+	0x06, 0x35, 0x09, 0x06, 0x06, 0x36, 0x06, 0x05, 0x05, 0x34, 0x05, 0x07, 0x04, 0x71, 0x00, 0x03,
+	0x04, 0x0b, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x45, 0x4e, 0x4f, 0x45, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x27, 0x00, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x11, 0x42, 0x01, 0x08, 0x00, 0x22, 0x81, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08,
+	0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x66, 0x61, 0x69, 0x6c, 0x5f, 0x69, 0x66, 0x5f, 0x6e, 0x6f, 0x74, 0x5f, 0x66, 0x6f, 0x75, 0x6e,
+	0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x02, 0x04,
+	0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x81, 0xa4, 0x02, 0x04, 0x00, 0x05, 0x04,
+	0x03, 0x00, 0x04, 0x07, 0xa5, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00, 0x1a, 0x02, 0x00, 0x01, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x0a,
+	0x00, 0x00, 0x03, 0x0b, 0x03, 0x00, 0x07, 0x03, 0xb0, 0x00, 0x07, 0x03, 0x00, 0x00, 0x01, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x04, 0x08, 0x07, 0xd2, 0x00, 0x03, 0x09, 0x00, 0x00, 0x01, 0x0a,
+	0x00, 0x00, 0x07, 0x02, 0xb0, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x04,
+	0x9b, 0x00, 0x05, 0x06, 0x0b, 0x06, 0x06, 0x07, 0x6e, 0x00, 0x07, 0x08, 0x35, 0x08, 0x08, 0x08,
+	0x36, 0x08, 0x07, 0x07, 0x34, 0x07, 0x06, 0x06, 0x71, 0x00, 0x05, 0x06, 0x0b, 0x00, 0x06, 0x00,
+	0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x09, 0x08, 0x07, 0xd2, 0x00, 0x03, 0x09, 0x00, 0x00, 0x07, 0x01,
+	0xb0, 0x00, 0x00, 0x04, 0xa8, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e,
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x74, 0x72, 0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d,
+	0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x29, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x17, 0x2c, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x11, 0xa1, 0x44, 0x00, 0x90, 0x21, 0x00, 0x84, 0x42, 0x02, 0x60, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63,
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x66, 0x64, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x03, 0x5a, 0x01, 0x01, 0x04,
+	0x5a, 0x00, 0x0a, 0x06, 0x03, 0x00, 0x06, 0x05, 0xa5, 0x80, 0x00, 0x2a, 0x02, 0x80, 0x00, 0x45,
+	0x02, 0x00, 0x02, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x03, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b,
+	0x00, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x05, 0x00, 0x04, 0x05, 0x08, 0x6e, 0x02, 0x08, 0x08,
+	0x4c, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00,
+	0x9d, 0x04, 0x05, 0x08, 0x6e, 0x03, 0x08, 0x09, 0x4c, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x05, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x06, 0x0c, 0x0b, 0xd2, 0x00, 0x0b, 0x00,
+	0xb0, 0x07, 0x05, 0x0c, 0x6e, 0x0c, 0x0b, 0x09, 0x18, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x02,
+	0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x9d, 0x04, 0x05, 0x08, 0x6e, 0x04, 0x08, 0x09,
+	0x4c, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x05, 0x0a, 0x0b, 0x00, 0x0a, 0x0c,
+	0x00, 0x08, 0x0c, 0x0b, 0xd2, 0x00, 0x0b, 0x00, 0xb0, 0x09, 0x05, 0x0c, 0x6e, 0x0c, 0x0b, 0x09,
+	0x18, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x0a, 0x06, 0x9b, 0x00, 0x08, 0x07, 0xc1, 0x80, 0x00, 0x09,
+	0x04, 0x00, 0x0b, 0x0a, 0x0b, 0x00, 0x0c, 0x0b, 0x0b, 0x0d, 0x0b, 0x0b, 0x6e, 0x00, 0x0c, 0x0c,
+	0x0b, 0x0e, 0x0c, 0x0c, 0x6e, 0x00, 0x0c, 0x0d, 0x0b, 0x0f, 0x0d, 0x0d, 0x6e, 0x00, 0x0c, 0x0e,
+	0x0b, 0x10, 0x0e, 0x0e, 0x6e, 0x00, 0x0c, 0x0f, 0x0b, 0x11, 0x0f, 0x0f, 0x6e, 0x00, 0x0c, 0x10,
+	0x0b, 0x12, 0x10, 0x10, 0x6e, 0x08, 0x09, 0x08, 0xc6, 0x00, 0x08, 0x0a, 0x00, 0x13, 0x0a, 0x09,
+	0xd2, 0x00, 0x0a, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x6e, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x00,
+	0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x0a, 0x08, 0x0b, 0x00, 0x08, 0x00, 0xa9, 0x80, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x01, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73,
+	0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x65, 0x67, 0x69,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65,
+	0x74, 0x65, 0x75, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x75, 0x69, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+	0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x45, 0x4e, 0x41,
+	0x4d, 0x45, 0x54, 0x4f, 0x4f, 0x4c, 0x4f, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x4e,
+	0x4f, 0x4d, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x45, 0x4f, 0x56, 0x45, 0x52, 0x46, 0x4c,
+	0x4f, 0x57, 0x00, 0x00, 0x00, 0x00, 0x06, 0x45, 0x42, 0x41, 0x44, 0x46, 0x44, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x45, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x69, 0x6e, 0x63,
+	0x6c, 0x75, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x61, 0x74,
+	0x63, 0x68, 0x65, 0x73, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x29, 0x4f, 0x00, 0x00, 0x00,
+	0xdc, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x88, 0x91, 0x00, 0x91, 0x0a, 0x00, 0x10, 0xa0, 0x01, 0x09, 0x4a, 0x21, 0x08, 0x42, 0x10, 0x00,
+	0x80, 0x25, 0x15, 0x28, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x6f, 0x64, 0x65, 0x62, 0x69, 0x74,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x75, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x05, 0x67, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x05, 0x6f, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x73,
+	0x74, 0x61, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x77, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x93, 0x02,
+	0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, 0x6a, 0x91, 0xa1, 0xec, 0x94, 0xa5, 0x29,
+	0x24, 0x91, 0x1a, 0x22, 0x5a, 0x2b, 0x43, 0x34, 0x96, 0x98, 0x68, 0xad, 0x2c, 0xd1, 0x1a, 0x29,
+	0xa2, 0x74, 0x63, 0x44, 0xc8, 0xd1, 0x32, 0xd1, 0x32, 0xd1, 0x52, 0xd1, 0x32, 0xd1, 0x32, 0xd1,
+	0x32, 0xd1, 0x52, 0xd1, 0x32, 0xd1, 0x52, 0xd1, 0x5a, 0x41, 0xa4, 0xf5, 0x53, 0x45, 0x68, 0xb6,
+	0x8a, 0xd2, 0xcd, 0x15, 0xa1, 0x9a, 0x3f, 0x4a, 0x34, 0x6e, 0x95, 0x68, 0xad, 0x10, 0xd1, 0xb2,
+	0xd1, 0x52, 0xd1, 0x5a, 0x59, 0xa2, 0x74, 0x78, 0x96, 0x8d, 0xd1, 0xed, 0x19, 0xa4, 0xda, 0xce,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x61, 0x74,
+	0x63, 0x68, 0x65, 0x73, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x65,
+	0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x07, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_6[] = {
+	0xbf, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1c, 0x0b, 0x80, 0x00, 0x00, 0x03,
+	0x98, 0x00, 0x01, 0x04, 0x98, 0x00, 0x02, 0x05, 0x98, 0x00, 0x12, 0x00, 0xc0, 0x00, 0x12, 0x06,
+	0x00, 0x00, 0x12, 0x03, 0xab, 0x00, 0x12, 0x00, 0xb0, 0x00, 0x12, 0x07, 0x00, 0x00, 0x00, 0x08,
+	0x0b, 0x00, 0x12, 0x00, 0x08, 0x12, 0x02, 0x12, 0x18, 0x00, 0x12, 0x00, 0x30, 0x80, 0x00, 0x02,
+	0x02, 0x01, 0x01, 0x12, 0x6e, 0x02, 0x12, 0x02, 0x36, 0x00, 0x04, 0x12, 0x03, 0x00, 0x12, 0x05,
+	0xa5, 0x80, 0x00, 0x0e, 0x02, 0x80, 0x00, 0x18, 0x02, 0x00, 0x14, 0x04, 0xab, 0x00, 0x02, 0x16,
+	0x00, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x15, 0x00, 0x03, 0x15, 0x14, 0xd2, 0x00, 0x0b, 0x16,
+	0x00, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x04, 0x12,
+	0x9b, 0x00, 0x01, 0x15, 0x00, 0x05, 0x15, 0x14, 0xd2, 0x02, 0x06, 0x16, 0x35, 0x07, 0x16, 0x16,
+	0x36, 0x00, 0x04, 0x17, 0x0b, 0x17, 0x16, 0x16, 0x34, 0x08, 0x16, 0x16, 0x36, 0x00, 0x14, 0x01,
+	0xb0, 0x00, 0x09, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x0a, 0x12, 0x0d, 0x00, 0x12, 0x00,
+	0x30, 0x80, 0x00, 0x47, 0x02, 0x00, 0x04, 0x12, 0x03, 0x00, 0x12, 0x05, 0xa5, 0x80, 0x00, 0x23,
+	0x02, 0x80, 0x00, 0x2d, 0x02, 0x00, 0x01, 0x15, 0x00, 0x0a, 0x15, 0x14, 0xd2, 0x00, 0x02, 0x16,
+	0x00, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x14, 0x09, 0x00, 0x00, 0x01, 0x15, 0x00, 0x0b, 0x15, 0x14,
+	0xd2, 0x00, 0x09, 0x16, 0x00, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x14, 0x16, 0x00, 0x0c, 0x16, 0x15,
+	0xd2, 0x00, 0x08, 0x17, 0x03, 0x00, 0x15, 0x01, 0xb0, 0x00, 0x15, 0x0d, 0x00, 0x00, 0x0d, 0x14,
+	0x00, 0x0d, 0x14, 0x14, 0x6e, 0x00, 0x14, 0x16, 0x00, 0x0e, 0x16, 0x15, 0xd2, 0x00, 0x0f, 0x17,
+	0x03, 0x00, 0x15, 0x01, 0xb0, 0x00, 0x15, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x0d, 0x14,
+	0x00, 0x00, 0x0d, 0x15, 0x00, 0x0d, 0x15, 0x15, 0x6e, 0x15, 0x10, 0x15, 0x35, 0x15, 0x0d, 0x14,
+	0x71, 0x00, 0x0d, 0x15, 0x00, 0x11, 0x15, 0x14, 0xd2, 0x00, 0x08, 0x16, 0x03, 0x00, 0x14, 0x01,
+	0xb0, 0x14, 0x12, 0x14, 0x35, 0x13, 0x14, 0x0c, 0x36, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x04, 0x12,
+	0x9b, 0x00, 0x01, 0x15, 0x00, 0x05, 0x15, 0x14, 0xd2, 0x02, 0x06, 0x16, 0x35, 0x14, 0x16, 0x16,
+	0x36, 0x00, 0x04, 0x17, 0x0b, 0x17, 0x16, 0x16, 0x34, 0x08, 0x16, 0x16, 0x36, 0x00, 0x14, 0x01,
+	0xb0, 0x00, 0x09, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x04, 0x12, 0x03, 0x00, 0x12, 0x05,
+	0xa5, 0x80, 0x00, 0x08, 0x02, 0x80, 0x00, 0x12, 0x02, 0x00, 0x01, 0x15, 0x00, 0x15, 0x15, 0x14,
+	0xd2, 0x00, 0x0c, 0x16, 0x00, 0x00, 0x09, 0x17, 0x00, 0x00, 0x14, 0x02, 0xb0, 0x00, 0x14, 0x0a,
+	0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x04, 0x12, 0x9b, 0x00, 0x01, 0x15, 0x00, 0x05, 0x15, 0x14,
+	0xd2, 0x02, 0x16, 0x16, 0x35, 0x17, 0x16, 0x16, 0x36, 0x00, 0x04, 0x17, 0x0b, 0x17, 0x16, 0x16,
+	0x34, 0x08, 0x16, 0x16, 0x36, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x09, 0x00, 0xa0, 0x00, 0x00, 0x00,
+	0xa7, 0x00, 0x04, 0x12, 0x03, 0x00, 0x12, 0x05, 0xa5, 0x80, 0x00, 0x31, 0x02, 0x80, 0x00, 0x3a,
+	0x02, 0x00, 0x14, 0x00, 0xc1, 0x00, 0x14, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x10,
+	0x02, 0x80, 0x00, 0x07, 0x02, 0x80, 0x03, 0x0f, 0x04, 0x00, 0x18, 0x14, 0x0b, 0x19, 0x14, 0x14,
+	0x6e, 0x14, 0x0f, 0x14, 0x28, 0x00, 0x14, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x08,
+	0x02, 0x00, 0x0f, 0x14, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x0e, 0x14, 0x00, 0x1a, 0x0f, 0x15,
+	0x3a, 0x00, 0x18, 0x16, 0x0b, 0x0f, 0x16, 0x16, 0x6c, 0x16, 0x15, 0x14, 0x70, 0x7f, 0xff, 0xf8,
+	0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x14, 0x05, 0xab, 0x00, 0x09, 0x16, 0x00, 0x00, 0x14, 0x01,
+	0xb0, 0x00, 0x14, 0x10, 0x00, 0x00, 0x14, 0x10, 0xab, 0x00, 0x1b, 0x16, 0x03, 0x00, 0x14, 0x01,
+	0xb0, 0x00, 0x14, 0x10, 0xab, 0x00, 0x1c, 0x16, 0x03, 0x00, 0x14, 0x01, 0xb0, 0x00, 0x14, 0x08,
+	0x00, 0x00, 0x14, 0x0a, 0xab, 0x00, 0x0e, 0x16, 0x00, 0x00, 0x10, 0x17, 0x00, 0x00, 0x14, 0x02,
+	0xb0, 0x00, 0x14, 0x11, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x14, 0x11, 0x14, 0x18, 0x00, 0x14, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x1d, 0x00, 0xa0, 0x00, 0x11, 0x14, 0x99, 0x1e, 0x14, 0x14,
+	0x1a, 0x00, 0x14, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x11, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x04, 0x12, 0x9b, 0x00, 0x01, 0x15, 0x00, 0x05, 0x15, 0x14, 0xd2, 0x00, 0x04, 0x16,
+	0x0b, 0x1f, 0x16, 0x16, 0x6e, 0x16, 0x20, 0x16, 0x35, 0x08, 0x16, 0x16, 0x36, 0x00, 0x14, 0x01,
+	0xb0, 0x00, 0x09, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x0d, 0x00, 0xa0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2f, 0x72, 0x65, 0x70,
+	0x6c, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x65, 0x6d,
+	0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x63,
+	0x72, 0x69, 0x70, 0x74, 0x20, 0x00, 0x00, 0x00, 0x00, 0x13, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f,
+	0x74, 0x20, 0x62, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x3a, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x0a, 0x01, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65,
+	0x61, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x70, 0x6c, 0x69,
+	0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73,
+	0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x23, 0x21,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x19, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x61, 0x72,
+	0x67, 0x76, 0x2c, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x29, 0x7b, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x20, 0x3b, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x63, 0x61, 0x6e, 0x6e,
+	0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70,
+	0x74, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72,
+	0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x01, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x73, 0x68, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e, 0x01, 0x3f,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x75, 0x6d, 0x62,
+	0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x55, 0x6e, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+	0x3a, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06, 0x03, 0x00, 0x04,
+	0x01, 0xb0, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00,
+	0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x16, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03,
+	0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x04, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04,
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x05,
+	0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x06, 0x01, 0x00, 0x36, 0x80, 0x00, 0x06, 0x02, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x07, 0x02, 0x00, 0x36, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03,
+	0x00, 0x9d, 0x08, 0x00, 0x03, 0x36, 0x00, 0x00, 0x04, 0x0b, 0x09, 0x04, 0x04, 0x6e, 0x04, 0x03,
+	0x03, 0x34, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x0f,
+	0x4a, 0x4f, 0x53, 0x48, 0x49, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x44, 0x49, 0x52, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x58, 0x44, 0x47, 0x5f, 0x43, 0x41, 0x43,
+	0x48, 0x45, 0x5f, 0x48, 0x4f, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0x4f, 0x4d, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x2f, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x2f, 0x2e, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2f, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x63,
+	0x6f, 0x64, 0x65, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00,
+	0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x17, 0x2b, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x90, 0xa1, 0x00, 0x80, 0x4a, 0x20, 0x88,
+	0x85, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00,
+	0x02, 0x02, 0x0d, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x32, 0x80, 0x00, 0x08, 0x02, 0x00,
+	0x00, 0x05, 0x00, 0x02, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x0b, 0x03, 0x06, 0x06, 0x6e, 0x04,
+	0x06, 0x06, 0x36, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x04, 0x0d, 0x00, 0x04, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0x9d, 0x00,
+	0x00, 0x03, 0x00, 0x05, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x0b, 0x03, 0x04, 0x04, 0x6e, 0x06,
+	0x04, 0x04, 0x6e, 0x07, 0x04, 0x04, 0x36, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x01, 0x00, 0x00,
+	0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x01, 0x02, 0x03, 0x6c, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x01, 0x03, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00,
+	0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73,
+	0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x69,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x75, 0x62, 0x73,
+	0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x3f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x67, 0x65,
+	0x74, 0x5f, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00,
+	0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x24, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x20, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x98, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x04, 0x98,
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x02, 0x04, 0x98, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00,
+	0x00, 0x00, 0x04, 0x71, 0x00, 0x03, 0x04, 0x00, 0x02, 0x01, 0x04, 0x71, 0x00, 0x03, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x5f, 0x70,
+	0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0xc1, 0x00,
+	0x02, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x00, 0x01, 0x04, 0x03, 0x00,
+	0x02, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x98, 0x00,
+	0x03, 0x01, 0xb0, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x06, 0x98, 0x00,
+	0x04, 0x01, 0xb0, 0x00, 0x01, 0x03, 0x00, 0x04, 0x03, 0x02, 0xd2, 0x00, 0x01, 0x04, 0x03, 0x00,
+	0x02, 0x01, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x73, 0x70, 0x6c, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61,
+	0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x01, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d,
+	0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x01,
+	0x0b, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x80, 0x00, 0x05,
+	0x02, 0x00, 0x01, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x03, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x2e,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x70, 0x6f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+	0x44, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x12, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x84,
+	0xa1, 0xa1, 0x92, 0x10, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x6e, 0x70, 0x61, 0x72, 0x74, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x01, 0x09, 0x08, 0xd2, 0x00, 0x02,
+	0x0a, 0x03, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x07, 0x0b, 0x00, 0x07,
+	0x09, 0x00, 0x03, 0x09, 0x08, 0xd2, 0x80, 0x00, 0x0a, 0x04, 0x04, 0x01, 0x0b, 0x36, 0x00, 0x08,
+	0x02, 0xb0, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05, 0x08, 0x07, 0xd2, 0x00, 0x06,
+	0x09, 0x03, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x07, 0x0d, 0x00, 0x07, 0x08, 0x00, 0x00, 0x08,
+	0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x05, 0x0a, 0x09, 0xd2, 0x00, 0x07,
+	0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x09, 0x0d, 0x00, 0x09, 0x08, 0x00, 0x00, 0x08,
+	0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x08, 0x00, 0x00, 0x36, 0x00, 0x00, 0x07, 0x00, 0x09, 0x07,
+	0x07, 0x6e, 0x0a, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x04, 0x02, 0x00, 0x0b,
+	0x07, 0xad, 0x00, 0x02, 0x09, 0x34, 0x00, 0x07, 0x01, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x00,
+	0x07, 0x00, 0x09, 0x07, 0x07, 0x6e, 0x02, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00,
+	0x04, 0x02, 0x00, 0x0b, 0x07, 0xad, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb1, 0x00, 0x07,
+	0x00, 0x9d, 0x00, 0x0c, 0x07, 0x0b, 0x0d, 0x07, 0x08, 0x6e, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00,
+	0x03, 0x02, 0x00, 0x0c, 0x09, 0x0b, 0x0d, 0x09, 0x09, 0x6e, 0x00, 0x09, 0x08, 0x6c, 0x00, 0x08,
+	0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x0c, 0x07, 0x0b, 0x0e, 0x07, 0x07, 0x6e, 0x02, 0x07,
+	0x07, 0x36, 0x00, 0x07, 0x07, 0x34, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x0f, 0x07, 0x0b, 0x00, 0x07,
+	0x07, 0x0d, 0x00, 0x07, 0x08, 0x00, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x05, 0x02, 0x00, 0x0f,
+	0x09, 0x0b, 0x10, 0x09, 0x09, 0x6e, 0x11, 0x09, 0x09, 0x6e, 0x00, 0x09, 0x09, 0x0d, 0x00, 0x09,
+	0x08, 0x00, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x0b, 0x07, 0xad, 0x00, 0x0c,
+	0x09, 0x0b, 0x0e, 0x09, 0x09, 0x6e, 0x02, 0x09, 0x09, 0x36, 0x00, 0x09, 0x09, 0x34, 0x00, 0x07,
+	0x01, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x07, 0x01, 0xc1, 0x80, 0x00, 0x08, 0x04, 0x00, 0x0c,
+	0x09, 0x0b, 0x0e, 0x09, 0x09, 0x6e, 0x02, 0x08, 0x07, 0xc6, 0x00, 0x07, 0x09, 0x00, 0x12, 0x09,
+	0x08, 0xd2, 0x00, 0x0f, 0x0a, 0x0b, 0x10, 0x0a, 0x0a, 0x6e, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1b, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00,
+	0x05, 0x04, 0x11, 0x03, 0x07, 0x6e, 0x07, 0x05, 0x07, 0x28, 0x00, 0x07, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x14, 0x02, 0x00, 0x05, 0x07, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x14,
+	0x07, 0x03, 0x00, 0x07, 0x05, 0xa5, 0x80, 0x00, 0x0c, 0x02, 0x7f, 0xff, 0xfa, 0x02, 0x00, 0x03,
+	0x09, 0x00, 0x05, 0x09, 0x09, 0x6c, 0x02, 0x09, 0x09, 0x36, 0x00, 0x09, 0x06, 0x34, 0x00, 0x0c,
+	0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x13, 0x0b, 0x0a, 0xd2, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x0a,
+	0x01, 0xb0, 0x00, 0x0a, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x14, 0x07, 0x9b, 0x00, 0x00,
+	0x00, 0xa7, 0x7f, 0xff, 0xec, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x0b, 0x07, 0xad, 0x00, 0x0c,
+	0x09, 0x0b, 0x0e, 0x09, 0x09, 0x6e, 0x02, 0x09, 0x09, 0x36, 0x00, 0x09, 0x09, 0x34, 0x00, 0x07,
+	0x01, 0xb1, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f,
+	0x77, 0x6e, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0x61,
+	0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6e, 0x64, 0x73, 0x57, 0x69, 0x74, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x73, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63,
+	0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x61, 0x6c, 0x70, 0x61,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x36, 0x82, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00,
+	0x00, 0x28, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x04, 0x01, 0x20,
+	0x00, 0x22, 0x82, 0x05, 0x04, 0x0a, 0x00, 0x80, 0xa0, 0x00, 0x40, 0x14, 0x00, 0x41, 0x20, 0x20,
+	0x40, 0x90, 0x42, 0x61, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x09, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x04, 0x64, 0x69, 0x72, 0x73, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x66,
+	0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x6b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x63, 0x61, 0x6e, 0x64, 0x69,
+	0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x07, 0xad,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x01, 0x00, 0x00, 0x01, 0x07, 0x0b,
+	0x01, 0x07, 0x07, 0x6c, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x01, 0x07, 0x0b,
+	0x01, 0x07, 0x07, 0x6c, 0x00, 0x07, 0x00, 0x9d, 0x00, 0x12, 0x07, 0x03, 0x00, 0x07, 0x05, 0xa5,
+	0x80, 0x00, 0x58, 0x02, 0x80, 0x00, 0x75, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x02, 0x0a, 0x09, 0xd2,
+	0x00, 0x03, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x39, 0x02,
+	0x00, 0x01, 0x0a, 0x00, 0x04, 0x0a, 0x09, 0xd2, 0x00, 0x05, 0x0b, 0x0b, 0x06, 0x0b, 0x0b, 0x6e,
+	0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x02, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x09, 0x00, 0x30,
+	0x80, 0x00, 0x02, 0x02, 0x00, 0x07, 0x09, 0x03, 0x80, 0x00, 0x01, 0x02, 0x00, 0x08, 0x09, 0x03,
+	0x00, 0x09, 0x03, 0x00, 0x00, 0x09, 0x09, 0xad, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x09, 0x01, 0xb0,
+	0x00, 0x09, 0x04, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02,
+	0x00, 0x05, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x0a, 0x0c, 0x0b, 0xd2, 0x00, 0x04, 0x0d, 0x00,
+	0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x09, 0x00, 0x80, 0x00, 0x08, 0x02, 0x00, 0x05, 0x0c, 0x0b,
+	0x00, 0x0c, 0x0e, 0x00, 0x0b, 0x0e, 0x0d, 0xd2, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x03, 0x10, 0x00,
+	0x00, 0x0c, 0x11, 0x0b, 0x00, 0x0d, 0x03, 0xb0, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x09, 0x05, 0x00,
+	0x00, 0x01, 0x09, 0x0b, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x30,
+	0x80, 0x00, 0x08, 0x02, 0x00, 0x0c, 0x05, 0xab, 0x00, 0x0d, 0x0e, 0xad, 0x00, 0x01, 0x10, 0x00,
+	0x00, 0x0e, 0x01, 0xb0, 0x00, 0x05, 0x0f, 0x0b, 0x00, 0x0c, 0x02, 0xb0, 0x00, 0x0c, 0x0b, 0x00,
+	0x80, 0x00, 0x06, 0x02, 0x00, 0x0d, 0x05, 0xab, 0x00, 0x0d, 0x0f, 0xad, 0x00, 0x01, 0x11, 0x00,
+	0x00, 0x0f, 0x01, 0xb0, 0x00, 0x0d, 0x01, 0xb0, 0x00, 0x0d, 0x0b, 0x00, 0x0b, 0x0a, 0x09, 0x70,
+	0x80, 0x00, 0x14, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x02, 0x0a, 0x09, 0xd2, 0x00, 0x0e, 0x0b, 0x03,
+	0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x09, 0x02, 0x00, 0x01, 0x09, 0x0b,
+	0x00, 0x01, 0x0a, 0x00, 0x00, 0x05, 0x0b, 0x0b, 0x00, 0x0b, 0x0d, 0x00, 0x0f, 0x0d, 0x0c, 0xd2,
+	0x00, 0x01, 0x0e, 0x00, 0x00, 0x0c, 0x01, 0xb0, 0x0c, 0x0a, 0x09, 0x70, 0x80, 0x00, 0x05, 0x02,
+	0x00, 0x10, 0x09, 0x0b, 0x00, 0x0a, 0x00, 0xc0, 0x01, 0x11, 0x0b, 0x35, 0x00, 0x09, 0x01, 0xb2,
+	0x00, 0x09, 0x00, 0xa9, 0x00, 0x01, 0x09, 0x0b, 0x01, 0x09, 0x09, 0x6c, 0x00, 0x09, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0xa6, 0x00, 0x12, 0x07, 0x9b, 0x00, 0x12, 0x09, 0x0b, 0x13, 0x09, 0x0a, 0x6e,
+	0x00, 0x0a, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x00, 0x14, 0x0a, 0x03, 0x00, 0x0a, 0x06, 0x00,
+	0x00, 0x06, 0x0a, 0x00, 0x04, 0x0a, 0x09, 0xd2, 0x00, 0x15, 0x0b, 0x03, 0x00, 0x09, 0x01, 0xb0,
+	0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x10, 0x09, 0x0b, 0x00, 0x0a, 0x00, 0xc0,
+	0x00, 0x16, 0x0b, 0x35, 0x00, 0x09, 0x01, 0xb2, 0x00, 0x12, 0x09, 0x9b, 0x00, 0x12, 0x09, 0x0b,
+	0x18, 0x17, 0x09, 0x73, 0x80, 0x00, 0x06, 0x02, 0x00, 0x12, 0x09, 0x0b, 0x13, 0x09, 0x0a, 0x6e,
+	0x00, 0x19, 0x0b, 0x35, 0x1a, 0x0b, 0x0b, 0x36, 0x0b, 0x0a, 0x0a, 0x34, 0x0a, 0x13, 0x09, 0x71,
+	0x00, 0x12, 0x09, 0x0b, 0x00, 0x09, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65,
+	0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+	0x73, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x6e, 0x64, 0x73,
+	0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x65,
+	0x71, 0x75, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71,
+	0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x11, 0x67, 0x65, 0x74, 0x5f, 0x65, 0x6d, 0x62,
+	0x65, 0x64, 0x64, 0x65, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x6c,
+	0x6f, 0x61, 0x64, 0x5f, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x61, 0x63,
+	0x68, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x73,
+	0x6f, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x5f, 0x73, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
+	0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x74, 0x79,
+	0x70, 0x65, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x69,
+	0x6c, 0x65, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20,
+	0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x65, 0x72, 0x72, 0x6e, 0x6f, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x20, 0x28, 0x69, 0x6e, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20,
+	0x6f, 0x66, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x38,
+	0x85, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x12, 0x20, 0xa1, 0x00,
+	0x80, 0x40, 0x12, 0x28, 0x02, 0x00, 0x12, 0x80, 0x00, 0x08, 0x01, 0x00, 0x40, 0x08, 0x80, 0xa2,
+	0x10, 0x09, 0x04, 0x04, 0x22, 0x00, 0xa4, 0x40, 0x00, 0x00, 0x00, 0x06, 0x6d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69, 0x6c, 0x65, 0x70, 0x61,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x69, 0x73, 0x5f, 0x63, 0x6f, 0x72,
+	0x65, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x61, 0x72, 0x67, 0x73, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x65, 0x6d, 0x62, 0x65,
+	0x64, 0x64, 0x65, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x02, 0x66, 0x6e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x73, 0x67, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x0e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x0c,
+	0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6a, 0x86, 0xaa, 0x4a, 0x13,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x65, 0x64,
+	0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10,
+	0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x4c, 0xb5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c,
+	0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x3f,
+	0x00, 0x00, 0x00, 0x08, 0x23, 0x80, 0x00, 0x00, 0x4b, 0x08, 0x68, 0x61, 0x02, 0x51, 0x01, 0x28,
+	0x01, 0x11, 0x25, 0x09, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x60, 0x84, 0x00, 0x88, 0x91, 0x00, 0x84,
+	0x20, 0x22, 0x22, 0xc4, 0x04, 0x80, 0x02, 0x02, 0x12, 0x24, 0x81, 0x21, 0x22, 0x28, 0x44, 0xa0,
+	0x08, 0x89, 0x80, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69,
+	0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x67, 0x65,
+	0x74, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65,
+	0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x67, 0x65, 0x74, 0x5f,
+	0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x71, 0x75,
+	0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+	0x65, 0x73, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x12,
+	0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x64,
+	0x69, 0x72, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x0a, 0x00,
+	0x00, 0x00, 0x0d, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x5f, 0x6e, 0x61, 0x6d, 0x65,
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x6d, 0x61, 0x69, 0x6e, 0x5f, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x6d, 0x61, 0x69, 0x6e, 0x5f,
+	0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67,
+	0x76, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+	0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x06, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69, 0x6c, 0x65, 0x70, 0x61, 0x74, 0x68,
+};
+
+static const unsigned char file_7[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x0d, 0x00,
+	0xab, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x0d, 0x01, 0xb0, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x01, 0x0d,
+	0x0b, 0x00, 0x0e, 0x00, 0xc0, 0x00, 0x0d, 0x00, 0xb2, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x02, 0x0d,
+	0x0b, 0x00, 0x0e, 0x00, 0xc0, 0x00, 0x0d, 0x00, 0xb2, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0d, 0x11,
+	0xc0, 0x00, 0x03, 0x0e, 0x03, 0x80, 0x00, 0x0f, 0x04, 0x00, 0x04, 0x10, 0x03, 0x80, 0x01, 0x11,
+	0x04, 0x00, 0x05, 0x12, 0x03, 0x80, 0x02, 0x13, 0x04, 0x00, 0x06, 0x14, 0x03, 0x80, 0x04, 0x15,
+	0x04, 0x00, 0x07, 0x16, 0x03, 0x80, 0x08, 0x17, 0x04, 0x00, 0x08, 0x18, 0x03, 0x80, 0x10, 0x19,
+	0x04, 0x00, 0x09, 0x1a, 0x03, 0x80, 0x20, 0x1b, 0x04, 0x00, 0x0a, 0x1c, 0x03, 0x80, 0x40, 0x1d,
+	0x04, 0x00, 0x0b, 0x1e, 0x03, 0x80, 0x80, 0x1f, 0x04, 0x00, 0x0c, 0x20, 0x03, 0x81, 0x00, 0x21,
+	0x04, 0x14, 0x0e, 0x0d, 0xc2, 0x00, 0x0d, 0x0e, 0x03, 0x82, 0x00, 0x0f, 0x04, 0x00, 0x0e, 0x10,
+	0x03, 0x84, 0x00, 0x11, 0x04, 0x00, 0x0f, 0x12, 0x03, 0x90, 0x00, 0x13, 0x04, 0x00, 0x10, 0x14,
+	0x03, 0xa0, 0x00, 0x15, 0x04, 0x00, 0x11, 0x16, 0x03, 0x80, 0x00, 0x17, 0x04, 0x00, 0x12, 0x18,
+	0x03, 0x80, 0x01, 0x19, 0x04, 0x00, 0x13, 0x1a, 0x03, 0x80, 0x02, 0x1b, 0x04, 0x0e, 0x0e, 0x0d,
+	0xc2, 0x00, 0x0d, 0x05, 0x00, 0x84, 0x00, 0x06, 0x04, 0x80, 0x40, 0x07, 0x04, 0x80, 0x00, 0x08,
+	0x04, 0x80, 0x02, 0x09, 0x04, 0x82, 0x00, 0x0a, 0x04, 0x80, 0x01, 0x0b, 0x04, 0x00, 0x0d, 0x03,
+	0xc0, 0x00, 0x14, 0x0e, 0x03, 0x00, 0x08, 0x0f, 0x00, 0x00, 0x15, 0x10, 0x03, 0x00, 0x0b, 0x11,
+	0x00, 0x00, 0x16, 0x12, 0x03, 0x00, 0x09, 0x13, 0x00, 0x06, 0x0e, 0x0d, 0xc2, 0x00, 0x0d, 0x0c,
+	0x00, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x98, 0x0e, 0x17, 0x0d, 0x71, 0x00, 0x05, 0x0d,
+	0x00, 0x00, 0x01, 0x0e, 0x98, 0x0e, 0x18, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x02, 0x0e,
+	0x98, 0x0e, 0x19, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x03, 0x0e, 0x98, 0x0e, 0x1a, 0x0d,
+	0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x04, 0x0e, 0x98, 0x0e, 0x1b, 0x0d, 0x71, 0x00, 0x05, 0x0d,
+	0x00, 0x00, 0x05, 0x0e, 0x98, 0x0e, 0x1c, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x06, 0x0e,
+	0x98, 0x0e, 0x1d, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x07, 0x0e, 0x98, 0x0e, 0x1e, 0x0d,
+	0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x08, 0x0e, 0x98, 0x0e, 0x1f, 0x0d, 0x71, 0x00, 0x05, 0x0d,
+	0x00, 0x00, 0x09, 0x0e, 0x98, 0x0e, 0x20, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0a, 0x0e,
+	0x98, 0x0e, 0x21, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0b, 0x0e, 0x98, 0x0e, 0x22, 0x0d,
+	0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0c, 0x0e, 0x98, 0x0e, 0x23, 0x0d, 0x71, 0x00, 0x05, 0x0d,
+	0x00, 0x00, 0x0d, 0x0e, 0x98, 0x0e, 0x24, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0e, 0x0e,
+	0x98, 0x0e, 0x25, 0x0d, 0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0f, 0x0e, 0x98, 0x0e, 0x26, 0x0d,
+	0x71, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x10, 0x0e, 0x98, 0x0e, 0x27, 0x0d, 0x71, 0x00, 0x05, 0x0d,
+	0x00, 0x00, 0x11, 0x0e, 0x98, 0x0e, 0x28, 0x0d, 0x71, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x41, 0x46, 0x5f, 0x55, 0x4e, 0x49, 0x58, 0x5f, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x50, 0x4f, 0x4c, 0x4c, 0x49, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x4f,
+	0x4c, 0x4c, 0x50, 0x52, 0x49, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x4f, 0x4c, 0x4c, 0x4f, 0x55,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x4f, 0x4c, 0x4c, 0x45, 0x52, 0x52, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x50, 0x4f, 0x4c, 0x4c, 0x48, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x4f,
+	0x4c, 0x4c, 0x4e, 0x56, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x50, 0x4f, 0x4c, 0x4c, 0x52,
+	0x44, 0x4e, 0x4f, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x50, 0x4f, 0x4c, 0x4c, 0x52, 0x44,
+	0x42, 0x41, 0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x50, 0x4f, 0x4c, 0x4c, 0x57, 0x52, 0x4e,
+	0x4f, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x50, 0x4f, 0x4c, 0x4c, 0x57, 0x52, 0x42, 0x41,
+	0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x4f, 0x4c, 0x4c, 0x4d, 0x53, 0x47, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x50, 0x4f, 0x4c, 0x4c, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x50, 0x4f, 0x4c, 0x4c, 0x52, 0x44, 0x48, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x53, 0x45, 0x45, 0x4b, 0x5f, 0x53, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x45, 0x45,
+	0x4b, 0x5f, 0x43, 0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x45, 0x45, 0x4b, 0x5f, 0x45,
+	0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x72, 0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x63,
+	0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x75,
+	0x70, 0x32, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x6f, 0x6c, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x65, 0x61, 0x64, 0x5f,
+	0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x65,
+	0x61, 0x64, 0x5f, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x65, 0x61,
+	0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x65,
+	0x6b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x72, 0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x02, 0xad, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x81, 0xa4,
+	0x04, 0x04, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x02,
+	0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x06, 0x0b, 0x00, 0x04,
+	0x07, 0x0b, 0x07, 0x06, 0x06, 0x50, 0x00, 0x05, 0x08, 0x0b, 0x08, 0x06, 0x06, 0x50, 0x00, 0x01,
+	0x07, 0x00, 0x00, 0x03, 0x03, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x5f, 0x43,
+	0x52, 0x45, 0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x5f, 0x41, 0x50, 0x50, 0x45, 0x4e,
+	0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x5f, 0x57, 0x52, 0x4f, 0x4e, 0x4c, 0x59, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x02,
+	0x03, 0x00, 0x02, 0x05, 0xa5, 0x80, 0x00, 0x0a, 0x02, 0x80, 0x00, 0x18, 0x02, 0x00, 0x00, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x01, 0x06, 0x05, 0xd2, 0x00, 0x02, 0x07, 0xad, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x03, 0x02, 0x9b, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x05,
+	0x02, 0x00, 0x03, 0x05, 0x0b, 0x04, 0x05, 0x05, 0x6e, 0x00, 0x04, 0x06, 0x0b, 0x05, 0x06, 0x06,
+	0x6e, 0x06, 0x05, 0x04, 0x1c, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x04,
+	0x0b, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x45, 0x42, 0x41, 0x44, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x1d, 0x00, 0x00, 0x00,
+	0x76, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x02, 0x10, 0x00, 0x85, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x66, 0x61, 0x69,
+	0x6c, 0x5f, 0x69, 0x66, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x17, 0x02, 0x00, 0x00, 0x00, 0xce, 0x00,
+	0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x02, 0x00, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x0b, 0x02, 0x00, 0x01, 0x04, 0x99, 0x02, 0x04, 0x04, 0x1e, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x0d, 0x02, 0x00, 0x03, 0x04, 0x0b, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x04, 0x06, 0x03, 0x00,
+	0x04, 0x01, 0xb2, 0x00, 0x04, 0x00, 0xa9, 0x80, 0x00, 0x07, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00,
+	0x03, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x05, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00,
+	0x02, 0x00, 0xa9, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x06, 0x02, 0x0b, 0x00,
+	0x02, 0x04, 0x00, 0x07, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00,
+	0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x41, 0x46, 0x5f, 0x55, 0x4e, 0x49, 0x58, 0x5f, 0x53,
+	0x54, 0x52, 0x45, 0x41, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x32, 0x41,
+	0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x41, 0x46, 0x5f, 0x55, 0x4e,
+	0x49, 0x58, 0x5f, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4d, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+	0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x15, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x73, 0x6f,
+	0x63, 0x6b, 0x65, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x22, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x20, 0x20, 0x42, 0x21, 0x2a, 0x04, 0x48, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x00, 0x05, 0x0b, 0x05, 0x02, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02,
+	0x81, 0xa4, 0x01, 0x04, 0x00, 0x01, 0x02, 0x03, 0x80, 0x00, 0x10, 0x02, 0x00, 0x00, 0x03, 0x0b,
+	0x03, 0x02, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x99,
+	0x02, 0x05, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x00,
+	0x81, 0xa4, 0x01, 0x04, 0x80, 0x00, 0x05, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x02, 0x03, 0x18,
+	0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x03, 0x03, 0xad,
+	0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x04, 0x00,
+	0x04, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x03, 0x0b,
+	0x00, 0x03, 0x05, 0x00, 0x06, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x07, 0x0b,
+	0x00, 0x08, 0x08, 0x0b, 0x02, 0x08, 0x08, 0x6c, 0x08, 0x07, 0x07, 0x50, 0x00, 0x01, 0x08, 0x00,
+	0x00, 0x04, 0x03, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x6f, 0x53, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f,
+	0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x00, 0x00, 0x00, 0xb4, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x11, 0x10, 0x11, 0x42, 0x04, 0x80, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2,
+	0x00, 0x02, 0x04, 0xad, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x02, 0x01, 0xb1,
+	0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x64, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65,
+	0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x00,
+	0xcc, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x02, 0x05, 0xad, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x02, 0x06, 0xad, 0x00, 0x01, 0x08, 0x00, 0x00, 0x06,
+	0x01, 0xb0, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x75, 0x70, 0x32, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x03, 0x00, 0x05, 0x02, 0x03, 0x00, 0x02, 0x05,
+	0xa5, 0x80, 0x00, 0x0b, 0x02, 0x80, 0x00, 0x14, 0x02, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x04, 0x06,
+	0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x08, 0x0b, 0x01, 0x08, 0x08,
+	0x6c, 0x80, 0x00, 0x09, 0x04, 0x00, 0x05, 0x03, 0xb0, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x05, 0x02, 0x9b, 0x00, 0x05, 0x04, 0x0b, 0x06, 0x04, 0x05, 0x6e, 0x00, 0x07, 0x06,
+	0x35, 0x08, 0x06, 0x06, 0x36, 0x06, 0x05, 0x05, 0x34, 0x05, 0x06, 0x04, 0x71, 0x00, 0x05, 0x04,
+	0x0b, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x72, 0x77, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x46, 0x4c, 0x41,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65,
+	0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x1e, 0x00, 0x00,
+	0x00, 0xe8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x42, 0x00, 0x21, 0x00, 0x84, 0x40,
+	0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x01, 0x02, 0xc1, 0x80, 0x00, 0x02, 0x04, 0x7f, 0xff, 0x03, 0x04, 0x7f, 0xff,
+	0x04, 0x04, 0x03, 0x02, 0x01, 0xc6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01,
+	0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x02, 0x02,
+	0x02, 0x6e, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x69,
+	0x6c, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e,
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x01, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00,
+	0x01, 0x02, 0x7f, 0xff, 0x01, 0x04, 0x00, 0x01, 0x04, 0xad, 0x00, 0x01, 0x06, 0x00, 0x00, 0x04,
+	0x01, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x03, 0x06,
+	0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x08, 0x6e, 0x00, 0x01, 0x09, 0x00, 0x00, 0x05,
+	0x03, 0xb0, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x04, 0x04, 0x73, 0x00, 0x00,
+	0x00, 0xa1, 0x80, 0x00, 0x10, 0x02, 0x80, 0x00, 0x07, 0x02, 0x80, 0x00, 0x03, 0x04, 0x06, 0x02,
+	0x04, 0x6e, 0x04, 0x04, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x00,
+	0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x06, 0x02, 0x06, 0x6e, 0x03, 0x06, 0x06, 0x6c, 0x00, 0x04,
+	0x01, 0xb0, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x08, 0x02, 0x04, 0x6e, 0x00, 0x04,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66,
+	0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x6f, 0x6c, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70,
+	0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x29, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x11, 0x42, 0x40, 0x48, 0x40, 0x04, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x06, 0x0b, 0x06, 0x02, 0x06, 0x18, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01,
+	0x02, 0x7f, 0xff, 0x02, 0x04, 0x00, 0x01, 0x06, 0xad, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01,
+	0xb0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x06, 0xad, 0x00, 0x02, 0x08, 0x00, 0x00, 0x06, 0x01,
+	0xb0, 0x00, 0x06, 0x02, 0x00, 0x02, 0x02, 0x06, 0x1a, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x34,
+	0x02, 0x03, 0x01, 0x02, 0x6e, 0x03, 0x01, 0x03, 0x6e, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x2b, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x09, 0x00, 0x06, 0x00,
+	0x30, 0x80, 0x00, 0x27, 0x02, 0x00, 0x04, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x05, 0x08, 0x07,
+	0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x07, 0x03,
+	0xb0, 0x00, 0x07, 0x05, 0x00, 0x06, 0x05, 0x06, 0x1a, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01,
+	0x02, 0x80, 0x00, 0x1b, 0x02, 0x04, 0x01, 0x06, 0x1c, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x0a,
+	0x02, 0x00, 0x01, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x04, 0x09, 0x00, 0x08, 0x09, 0x08,
+	0xd2, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x08, 0x02, 0xb0, 0x03, 0x01, 0x09,
+	0x6e, 0x03, 0x09, 0x09, 0x38, 0x00, 0x06, 0x02, 0xb0, 0x05, 0x03, 0x03, 0x38, 0x06, 0x03, 0x06,
+	0x1a, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x09, 0x02, 0x04, 0x01, 0x06,
+	0x18, 0x00, 0x06, 0x00, 0x30, 0x7f, 0xff, 0xdc, 0x02, 0x00, 0x09, 0x06, 0x0b, 0x00, 0x07, 0x00,
+	0xc0, 0x00, 0x03, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb2, 0x00, 0x06, 0x04, 0x00, 0x7f, 0xff, 0xd6,
+	0x02, 0x00, 0x00, 0x00, 0xa2, 0x03, 0x02, 0x06, 0x38, 0x00, 0x06, 0x00, 0x9d, 0x80, 0x00, 0x08,
+	0x02, 0x00, 0x04, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x05, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x07, 0x03, 0xb1, 0x00, 0x07, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+	0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x01, 0xbf,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x65, 0x61,
+	0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73,
+	0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x28, 0x4d, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x11, 0x42, 0x04,
+	0x91, 0x30, 0x24, 0x80, 0x12, 0x45, 0x10, 0x00, 0xa9, 0x22, 0x88, 0x09, 0x00, 0x94, 0x40, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03,
+	0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x02, 0x01, 0x07, 0x6e, 0x00, 0x03, 0x03,
+	0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e,
+	0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69,
+	0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00,
+	0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0, 0x90, 0x00, 0x08, 0x04, 0x00, 0x06, 0x01, 0xb2,
+	0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0, 0x01, 0x01, 0x08, 0x6e,
+	0x00, 0x06, 0x01, 0xb2, 0x00, 0x06, 0x02, 0x00, 0x80, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0xa1,
+	0x80, 0x00, 0x30, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x09, 0x00, 0x06, 0x00, 0x30,
+	0x80, 0x00, 0x2c, 0x02, 0x00, 0x02, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x03, 0x08, 0x07, 0xd2,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0, 0x00, 0x07, 0x04, 0x00,
+	0x01, 0x02, 0x06, 0x6e, 0x04, 0x03, 0x07, 0x34, 0x07, 0x06, 0x06, 0x28, 0x00, 0x06, 0x00, 0x30,
+	0x80, 0x00, 0x14, 0x02, 0x04, 0x03, 0x06, 0x22, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02,
+	0x00, 0x00, 0x07, 0x0b, 0x00, 0x08, 0x00, 0xc0, 0x04, 0x03, 0x09, 0x36, 0x00, 0x07, 0x01, 0xb2,
+	0x00, 0x07, 0x06, 0x00, 0x80, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x0b, 0x00, 0xc0,
+	0x05, 0x03, 0x0c, 0x3e, 0x00, 0x0a, 0x01, 0xb2, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x06, 0x05, 0x00,
+	0x00, 0x05, 0x07, 0x00, 0x06, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0,
+	0x00, 0x05, 0x02, 0x00, 0x00, 0x02, 0x07, 0x00, 0x06, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x08, 0x00,
+	0x00, 0x03, 0x09, 0x00, 0x00, 0x06, 0x02, 0xb0, 0x04, 0x03, 0x03, 0x34, 0x01, 0x01, 0x06, 0x6e,
+	0x06, 0x04, 0x06, 0x28, 0x00, 0x06, 0x00, 0x30, 0x7f, 0xff, 0xd3, 0x02, 0x80, 0x00, 0x01, 0x02,
+	0x7f, 0xff, 0xd1, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x01, 0x02, 0x06, 0x6e, 0x03, 0x06, 0x06, 0x1c,
+	0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0,
+	0x00, 0x03, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb2, 0x00, 0x06, 0x05, 0x00, 0x00, 0x05, 0x07, 0x00,
+	0x06, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x09, 0x00, 0x07, 0x09, 0x08, 0xd2, 0x80, 0x00, 0x0a, 0x04,
+	0x00, 0x03, 0x0b, 0x00, 0x00, 0x08, 0x02, 0xb0, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e,
+	0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x65,
+	0x61, 0x64, 0x01, 0x41, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x73, 0x75, 0x62, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x27, 0x52, 0x00, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x95, 0x01, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x08, 0x12, 0x40, 0x12, 0x14, 0x02, 0x00,
+	0x91, 0x34, 0x13, 0x22, 0x25, 0x20, 0x40, 0x48, 0x09, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x04, 0x0b, 0x00,
+	0x04, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00,
+	0x05, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05,
+	0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x08,
+	0x00, 0x00, 0x04, 0x03, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x73, 0x65, 0x65, 0x6b, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01,
+	0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x05, 0x04, 0x00, 0x00,
+	0x06, 0x0b, 0x02, 0x06, 0x06, 0x6e, 0x00, 0x02, 0x03, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65,
+	0x65, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x45, 0x45, 0x4b, 0x5f, 0x43, 0x55, 0x52, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0xc6, 0x01,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b,
+	0x03, 0x01, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00, 0x05, 0x0b,
+	0x05, 0x02, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x81, 0xa4, 0x01, 0x04,
+	0x00, 0x01, 0x02, 0x03, 0x80, 0x00, 0x10, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x02, 0x04, 0x18,
+	0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x99, 0x02, 0x05, 0x04, 0x1a,
+	0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x00, 0x81, 0xa4, 0x01, 0x04,
+	0x80, 0x00, 0x05, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x02, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30,
+	0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x03, 0x03, 0xad, 0x00, 0x01, 0x05, 0x00,
+	0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2,
+	0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00,
+	0x06, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x07, 0x0b, 0x00, 0x08, 0x08, 0x0b,
+	0x08, 0x07, 0x07, 0x50, 0x00, 0x09, 0x09, 0x0b, 0x02, 0x09, 0x09, 0x6c, 0x09, 0x07, 0x07, 0x50,
+	0x00, 0x01, 0x08, 0x00, 0x00, 0x04, 0x03, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x72, 0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x5f, 0x43, 0x52,
+	0x45, 0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x5f, 0x54, 0x52, 0x55, 0x4e, 0x43, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x17, 0x31, 0x00, 0x00, 0x00, 0xdb, 0x01,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x11, 0x10, 0x11, 0x42, 0x04, 0x80, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x05, 0x0b, 0x05, 0x02, 0x05, 0x18, 0x00, 0x05, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0x02, 0x04, 0x00, 0x01, 0x05, 0xad, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x05, 0xad, 0x00, 0x02, 0x07,
+	0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x02, 0x00, 0x02, 0x02, 0x05, 0x1a, 0x00, 0x05, 0x00,
+	0x30, 0x80, 0x00, 0x1f, 0x02, 0x03, 0x01, 0x02, 0x6e, 0x03, 0x01, 0x03, 0x6e, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x18, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x09, 0x00, 0x05, 0x00,
+	0x30, 0x80, 0x00, 0x14, 0x02, 0x00, 0x04, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x05, 0x07, 0x06,
+	0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x06, 0x03,
+	0xb0, 0x00, 0x06, 0x04, 0x00, 0x04, 0x03, 0x03, 0x38, 0x06, 0x03, 0x05, 0x1a, 0x00, 0x05, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x07, 0x02, 0x00, 0x07, 0x05, 0x0b, 0x00, 0x06, 0x00,
+	0xc0, 0x00, 0x01, 0x07, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb2, 0x00, 0x05, 0x01,
+	0x00, 0x7f, 0xff, 0xe9, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x02, 0x00, 0x9d, 0x80, 0x00, 0x08,
+	0x02, 0x00, 0x04, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x05, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x06, 0x03, 0xb1, 0x00, 0x06, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+	0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x01, 0xbf,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x72, 0x69,
+	0x74, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x11, 0x42, 0x04, 0x91, 0x22, 0x48, 0x01, 0x32, 0x45, 0x02, 0x13, 0x10, 0x02, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0xad, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00,
+	0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x04, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x05, 0x08, 0x07, 0xd2, 0x00,
+	0x01, 0x0a, 0x00, 0x01, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x07, 0x01, 0xb0, 0x00,
+	0x07, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x63,
+	0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x17, 0x00, 0x00, 0x00, 0x23, 0x02,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x24, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x6f,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x58, 0x79, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+	0x00, 0x12, 0x20, 0x6a, 0x3b, 0x52, 0x10, 0x84, 0x21, 0x08, 0x42, 0x08, 0x42, 0x1a, 0x15, 0x29,
+	0x22, 0x62, 0x22, 0x22, 0x61, 0x08, 0x00, 0xd2, 0xd6, 0xd1, 0x5a, 0x29, 0xa4, 0x74, 0x7b, 0x4a,
+	0x68, 0xf6, 0x89, 0x96, 0x8a, 0x96, 0x8e, 0xd1, 0x6d, 0x17, 0x6d, 0x23, 0xa3, 0xda, 0x5b, 0x54,
+	0x34, 0x74, 0xb4, 0x4e, 0xa6, 0x68, 0xb9, 0x68, 0xf9, 0x68, 0x99, 0x69, 0x3d, 0x1e, 0xd2, 0x5a,
+	0x75, 0xa2, 0xb4, 0x2a, 0x60, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65,
+	0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x63,
+	0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x5f, 0x41, 0x50, 0x50, 0x45, 0x4e, 0x44, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x5f, 0x52, 0x44, 0x4f, 0x4e, 0x4c, 0x59, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x5f, 0x52, 0x44, 0x57, 0x52, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x00, 0x07, 0x4f, 0x5f, 0x54, 0x52, 0x55, 0x4e, 0x43, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+	0x00, 0x08, 0x4f, 0x5f, 0x57, 0x52, 0x4f, 0x4e, 0x4c, 0x59, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+	0x00, 0x0b, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_8[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x00,
+	0xc0, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x04, 0x6e, 0x04, 0x00, 0x03,
+	0x71, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0xc1, 0x04, 0x01, 0x03, 0x71, 0x00, 0x02, 0x03,
+	0x00, 0x02, 0x01, 0x04, 0x6e, 0x04, 0x02, 0x03, 0x71, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6b, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x6b, 0x65, 0x72, 0x6e, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x13, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x68, 0xd3, 0x43, 0x9a, 0x20, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_9[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x05, 0x03,
+	0xc0, 0x00, 0x01, 0x06, 0x03, 0x00, 0x01, 0x07, 0x98, 0x00, 0x02, 0x08, 0x03, 0x00, 0x02, 0x09,
+	0x98, 0x00, 0x03, 0x0a, 0x03, 0x00, 0x03, 0x0b, 0x98, 0x06, 0x06, 0x05, 0xc2, 0x05, 0x00, 0x04,
+	0x71, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x05, 0x98, 0x05, 0x04, 0x04, 0x71, 0x00, 0x03, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74,
+	0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6c, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x01, 0xc1, 0x80, 0x00, 0x03, 0x04,
+	0x00, 0x00, 0x04, 0x00, 0x02, 0x03, 0x02, 0xc6, 0x02, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x02, 0x01, 0xc1, 0x80, 0x00, 0x03, 0x04, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00,
+	0x03, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x02, 0x03, 0x02, 0xc6,
+	0x02, 0x01, 0x01, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x62,
+	0x65, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x6e, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x50,
+	0x65, 0x72, 0x66, 0x44, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x65, 0x72, 0x66, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x06, 0x02, 0x01, 0x01, 0x6e, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x03, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x04,
+	0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x61, 0x6d, 0x70,
+	0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+	0x6e, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6e, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x65, 0x72, 0x66, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x03, 0x00,
+	0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x02, 0x01, 0xd2, 0x00, 0x04, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x05, 0x05, 0x04, 0xd2, 0x00,
+	0x04, 0x00, 0xb0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x62, 0x65,
+	0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x6e, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x70, 0x65, 0x72, 0x66, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x10, 0x13, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2a,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x02, 0x6e,
+	0x01, 0x02, 0x02, 0x6e, 0x02, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x21, 0x02,
+	0x80, 0x00, 0x08, 0x02, 0x80, 0x01, 0x01, 0x04, 0x00, 0x02, 0x00, 0x06, 0x03, 0x02, 0x02, 0x6e,
+	0x04, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x02, 0x28, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02,
+	0x80, 0x00, 0x18, 0x02, 0x00, 0x01, 0x02, 0x7a, 0x7f, 0xff, 0xf7, 0x02, 0x05, 0x00, 0x00, 0x36,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x03, 0x6e, 0x01, 0x03, 0x03, 0x6c,
+	0x06, 0x03, 0x03, 0x36, 0x03, 0x02, 0x00, 0x34, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x06,
+	0x03, 0x03, 0x03, 0x6e, 0x01, 0x03, 0x03, 0x6c, 0x00, 0x04, 0x00, 0x06, 0x03, 0x04, 0x04, 0x6e,
+	0x07, 0x01, 0x05, 0x3a, 0x05, 0x04, 0x04, 0x6c, 0x04, 0x03, 0x03, 0x38, 0x00, 0x03, 0x07, 0x00,
+	0x08, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x06, 0x02, 0x00, 0x34, 0x09, 0x00, 0x00, 0x36,
+	0x7f, 0xff, 0xe8, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x50, 0x45, 0x52, 0x46, 0x4f, 0x52, 0x4d,
+	0x41, 0x4e, 0x43, 0x45, 0x20, 0x52, 0x45, 0x50, 0x4f, 0x52, 0x54, 0x3a, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65,
+	0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x20, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x6d,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x65, 0x72,
+	0x66, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x2a, 0x00,
+	0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x40, 0x11, 0x00, 0x80, 0x00,
+	0x88, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x02, 0x00, 0xc0, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb3, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x50, 0x65, 0x72, 0x66, 0x44, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x65, 0x72, 0x66, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x65, 0x72, 0x66, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x18, 0x12, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x34, 0x5b, 0x43, 0xd6, 0x87, 0xbd, 0x13, 0xa2,
+	0xd1, 0xa2, 0x25, 0x30, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08,
+	0x50, 0x65, 0x72, 0x66, 0x44, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x65, 0x72, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_10[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1b, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x06, 0x00,
+	0xab, 0x00, 0x00, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x06, 0x00,
+	0xab, 0x00, 0x01, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x25,
+	0xc0, 0x00, 0x02, 0x07, 0x03, 0x80, 0x01, 0x08, 0x04, 0x00, 0x03, 0x09, 0x03, 0x80, 0x02, 0x0a,
+	0x04, 0x00, 0x04, 0x0b, 0x03, 0x80, 0x03, 0x0c, 0x04, 0x00, 0x05, 0x0d, 0x03, 0x80, 0x04, 0x0e,
+	0x04, 0x00, 0x06, 0x0f, 0x03, 0x80, 0x05, 0x10, 0x04, 0x00, 0x07, 0x11, 0x03, 0x80, 0x06, 0x12,
+	0x04, 0x00, 0x08, 0x13, 0x03, 0x80, 0x06, 0x14, 0x04, 0x00, 0x09, 0x15, 0x03, 0x80, 0x07, 0x16,
+	0x04, 0x00, 0x0a, 0x17, 0x03, 0x80, 0x08, 0x18, 0x04, 0x00, 0x0b, 0x19, 0x03, 0x80, 0x09, 0x1a,
+	0x04, 0x14, 0x07, 0x06, 0xc2, 0x00, 0x0c, 0x07, 0x03, 0x80, 0x0a, 0x08, 0x04, 0x00, 0x0d, 0x09,
+	0x03, 0x80, 0x0b, 0x0a, 0x04, 0x00, 0x0e, 0x0b, 0x03, 0x80, 0x0c, 0x0c, 0x04, 0x00, 0x0f, 0x0d,
+	0x03, 0x80, 0x0d, 0x0e, 0x04, 0x00, 0x10, 0x0f, 0x03, 0x80, 0x0e, 0x10, 0x04, 0x00, 0x11, 0x11,
+	0x03, 0x80, 0x0f, 0x12, 0x04, 0x00, 0x12, 0x13, 0x03, 0x80, 0x10, 0x14, 0x04, 0x00, 0x13, 0x15,
+	0x03, 0x80, 0x11, 0x16, 0x04, 0x00, 0x14, 0x17, 0x03, 0x80, 0x12, 0x18, 0x04, 0x00, 0x15, 0x19,
+	0x03, 0x80, 0x13, 0x1a, 0x04, 0x14, 0x07, 0x06, 0xc2, 0x00, 0x16, 0x07, 0x03, 0x80, 0x14, 0x08,
+	0x04, 0x00, 0x17, 0x09, 0x03, 0x80, 0x15, 0x0a, 0x04, 0x00, 0x18, 0x0b, 0x03, 0x80, 0x16, 0x0c,
+	0x04, 0x00, 0x19, 0x0d, 0x03, 0x80, 0x17, 0x0e, 0x04, 0x00, 0x1a, 0x0f, 0x03, 0x80, 0x18, 0x10,
+	0x04, 0x00, 0x1b, 0x11, 0x03, 0x80, 0x19, 0x12, 0x04, 0x00, 0x1c, 0x13, 0x03, 0x80, 0x1a, 0x14,
+	0x04, 0x00, 0x1d, 0x15, 0x03, 0x80, 0x1b, 0x16, 0x04, 0x00, 0x1e, 0x17, 0x03, 0x80, 0x1c, 0x18,
+	0x04, 0x00, 0x1f, 0x19, 0x03, 0x80, 0x1d, 0x1a, 0x04, 0x14, 0x07, 0x06, 0xc2, 0x00, 0x20, 0x07,
+	0x03, 0x80, 0x1d, 0x08, 0x04, 0x00, 0x21, 0x09, 0x03, 0x80, 0x1e, 0x0a, 0x04, 0x00, 0x22, 0x0b,
+	0x03, 0x80, 0x1f, 0x0c, 0x04, 0x00, 0x23, 0x0d, 0x03, 0x80, 0x1f, 0x0e, 0x04, 0x00, 0x24, 0x0f,
+	0x03, 0x80, 0x01, 0x10, 0x04, 0x00, 0x25, 0x11, 0x03, 0x80, 0x02, 0x12, 0x04, 0x00, 0x26, 0x13,
+	0x03, 0x80, 0x08, 0x14, 0x04, 0x0e, 0x07, 0x06, 0xc2, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x00,
+	0xc1, 0x00, 0x06, 0x05, 0x00, 0x00, 0x01, 0x07, 0x00, 0x27, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08,
+	0x98, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x04, 0x06, 0x00, 0x00, 0x01, 0x07, 0x98, 0x07, 0x28, 0x06,
+	0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x02, 0x07, 0x98, 0x07, 0x27, 0x06, 0x71, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x03, 0x07, 0x98, 0x07, 0x29, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x04, 0x07,
+	0x98, 0x07, 0x2a, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x05, 0x07, 0x98, 0x07, 0x2b, 0x06,
+	0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x06, 0x07, 0x98, 0x07, 0x2c, 0x06, 0x71, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x07, 0x07, 0x98, 0x07, 0x2d, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x07,
+	0x98, 0x07, 0x2e, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0x07, 0x98, 0x07, 0x2f, 0x06,
+	0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x0a, 0x07, 0x98, 0x07, 0x30, 0x06, 0x71, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x0b, 0x07, 0x98, 0x07, 0x31, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x0c, 0x07,
+	0x98, 0x07, 0x32, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x0d, 0x07, 0x98, 0x07, 0x33, 0x06,
+	0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x0e, 0x07, 0x98, 0x07, 0x34, 0x06, 0x71, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x0f, 0x07, 0x98, 0x07, 0x35, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x10, 0x07,
+	0x98, 0x07, 0x36, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x11, 0x07, 0x98, 0x07, 0x37, 0x06,
+	0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x12, 0x07, 0x98, 0x07, 0x38, 0x06, 0x71, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x13, 0x07, 0x98, 0x07, 0x39, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x14, 0x07,
+	0x98, 0x07, 0x3a, 0x06, 0x71, 0x00, 0x04, 0x06, 0x00, 0x00, 0x15, 0x07, 0x98, 0x07, 0x3b, 0x06,
+	0x71, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72,
+	0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53,
+	0x49, 0x47, 0x48, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x49, 0x47, 0x49, 0x4e, 0x54,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x51, 0x55, 0x49, 0x54, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x53, 0x49, 0x47, 0x49, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x54,
+	0x52, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x41, 0x42, 0x52, 0x54, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x53, 0x49, 0x47, 0x49, 0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53,
+	0x49, 0x47, 0x42, 0x55, 0x53, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x49, 0x47, 0x46, 0x50, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x4b, 0x49, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x53, 0x49, 0x47, 0x55, 0x53, 0x52, 0x31, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47,
+	0x53, 0x45, 0x47, 0x56, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x55, 0x53, 0x52, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x50, 0x49, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x53, 0x49, 0x47, 0x41, 0x4c, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47,
+	0x54, 0x45, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x53, 0x49, 0x47, 0x53, 0x54, 0x4b, 0x46,
+	0x4c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x43, 0x48, 0x4c, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x43, 0x4f, 0x4e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53,
+	0x49, 0x47, 0x53, 0x54, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x54, 0x53,
+	0x54, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x54, 0x54, 0x49, 0x4e, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x54, 0x54, 0x4f, 0x55, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53,
+	0x49, 0x47, 0x55, 0x52, 0x47, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x58, 0x43, 0x50,
+	0x55, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x58, 0x46, 0x53, 0x5a, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x53, 0x49, 0x47, 0x56, 0x54, 0x41, 0x4c, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x53, 0x49, 0x47, 0x50, 0x52, 0x4f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x49, 0x47, 0x57,
+	0x49, 0x4e, 0x43, 0x48, 0x00, 0x00, 0x00, 0x00, 0x05, 0x53, 0x49, 0x47, 0x49, 0x4f, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x50, 0x4f, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53,
+	0x49, 0x47, 0x50, 0x57, 0x52, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x49, 0x47, 0x53, 0x59, 0x53,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x53, 0x49, 0x47, 0x55, 0x4e, 0x55, 0x53, 0x45, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x57, 0x4e, 0x4f, 0x48, 0x41, 0x4e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x09, 0x57,
+	0x55, 0x4e, 0x54, 0x52, 0x41, 0x43, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x57, 0x43, 0x4f,
+	0x4e, 0x54, 0x49, 0x4e, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x74, 0x65, 0x78,
+	0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x63, 0x68, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x65, 0x63, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6f, 0x72,
+	0x6b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x6f, 0x72, 0x6b, 0x32, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x65, 0x67,
+	0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x65, 0x75, 0x69, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65,
+	0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x70, 0x70, 0x69, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x75, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x6b, 0x69, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x73, 0x65, 0x74, 0x73, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x69, 0x67, 0x6e, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x77, 0x61, 0x69, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1c, 0x02, 0x80, 0x00, 0x07, 0x02,
+	0x00, 0x00, 0x04, 0x0b, 0x01, 0x04, 0x04, 0x6e, 0x02, 0x04, 0x00, 0x3a, 0x03, 0x00, 0x02, 0x26,
+	0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x14, 0x02, 0x00, 0x00, 0x02, 0x7b,
+	0x7f, 0xff, 0xfa, 0x02, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x01, 0x6c, 0x04, 0x01, 0x02, 0x6e,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x04, 0x01, 0x03, 0x6e, 0x00, 0x05, 0x04, 0x0b,
+	0x00, 0x04, 0x06, 0x00, 0x06, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x05, 0x03, 0x02, 0x1c,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0xf0, 0x02, 0x00, 0x01, 0x03, 0x00,
+	0x07, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x7f, 0xff, 0xec, 0x02, 0x00, 0x00, 0x00, 0xa2,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x74, 0x65, 0x78, 0x69, 0x74, 0x5f,
+	0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e,
+	0x67, 0x74, 0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x70, 0x69,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, 0x76, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x02, 0x28, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x04,
+	0xad, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x02, 0x01, 0xb1, 0x00, 0x02, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x61, 0x6c, 0x61, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00,
+	0x00, 0x9a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x04, 0x0b, 0x00,
+	0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x03, 0x00, 0x00,
+	0x03, 0x02, 0x00, 0x00, 0x03, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x04, 0x05, 0x04, 0xd2, 0x00,
+	0x06, 0x02, 0xc0, 0x00, 0x05, 0x07, 0x03, 0x00, 0x01, 0x08, 0x00, 0x00, 0x06, 0x09, 0x03, 0x00,
+	0x02, 0x0a, 0x00, 0x04, 0x07, 0x06, 0xc2, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x70, 0x69,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x74, 0x65, 0x78, 0x69, 0x74, 0x5f, 0x68, 0x61, 0x6e,
+	0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70,
+	0x69, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72,
+	0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x1c,
+	0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x14, 0x00, 0x48, 0x84,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03,
+	0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x68, 0x64,
+	0x69, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72,
+	0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07,
+	0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x01, 0x06, 0x05, 0xd2, 0x00, 0x01, 0x07,
+	0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x03,
+	0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0xc1, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x04,
+	0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0xc1, 0x00, 0x05, 0x04,
+	0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x02,
+	0x02, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x01,
+	0xc1, 0x80, 0x00, 0x05, 0x04, 0x00, 0x00, 0x06, 0x00, 0x02, 0x05, 0x04, 0xc6, 0x00, 0x04, 0x06,
+	0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x07,
+	0x00, 0x03, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x98, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x03,
+	0x00, 0x00, 0x03, 0x05, 0x00, 0x04, 0x05, 0x04, 0xd2, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x01,
+	0xb0, 0x05, 0x02, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x06, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x05, 0x02, 0x07, 0x6e, 0x00, 0x05, 0x01,
+	0xb0, 0x08, 0x02, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x09, 0x02, 0x00, 0x09, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x0a, 0x06, 0x05, 0xd2, 0x08, 0x02, 0x07, 0x6e, 0x00, 0x05, 0x01,
+	0xb0, 0x00, 0x05, 0x07, 0x00, 0x0b, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x08, 0x98, 0x00, 0x06, 0x01,
+	0xb0, 0x00, 0x11, 0x04, 0x03, 0x00, 0x04, 0x05, 0xa5, 0x80, 0x00, 0x19, 0x02, 0x80, 0x00, 0x22,
+	0x02, 0x0c, 0x02, 0x06, 0x6e, 0x00, 0x07, 0x00, 0x0a, 0x07, 0x06, 0x06, 0x1c, 0x00, 0x06, 0x00,
+	0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x0d, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x0e, 0x08, 0x07,
+	0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x0d, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x0f, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0, 0x00, 0x06, 0x06, 0x0b, 0x00, 0x06, 0x08,
+	0x00, 0x10, 0x08, 0x07, 0xd2, 0x7f, 0xff, 0x09, 0x04, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x11, 0x04, 0x9b, 0x00, 0x11, 0x06, 0x0b, 0x12, 0x06, 0x07, 0x6e, 0x00, 0x13, 0x08,
+	0x35, 0x14, 0x08, 0x08, 0x36, 0x08, 0x07, 0x07, 0x34, 0x07, 0x12, 0x06, 0x71, 0x00, 0x11, 0x06,
+	0x0b, 0x00, 0x06, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x41, 0x72,
+	0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x68, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65,
+	0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f,
+	0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+	0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x65, 0x78, 0x65, 0x63, 0x76, 0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x78, 0x65, 0x63, 0x76,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x20, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x00, 0x01,
+	0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x00, 0x03,
+	0x00, 0x01, 0x03, 0x02, 0x6e, 0x00, 0x03, 0x00, 0x08, 0x03, 0x02, 0x03, 0x1c, 0x00, 0x03, 0x00,
+	0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x04,
+	0xd2, 0x00, 0x01, 0x06, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x02, 0xb0, 0x80, 0x00, 0x05,
+	0x02, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x04, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x06,
+	0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x44, 0x02, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72,
+	0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2a, 0x63,
+	0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x22,
+	0x00, 0x00, 0x00, 0x01, 0x10, 0xa0, 0x40, 0x24, 0x01, 0x24, 0x09, 0x20, 0x28, 0x80, 0x34, 0x4a,
+	0x80, 0x08, 0x04, 0x40, 0x28, 0x21, 0x00, 0x84, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x65, 0x78, 0x65,
+	0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61,
+	0x72, 0x67, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x74, 0x73, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0xad, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x32, 0x80,
+	0x00, 0x01, 0x02, 0x80, 0x00, 0x03, 0x04, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62,
+	0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x69,
+	0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f,
+	0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0d, 0x00,
+	0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x03, 0x99, 0x00, 0x03, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x03,
+	0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x03,
+	0x0d, 0x00, 0x03, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+	0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x04, 0x0b, 0x04, 0x01, 0x03, 0x18, 0x00, 0x03, 0x00,
+	0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x03, 0x05,
+	0x03, 0x00, 0x03, 0x01, 0xb2, 0x00, 0x03, 0x00, 0xa9, 0x00, 0x04, 0x03, 0x0b, 0x00, 0x03, 0x05,
+	0x00, 0x05, 0x05, 0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x04, 0x02, 0x00, 0x06, 0x02, 0x03,
+	0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x24, 0x02, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x21,
+	0x02, 0x00, 0x07, 0x03, 0x03, 0x00, 0x03, 0x05, 0xa5, 0x80, 0x00, 0x04, 0x02, 0x80, 0x00, 0x17,
+	0x02, 0x00, 0x05, 0x01, 0xab, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x07, 0x03,
+	0x9b, 0x00, 0x08, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x09, 0x07, 0x06, 0xd2, 0x80, 0x02, 0x08,
+	0x04, 0x00, 0x07, 0x09, 0x0b, 0x0a, 0x09, 0x09, 0x6e, 0x0b, 0x09, 0x09, 0x36, 0x00, 0x06, 0x02,
+	0xb0, 0x00, 0x0c, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x0d, 0x07, 0x06, 0xd2, 0x00, 0x07, 0x08,
+	0x0b, 0x0e, 0x08, 0x09, 0x6e, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x80, 0x01, 0x09,
+	0x04, 0x00, 0x09, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x0c, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x0d, 0x05, 0x04, 0xd2, 0x80, 0x00, 0x06, 0x04, 0x00, 0x04, 0x01,
+	0xb0, 0x80, 0x00, 0x01, 0x02, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x0c, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x0f, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06,
+	0x00, 0x00, 0x04, 0x01, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x31, 0x43, 0x61, 0x6e, 0x6e, 0x6f,
+	0x74, 0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x6b,
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6f, 0x72, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x61, 0x69, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x26, 0x4c, 0x00, 0x00, 0x00, 0x46, 0x01, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x05,
+	0x01, 0x01, 0x41, 0x24, 0x20, 0x42, 0x10, 0x02, 0x00, 0x11, 0x20, 0x8b, 0x40, 0x2a, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x05, 0x99, 0x00, 0x05, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30,
+	0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0b,
+	0x05, 0x01, 0x05, 0x18, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x05, 0x0b,
+	0x00, 0x06, 0x00, 0xc0, 0x00, 0x03, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb2, 0x00, 0x05, 0x00, 0xa9,
+	0x00, 0x00, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x04, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00,
+	0x05, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x06, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x00, 0x06, 0x03, 0x00,
+	0x08, 0x03, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x68, 0x02, 0x00, 0x0d, 0x05, 0x03,
+	0x00, 0x05, 0x05, 0xa5, 0x80, 0x00, 0x47, 0x02, 0x80, 0x00, 0x5e, 0x02, 0x00, 0x06, 0x07, 0x0b,
+	0x00, 0x07, 0x09, 0x00, 0x07, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x00, 0xb0, 0x00, 0x08, 0x03, 0x00,
+	0x08, 0x03, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x3d, 0x02, 0x00, 0x0d, 0x07, 0x03,
+	0x00, 0x07, 0x05, 0xa5, 0x80, 0x00, 0x1d, 0x02, 0x80, 0x00, 0x34, 0x02, 0x00, 0x00, 0x00, 0x30,
+	0x80, 0x00, 0x17, 0x02, 0x00, 0x04, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x0a, 0xd2,
+	0x00, 0x02, 0x0c, 0x00, 0x08, 0x0c, 0x0c, 0x6e, 0x00, 0x0a, 0x01, 0xb0, 0x00, 0x04, 0x09, 0x0b,
+	0x00, 0x09, 0x0b, 0x00, 0x0a, 0x0b, 0x0a, 0xd2, 0x00, 0x02, 0x0c, 0x00, 0x0b, 0x0c, 0x0c, 0x6e,
+	0x00, 0x06, 0x0d, 0x0b, 0x00, 0x0d, 0x0f, 0x00, 0x0c, 0x0f, 0x0e, 0xd2, 0x00, 0x0e, 0x00, 0xb0,
+	0x00, 0x0e, 0x0d, 0x00, 0x00, 0x0a, 0x02, 0xb0, 0x00, 0x04, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00,
+	0x09, 0x0b, 0x0a, 0xd2, 0x00, 0x02, 0x0c, 0x00, 0x0b, 0x0c, 0x0c, 0x6e, 0x00, 0x0a, 0x01, 0xb0,
+	0x00, 0x09, 0x01, 0xab, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x0d, 0x07, 0x9b,
+	0x00, 0x04, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0a, 0x0b, 0x0a, 0xd2, 0x80, 0x02, 0x0c, 0x04,
+	0x00, 0x0d, 0x0d, 0x0b, 0x0e, 0x0d, 0x0d, 0x6e, 0x00, 0x0a, 0x02, 0xb0, 0x00, 0x06, 0x09, 0x0b,
+	0x00, 0x09, 0x0b, 0x00, 0x0f, 0x0b, 0x0a, 0xd2, 0x00, 0x0d, 0x0c, 0x0b, 0x10, 0x0c, 0x0c, 0x6e,
+	0x00, 0x01, 0x0d, 0x0b, 0x0d, 0x0c, 0x0e, 0x18, 0x00, 0x0e, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x7f, 0xff, 0x0e, 0x04, 0x80, 0x00, 0x02, 0x02, 0x00, 0x0d, 0x0f, 0x0b, 0x10, 0x0f, 0x0e, 0x6e,
+	0x00, 0x0e, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x06, 0x07, 0x0b,
+	0x00, 0x07, 0x09, 0x00, 0x0f, 0x09, 0x08, 0xd2, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x08, 0x01, 0xb0,
+	0x00, 0x00, 0x00, 0xa6, 0x00, 0x0d, 0x05, 0x9b, 0x00, 0x04, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00,
+	0x0a, 0x09, 0x08, 0xd2, 0x80, 0x02, 0x0a, 0x04, 0x00, 0x0d, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x6e,
+	0x00, 0x08, 0x02, 0xb0, 0x00, 0x06, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x0f, 0x09, 0x08, 0xd2,
+	0x00, 0x0d, 0x0a, 0x0b, 0x10, 0x0a, 0x0a, 0x6e, 0x00, 0x01, 0x0b, 0x0b, 0x0b, 0x0a, 0x0c, 0x18,
+	0x00, 0x0c, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x7f, 0xff, 0x0c, 0x04, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x0d, 0x0d, 0x0b, 0x10, 0x0d, 0x0c, 0x6e, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0,
+	0x00, 0x00, 0x00, 0xa7, 0x00, 0x06, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x0f, 0x07, 0x06, 0xd2,
+	0x80, 0x00, 0x08, 0x04, 0x00, 0x06, 0x01, 0xb0, 0x80, 0x00, 0x05, 0x02, 0x00, 0x06, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x11, 0x07, 0x06, 0xd2, 0x00, 0x03, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0,
+	0x00, 0x01, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x80, 0x00, 0x16, 0x02, 0x00, 0x04, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x09, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x0b, 0x08, 0x08, 0x6e,
+	0x00, 0x06, 0x01, 0xb0, 0x00, 0x12, 0x05, 0xad, 0x00, 0x04, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00,
+	0x13, 0x09, 0x08, 0xd2, 0x00, 0x02, 0x0a, 0x00, 0x08, 0x0a, 0x0a, 0x6e, 0x00, 0x08, 0x01, 0xb0,
+	0x00, 0x08, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x09, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x08, 0x08, 0x08, 0x6e,
+	0x00, 0x06, 0x01, 0xb0, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e,
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x32, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x61, 0x75,
+	0x6e, 0x63, 0x68, 0x20, 0x61, 0x20, 0x64, 0x61, 0x65, 0x6d, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74,
+	0x68, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f,
+	0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6f, 0x72, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x3f,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x70,
+	0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73,
+	0x74, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x61, 0x69, 0x74,
+	0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x42, 0xaa, 0x00, 0x00, 0x00, 0x84,
+	0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xad,
+	0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x11, 0x11, 0x05, 0x08, 0x0d, 0x0a, 0x80, 0xa0, 0x92,
+	0x04, 0x04, 0x90, 0x21, 0x00, 0x80, 0x00, 0x08, 0x05, 0x21, 0x00, 0x40, 0x00, 0x11, 0x21, 0x28,
+	0x02, 0x00, 0x00, 0x22, 0x42, 0x20, 0x2a, 0x50, 0x08, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x66, 0x64, 0x73, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x63,
+	0x68, 0x69, 0x6c, 0x64, 0x5f, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x02, 0x01, 0xb1, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xc7, 0x01,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b,
+	0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67,
+	0x65, 0x74, 0x65, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01,
+	0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x65, 0x75, 0x69, 0x64, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00,
+	0xd9, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x67, 0x65, 0x74, 0x67, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02,
+	0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00,
+	0xeb, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x67, 0x65, 0x74, 0x70, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x75, 0x69, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00,
+	0x00, 0xfd, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x01, 0x02, 0x0b, 0x02, 0x02, 0x01, 0x6e, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x04,
+	0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb1, 0x00,
+	0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65,
+	0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x53, 0x49, 0x47, 0x4b, 0x49, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x69, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x10, 0xa0, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x03,
+	0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0b, 0x03, 0x02, 0x04,
+	0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00, 0x09, 0x80, 0x00, 0x03,
+	0x02, 0x00, 0x02, 0x05, 0x0d, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x02,
+	0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x01, 0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x0a,
+	0x02, 0x00, 0x02, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x02, 0x00,
+	0xa0, 0x00, 0x03, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x04, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x04, 0x01, 0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x03, 0x03, 0x0b, 0x00, 0x03, 0x05,
+	0x00, 0x05, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x08, 0x07,
+	0xd2, 0x00, 0x07, 0x00, 0xb0, 0x00, 0x02, 0x08, 0x00, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x02,
+	0x02, 0x80, 0x01, 0x08, 0x04, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x08, 0x04, 0x00, 0x04, 0x03,
+	0xb1, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x6f,
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66,
+	0x69, 0x6e, 0x65, 0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x91, 0x04, 0x50, 0x28, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00,
+	0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x73, 0x65, 0x74, 0x73, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04,
+	0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x0b, 0x02, 0x80, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x01, 0x01,
+	0x0b, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01,
+	0xb0, 0x00, 0x02, 0x00, 0x00, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+	0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x75, 0x02, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01,
+	0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb1, 0x00, 0x02,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4e,
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0xad, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x06, 0x0b, 0x06, 0x01, 0x06, 0x18,
+	0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0xa1,
+	0x80, 0x00, 0x1c, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x02, 0x06, 0x0d, 0x00, 0x06, 0x00, 0x30,
+	0x80, 0x00, 0x18, 0x02, 0x00, 0x04, 0x06, 0x03, 0x00, 0x06, 0x05, 0xa5, 0x80, 0x00, 0x09, 0x02,
+	0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x03, 0x0a, 0x09, 0xd2,
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x09, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0xa6, 0x00, 0x04, 0x06, 0x9b, 0x00, 0x04, 0x08, 0x0b, 0x05, 0x08, 0x08, 0x6e,
+	0x00, 0x05, 0x09, 0x0b, 0x06, 0x09, 0x09, 0x6e, 0x09, 0x08, 0x08, 0x1c, 0x00, 0x08, 0x00, 0x30,
+	0x80, 0x00, 0x02, 0x02, 0x00, 0x04, 0x08, 0x0b, 0x00, 0x08, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7,
+	0x7f, 0xff, 0xe5, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x07, 0x02, 0x03, 0x6e, 0x08, 0x03, 0x06, 0x4e,
+	0x09, 0x06, 0x04, 0x62, 0x0a, 0x03, 0x05, 0x4e, 0x00, 0x06, 0x06, 0xc0, 0x00, 0x0b, 0x07, 0x03,
+	0x0b, 0x02, 0x08, 0x6e, 0x00, 0x0c, 0x09, 0x03, 0x0d, 0x05, 0x0a, 0x1a, 0x00, 0x0a, 0x00, 0x30,
+	0x80, 0x00, 0x02, 0x02, 0x00, 0x04, 0x0a, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x0a, 0x0b,
+	0x00, 0x0e, 0x0b, 0x03, 0x0d, 0x05, 0x0c, 0x1a, 0x00, 0x0c, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x01, 0x0c, 0x0b, 0x80, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x0f, 0x0d, 0x03,
+	0x10, 0x03, 0x0e, 0x4e, 0x0a, 0x0e, 0x0f, 0x12, 0x00, 0x0f, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x04, 0x0f, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00, 0x01, 0x0f, 0x0b, 0x00, 0x0f, 0x0e, 0x00,
+	0x00, 0x11, 0x0f, 0x03, 0x12, 0x03, 0x10, 0x4e, 0x0d, 0x10, 0x10, 0x16, 0x00, 0x13, 0x11, 0x03,
+	0x14, 0x03, 0x12, 0x12, 0x0c, 0x07, 0x06, 0xc2, 0x00, 0x06, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x77, 0x61, 0x69, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x45, 0x49, 0x4e, 0x54, 0x52, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x73, 0x74, 0x61,
+	0x74, 0x75, 0x73, 0x01, 0x40, 0xef, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x65, 0x78, 0x69,
+	0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x74, 0x6f, 0x70, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x61,
+	0x6c, 0x01, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63,
+	0x6f, 0x72, 0x65, 0x5f, 0x64, 0x75, 0x6d, 0x70, 0x01, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x64, 0x01,
+	0x40, 0xef, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x70, 0x72, 0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x28, 0x4e, 0x00, 0x00, 0x00, 0x99, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0xb4, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x12, 0x22, 0x89, 0x20, 0x40, 0x10, 0x80,
+	0x21, 0x30, 0x99, 0x44, 0xc2, 0x00, 0x80, 0x20, 0x00, 0x04, 0x10, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x70, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6c,
+	0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x77, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x65, 0x78, 0x69, 0x74, 0x5f, 0x73, 0x74, 0x61,
+	0x74, 0x75, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x74, 0x65, 0x72, 0x6d, 0x5f,
+	0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x72,
+	0x6f, 0x63, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x6d, 0x9f,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x10, 0x35, 0xdc, 0x21, 0x08,
+	0x42, 0x10, 0x84, 0x21, 0x04, 0x21, 0x08, 0x42, 0x10, 0x84, 0x20, 0x84, 0x21, 0x08, 0x40, 0x84,
+	0x21, 0x04, 0x21, 0x0a, 0x4b, 0x42, 0x91, 0xa2, 0x14, 0xd1, 0x4d, 0x35, 0x2d, 0x29, 0xa3, 0x1a,
+	0x22, 0x5a, 0x4b, 0x55, 0xb4, 0x4d, 0xb5, 0xb6, 0xa2, 0x69, 0xcd, 0x76, 0xd1, 0x12, 0xd0, 0xf2,
+	0xd0, 0xf2, 0xd0, 0xf2, 0xd0, 0xe0, 0x68, 0x79, 0x68, 0x79, 0x6a, 0x3d, 0x0c, 0xd1, 0x7a, 0x35,
+	0xa5, 0x25, 0xa5, 0x25, 0xa2, 0x6d, 0xa2, 0x65, 0xa5, 0x75, 0x02, 0x60, 0x00, 0x00, 0x00, 0x07,
+	0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x70,
+	0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x74, 0x65, 0x78, 0x69,
+	0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_11[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x00, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x01, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x03, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x02, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x03, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x05, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x04, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x06, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x05, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x07, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x06, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x08, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x07, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x09, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x08, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x0a, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x09, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x0b, 0x00, 0x00, 0x10, 0x01,
+	0xab, 0x00, 0x0a, 0x12, 0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x2e, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00,
+	0x30, 0x80, 0x00, 0x2a, 0x02, 0x00, 0x0b, 0x11, 0x00, 0x0b, 0x11, 0x10, 0xd2, 0x00, 0x0c, 0x12,
+	0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x0b, 0x11, 0x00, 0x0d, 0x11, 0x10, 0xd2, 0x00, 0x10, 0x00,
+	0xb0, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x10, 0x00, 0x08, 0x10, 0x0e, 0x10, 0x18, 0x00, 0x10, 0x00,
+	0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x10, 0xd2, 0x00, 0x0f, 0x12,
+	0x03, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x08, 0x11, 0x00, 0x10, 0x11, 0x10, 0xd2, 0x80, 0x00, 0x12,
+	0x04, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x12, 0x10, 0x03, 0x00, 0x10, 0x05, 0xa5, 0x80, 0x00, 0x06,
+	0x02, 0x80, 0x00, 0x0c, 0x02, 0x00, 0x11, 0x12, 0xad, 0x00, 0x0e, 0x14, 0x00, 0x00, 0x12, 0x01,
+	0xb4, 0x00, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x12, 0x10, 0x9b, 0x00, 0x0b, 0x13,
+	0x00, 0x13, 0x13, 0x12, 0xd2, 0x00, 0x12, 0x14, 0x0b, 0x14, 0x14, 0x14, 0x6e, 0x00, 0x12, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x0e, 0x0d, 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x10,
+	0xd2, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x10, 0x01, 0xb0, 0x7f, 0xff, 0xd3, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x65, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70,
+	0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72,
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72,
+	0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72,
+	0x65, 0x61, 0x64, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72, 0x69,
+	0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78,
+	0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x65, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x70, 0x6c, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x2b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20,
+	0x09, 0x20, 0x50, 0x91, 0x00, 0x40, 0xd0, 0xa2, 0x04, 0x20, 0x22, 0x64, 0x42, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x61, 0x72, 0x67, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
+	0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x79,
+	0x70, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x65, 0x72, 0x72, 0x6e, 0x6f,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x72, 0x6e,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x70, 0x65, 0x72, 0x66, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01,
+	0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x00,
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x61,
+	0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x63, 0x6d, 0x64, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0e, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00,
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x61,
+	0x72, 0x67, 0x76, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+};
+
+static const unsigned char file_12[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0d, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x05, 0x00, 0xab, 0x00, 0x00, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x03,
+	0x00, 0x00, 0x05, 0x00, 0xab, 0x00, 0x01, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04,
+	0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x06, 0x03, 0xc0, 0x80, 0x00, 0x07, 0x04, 0x00, 0x03, 0x08,
+	0x03, 0x80, 0x01, 0x09, 0x04, 0x00, 0x04, 0x0a, 0x03, 0x80, 0x02, 0x0b, 0x04, 0x00, 0x05, 0x0c,
+	0x03, 0x06, 0x07, 0x06, 0xc2, 0x06, 0x02, 0x05, 0x71, 0x00, 0x02, 0x05, 0x00, 0x00, 0x06, 0x02,
+	0xc0, 0x00, 0x07, 0x07, 0x03, 0x00, 0x01, 0x08, 0x98, 0x00, 0x08, 0x09, 0x03, 0x00, 0x02, 0x0a,
+	0x98, 0x04, 0x07, 0x06, 0xc2, 0x06, 0x06, 0x05, 0x71, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x4e, 0x41, 0x4d, 0x45, 0x53, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65,
+	0x6e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x02, 0x01, 0x02, 0x73, 0x00, 0x02, 0x00,
+	0x06, 0x01, 0x03, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x00, 0x03, 0x00, 0xc1, 0x03, 0x04, 0x02,
+	0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x10, 0x73, 0x68, 0x65,
+	0x6c, 0x6c, 0x2f, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0f, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x10, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x06,
+	0x01, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x98,
+	0x00, 0x02, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0xc1, 0x02, 0x01, 0x01, 0x71,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e,
+	0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x01, 0x02, 0xa5, 0x00, 0x00,
+	0x00, 0xce, 0x80, 0x00, 0x11, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05,
+	0x04, 0xd2, 0x02, 0x00, 0x06, 0x6e, 0x80, 0x00, 0x07, 0x04, 0x00, 0x00, 0x08, 0x0b, 0x03, 0x08,
+	0x08, 0x6e, 0x00, 0x04, 0x03, 0xb0, 0x00, 0x04, 0x03, 0x0b, 0x05, 0x00, 0x04, 0x6e, 0x00, 0x00,
+	0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x06, 0x07, 0x06, 0xd2, 0x02, 0x00, 0x08, 0x6e, 0x00, 0x06,
+	0x01, 0xb0, 0x06, 0x04, 0x03, 0x70, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03,
+	0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x02, 0x00, 0x06, 0x6e, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x04,
+	0x02, 0xb0, 0x00, 0x00, 0x01, 0xa8, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69,
+	0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x65, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x45, 0x45, 0x4b, 0x5f, 0x53, 0x45, 0x54, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+	0x2f, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x1d,
+	0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x44, 0x02,
+	0x20, 0x00, 0x00, 0x00, 0x06, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x48, 0xd0, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+	0x69, 0x6e, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x01, 0xc0,
+	0x00, 0x00, 0x04, 0x03, 0x00, 0x01, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x6e, 0x00, 0x05, 0x06, 0x6c,
+	0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x00, 0x03, 0x06, 0x35, 0x00, 0x06, 0x05, 0x00,
+	0x02, 0x04, 0x03, 0xc2, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00,
+	0x05, 0x05, 0x04, 0xd2, 0x00, 0x06, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x02, 0x00,
+	0x00, 0x01, 0x03, 0x00, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2,
+	0x00, 0x02, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x05, 0x03, 0x03, 0x71, 0x00, 0x04, 0x03, 0x0b,
+	0x00, 0x03, 0x05, 0x00, 0x09, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0,
+	0x00, 0x03, 0x00, 0x06, 0x0a, 0x03, 0x03, 0x6e, 0x00, 0x03, 0x05, 0x00, 0x0b, 0x05, 0x04, 0xd2,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x03, 0x01, 0x03, 0x6e, 0x00, 0x03, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4e, 0x41,
+	0x4d, 0x45, 0x53, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x74, 0x65, 0x6d,
+	0x70, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x43,
+	0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x26, 0x00, 0x00,
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x08, 0x90, 0x40, 0x10, 0x12, 0x09,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x43, 0x61, 0x70, 0x74, 0x75,
+	0x72, 0x65, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x65, 0x08, 0x41, 0x12, 0xd0, 0xfa, 0x37, 0x46, 0x68,
+	0xc4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x43,
+	0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_13[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x04, 0x00, 0xab, 0x00, 0x00, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x03,
+	0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x05, 0x02, 0xc0, 0x00, 0x02, 0x06, 0x03, 0x00, 0x01, 0x07,
+	0x98, 0x00, 0x03, 0x08, 0x03, 0x00, 0x02, 0x09, 0x98, 0x04, 0x06, 0x05, 0xc2, 0x05, 0x01, 0x04,
+	0x71, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65,
+	0x6e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x02, 0x01, 0x02, 0x73, 0x00, 0x02, 0x00,
+	0x06, 0x00, 0x04, 0x03, 0x0b, 0x03, 0x03, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x01, 0x05, 0x02,
+	0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72,
+	0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f,
+	0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65,
+	0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x14, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+	0x2f, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0f, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42,
+	0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
+	0x00, 0x30, 0x80, 0x00, 0x09, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02,
+	0x01, 0xd2, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x03, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5f, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65,
+	0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c,
+	0x46, 0x64, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x08, 0x24, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x01, 0x0b,
+	0x00, 0x02, 0x00, 0xc0, 0x00, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9,
+	0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x03, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x5f, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x1b, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x20, 0x69,
+	0x73, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x5f, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65,
+	0x72, 0x61, 0x6c, 0x46, 0x64, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x14, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46,
+	0x64, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x0d, 0x4c, 0xd0, 0xfa, 0x17, 0x44, 0xe8, 0xa4, 0x4c, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65,
+	0x72, 0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_14[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x03, 0x03, 0x98, 0x00, 0x09, 0x00, 0xab, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x09, 0x01,
+	0xb0, 0x00, 0x09, 0x04, 0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x01, 0x0b, 0x03, 0x00, 0x09, 0x01,
+	0xb0, 0x00, 0x09, 0x05, 0x00, 0x00, 0x09, 0x00, 0xab, 0x00, 0x02, 0x0b, 0x03, 0x00, 0x09, 0x01,
+	0xb0, 0x00, 0x09, 0x06, 0x00, 0x03, 0x06, 0x07, 0x6e, 0x04, 0x06, 0x08, 0x6e, 0x00, 0x02, 0x09,
+	0x00, 0x00, 0x0a, 0x02, 0xc0, 0x00, 0x06, 0x0b, 0x03, 0x00, 0x01, 0x0c, 0x98, 0x00, 0x07, 0x0d,
+	0x03, 0x00, 0x02, 0x0e, 0x98, 0x04, 0x0b, 0x0a, 0xc2, 0x0a, 0x05, 0x09, 0x71, 0x00, 0x03, 0x09,
+	0x00, 0x00, 0x0a, 0x0a, 0xc0, 0x00, 0x08, 0x0b, 0x03, 0x00, 0x04, 0x0c, 0x98, 0x00, 0x09, 0x0d,
+	0x03, 0x00, 0x05, 0x0e, 0x98, 0x00, 0x0a, 0x0f, 0x03, 0x00, 0x06, 0x10, 0x98, 0x00, 0x0b, 0x11,
+	0x03, 0x00, 0x07, 0x12, 0x98, 0x00, 0x0c, 0x13, 0x03, 0x00, 0x08, 0x14, 0x98, 0x00, 0x0d, 0x15,
+	0x03, 0x00, 0x09, 0x16, 0x98, 0x00, 0x0e, 0x17, 0x03, 0x00, 0x0a, 0x18, 0x98, 0x00, 0x0f, 0x19,
+	0x03, 0x00, 0x0b, 0x1a, 0x98, 0x00, 0x10, 0x1b, 0x03, 0x00, 0x0c, 0x1c, 0x98, 0x00, 0x11, 0x1d,
+	0x03, 0x00, 0x0d, 0x1e, 0x98, 0x14, 0x0b, 0x0a, 0xc2, 0x0a, 0x05, 0x09, 0x71, 0x00, 0x03, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70,
+	0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x69, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x02, 0x64, 0x6f, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x6f, 0x53,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64,
+	0x50, 0x72, 0x6f, 0x63, 0x73, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
+	0x63, 0x74, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x5f, 0x73, 0x65, 0x74, 0x75, 0x70, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x6c, 0x61, 0x75, 0x6e, 0x63,
+	0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72,
+	0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x02,
+	0x00, 0xc0, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x4e, 0x6f, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x65, 0x64,
+	0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65,
+	0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00, 0xc0, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0xb2,
+	0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72,
+	0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4e, 0x6f, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x65,
+	0x6d, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x02, 0x71, 0x00, 0x02,
+	0x00, 0x06, 0x02, 0x01, 0x02, 0x73, 0x00, 0x02, 0x00, 0x06, 0x01, 0x03, 0x02, 0x71, 0x00, 0x02,
+	0x00, 0x06, 0x00, 0x05, 0x03, 0x0b, 0x03, 0x04, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x00, 0x03,
+	0x00, 0xc0, 0x03, 0x06, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x00, 0x03, 0x00, 0xc0, 0x03, 0x07,
+	0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x00, 0x03, 0x00, 0xc0, 0x03, 0x08, 0x02, 0x71, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f,
+	0x61, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61,
+	0x72, 0x67, 0x76, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5f,
+	0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72,
+	0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x12, 0x41, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01,
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f,
+	0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00,
+	0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x5f, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x07, 0x01, 0xc1, 0x80, 0x00, 0x08, 0x04, 0x00, 0x09,
+	0x00, 0x06, 0x02, 0x08, 0x07, 0xc6, 0x00, 0x07, 0x09, 0x00, 0x00, 0x09, 0x08, 0xd2, 0x00, 0x0a,
+	0x00, 0x06, 0x00, 0x0a, 0x0c, 0x00, 0x01, 0x0c, 0x0b, 0xd2, 0x00, 0x0b, 0x00, 0xb0, 0x00, 0x0b,
+	0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00,
+	0x1e, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x01, 0x04, 0x02, 0x00, 0x07, 0x6e, 0x07, 0x01,
+	0x07, 0x28, 0x00, 0x07, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x17, 0x02, 0x00, 0x01,
+	0x07, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x02, 0x6c, 0x00, 0x07,
+	0x00, 0x06, 0x03, 0x07, 0x07, 0x6e, 0x00, 0x07, 0x09, 0x00, 0x04, 0x09, 0x08, 0xd2, 0x05, 0x02,
+	0x0a, 0x6e, 0x06, 0x0a, 0x0a, 0x6e, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x09, 0x00, 0x08, 0x09, 0x08,
+	0x08, 0x18, 0x00, 0x08, 0x00, 0x30, 0x7f, 0xff, 0xf1, 0x02, 0x00, 0x07, 0x07, 0x0b, 0x00, 0x08,
+	0x00, 0xc0, 0x05, 0x02, 0x09, 0x6e, 0x06, 0x09, 0x09, 0x6e, 0x09, 0x08, 0x09, 0x35, 0x00, 0x07,
+	0x01, 0xb2, 0x00, 0x07, 0x00, 0xa9, 0x7f, 0xff, 0xe9, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x07,
+	0x00, 0xc1, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x07, 0x02, 0xa5, 0x00, 0x00,
+	0x00, 0xce, 0x80, 0x00, 0x5c, 0x02, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x14, 0x02, 0x80, 0x00,
+	0x06, 0x02, 0x80, 0x00, 0x01, 0x04, 0x02, 0x00, 0x09, 0x6e, 0x09, 0x01, 0x09, 0x28, 0x00, 0x09,
+	0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0d, 0x02, 0x00, 0x01, 0x09, 0x7a, 0x7f, 0xff,
+	0xf9, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x0b,
+	0x0b, 0x6c, 0x00, 0x0b, 0x0d, 0x00, 0x09, 0x0d, 0x0c, 0xd2, 0x00, 0x0c, 0x00, 0xb0, 0x00, 0x0c,
+	0x0b, 0x00, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x03, 0x00, 0x7f, 0xff, 0xf3, 0x02, 0x00, 0x01,
+	0x00, 0xa2, 0x00, 0x02, 0x00, 0xa1, 0x80, 0x00, 0x10, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00,
+	0x01, 0x04, 0x02, 0x00, 0x09, 0x6e, 0x09, 0x01, 0x09, 0x28, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x09, 0x02, 0x00, 0x01, 0x09, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x00,
+	0x09, 0x00, 0x01, 0x09, 0x02, 0x6c, 0x00, 0x02, 0x0a, 0x00, 0x0a, 0x0a, 0x09, 0xd2, 0x00, 0x00,
+	0x0b, 0x98, 0x00, 0x09, 0x01, 0xb0, 0x7f, 0xff, 0xf7, 0x02, 0x00, 0x02, 0x00, 0xa2, 0x02, 0x00,
+	0x09, 0x6e, 0x0b, 0x09, 0x04, 0x3a, 0x00, 0x03, 0x00, 0xa1, 0x80, 0x00, 0x0e, 0x02, 0x80, 0x00,
+	0x05, 0x02, 0x80, 0x00, 0x01, 0x04, 0x04, 0x01, 0x09, 0x28, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00, 0x01, 0x09, 0x7a, 0x7f, 0xff, 0xfa, 0x02, 0x00, 0x00,
+	0x09, 0x00, 0x01, 0x09, 0x09, 0x6c, 0x00, 0x09, 0x0b, 0x00, 0x0c, 0x0b, 0x0a, 0xd2, 0x00, 0x0a,
+	0x00, 0xb0, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x03, 0x00, 0xa2, 0x00, 0x00, 0x09, 0x00, 0x04, 0x09,
+	0x09, 0x6c, 0x00, 0x09, 0x0b, 0x00, 0x0c, 0x0b, 0x0a, 0xd2, 0x00, 0x0a, 0x00, 0xb0, 0x00, 0x0a,
+	0x05, 0x00, 0x00, 0x09, 0x00, 0x06, 0x00, 0x09, 0x0b, 0x00, 0x0d, 0x0b, 0x0a, 0xd2, 0x00, 0x0a,
+	0x00, 0xb0, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x04, 0x00, 0xa1, 0x80, 0x00, 0x0f, 0x02, 0x80, 0x00,
+	0x06, 0x02, 0x80, 0x00, 0x01, 0x04, 0x02, 0x06, 0x09, 0x6e, 0x09, 0x01, 0x09, 0x28, 0x00, 0x09,
+	0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00, 0x01, 0x09, 0x7a, 0x7f, 0xff,
+	0xf9, 0x02, 0x00, 0x06, 0x09, 0x00, 0x01, 0x09, 0x09, 0x6c, 0x00, 0x09, 0x0b, 0x00, 0x0e, 0x0b,
+	0x0a, 0xd2, 0x00, 0x0a, 0x00, 0xb0, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x04, 0x00, 0xa2, 0x00, 0x05,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00,
+	0x06, 0x02, 0x80, 0x00, 0x01, 0x04, 0x02, 0x03, 0x09, 0x6e, 0x09, 0x01, 0x09, 0x28, 0x00, 0x09,
+	0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x01, 0x09, 0x7a, 0x7f, 0xff,
+	0xf9, 0x02, 0x00, 0x0f, 0x09, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x0e, 0x0b, 0x0a, 0xd2, 0x00, 0x03,
+	0x0c, 0x00, 0x01, 0x0c, 0x0c, 0x6c, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0a, 0x02, 0xb0, 0x7f, 0xff,
+	0xf6, 0x02, 0x00, 0x05, 0x00, 0xa2, 0x00, 0x00, 0x07, 0xa8, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x12, 0x5f, 0x63,
+	0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x72, 0x6f, 0x63, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x13, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f,
+	0x75, 0x6e, 0x64, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x12, 0x5f, 0x73, 0x65, 0x74, 0x75, 0x70,
+	0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x5f, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5f,
+	0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x01, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x0b,
+	0x03, 0x08, 0x08, 0x6e, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0xc0,
+	0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1e, 0x02, 0x80, 0x00, 0x06, 0x02,
+	0x80, 0x00, 0x02, 0x04, 0x04, 0x00, 0x05, 0x6e, 0x05, 0x02, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32,
+	0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x17, 0x02, 0x00, 0x02, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02,
+	0x00, 0x00, 0x05, 0x00, 0x02, 0x05, 0x03, 0x6c, 0x00, 0x02, 0x05, 0x0b, 0x03, 0x05, 0x05, 0x6e,
+	0x03, 0x05, 0x04, 0x6c, 0x00, 0x05, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x06, 0x07, 0x06, 0xd2,
+	0x00, 0x04, 0x08, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x06, 0x02, 0xb0, 0x00, 0x05, 0x05, 0x0b,
+	0x00, 0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x04, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0,
+	0x00, 0x01, 0x05, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x07, 0x00, 0x09, 0x07, 0x06, 0x05, 0x70,
+	0x7f, 0xff, 0xe9, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x17, 0x02,
+	0x80, 0x00, 0x07, 0x02, 0x80, 0x00, 0x02, 0x04, 0x00, 0x08, 0x05, 0x0b, 0x04, 0x05, 0x05, 0x6e,
+	0x05, 0x02, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0f, 0x02,
+	0x00, 0x02, 0x05, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x08, 0x05, 0x0b, 0x02, 0x05, 0x03, 0x6c,
+	0x00, 0x01, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x30,
+	0x7f, 0xff, 0xf7, 0x02, 0x00, 0x05, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2,
+	0x00, 0x03, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x7f, 0xff, 0xf1, 0x02, 0x00, 0x01, 0x00, 0xa2,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x68, 0x69,
+	0x6c, 0x64, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x72, 0x65, 0x64, 0x69,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x75, 0x70, 0x32, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x70, 0x65, 0x6e, 0x46,
+	0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68,
+	0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x23, 0x45,
+	0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x00, 0x00, 0x02, 0x02, 0x40, 0x42, 0x09, 0x04, 0x04, 0x88, 0x0a, 0x00, 0x84, 0x84, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x3f, 0xa6, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c,
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x36,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x21, 0x20, 0x04, 0x01, 0x2a, 0x48, 0x12, 0x02, 0x00, 0x00,
+	0x80, 0xa0, 0x10, 0x96, 0x97, 0x42, 0x82, 0x40, 0x80, 0x84, 0x82, 0x80, 0x40, 0x02, 0x02, 0x13,
+	0x02, 0x40, 0x40, 0x10, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50,
+	0x72, 0x6f, 0x63, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x09, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x70, 0x65, 0x6e, 0x46, 0x64, 0x73, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x6c, 0x61, 0x73, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x06, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x72,
+	0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x1e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x02, 0x6e, 0x00, 0x01, 0x04, 0x0b, 0x04,
+	0x01, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x04, 0x01, 0xc1, 0x80, 0x00, 0x05, 0x04, 0x80, 0x01, 0x06, 0x04, 0x02, 0x05, 0x04, 0xc6, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x04, 0x01, 0xc1, 0x80, 0x00, 0x05, 0x04, 0x00, 0x00, 0x06, 0x00, 0x02,
+	0x05, 0x04, 0xc6, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x04, 0x01, 0x04, 0x18, 0x00,
+	0x04, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x80, 0x00, 0x39, 0x02, 0x00, 0x01, 0x04, 0x99, 0x04,
+	0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x35, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05,
+	0x05, 0x04, 0xd2, 0x00, 0x06, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x0a, 0x02, 0x00, 0x02, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x08,
+	0x07, 0x06, 0xd2, 0x80, 0x02, 0x08, 0x04, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x09, 0x07, 0x03, 0x00,
+	0x04, 0x02, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x80, 0x00, 0x25, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05,
+	0x05, 0x04, 0xd2, 0x00, 0x0a, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x0a, 0x02, 0x00, 0x02, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x08,
+	0x07, 0x06, 0xd2, 0x80, 0x02, 0x08, 0x04, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x0b, 0x07, 0x03, 0x00,
+	0x04, 0x02, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x80, 0x00, 0x15, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05,
+	0x05, 0x04, 0xd2, 0x00, 0x0c, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x0a, 0x02, 0x00, 0x02, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x08,
+	0x07, 0x06, 0xd2, 0x80, 0x01, 0x08, 0x04, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x0d, 0x07, 0x03, 0x00,
+	0x04, 0x02, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x07,
+	0x05, 0x04, 0xd2, 0x00, 0x01, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00,
+	0x04, 0x00, 0x08, 0x04, 0x01, 0x04, 0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x17, 0x02, 0x00,
+	0x00, 0x00, 0xa1, 0x80, 0x00, 0x13, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x0e,
+	0x00, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80,
+	0x00, 0x0c, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f,
+	0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x00, 0x02, 0x07, 0x00, 0x07,
+	0x07, 0x06, 0xd2, 0x00, 0x10, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x06, 0x05, 0x04, 0x70, 0x7f,
+	0xff, 0xf4, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x80, 0x00, 0xb3, 0x02, 0x11, 0x01, 0x04, 0x6e, 0x12,
+	0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x01, 0x00, 0xa1, 0x80,
+	0x00, 0x0f, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x0e, 0x00, 0x04, 0x6e, 0x04,
+	0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00,
+	0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00,
+	0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x01, 0x05, 0x04, 0x70, 0x7f, 0xff, 0xf8, 0x02, 0x00,
+	0x01, 0x00, 0xa2, 0x80, 0x00, 0x9c, 0x02, 0x00, 0x01, 0x04, 0x99, 0x13, 0x04, 0x05, 0x1a, 0x00,
+	0x05, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02, 0x00, 0x14, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x15,
+	0x08, 0x07, 0xd2, 0x00, 0x01, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x0e, 0x07, 0x07, 0x6e, 0x16,
+	0x07, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x18, 0x02, 0x00, 0x02, 0x05, 0x00, 0x17,
+	0x05, 0x04, 0xd2, 0x00, 0x01, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00,
+	0x02, 0x00, 0xa1, 0x80, 0x00, 0x0f, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x0e,
+	0x00, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80,
+	0x00, 0x08, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f,
+	0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x01, 0x05, 0x04, 0x70, 0x7f,
+	0xff, 0xf8, 0x02, 0x00, 0x02, 0x00, 0xa2, 0x80, 0x00, 0x77, 0x02, 0x00, 0x02, 0x04, 0x0b, 0x00,
+	0x04, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00,
+	0x05, 0x06, 0x00, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x04, 0x02, 0x00, 0x01, 0x07, 0x00, 0x16,
+	0x07, 0x07, 0x6e, 0x00, 0x07, 0x07, 0x99, 0x04, 0x07, 0x06, 0x1a, 0x00, 0x06, 0x00, 0x30, 0x80,
+	0x00, 0x18, 0x02, 0x00, 0x03, 0x00, 0xa1, 0x80, 0x00, 0x14, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80,
+	0x00, 0x03, 0x04, 0x0e, 0x00, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80,
+	0x00, 0x03, 0x02, 0x80, 0x00, 0x0d, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00,
+	0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x00,
+	0x02, 0x07, 0x00, 0x18, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x08, 0x00, 0x16, 0x08, 0x08, 0x6e, 0x00,
+	0x06, 0x01, 0xb0, 0x06, 0x05, 0x04, 0x70, 0x7f, 0xff, 0xf3, 0x02, 0x00, 0x03, 0x00, 0xa2, 0x80,
+	0x00, 0x51, 0x02, 0x11, 0x01, 0x04, 0x6e, 0x19, 0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80,
+	0x00, 0x1a, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x16,
+	0x05, 0x05, 0x6e, 0x01, 0x05, 0x04, 0x70, 0x00, 0x04, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x80, 0x01, 0x03, 0x04, 0x0e, 0x00, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00,
+	0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x03,
+	0x05, 0x05, 0x6c, 0x00, 0x00, 0x06, 0x00, 0x16, 0x06, 0x06, 0x6e, 0x06, 0x05, 0x04, 0x70, 0x7f,
+	0xff, 0xf6, 0x02, 0x00, 0x04, 0x00, 0xa2, 0x80, 0x00, 0x33, 0x02, 0x11, 0x01, 0x04, 0x6e, 0x1a,
+	0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x05, 0x00, 0xa1, 0x80,
+	0x00, 0x0f, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x0e, 0x00, 0x04, 0x6e, 0x04,
+	0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00,
+	0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00,
+	0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6c, 0x01, 0x05, 0x04, 0x70, 0x7f, 0xff, 0xf8, 0x02, 0x00,
+	0x05, 0x00, 0xa2, 0x80, 0x00, 0x1c, 0x02, 0x00, 0x01, 0x04, 0x99, 0x1b, 0x04, 0x04, 0x1a, 0x00,
+	0x04, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x06, 0x00, 0xa1, 0x80, 0x00, 0x0f, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x0e, 0x00, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00,
+	0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x00, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x04, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x03,
+	0x05, 0x05, 0x6c, 0x01, 0x05, 0x04, 0x70, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x06, 0x00, 0xa2, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x1c, 0x04, 0x0b, 0x00, 0x05, 0x00, 0xc0, 0x01, 0x1d, 0x06, 0x35, 0x00,
+	0x04, 0x01, 0xb2, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e,
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61,
+	0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x74, 0x61,
+	0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x3a, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x2b, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x64, 0x65,
+	0x76, 0x2f, 0x6e, 0x75, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f, 0x61, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x68, 0x65, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x72, 0x6f,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x20, 0x55, 0x6e, 0x73, 0x75, 0x70,
+	0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
+	0x6f, 0x6e, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f,
+	0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x67, 0x28, 0x01, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x50, 0x88, 0x09, 0x01, 0x01, 0x62, 0x42, 0x01, 0x00, 0x10, 0x04, 0x00,
+	0x00, 0x80, 0x20, 0x02, 0x20, 0x34, 0x30, 0x10, 0x02, 0x00, 0x21, 0x40, 0x20, 0x00, 0x80, 0x85,
+	0x00, 0x02, 0x00, 0x48, 0x08, 0x08, 0x50, 0x00, 0x02, 0x00, 0x02, 0x00, 0x10, 0xa0, 0x90, 0x14,
+	0x02, 0x00, 0x85, 0x00, 0x80, 0x00, 0x80, 0x85, 0x00, 0x80, 0x10, 0x10, 0x88, 0x0a, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0xb0, 0x01, 0x03, 0x01, 0x35, 0x04,
+	0x01, 0x01, 0x36, 0x00, 0x02, 0x00, 0x06, 0x05, 0x02, 0x03, 0x6e, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x04, 0x02, 0x00, 0x04, 0x00, 0x06, 0x05, 0x04, 0x04, 0x6e, 0x04, 0x06, 0x03, 0x35, 0x80,
+	0x00, 0x01, 0x02, 0x00, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x34, 0x08, 0x01, 0x01, 0x36, 0x00,
+	0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x76,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6f, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x50, 0x72, 0x6f, 0x63, 0x7b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2c, 0x20, 0x70,
+	0x69, 0x64, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+	0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00,
+	0x39, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x20, 0x01, 0x28, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x03, 0x00,
+	0x06, 0x02, 0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77,
+	0x61, 0x69, 0x74, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f,
+	0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x48,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x05, 0x00,
+	0xc1, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x01, 0x07, 0x06,
+	0xd2, 0x00, 0x08, 0x00, 0x06, 0x02, 0x08, 0x08, 0x6e, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1e, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x02,
+	0x04, 0x03, 0x01, 0x05, 0x6e, 0x05, 0x02, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x17, 0x02, 0x00, 0x02, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x01, 0x05,
+	0x00, 0x02, 0x05, 0x03, 0x6c, 0x00, 0x05, 0x00, 0x06, 0x02, 0x05, 0x05, 0x6e, 0x03, 0x05, 0x04,
+	0x6c, 0x04, 0x04, 0x05, 0x6e, 0x05, 0x05, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x7f, 0xff, 0xf5,
+	0x02, 0x00, 0x00, 0x06, 0x00, 0x06, 0x06, 0x05, 0xd2, 0x00, 0x04, 0x07, 0x00, 0x00, 0x05, 0x01,
+	0xb0, 0x00, 0x00, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00, 0x04, 0x08, 0x00, 0x08, 0x08, 0x07,
+	0xd2, 0x00, 0x07, 0x00, 0xb0, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x00, 0x7f, 0xff, 0xe9,
+	0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f, 0x61, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x50, 0x72,
+	0x6f, 0x63, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73,
+	0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16,
+	0x2c, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x02, 0x40, 0x42,
+	0x09, 0x10, 0x20, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x39, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x05, 0x00, 0xc1, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x01, 0x07, 0x06, 0xd2, 0x00, 0x08,
+	0x00, 0x06, 0x02, 0x08, 0x08, 0x6e, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xa1, 0x80, 0x00, 0x2b, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x03, 0x01,
+	0x05, 0x6e, 0x05, 0x02, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00,
+	0x24, 0x02, 0x00, 0x02, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x01, 0x05, 0x00, 0x02, 0x05,
+	0x03, 0x6c, 0x00, 0x05, 0x00, 0x06, 0x02, 0x05, 0x05, 0x6e, 0x03, 0x05, 0x04, 0x6c, 0x04, 0x04,
+	0x05, 0x6e, 0x00, 0x05, 0x05, 0x99, 0x05, 0x05, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00,
+	0x0c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x06, 0x06, 0x05, 0xd2, 0x00, 0x04, 0x07, 0x00, 0x00, 0x05,
+	0x01, 0xb0, 0x00, 0x05, 0x05, 0x0d, 0x00, 0x05, 0x00, 0x30, 0x7f, 0xff, 0xed, 0x02, 0x00, 0x00,
+	0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00, 0x04, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x7f, 0xff,
+	0xe8, 0x02, 0x08, 0x04, 0x05, 0x6e, 0x09, 0x05, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x7f, 0xff,
+	0xe4, 0x02, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x06, 0x05, 0xd2, 0x00, 0x04, 0x08, 0x00, 0x0b, 0x08,
+	0x07, 0xd2, 0x00, 0x07, 0x00, 0xb0, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x00, 0x7f, 0xff,
+	0xdc, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65,
+	0x79, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x52, 0x65,
+	0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x18, 0x39, 0x00, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x48, 0x02, 0x40, 0x42, 0x09, 0x08, 0x02, 0x04, 0x84, 0x81, 0x29, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x06, 0x00, 0xc1, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x06, 0x03, 0x00,
+	0x06, 0x05, 0xa5, 0x80, 0x00, 0x71, 0x02, 0x80, 0x00, 0x88, 0x02, 0x00, 0x00, 0x08, 0x0b, 0x00,
+	0x08, 0x0a, 0x00, 0x01, 0x0a, 0x09, 0xd2, 0x00, 0x0b, 0x00, 0x06, 0x02, 0x0b, 0x0b, 0x6e, 0x00,
+	0x09, 0x01, 0xb0, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x65, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x03, 0x01, 0x08, 0x6e, 0x08, 0x02, 0x08, 0x28, 0x00,
+	0x08, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x5e, 0x02, 0x00, 0x02, 0x08, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x00, 0x01, 0x08, 0x00, 0x02, 0x08, 0x03, 0x6c, 0x00, 0x08, 0x00, 0x06, 0x02,
+	0x08, 0x08, 0x6e, 0x03, 0x08, 0x04, 0x6c, 0x04, 0x04, 0x08, 0x6e, 0x05, 0x08, 0x08, 0x1a, 0x00,
+	0x08, 0x00, 0x30, 0x80, 0x00, 0x2b, 0x02, 0x02, 0x04, 0x08, 0x6e, 0x06, 0x08, 0x08, 0x6e, 0x00,
+	0x08, 0x00, 0x30, 0x80, 0x00, 0x0c, 0x02, 0x00, 0x07, 0x08, 0x0b, 0x00, 0x09, 0x00, 0xc0, 0x04,
+	0x08, 0x0a, 0x35, 0x09, 0x0a, 0x0a, 0x36, 0x02, 0x04, 0x0b, 0x6e, 0x06, 0x0b, 0x0b, 0x6e, 0x0b,
+	0x0a, 0x0a, 0x34, 0x0a, 0x0a, 0x0a, 0x36, 0x00, 0x0c, 0x00, 0x06, 0x0c, 0x0a, 0x0a, 0x34, 0x00,
+	0x08, 0x01, 0xb2, 0x00, 0x08, 0x00, 0xa9, 0x00, 0x0b, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0c,
+	0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x05, 0x00, 0x00, 0x08, 0x00, 0x06, 0x0d,
+	0x08, 0x08, 0x6e, 0x00, 0x03, 0x09, 0x00, 0x00, 0x05, 0x0a, 0x00, 0x0e, 0x0a, 0x0a, 0x6e, 0x0a,
+	0x09, 0x08, 0x70, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x09, 0x08, 0xd2, 0x00, 0x0a, 0x00, 0x06, 0x0d,
+	0x0a, 0x0a, 0x6e, 0x03, 0x0a, 0x0a, 0x6c, 0x00, 0x08, 0x01, 0xb0, 0x0d, 0x04, 0x08, 0x6e, 0x00,
+	0x05, 0x09, 0x00, 0x06, 0x09, 0x09, 0x6e, 0x09, 0x06, 0x08, 0x71, 0x00, 0x00, 0x09, 0x00, 0x0f,
+	0x09, 0x08, 0xd2, 0x0d, 0x04, 0x0a, 0x6e, 0x06, 0x0a, 0x0a, 0x6e, 0x00, 0x08, 0x01, 0xb0, 0x7f,
+	0xff, 0xca, 0x02, 0x10, 0x04, 0x08, 0x6e, 0x00, 0x08, 0x08, 0x99, 0x11, 0x08, 0x08, 0x1a, 0x00,
+	0x08, 0x00, 0x30, 0x80, 0x00, 0x0f, 0x02, 0x00, 0x08, 0x00, 0x06, 0x0d, 0x08, 0x08, 0x6e, 0x00,
+	0x03, 0x09, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x10, 0x0b, 0x0a, 0xd2, 0x00, 0x03, 0x0c, 0x00, 0x00,
+	0x0a, 0x01, 0xb0, 0x0a, 0x09, 0x08, 0x70, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x09, 0x08, 0xd2, 0x00,
+	0x0a, 0x00, 0x06, 0x0d, 0x0a, 0x0a, 0x6e, 0x03, 0x0a, 0x0a, 0x6c, 0x00, 0x08, 0x01, 0xb0, 0x7f,
+	0xff, 0xb6, 0x02, 0x00, 0x04, 0x08, 0x99, 0x12, 0x08, 0x08, 0x1a, 0x00, 0x08, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x08, 0x00, 0x06, 0x0d, 0x08, 0x08, 0x6e, 0x00, 0x03, 0x09, 0x00, 0x04,
+	0x09, 0x08, 0x70, 0x7f, 0xff, 0xad, 0x02, 0x00, 0x07, 0x08, 0x0b, 0x00, 0x09, 0x00, 0xc0, 0x03,
+	0x13, 0x0a, 0x35, 0x14, 0x0a, 0x0a, 0x36, 0x00, 0x0b, 0x00, 0x06, 0x0b, 0x0a, 0x0a, 0x34, 0x15,
+	0x0a, 0x0a, 0x36, 0x04, 0x0a, 0x0a, 0x34, 0x00, 0x08, 0x01, 0xb2, 0x00, 0x08, 0x00, 0xa9, 0x7f,
+	0xff, 0xa2, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x16, 0x06, 0x9b, 0x00,
+	0x01, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x03,
+	0x00, 0x08, 0x6e, 0x08, 0x02, 0x08, 0x28, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80,
+	0x00, 0x0a, 0x02, 0x00, 0x02, 0x08, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x0b, 0x08, 0x0b, 0x00,
+	0x08, 0x0a, 0x00, 0x17, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x0b, 0x0b, 0x6c, 0x00,
+	0x0c, 0x00, 0x0a, 0x00, 0x09, 0x02, 0xb0, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x01, 0x00, 0xa2, 0x00,
+	0x16, 0x08, 0x0b, 0x00, 0x08, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x70, 0x69, 0x70,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x72, 0x6f, 0x63, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	0x20, 0x73, 0x74, 0x64, 0x69, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x72, 0x65, 0x64,
+	0x69, 0x72, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e,
+	0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x55, 0x6e, 0x73, 0x75, 0x70, 0x70,
+	0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x64, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x6f,
+	0x66, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x72,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f,
+	0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x3f, 0x90, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00,
+	0x3a, 0x00, 0x00, 0x00, 0x48, 0x80, 0x04, 0x80, 0x84, 0x12, 0x20, 0x42, 0x62, 0x08, 0x84, 0x28,
+	0x24, 0x10, 0x00, 0x48, 0x80, 0x80, 0x40, 0x08, 0x04, 0x04, 0x08, 0x84, 0xc4, 0x22, 0x21, 0x28,
+	0x09, 0x00, 0x40, 0x10, 0x94, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x70, 0x65, 0x6e, 0x46,
+	0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x64, 0x73, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x66, 0x64,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x04, 0x70, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05,
+	0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x00, 0x06, 0x98, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x02,
+	0x00, 0x00, 0x03, 0x00, 0x06, 0x02, 0x02, 0x03, 0x71, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x66, 0x6f, 0x72, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00,
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x00, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0, 0x00,
+	0x01, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00,
+	0x03, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x04, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x03, 0x0b, 0x02,
+	0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x01, 0xd2, 0x00, 0x01, 0x03, 0x0b, 0x06, 0x03, 0x03, 0x6e, 0x07, 0x03, 0x03, 0x6e, 0x00,
+	0x01, 0x04, 0x0b, 0x06, 0x04, 0x04, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x80,
+	0x01, 0x07, 0x04, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x05, 0x01, 0xc0, 0x00,
+	0x09, 0x06, 0x03, 0x00, 0x01, 0x07, 0x0b, 0x0a, 0x07, 0x07, 0x6e, 0x02, 0x06, 0x05, 0xc2, 0x00,
+	0x01, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x65, 0x74, 0x75,
+	0x70, 0x43, 0x42, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x6c, 0x66, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x5f, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x63, 0x68, 0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x78, 0x65,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5f, 0x65, 0x6e, 0x76, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f,
+	0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x23, 0x00, 0x00, 0x00, 0xd8,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x21, 0x42, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x11, 0x0d, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x49,
+	0xa2, 0x8a, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x65, 0x74, 0x75, 0x70, 0x43, 0x42, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x6c, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x03, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x68,
+	0x65, 0x6c, 0x6c, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x32, 0x32,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x08, 0x13, 0x1a, 0x29,
+	0xa1, 0xe7, 0x44, 0x4a, 0x34, 0xab, 0x44, 0x56, 0x8d, 0xad, 0x13, 0xb2, 0xb5, 0xb6, 0xd0, 0xd1,
+	0x1a, 0x27, 0x44, 0xce, 0x88, 0xd2, 0x1a, 0x27, 0x4a, 0x69, 0x1d, 0x6f, 0xa3, 0xb4, 0x9a, 0x26,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x52, 0x65, 0x64,
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72,
+	0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69,
+	0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff,
+};
+
+static const unsigned char file_15[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x0c, 0x00,
+	0xab, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x0c, 0x00,
+	0xab, 0x00, 0x01, 0x0e, 0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x0c, 0x00,
+	0xab, 0x00, 0x02, 0x0e, 0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x0c, 0x00,
+	0xab, 0x00, 0x03, 0x0e, 0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x05, 0x00, 0x04, 0x05, 0x06,
+	0x6e, 0x05, 0x05, 0x07, 0x6e, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x06, 0x0e, 0x03, 0x00, 0x0c, 0x01,
+	0xb0, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x07, 0x0e, 0x03, 0x00, 0x0c, 0x01,
+	0xb0, 0x00, 0x0c, 0x09, 0x00, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x08, 0x0e, 0x03, 0x00, 0x0c, 0x01,
+	0xb0, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0xc0, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x00, 0x0d, 0x98, 0x0d, 0x09, 0x0c, 0x71, 0x09, 0x0b, 0x0b, 0x6e, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x01, 0x0d, 0x98, 0x0d, 0x0a, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x02, 0x0d,
+	0x98, 0x0d, 0x0b, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x03, 0x0d, 0x98, 0x0d, 0x0c, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x04, 0x0d, 0x98, 0x0d, 0x0d, 0x0c, 0x71, 0x00, 0x0b, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x2e, 0x2f, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x2e, 0x2f, 0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46,
+	0x64, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2e, 0x2f, 0x50, 0x72, 0x6f, 0x63, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x07, 0x63, 0x61, 0x70,
+	0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x68, 0x65, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x65, 0x61, 0x72, 0x63,
+	0x68, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14,
+	0x0b, 0x80, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02,
+	0x02, 0x6e, 0x02, 0x02, 0x02, 0x22, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x14, 0x02, 0x00, 0x00,
+	0x00, 0xa1, 0x80, 0x00, 0x10, 0x02, 0x80, 0x00, 0x07, 0x02, 0x80, 0x00, 0x01, 0x04, 0x00, 0x00,
+	0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x02, 0x28, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x08, 0x02, 0x00, 0x01, 0x02, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x0b, 0x01, 0x04, 0x04, 0x6c, 0x00, 0x02,
+	0x01, 0xb0, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x80, 0x00, 0x1d, 0x02, 0x00, 0x00,
+	0x02, 0x0b, 0x04, 0x02, 0x02, 0x6e, 0x00, 0x02, 0x02, 0x99, 0x05, 0x02, 0x02, 0x1a, 0x00, 0x02,
+	0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x00, 0x03, 0x03, 0x02, 0xd2, 0x00, 0x00,
+	0x04, 0x0b, 0x04, 0x04, 0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x80, 0x00, 0x11, 0x02, 0x00, 0x06,
+	0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x07, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x0b, 0x04, 0x05,
+	0x05, 0x6e, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00,
+	0x02, 0x0b, 0x04, 0x02, 0x00, 0x6e, 0x80, 0x00, 0x06, 0x02, 0x00, 0x08, 0x02, 0x0b, 0x00, 0x03,
+	0x00, 0xc0, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x09, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02,
+	0x00, 0xa9, 0x00, 0x0a, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x0b, 0x04, 0x0b, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x02, 0x02, 0xb3, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x41, 0x72,
+	0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x13, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
+	0x6e, 0x74, 0x73, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x19, 0x3f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x48, 0x08, 0x00, 0x80, 0x84, 0x01, 0x01, 0x00, 0x10, 0x88, 0x05, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x02, 0x00, 0xc0,
+	0x00, 0x01, 0x03, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0xb3, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x03,
+	0x00, 0xc0, 0x00, 0x01, 0x04, 0x0b, 0x00, 0x00, 0x05, 0x98, 0x00, 0x02, 0x02, 0xb3, 0x00, 0x02,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65, 0x6d,
+	0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0xad,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0b,
+	0x00, 0x02, 0x02, 0x0d, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x0b, 0x02, 0x02, 0x00, 0x02, 0x1a,
+	0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x03, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30,
+	0x80, 0x00, 0x03, 0x02, 0x00, 0x04, 0x02, 0x03, 0x00, 0x01, 0x02, 0x9b, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x05, 0x02, 0x03, 0x00, 0x01, 0x02, 0x9b, 0x00, 0x06, 0x01, 0x03, 0x07, 0x00, 0x02, 0x1a,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x08, 0x01, 0x03, 0x80, 0x00, 0x07, 0x02,
+	0x02, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x01, 0x02, 0x03, 0x00, 0x02, 0x1a,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x09, 0x01, 0x03, 0x00, 0x00, 0x00, 0xa1,
+	0x80, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0xce, 0x00, 0x01, 0x02, 0x0b, 0x05, 0x02, 0x03, 0x1a,
+	0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x0a, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00,
+	0x0b, 0x06, 0x05, 0xd2, 0x00, 0x0c, 0x07, 0x0b, 0x00, 0x01, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb1,
+	0x00, 0x05, 0x00, 0x9d, 0x80, 0x00, 0x03, 0x02, 0x0d, 0x02, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30,
+	0x80, 0x00, 0x07, 0x02, 0x00, 0x0a, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x0e, 0x06, 0x05, 0xd2,
+	0x00, 0x0c, 0x07, 0x0b, 0x00, 0x05, 0x01, 0xb1, 0x00, 0x05, 0x00, 0x9d, 0x80, 0x00, 0x03, 0x02,
+	0x04, 0x02, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x0a, 0x04, 0x0b,
+	0x00, 0x04, 0x06, 0x00, 0x0f, 0x06, 0x05, 0xd2, 0x00, 0x0c, 0x07, 0x0b, 0x00, 0x01, 0x08, 0x00,
+	0x00, 0x05, 0x02, 0xb1, 0x00, 0x05, 0x00, 0x9d, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa2,
+	0x00, 0x10, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x01, 0x04, 0x0b, 0x04, 0x11, 0x04, 0x35,
+	0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f, 0x64, 0x65,
+	0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x72, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69,
+	0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x72, 0x75, 0x6e,
+	0x63, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3a,
+	0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65,
+	0x6c, 0x6c, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x26, 0x4c,
+	0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x23,
+	0x00, 0x00, 0x00, 0x12, 0x20, 0x10, 0x88, 0x5c, 0x91, 0x00, 0x44, 0x13, 0x04, 0x00, 0x92, 0x00,
+	0x92, 0x00, 0x11, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00, 0x00, 0xda,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x34, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x69,
+	0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x02,
+	0x00, 0xc0, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x00, 0x04, 0x98, 0x00, 0x01, 0x02, 0xb3, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x45, 0x70, 0x68, 0x65, 0x6d,
+	0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b,
+	0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06, 0x0b, 0x81, 0x00, 0x07, 0x04,
+	0x00, 0x04, 0x02, 0xb0, 0x00, 0x04, 0x01, 0x00, 0x00, 0x03, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00,
+	0x04, 0x05, 0x04, 0xd2, 0x00, 0x01, 0x06, 0x00, 0x00, 0x05, 0x07, 0x03, 0x00, 0x04, 0x02, 0xb0,
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x06, 0x05, 0x04, 0xd2,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x5f, 0x74, 0x65, 0x6d, 0x70, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x68, 0x65, 0x72, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0x0f,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x34, 0x29,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x68, 0x65, 0x72, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x49,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x05, 0xd2,
+	0x00, 0x01, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x0c, 0x02,
+	0x00, 0x02, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x03, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x07, 0x00, 0x00, 0x07, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x01, 0x02, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x9d,
+	0x00, 0x04, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x05, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x08, 0x03,
+	0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x01, 0x00, 0x00, 0x05, 0x00, 0x08, 0x05, 0x01, 0x05, 0x18,
+	0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x07, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00,
+	0x08, 0x06, 0x05, 0xd2, 0x00, 0x09, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x21, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04,
+	0x0a, 0x02, 0x05, 0x6e, 0x05, 0x03, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02,
+	0x80, 0x00, 0x1a, 0x02, 0x00, 0x03, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x05, 0x00,
+	0x03, 0x05, 0x04, 0x6c, 0x07, 0x04, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02,
+	0x7f, 0xff, 0xf8, 0x02, 0x00, 0x04, 0x05, 0x00, 0x0a, 0x04, 0x06, 0x6e, 0x0b, 0x06, 0x06, 0x3a,
+	0x06, 0x05, 0x05, 0x6c, 0x01, 0x05, 0x05, 0x1e, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02,
+	0x01, 0x04, 0x04, 0x36, 0x00, 0x02, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x03, 0x07, 0x06, 0xd2,
+	0x00, 0x04, 0x08, 0x34, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x00, 0x30, 0x7f, 0xff, 0xe9, 0x02,
+	0x00, 0x04, 0x05, 0x34, 0x00, 0x05, 0x00, 0x9d, 0x7f, 0xff, 0xe6, 0x02, 0x00, 0x00, 0x00, 0xa2,
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x69, 0x73, 0x5f, 0x65, 0x78,
+	0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x50, 0x41, 0x54, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73,
+	0x70, 0x6c, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x24, 0x49, 0x00, 0x00, 0x00,
+	0x1e, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x0a, 0x04, 0x88, 0xa0, 0x12, 0x02, 0x12, 0x45, 0x01, 0x14, 0x00, 0x42, 0x52, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x24, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x10, 0x20, 0x40, 0x98, 0x91, 0x02, 0x06, 0xa0, 0x6d, 0x9d, 0x20, 0xad, 0x3b, 0x2d,
+	0x47, 0xa8, 0x5a, 0x4f, 0x43, 0xb4, 0x4e, 0x9e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65,
+	0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x66, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+	0x69, 0x6f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x08, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x07, 0x43, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0b,
+	0x45, 0x70, 0x68, 0x65, 0x6d, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x64, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x00, 0x04, 0x50, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x73,
+	0x68, 0x65, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_16[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x00, 0x03, 0x98, 0x03, 0x02, 0x02, 0x71, 0x00, 0x00, 0x02,
+	0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x01, 0x03, 0x98, 0x03, 0x03, 0x02, 0x71, 0x00, 0x00, 0x02,
+	0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x02, 0x03, 0x98, 0x03, 0x04, 0x02, 0x71, 0x00, 0x00, 0x02,
+	0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x03, 0x03, 0x98, 0x03, 0x05, 0x02, 0x71, 0x00, 0x00, 0x02,
+	0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x04, 0x03, 0x98, 0x03, 0x06, 0x02, 0x71, 0x00, 0x07, 0x02,
+	0x0b, 0x00, 0x05, 0x03, 0x98, 0x03, 0x08, 0x02, 0x71, 0x00, 0x07, 0x02, 0x0b, 0x00, 0x06, 0x03,
+	0x98, 0x03, 0x09, 0x02, 0x71, 0x00, 0x0a, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x07, 0x03,
+	0x98, 0x03, 0x0b, 0x02, 0x71, 0x00, 0x0a, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x08, 0x03,
+	0x98, 0x03, 0x0c, 0x02, 0x71, 0x00, 0x0a, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x0a, 0x03,
+	0x0b, 0x01, 0x03, 0x03, 0x6e, 0x00, 0x09, 0x04, 0x98, 0x04, 0x0e, 0x03, 0x71, 0x04, 0x0d, 0x02,
+	0x71, 0x00, 0x0a, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x0a, 0x03, 0x0b, 0x01, 0x03, 0x03,
+	0x6e, 0x00, 0x0a, 0x04, 0x98, 0x04, 0x10, 0x03, 0x71, 0x04, 0x0f, 0x02, 0x71, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x69,
+	0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x66, 0x69, 0x6e, 0x64, 0x49, 0x6e, 0x64, 0x65, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6c, 0x61, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x69, 0x6e,
+	0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x61, 0x6c,
+	0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x65, 0x6e, 0x64, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74,
+	0x72, 0x69, 0x6d, 0x4c, 0x65, 0x66, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x72, 0x69, 0x6d,
+	0x53, 0x74, 0x61, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x72, 0x69, 0x6d, 0x52, 0x69,
+	0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x74, 0x72, 0x69, 0x6d, 0x45, 0x6e, 0x64, 0x00,
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00,
+	0x02, 0x04, 0x00, 0x00, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00,
+	0x03, 0x01, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x02, 0x02, 0x0b, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x00, 0x06, 0x01, 0x03, 0x02, 0x6c, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x66, 0x69, 0x6e, 0x64,
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x01, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x12, 0x02, 0x80, 0x00, 0x07, 0x02, 0x80, 0x00, 0x01, 0x04, 0x00, 0x02, 0x00,
+	0x06, 0x00, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x02, 0x28, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x01, 0x02, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x02, 0x00,
+	0xab, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x04, 0x6c, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x00,
+	0x30, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x01, 0x00, 0x9d, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65,
+	0x6e, 0x67, 0x74, 0x68, 0x01, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x17, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x94, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80,
+	0x00, 0x00, 0x01, 0xad, 0x00, 0x01, 0x03, 0x0b, 0x02, 0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb0,
+	0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x80, 0x01, 0x02, 0x04,
+	0x80, 0x00, 0x05, 0x02, 0x00, 0x03, 0x03, 0xad, 0x00, 0x01, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x6e,
+	0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x04, 0x02, 0x0b, 0x05, 0x02, 0x02, 0x6e,
+	0x06, 0x02, 0x02, 0x6e, 0x00, 0x02, 0x04, 0x00, 0x07, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x00, 0x06,
+	0x00, 0x00, 0x06, 0x98, 0x00, 0x07, 0x00, 0xc1, 0x00, 0x03, 0x03, 0xb0, 0x00, 0x03, 0x01, 0x00,
+	0x80, 0x00, 0x08, 0x02, 0x00, 0x04, 0x04, 0x0b, 0x05, 0x04, 0x04, 0x6e, 0x08, 0x04, 0x04, 0x6e,
+	0x00, 0x04, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00, 0x07, 0x00, 0x06, 0x00, 0x05, 0x01, 0xb0,
+	0x00, 0x05, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d,
+	0x65, 0x6e, 0x74, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x72, 0x72,
+	0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00,
+	0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02,
+	0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03,
+	0x00, 0x30, 0x80, 0x00, 0x10, 0x02, 0x02, 0x00, 0x02, 0x6e, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04,
+	0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x04, 0x06, 0x06, 0x6e, 0x05, 0x06,
+	0x06, 0x6e, 0x00, 0x06, 0x08, 0x00, 0x06, 0x08, 0x07, 0xd2, 0x00, 0x01, 0x09, 0x00, 0x00, 0x07,
+	0x0a, 0x0b, 0x08, 0x0a, 0x0a, 0x3a, 0x00, 0x07, 0x02, 0xb0, 0x00, 0x07, 0x06, 0x00, 0x00, 0x03,
+	0x02, 0xb0, 0x80, 0x00, 0x04, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x01,
+	0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x73, 0x41,
+	0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74,
+	0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x6c, 0x61, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x70, 0x74,
+	0x68, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x1d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x02, 0x08, 0x80, 0x04, 0x44, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73,
+	0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x15, 0x27, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+	0x46, 0x8c, 0x88, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x70, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x12, 0x02, 0x80,
+	0x00, 0x07, 0x02, 0x80, 0x00, 0x01, 0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x02, 0x6e, 0x02,
+	0x01, 0x02, 0x28, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x00,
+	0x01, 0x02, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x02, 0x00, 0x06, 0x01, 0x02, 0x02, 0x6c, 0x00,
+	0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x00, 0x09, 0x00,
+	0x02, 0x00, 0x9d, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x02, 0x00, 0x0a, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68,
+	0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11,
+	0x18, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x94,
+	0xa0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x80, 0x00, 0x02, 0x04, 0x00, 0x00, 0x04, 0x0b, 0x04, 0x01, 0x04,
+	0x18, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x01,
+	0x6e, 0x80, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x13, 0x02, 0x80, 0x00, 0x07,
+	0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x00, 0x06, 0x02, 0x04, 0x04, 0x6e, 0x04, 0x03, 0x04,
+	0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x03, 0x04,
+	0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x00, 0x04, 0x00, 0xab, 0x00, 0x01, 0x06, 0x00, 0x00, 0x07, 0x00,
+	0x06, 0x03, 0x07, 0x07, 0x6c, 0x00, 0x03, 0x08, 0x00, 0x00, 0x09, 0x00, 0x06, 0x00, 0x04, 0x04,
+	0xb0, 0x00, 0x04, 0x01, 0x00, 0x7f, 0xff, 0xf5, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+	0x6e, 0x65, 0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x91, 0x08, 0x82, 0x40, 0x20, 0x04, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x05, 0x00,
+	0xc1, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x01, 0x07, 0x06,
+	0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x15, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x02, 0x02, 0x05,
+	0x6e, 0x05, 0x03, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0e,
+	0x02, 0x00, 0x03, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x05, 0x00, 0x03, 0x05, 0x04,
+	0x6c, 0x00, 0x01, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x07, 0x02, 0xc1, 0x80, 0x00, 0x08,
+	0x04, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x0a, 0x0a, 0x6c, 0x03, 0x08, 0x07,
+	0xc6, 0x00, 0x05, 0x01, 0xb0, 0x7f, 0xff, 0xf2, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65,
+	0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x22, 0x00, 0x00, 0x00, 0x42,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x04, 0x80, 0x84, 0x80, 0x42, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x05, 0x00, 0xc1, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x05,
+	0x07, 0x00, 0x01, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00,
+	0x03, 0x04, 0x02, 0x02, 0x05, 0x6e, 0x05, 0x03, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00,
+	0x03, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x03, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02,
+	0x05, 0x00, 0x03, 0x05, 0x04, 0x6c, 0x00, 0x01, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x00,
+	0x07, 0x00, 0x04, 0x07, 0x07, 0x6c, 0x00, 0x05, 0x01, 0xb0, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00,
+	0x00, 0xa2, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75,
+	0x73, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68,
+	0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13,
+	0x1e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x04, 0x80, 0x84,
+	0x84, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x00,
+	0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x01,
+	0x01, 0x02, 0x1a, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x0a, 0x00,
+	0x02, 0x00, 0x9d, 0x00, 0x02, 0x00, 0x06, 0x02, 0x02, 0x02, 0x6e, 0x02, 0x00, 0x03, 0x6e, 0x03,
+	0x02, 0x02, 0x38, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x01,
+	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e,
+	0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73,
+	0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x10, 0x12, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x90, 0xa0,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02,
+	0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x01, 0x02, 0x02, 0x1a, 0x00, 0x02, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+	0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x02, 0x01, 0x03, 0x97, 0x00, 0x03, 0x04, 0x03, 0x00, 0x01,
+	0x02, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72,
+	0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x02, 0x0b, 0x00, 0x10,
+	0x0a, 0x00, 0xfe, 0x83, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x01, 0xc4, 0x8a, 0x04, 0x1a, 0x09, 0x09,
+	0x0a, 0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x20, 0x20, 0xc2, 0xa0, 0xc2, 0xa0, 0xe1, 0x9a,
+	0x80, 0xe1, 0x9a, 0x80, 0xe1, 0xa0, 0x8e, 0xe1, 0xa0, 0x8e, 0xe2, 0x80, 0x80, 0xe2, 0x80, 0x80,
+	0xe2, 0x80, 0x81, 0xe2, 0x80, 0x81, 0xe2, 0x80, 0x82, 0xe2, 0x80, 0x82, 0xe2, 0x80, 0x83, 0xe2,
+	0x80, 0x83, 0xe2, 0x80, 0x84, 0xe2, 0x80, 0x84, 0xe2, 0x80, 0x85, 0xe2, 0x80, 0x85, 0xe2, 0x80,
+	0x86, 0xe2, 0x80, 0x86, 0xe2, 0x80, 0x87, 0xe2, 0x80, 0x87, 0xe2, 0x80, 0x88, 0xe2, 0x80, 0x88,
+	0xe2, 0x80, 0x89, 0xe2, 0x80, 0x89, 0xe2, 0x80, 0x8a, 0xe2, 0x80, 0x8a, 0xe2, 0x80, 0xaf, 0xe2,
+	0x80, 0xaf, 0xe2, 0x81, 0x9f, 0xe2, 0x81, 0x9f, 0xe3, 0x80, 0x80, 0xe3, 0x80, 0x80, 0xe2, 0x80,
+	0xa8, 0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa9, 0xe2, 0x80, 0xa9, 0xef, 0xbb, 0xbf, 0xef, 0xbb, 0xbf,
+	0x01, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x92, 0x5e, 0x5b, 0x5c, 0x78, 0x30, 0x39, 0x5c,
+	0x78, 0x30, 0x41, 0x5c, 0x78, 0x30, 0x42, 0x5c, 0x78, 0x30, 0x43, 0x5c, 0x78, 0x30, 0x44, 0x5c,
+	0x78, 0x32, 0x30, 0x5c, 0x78, 0x41, 0x30, 0x5c, 0x75, 0x31, 0x36, 0x38, 0x30, 0x5c, 0x75, 0x31,
+	0x38, 0x30, 0x45, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x30, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x31, 0x5c,
+	0x75, 0x32, 0x30, 0x30, 0x32, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x33, 0x5c, 0x75, 0x32, 0x30, 0x30,
+	0x34, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x35, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x36, 0x5c, 0x75, 0x32,
+	0x30, 0x30, 0x37, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x38, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x39, 0x5c,
+	0x75, 0x32, 0x30, 0x30, 0x41, 0x5c, 0x75, 0x32, 0x30, 0x32, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x35,
+	0x46, 0x5c, 0x75, 0x33, 0x30, 0x30, 0x30, 0x5c, 0x75, 0x32, 0x30, 0x32, 0x38, 0x5c, 0x75, 0x32,
+	0x30, 0x32, 0x39, 0x5c, 0x75, 0x46, 0x45, 0x46, 0x46, 0x5d, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d,
+	0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00,
+	0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x02, 0x01, 0x03,
+	0x97, 0x00, 0x03, 0x04, 0x03, 0x00, 0x01, 0x02, 0xb1, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x99, 0x00, 0x02, 0x0b, 0x00, 0x0a, 0x00, 0xfe, 0x83, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x01,
+	0xc4, 0x8a, 0x04, 0x1a, 0x09, 0x09, 0x0a, 0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x20, 0x20,
+	0xc2, 0xa0, 0xc2, 0xa0, 0xe1, 0x9a, 0x80, 0xe1, 0x9a, 0x80, 0xe1, 0xa0, 0x8e, 0xe1, 0xa0, 0x8e,
+	0xe2, 0x80, 0x80, 0xe2, 0x80, 0x80, 0xe2, 0x80, 0x81, 0xe2, 0x80, 0x81, 0xe2, 0x80, 0x82, 0xe2,
+	0x80, 0x82, 0xe2, 0x80, 0x83, 0xe2, 0x80, 0x83, 0xe2, 0x80, 0x84, 0xe2, 0x80, 0x84, 0xe2, 0x80,
+	0x85, 0xe2, 0x80, 0x85, 0xe2, 0x80, 0x86, 0xe2, 0x80, 0x86, 0xe2, 0x80, 0x87, 0xe2, 0x80, 0x87,
+	0xe2, 0x80, 0x88, 0xe2, 0x80, 0x88, 0xe2, 0x80, 0x89, 0xe2, 0x80, 0x89, 0xe2, 0x80, 0x8a, 0xe2,
+	0x80, 0x8a, 0xe2, 0x80, 0xaf, 0xe2, 0x80, 0xaf, 0xe2, 0x81, 0x9f, 0xe2, 0x81, 0x9f, 0xe3, 0x80,
+	0x80, 0xe3, 0x80, 0x80, 0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa8, 0xe2, 0x80, 0xa9, 0xe2, 0x80, 0xa9,
+	0xef, 0xbb, 0xbf, 0xef, 0xbb, 0xbf, 0x01, 0x11, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x92,
+	0x5b, 0x5c, 0x78, 0x30, 0x39, 0x5c, 0x78, 0x30, 0x41, 0x5c, 0x78, 0x30, 0x42, 0x5c, 0x78, 0x30,
+	0x43, 0x5c, 0x78, 0x30, 0x44, 0x5c, 0x78, 0x32, 0x30, 0x5c, 0x78, 0x41, 0x30, 0x5c, 0x75, 0x31,
+	0x36, 0x38, 0x30, 0x5c, 0x75, 0x31, 0x38, 0x30, 0x45, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x30, 0x5c,
+	0x75, 0x32, 0x30, 0x30, 0x31, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x32, 0x5c, 0x75, 0x32, 0x30, 0x30,
+	0x33, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x34, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x35, 0x5c, 0x75, 0x32,
+	0x30, 0x30, 0x36, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x37, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x38, 0x5c,
+	0x75, 0x32, 0x30, 0x30, 0x39, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x41, 0x5c, 0x75, 0x32, 0x30, 0x32,
+	0x46, 0x5c, 0x75, 0x32, 0x30, 0x35, 0x46, 0x5c, 0x75, 0x33, 0x30, 0x30, 0x30, 0x5c, 0x75, 0x32,
+	0x30, 0x32, 0x38, 0x5c, 0x75, 0x32, 0x30, 0x32, 0x39, 0x5c, 0x75, 0x46, 0x45, 0x46, 0x46, 0x5d,
+	0x2a, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x68, 0x69, 0x6d, 0x73, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x23, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x21, 0x2d, 0x2a, 0x96, 0x88, 0x4b, 0x46, 0xa7,
+	0x46, 0x27, 0x46, 0x25, 0xa2, 0x12, 0x94, 0x8d, 0x0a, 0x48, 0xd0, 0xa4, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_17[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x02,
+	0x98, 0x00, 0x06, 0x00, 0xab, 0x00, 0x00, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x03,
+	0x00, 0x00, 0x01, 0x06, 0x0b, 0x00, 0x07, 0x00, 0xc0, 0x00, 0x06, 0x00, 0xb2, 0x00, 0x06, 0x04,
+	0x00, 0x00, 0x06, 0x00, 0xc0, 0x00, 0x06, 0x05, 0x00, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x07,
+	0x98, 0x07, 0x02, 0x06, 0x71, 0x00, 0x05, 0x06, 0x00, 0x00, 0x01, 0x07, 0x98, 0x07, 0x03, 0x06,
+	0x71, 0x00, 0x05, 0x06, 0x00, 0x00, 0x02, 0x07, 0x98, 0x07, 0x04, 0x06, 0x71, 0x00, 0x05, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64,
+	0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75,
+	0x6e, 0x74, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x01, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0xc0,
+	0x81, 0x00, 0x05, 0x04, 0x00, 0x03, 0x01, 0xb2, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0x06, 0x03, 0x00, 0x07, 0x00, 0xc1, 0x06, 0x02, 0x01, 0xc2, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x5f, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x70, 0x75, 0x73,
+	0x68, 0x62, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x10, 0x0d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x80, 0x84, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00,
+	0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x05, 0x03, 0x00, 0x02, 0x02, 0xb1,
+	0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x75, 0x6e, 0x74,
+	0x69, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x06, 0x00, 0xc1, 0x00, 0x06, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x11, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03,
+	0x04, 0x00, 0x01, 0x06, 0x6e, 0x06, 0x03, 0x06, 0x28, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x03, 0x06, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x07,
+	0x00, 0x01, 0x07, 0x06, 0xd2, 0x00, 0x01, 0x09, 0x00, 0x02, 0x09, 0x08, 0xd2, 0x00, 0x03, 0x0a,
+	0x00, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x06, 0x01, 0xb0, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x06, 0x00, 0xc1, 0x00, 0x06, 0x04, 0x00, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x50,
+	0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x09, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x4c,
+	0x02, 0x00, 0x02, 0x00, 0xa1, 0x80, 0x00, 0x40, 0x02, 0x80, 0x00, 0x00, 0x02, 0x03, 0x00, 0x06,
+	0x6e, 0x00, 0x06, 0x06, 0x6e, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x3b, 0x02, 0x00, 0x04, 0x07,
+	0x00, 0x01, 0x07, 0x06, 0xd2, 0x03, 0x00, 0x08, 0x6e, 0x00, 0x08, 0x0a, 0x00, 0x04, 0x0a, 0x09,
+	0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x04, 0x06,
+	0x6e, 0x00, 0x02, 0x07, 0x6e, 0x07, 0x06, 0x06, 0x28, 0x00, 0x06, 0x00, 0x30, 0x80, 0x00, 0x01,
+	0x02, 0x7f, 0xff, 0xee, 0x02, 0x00, 0x05, 0x00, 0x09, 0x00, 0x03, 0x00, 0xa1, 0x80, 0x00, 0x17,
+	0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x00, 0x02, 0x06, 0x6e, 0x06, 0x03, 0x06,
+	0x28, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x10, 0x02, 0x00, 0x03, 0x06,
+	0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x04, 0x06, 0x00, 0x00, 0x04, 0x07, 0x6e, 0x00, 0x02, 0x08,
+	0x6e, 0x08, 0x07, 0x07, 0x38, 0x03, 0x07, 0x07, 0x34, 0x07, 0x06, 0x06, 0x6c, 0x00, 0x02, 0x09,
+	0x00, 0x03, 0x09, 0x09, 0x6c, 0x09, 0x06, 0x06, 0x1c, 0x00, 0x06, 0x00, 0x30, 0x7f, 0xff, 0xf3,
+	0x02, 0x00, 0x05, 0x00, 0x0a, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0xf0, 0x02, 0x00, 0x03, 0x00,
+	0xa2, 0x00, 0x05, 0x00, 0x30, 0x7f, 0xff, 0xd1, 0x02, 0x00, 0x05, 0x06, 0x0b, 0x00, 0x06, 0x08,
+	0x00, 0x06, 0x08, 0x07, 0xd2, 0x00, 0x07, 0x09, 0x0b, 0x00, 0x0a, 0x00, 0xc0, 0x00, 0x04, 0x0c,
+	0x00, 0x08, 0x0c, 0x0b, 0xd2, 0x80, 0x00, 0x0d, 0x04, 0x00, 0x04, 0x0e, 0x6e, 0x00, 0x02, 0x0f,
+	0x6e, 0x0f, 0x0e, 0x0e, 0x38, 0x00, 0x0b, 0x02, 0xb0, 0x00, 0x09, 0x01, 0xb2, 0x00, 0x07, 0x01,
+	0xb1, 0x00, 0x07, 0x00, 0x9d, 0x7f, 0xff, 0xc1, 0x02, 0x00, 0x02, 0x00, 0xa2, 0x00, 0x09, 0x06,
+	0xad, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x06, 0x0d, 0x00, 0x06, 0x00,
+	0x30, 0x7f, 0xff, 0xb4, 0x02, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x9d, 0x7f, 0xff, 0xb1,
+	0x02, 0x00, 0x01, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65,
+	0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x62, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73,
+	0x68, 0x69, 0x66, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73,
+	0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x65, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2d, 0x6c, 0x00, 0x00, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x09, 0x01, 0x00, 0x42, 0x42, 0x41, 0x02, 0x00, 0x48, 0x45, 0x09, 0x01, 0x20, 0x08, 0x09, 0x89,
+	0x4a, 0x08, 0x40, 0x11, 0x09, 0x48, 0x21, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03,
+	0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x02, 0x00, 0x06, 0x6e, 0x03, 0x00, 0x07,
+	0x6e, 0x03, 0x00, 0x08, 0x6e, 0x04, 0x08, 0x08, 0x6e, 0x00, 0x04, 0x03, 0xb0, 0x00, 0x04, 0x01,
+	0x00, 0x05, 0x01, 0x03, 0x1a, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x03, 0x00,
+	0x0a, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x0f, 0x02, 0x80, 0x00, 0x05,
+	0x02, 0x80, 0x00, 0x02, 0x04, 0x01, 0x02, 0x03, 0x28, 0x00, 0x03, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x09, 0x02, 0x00, 0x02, 0x03, 0x7a, 0x7f, 0xff, 0xfa, 0x02, 0x06, 0x00, 0x03,
+	0x6e, 0x00, 0x03, 0x05, 0x00, 0x07, 0x05, 0x04, 0xd2, 0x03, 0x00, 0x06, 0x6e, 0x02, 0x06, 0x06,
+	0x6c, 0x00, 0x04, 0x01, 0xb0, 0x7f, 0xff, 0xf7, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x03, 0x00,
+	0x09, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x66, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x62, 0x61, 0x63, 0x6b, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x70, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x66,
+	0x65, 0x65, 0x64, 0x00, 0x00, 0x00, 0x0f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x23, 0x00, 0x00, 0x00, 0x68, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x92, 0x10, 0x48, 0x10, 0x08, 0x4a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x19, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x09, 0x1a, 0x15, 0xa3, 0xb4, 0x33, 0x45, 0xcb, 0x45, 0xea, 0xa6, 0x97, 0x80, 0x00, 0x00,
+	0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x66, 0x65, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07,
+	0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff,
+};
+
+static const unsigned char file_18[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x0e, 0x02,
+	0x98, 0x00, 0x08, 0x00, 0xab, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x03,
+	0x00, 0x00, 0x08, 0x00, 0xab, 0x00, 0x01, 0x0a, 0x03, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x04,
+	0x00, 0x00, 0x08, 0x03, 0xc0, 0x00, 0x02, 0x09, 0x03, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x03, 0x0b,
+	0x03, 0x80, 0x01, 0x0c, 0x04, 0x00, 0x04, 0x0d, 0x03, 0x80, 0x02, 0x0e, 0x04, 0x06, 0x09, 0x08,
+	0xc2, 0x00, 0x08, 0x05, 0x00, 0x00, 0x05, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x06, 0x0a, 0x09,
+	0xd2, 0x80, 0x1b, 0x0b, 0x04, 0x00, 0x09, 0x01, 0xb0, 0x07, 0x09, 0x06, 0x36, 0x00, 0x04, 0x09,
+	0x00, 0x08, 0x09, 0x08, 0xd2, 0x80, 0x00, 0x0a, 0x04, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x07,
+	0x00, 0x00, 0x05, 0x08, 0x00, 0x00, 0x00, 0x09, 0x98, 0x09, 0x09, 0x08, 0x71, 0x00, 0x05, 0x08,
+	0x00, 0x00, 0x01, 0x09, 0x98, 0x09, 0x0a, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x02, 0x09,
+	0x98, 0x09, 0x0b, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x03, 0x09, 0x98, 0x09, 0x0c, 0x08,
+	0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x04, 0x09, 0x98, 0x09, 0x0d, 0x08, 0x71, 0x00, 0x05, 0x08,
+	0x00, 0x00, 0x05, 0x09, 0x98, 0x09, 0x0e, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x06, 0x09,
+	0x98, 0x09, 0x0f, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x07, 0x09, 0x98, 0x09, 0x10, 0x08,
+	0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x08, 0x09, 0x98, 0x09, 0x11, 0x08, 0x71, 0x00, 0x05, 0x08,
+	0x00, 0x00, 0x09, 0x09, 0x98, 0x09, 0x12, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0a, 0x09,
+	0x98, 0x09, 0x13, 0x08, 0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0b, 0x09, 0x98, 0x09, 0x14, 0x08,
+	0x71, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0c, 0x09, 0x98, 0x09, 0x15, 0x08, 0x71, 0x00, 0x05, 0x08,
+	0x00, 0x00, 0x0d, 0x09, 0x98, 0x09, 0x16, 0x08, 0x71, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72,
+	0x65, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43, 0x41, 0x4e, 0x4f, 0x4e, 0x49, 0x43, 0x41,
+	0x4c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x52, 0x41, 0x57, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x43, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x65,
+	0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x62, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63,
+	0x6c, 0x65, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x68, 0x69, 0x64, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x70, 0x72, 0x69, 0x6e,
+	0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69,
+	0x6e, 0x74, 0x6c, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6c,
+	0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x72, 0x65, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x73, 0x65, 0x74, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73,
+	0x68, 0x6f, 0x77, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74,
+	0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2,
+	0x00, 0x02, 0x06, 0x0b, 0x03, 0x06, 0x06, 0x36, 0x00, 0x06, 0x06, 0x34, 0x04, 0x06, 0x06, 0x36,
+	0x01, 0x06, 0x06, 0x34, 0x04, 0x06, 0x06, 0x36, 0x02, 0x06, 0x06, 0x34, 0x05, 0x06, 0x06, 0x36,
+	0x00, 0x04, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72,
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x38, 0x3b, 0x32, 0x3b, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00,
+	0x01, 0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x36, 0x00, 0x01, 0x01, 0xb0,
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x04, 0x02, 0x01, 0xd2, 0x80, 0x01, 0x03, 0x04,
+	0x80, 0x01, 0x04, 0x04, 0x00, 0x01, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32, 0x4a, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x74, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0d, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03,
+	0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x02, 0x06, 0x0b, 0x03, 0x06, 0x06, 0x36, 0x00, 0x06,
+	0x06, 0x34, 0x04, 0x06, 0x06, 0x36, 0x01, 0x06, 0x06, 0x34, 0x04, 0x06, 0x06, 0x36, 0x02, 0x06,
+	0x06, 0x34, 0x05, 0x06, 0x06, 0x36, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0x05, 0x33, 0x38,
+	0x3b, 0x32, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6d, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x0b, 0x03, 0x03,
+	0x03, 0x36, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74,
+	0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3f, 0x32, 0x35, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x42,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x0b, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x02, 0x05, 0x0b, 0x00, 0x05, 0x05,
+	0x34, 0x03, 0x05, 0x05, 0x36, 0x01, 0x05, 0x05, 0x34, 0x04, 0x05, 0x05, 0x36, 0x00, 0x03, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0x53, 0x49,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x80,
+	0x02, 0x02, 0x04, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x03, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x80,
+	0x01, 0x02, 0x04, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x03, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x80,
+	0x01, 0x02, 0x04, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x03, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x80,
+	0x02, 0x02, 0x04, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x03, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x01, 0x01, 0xb1, 0x00,
+	0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x74, 0x64, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02,
+	0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x02, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x36, 0x00, 0x01, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0x53, 0x49,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02,
+	0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x65, 0x72, 0x6d,
+	0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2,
+	0x00, 0x02, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x36, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72,
+	0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x3f, 0x32, 0x35, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0e, 0x07, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x03, 0x00, 0x05, 0x00, 0x08, 0x05, 0x00, 0x05, 0x18, 0x00,
+	0x05, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x36, 0x80, 0x00, 0x5b, 0x02, 0x00,
+	0x02, 0x05, 0x0b, 0x05, 0x00, 0x05, 0x18, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x03,
+	0x01, 0x01, 0x36, 0x80, 0x00, 0x55, 0x02, 0x00, 0x04, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x05,
+	0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x00, 0x30, 0x80,
+	0x00, 0x1c, 0x02, 0x06, 0x01, 0x01, 0x36, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x16, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x07, 0x00, 0x05, 0x6e, 0x05, 0x02, 0x05, 0x28, 0x00,
+	0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0f, 0x02, 0x00, 0x02, 0x05, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x08, 0x02, 0x05, 0x22, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x09,
+	0x01, 0x01, 0x36, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0a, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x0b,
+	0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x02, 0x09, 0x09, 0x6c, 0x00, 0x07, 0x01, 0xb0, 0x07,
+	0x05, 0x01, 0x34, 0x7f, 0xff, 0xf1, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x0c, 0x01, 0x01, 0x36, 0x80,
+	0x00, 0x32, 0x02, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x0e,
+	0x05, 0x05, 0x1a, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x27, 0x02, 0x0f, 0x01, 0x01, 0x36, 0x00,
+	0x10, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x11, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x06, 0x01, 0xb0, 0x00, 0x06, 0x03, 0x00, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x1b, 0x02, 0x80,
+	0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x07, 0x03, 0x05, 0x6e, 0x05, 0x02, 0x05, 0x28, 0x00,
+	0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x14, 0x02, 0x00, 0x02, 0x05, 0x7a, 0x7f,
+	0xff, 0xf9, 0x02, 0x00, 0x03, 0x05, 0x00, 0x02, 0x05, 0x04, 0x6c, 0x08, 0x02, 0x05, 0x22, 0x00,
+	0x05, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x09, 0x01, 0x01, 0x36, 0x00, 0x01, 0x05, 0x00, 0x12,
+	0x04, 0x06, 0x36, 0x06, 0x05, 0x01, 0x34, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0a, 0x06, 0x0b, 0x00,
+	0x06, 0x08, 0x00, 0x0b, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x04, 0x09, 0x09, 0x6c, 0x00,
+	0x07, 0x01, 0xb0, 0x07, 0x05, 0x01, 0x34, 0x7f, 0xff, 0xec, 0x02, 0x00, 0x01, 0x00, 0xa2, 0x13,
+	0x01, 0x01, 0x36, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d,
+	0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x06, 0x05, 0x01, 0x34, 0x00, 0x01, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x28, 0x6e, 0x75,
+	0x6c, 0x6c, 0x29, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x28, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+	0x29, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72,
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x4f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x65, 0x79, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x2b, 0x64, 0x00, 0x00, 0x00, 0xb4, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x91, 0x10,
+	0x11, 0x00, 0x20, 0x48, 0x08, 0x22, 0x80, 0x42, 0x60, 0x08, 0x90, 0x00, 0x01, 0x09, 0x22, 0x88,
+	0x01, 0x09, 0x88, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x16, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x04, 0x04, 0x01, 0x01, 0x05,
+	0x6e, 0x05, 0x04, 0x05, 0x28, 0x00, 0x05, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0f,
+	0x02, 0x00, 0x04, 0x05, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x02, 0x04, 0x05, 0x22, 0x00, 0x05, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x36, 0x00, 0x03, 0x05, 0x00, 0x00, 0x04, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x05, 0x08, 0x07, 0xd2, 0x00, 0x01, 0x09, 0x00, 0x04, 0x09, 0x09,
+	0x6c, 0x00, 0x07, 0x01, 0xb0, 0x07, 0x05, 0x03, 0x34, 0x7f, 0xff, 0xf1, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x06, 0x03, 0x03, 0x36, 0x00, 0x07, 0x05,
+	0x0b, 0x00, 0x05, 0x07, 0x00, 0x08, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x09,
+	0x00, 0x00, 0x06, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72,
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x0d, 0x74,
+	0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14,
+	0x24, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x02, 0x08, 0xa0,
+	0x10, 0x94, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x65, 0x72, 0x6d, 0x2f, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x3b, 0x49, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1e,
+	0x52, 0x92, 0x28, 0x10, 0x1a, 0x2e, 0x5a, 0x22, 0x9a, 0x2e, 0x5a, 0x22, 0x5a, 0x2a, 0x5a, 0x26,
+	0x5a, 0x26, 0x5a, 0x26, 0x5a, 0x26, 0x5a, 0x2e, 0x5a, 0x22, 0x5a, 0x32, 0x40, 0xd1, 0x12, 0xd1,
+	0x3a, 0xa1, 0xa7, 0xa0, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+	0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x69, 0x6f,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x03, 0x43, 0x53, 0x49, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x73, 0x74, 0x64,
+	0x69, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_19[] = {
+	0xbf, 0x00, 0x00, 0x01, 0x2a, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2d, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x14, 0x02,
+	0x98, 0x00, 0x15, 0x03, 0x98, 0x00, 0x16, 0x04, 0x98, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x00, 0x0e,
+	0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x05, 0x00, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x01, 0x0e,
+	0x03, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x0c, 0x02, 0xc0, 0x00, 0x02, 0x0d,
+	0x03, 0x80, 0x01, 0x0e, 0x04, 0x00, 0x03, 0x0f, 0x03, 0x80, 0x01, 0x10, 0x04, 0x04, 0x0d, 0x0c,
+	0xc2, 0x00, 0x0c, 0x08, 0x00, 0x80, 0x08, 0x09, 0x04, 0x80, 0x01, 0x0a, 0x04, 0x00, 0x0c, 0x56,
+	0xc0, 0x00, 0x04, 0x0d, 0x03, 0x00, 0x05, 0x0e, 0x03, 0x00, 0x06, 0x0f, 0x03, 0x80, 0xff, 0x10,
+	0x04, 0x00, 0x07, 0x11, 0x03, 0x80, 0x00, 0x12, 0x04, 0xff, 0x00, 0x12, 0x05, 0x00, 0x08, 0x13,
+	0x03, 0x80, 0x00, 0x14, 0x04, 0x00, 0x09, 0x15, 0x03, 0x80, 0x01, 0x16, 0x04, 0x00, 0x00, 0x16,
+	0x05, 0x00, 0x0a, 0x17, 0x03, 0x80, 0x02, 0x18, 0x04, 0x00, 0x00, 0x18, 0x05, 0x00, 0x0b, 0x19,
+	0x03, 0x80, 0x04, 0x1a, 0x04, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x0c, 0x1b, 0x03, 0x80, 0x08, 0x1c,
+	0x04, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x0d, 0x1d, 0x03, 0x80, 0x10, 0x1e, 0x04, 0x00, 0x00, 0x1e,
+	0x05, 0x00, 0x0e, 0x1f, 0x03, 0x80, 0x20, 0x20, 0x04, 0x00, 0x00, 0x20, 0x05, 0x14, 0x0d, 0x0c,
+	0xc2, 0x00, 0x0f, 0x0d, 0x03, 0x80, 0x40, 0x0e, 0x04, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x10, 0x0f,
+	0x03, 0x80, 0x80, 0x10, 0x04, 0x00, 0x00, 0x10, 0x05, 0x00, 0x11, 0x11, 0x03, 0x81, 0x00, 0x12,
+	0x04, 0x00, 0x00, 0x12, 0x05, 0x00, 0x12, 0x13, 0x03, 0x82, 0x00, 0x14, 0x04, 0x00, 0x00, 0x14,
+	0x05, 0x00, 0x13, 0x15, 0x03, 0x84, 0x00, 0x16, 0x04, 0x00, 0x00, 0x16, 0x05, 0x00, 0x14, 0x17,
+	0x03, 0x88, 0x00, 0x18, 0x04, 0x00, 0x00, 0x18, 0x05, 0x00, 0x15, 0x19, 0x03, 0x90, 0x00, 0x1a,
+	0x04, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x16, 0x1b, 0x03, 0xa0, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x1c,
+	0x05, 0x00, 0x17, 0x1d, 0x03, 0xc0, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x1e, 0x05, 0x00, 0x18, 0x1f,
+	0x03, 0x80, 0x00, 0x20, 0x04, 0x14, 0x0d, 0x0c, 0xc2, 0x00, 0x19, 0x0d, 0x03, 0x80, 0x01, 0x0e,
+	0x04, 0x00, 0x1a, 0x0f, 0x03, 0x80, 0x02, 0x10, 0x04, 0x00, 0x1b, 0x11, 0x03, 0x80, 0x03, 0x12,
+	0x04, 0x00, 0x1c, 0x13, 0x03, 0x80, 0x04, 0x14, 0x04, 0x00, 0x1d, 0x15, 0x03, 0x80, 0x05, 0x16,
+	0x04, 0x00, 0x1e, 0x17, 0x03, 0x80, 0x06, 0x18, 0x04, 0x00, 0x1f, 0x19, 0x03, 0x80, 0x07, 0x1a,
+	0x04, 0x00, 0x20, 0x1b, 0x03, 0x00, 0x1c, 0x08, 0xc0, 0x00, 0x21, 0x1d, 0x03, 0x00, 0x22, 0x1e,
+	0x03, 0x00, 0x23, 0x1f, 0x03, 0x00, 0x24, 0x20, 0x03, 0x00, 0x25, 0x21, 0x03, 0x00, 0x26, 0x22,
+	0x03, 0x00, 0x27, 0x23, 0x03, 0x00, 0x28, 0x24, 0x03, 0x00, 0x29, 0x25, 0x03, 0x00, 0x2a, 0x26,
+	0x03, 0x00, 0x2b, 0x27, 0x03, 0x00, 0x24, 0x28, 0x03, 0x00, 0x2c, 0x29, 0x03, 0x00, 0x2d, 0x2a,
+	0x03, 0x00, 0x2e, 0x2b, 0x03, 0x00, 0x28, 0x2c, 0x03, 0x10, 0x1d, 0x1c, 0xc2, 0x00, 0x2f, 0x1d,
+	0x03, 0x80, 0x01, 0x1e, 0x04, 0x00, 0x30, 0x1f, 0x03, 0x80, 0x02, 0x20, 0x04, 0x14, 0x0d, 0x0c,
+	0xc2, 0x00, 0x31, 0x0d, 0x03, 0x80, 0x03, 0x0e, 0x04, 0x00, 0x32, 0x0f, 0x03, 0x80, 0x04, 0x10,
+	0x04, 0x00, 0x33, 0x11, 0x03, 0x80, 0x05, 0x12, 0x04, 0x00, 0x34, 0x13, 0x03, 0x80, 0x06, 0x14,
+	0x04, 0x00, 0x35, 0x15, 0x03, 0x80, 0x07, 0x16, 0x04, 0x00, 0x36, 0x17, 0x03, 0x80, 0x08, 0x18,
+	0x04, 0x00, 0x37, 0x19, 0x03, 0x80, 0x09, 0x1a, 0x04, 0x00, 0x38, 0x1b, 0x03, 0x80, 0x0a, 0x1c,
+	0x04, 0x00, 0x39, 0x1d, 0x03, 0x80, 0x0b, 0x1e, 0x04, 0x00, 0x3a, 0x1f, 0x03, 0x80, 0x0c, 0x20,
+	0x04, 0x14, 0x0d, 0x0c, 0xc2, 0x00, 0x3b, 0x0d, 0x03, 0x80, 0x0d, 0x0e, 0x04, 0x00, 0x3c, 0x0f,
+	0x03, 0x80, 0x0e, 0x10, 0x04, 0x00, 0x3d, 0x11, 0x03, 0x80, 0x0f, 0x12, 0x04, 0x00, 0x3e, 0x13,
+	0x03, 0x80, 0x10, 0x14, 0x04, 0x00, 0x3f, 0x15, 0x03, 0x80, 0x11, 0x16, 0x04, 0x00, 0x40, 0x17,
+	0x03, 0x80, 0x12, 0x18, 0x04, 0x00, 0x41, 0x19, 0x03, 0x80, 0x13, 0x1a, 0x04, 0x00, 0x42, 0x1b,
+	0x03, 0x80, 0x14, 0x1c, 0x04, 0x00, 0x43, 0x1d, 0x03, 0x80, 0x15, 0x1e, 0x04, 0x00, 0x44, 0x1f,
+	0x03, 0x80, 0x16, 0x20, 0x04, 0x14, 0x0d, 0x0c, 0xc2, 0x00, 0x45, 0x0d, 0x03, 0x80, 0x17, 0x0e,
+	0x04, 0x00, 0x46, 0x0f, 0x03, 0x80, 0x18, 0x10, 0x04, 0x00, 0x47, 0x11, 0x03, 0x80, 0x19, 0x12,
+	0x04, 0x00, 0x48, 0x13, 0x03, 0x80, 0x1a, 0x14, 0x04, 0x00, 0x49, 0x15, 0x03, 0x80, 0x1b, 0x16,
+	0x04, 0x00, 0x4a, 0x17, 0x03, 0x81, 0x4b, 0x18, 0x04, 0x00, 0x4b, 0x19, 0x03, 0x81, 0x4a, 0x1a,
+	0x04, 0x00, 0x4c, 0x1b, 0x03, 0x81, 0x07, 0x1c, 0x04, 0x00, 0x4d, 0x1d, 0x03, 0x81, 0x06, 0x1e,
+	0x04, 0x00, 0x4e, 0x1f, 0x03, 0x81, 0x68, 0x20, 0x04, 0x14, 0x0d, 0x0c, 0xc2, 0x00, 0x4f, 0x0d,
+	0x03, 0x81, 0x52, 0x0e, 0x04, 0x00, 0x50, 0x0f, 0x03, 0x81, 0x53, 0x10, 0x04, 0x00, 0x51, 0x11,
+	0x03, 0x81, 0x9a, 0x12, 0x04, 0x00, 0x52, 0x13, 0x03, 0x81, 0x02, 0x14, 0x04, 0x00, 0x53, 0x15,
+	0x03, 0x81, 0x03, 0x16, 0x04, 0x00, 0x54, 0x17, 0x03, 0x81, 0x04, 0x18, 0x04, 0x00, 0x55, 0x19,
+	0x03, 0x81, 0x05, 0x1a, 0x04, 0x00, 0x56, 0x1b, 0x03, 0x81, 0x09, 0x1c, 0x04, 0x00, 0x57, 0x1d,
+	0x03, 0x81, 0x0a, 0x1e, 0x04, 0x00, 0x58, 0x1f, 0x03, 0x81, 0x0b, 0x20, 0x04, 0x14, 0x0d, 0x0c,
+	0xc2, 0x00, 0x59, 0x0d, 0x03, 0x81, 0x0c, 0x0e, 0x04, 0x00, 0x5a, 0x0f, 0x03, 0x81, 0x0d, 0x10,
+	0x04, 0x00, 0x5b, 0x11, 0x03, 0x81, 0x0e, 0x12, 0x04, 0x00, 0x5c, 0x13, 0x03, 0x81, 0x0f, 0x14,
+	0x04, 0x00, 0x5d, 0x15, 0x03, 0x81, 0x10, 0x16, 0x04, 0x00, 0x5e, 0x17, 0x03, 0x81, 0x11, 0x18,
+	0x04, 0x00, 0x5f, 0x19, 0x03, 0x81, 0x12, 0x1a, 0x04, 0x00, 0x60, 0x1b, 0x03, 0x81, 0x13, 0x1c,
+	0x04, 0x00, 0x61, 0x1d, 0x03, 0x81, 0x14, 0x1e, 0x04, 0x00, 0x62, 0x1f, 0x03, 0x81, 0x52, 0x20,
+	0x04, 0x14, 0x0d, 0x0c, 0xc2, 0x00, 0x63, 0x0d, 0x03, 0x81, 0x53, 0x0e, 0x04, 0x00, 0x64, 0x0f,
+	0x03, 0x00, 0x65, 0x10, 0x0b, 0x00, 0x66, 0x11, 0x03, 0x00, 0x65, 0x12, 0x0b, 0x00, 0x67, 0x13,
+	0x03, 0x00, 0x65, 0x14, 0x0b, 0x00, 0x68, 0x15, 0x03, 0x00, 0x65, 0x16, 0x0b, 0x00, 0x69, 0x17,
+	0x03, 0x00, 0x65, 0x18, 0x0b, 0x0c, 0x0d, 0x0c, 0xc2, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x00, 0x0d, 0x98, 0x0d, 0x6a, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x01, 0x0d,
+	0x98, 0x0d, 0x6b, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x02, 0x0d, 0x98, 0x0d, 0x6c, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x03, 0x0d, 0x98, 0x0d, 0x6d, 0x0c, 0x71, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x04, 0x0d, 0x98, 0x0d, 0x6e, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x05, 0x0d,
+	0x98, 0x0d, 0x6f, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x06, 0x0d, 0x98, 0x0d, 0x70, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x07, 0x0d, 0x98, 0x0d, 0x71, 0x0c, 0x71, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x08, 0x0d, 0x98, 0x0d, 0x72, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x09, 0x0d,
+	0x98, 0x0d, 0x73, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x0a, 0x0d, 0x98, 0x0d, 0x74, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x0b, 0x0d, 0x98, 0x0d, 0x75, 0x0c, 0x71, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x0c, 0x0d, 0x98, 0x0d, 0x76, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x0d, 0x0d,
+	0x98, 0x0d, 0x77, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x0e, 0x0d, 0x98, 0x0d, 0x78, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x0f, 0x0d, 0x98, 0x0d, 0x79, 0x0c, 0x71, 0x00, 0x0b, 0x0c,
+	0x00, 0x00, 0x10, 0x0d, 0x98, 0x0d, 0x7a, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x11, 0x0d,
+	0x98, 0x0d, 0x7b, 0x0c, 0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x12, 0x0d, 0x98, 0x0d, 0x7c, 0x0c,
+	0x71, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x13, 0x0d, 0x98, 0x0d, 0x7d, 0x0c, 0x71, 0x00, 0x0b, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6a, 0x6f, 0x73, 0x68, 0x69, 0x5f,
+	0x74, 0x75, 0x69, 0x2e, 0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x72, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6f, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x41, 0x5f, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 0x53,
+	0x01, 0x41, 0xef, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x41, 0x5f,
+	0x43, 0x48, 0x41, 0x52, 0x54, 0x45, 0x58, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0x5f, 0x43,
+	0x4f, 0x4c, 0x4f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41,
+	0x4c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x41, 0x5f, 0x53, 0x54, 0x41, 0x4e, 0x44, 0x4f, 0x55, 0x54,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x41, 0x5f, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x4c, 0x49, 0x4e, 0x45,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x41, 0x5f, 0x52, 0x45, 0x56, 0x45, 0x52, 0x53, 0x45, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x41, 0x5f, 0x42, 0x4c, 0x49, 0x4e, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41,
+	0x5f, 0x44, 0x49, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x5f, 0x42, 0x4f, 0x4c, 0x44, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x41, 0x5f, 0x41, 0x4c, 0x54, 0x43, 0x48, 0x41, 0x52, 0x53, 0x45, 0x54,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0x5f, 0x49, 0x4e, 0x56, 0x49, 0x53, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x41, 0x5f, 0x50, 0x52, 0x4f, 0x54, 0x45, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x41,
+	0x5f, 0x48, 0x4f, 0x52, 0x49, 0x5a, 0x4f, 0x4e, 0x54, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x41, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0x5f, 0x4c, 0x4f, 0x57,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x41, 0x5f, 0x54, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x41, 0x5f, 0x56, 0x45, 0x52,
+	0x54, 0x49, 0x43, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f,
+	0x42, 0x4c, 0x41, 0x43, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f,
+	0x52, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x47, 0x52,
+	0x45, 0x45, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x59, 0x45,
+	0x4c, 0x4c, 0x4f, 0x57, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x42,
+	0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x4d, 0x41,
+	0x47, 0x45, 0x4e, 0x54, 0x41, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f,
+	0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x57,
+	0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54,
+	0x5f, 0x42, 0x4f, 0x52, 0x44, 0x45, 0x52, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xe2, 0x94, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xe2, 0x94, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0xe2, 0x94, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe2, 0x94,
+	0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x62, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe2, 0x94, 0x98,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x62, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xe2, 0x94, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b,
+	0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45,
+	0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59,
+	0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f,
+	0x43, 0x54, 0x52, 0x4c, 0x5f, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43,
+	0x54, 0x52, 0x4c, 0x5f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54,
+	0x52, 0x4c, 0x5f, 0x47, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52,
+	0x4c, 0x5f, 0x48, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x54, 0x41, 0x42, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x54, 0x45, 0x52, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x4b, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b,
+	0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45,
+	0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59,
+	0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f,
+	0x43, 0x54, 0x52, 0x4c, 0x5f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43,
+	0x54, 0x52, 0x4c, 0x5f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54,
+	0x52, 0x4c, 0x5f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52,
+	0x4c, 0x5f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c,
+	0x5f, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f,
+	0x56, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x57,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x58, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x59, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x43, 0x54, 0x52, 0x4c, 0x5f, 0x5a, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45,
+	0x59, 0x5f, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59,
+	0x5f, 0x44, 0x45, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x4b, 0x45, 0x59, 0x5f, 0x42, 0x41, 0x43,
+	0x4b, 0x53, 0x50, 0x41, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x48,
+	0x4f, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x44, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x4b, 0x45, 0x59, 0x5f, 0x4e, 0x45, 0x58, 0x54, 0x5f, 0x50, 0x41, 0x47,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x4b, 0x45, 0x59, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5f, 0x50,
+	0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x45, 0x53, 0x49,
+	0x5a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b,
+	0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f,
+	0x52, 0x49, 0x47, 0x48, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x32, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x4b, 0x45, 0x59, 0x5f, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46,
+	0x34, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x35, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x36, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f,
+	0x46, 0x37, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x39, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59,
+	0x5f, 0x46, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x31, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x4b, 0x45, 0x59, 0x5f, 0x4e, 0x50, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b,
+	0x45, 0x59, 0x5f, 0x50, 0x50, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x61, 0x6e,
+	0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x68, 0x61, 0x73, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6d,
+	0x61, 0x78, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x6d, 0x61, 0x78, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x61, 0x64, 0x64,
+	0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x61, 0x64, 0x64, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63,
+	0x75, 0x72, 0x73, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x65,
+	0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x75, 0x72, 0x73, 0x5f, 0x70, 0x6f, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x63, 0x75, 0x72, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x65, 0x74, 0x5f, 0x6b,
+	0x65, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f,
+	0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x67, 0x65, 0x74, 0x63, 0x68, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x15, 0x73, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x65, 0x74, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x74, 0x69,
+	0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x69, 0x6e, 0x5f, 0x64, 0x65,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x69, 0x6e, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x77, 0x69, 0x6e, 0x5f, 0x6e, 0x65, 0x77, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x6e, 0x00, 0x01,
+	0x01, 0x0d, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x0b, 0x00, 0x02,
+	0x00, 0xc0, 0x00, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x00,
+	0x01, 0x0b, 0x04, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x01, 0x0d, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00,
+	0x05, 0x02, 0x00, 0x02, 0x01, 0x0b, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x05, 0x03, 0x03, 0x00, 0x01,
+	0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x06, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x07, 0x03,
+	0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x08, 0x04,
+	0x03, 0xd2, 0x00, 0x00, 0x05, 0x98, 0x00, 0x06, 0x00, 0xc0, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03,
+	0x00, 0x9d, 0x00, 0x09, 0x01, 0x0b, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x68, 0x61, 0x73, 0x5f, 0x63,
+	0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x54, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x64, 0x6f, 0x65,
+	0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x63, 0x6f,
+	0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x61, 0x6e, 0x5f, 0x63, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x54, 0x65,
+	0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+	0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x20, 0x72,
+	0x65, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69,
+	0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x01, 0x08, 0x00, 0x00, 0x08, 0x02, 0x6e, 0x00, 0x01, 0x08, 0x00, 0x01,
+	0x08, 0x03, 0x6e, 0x02, 0x03, 0x08, 0x6e, 0x03, 0x08, 0x08, 0x1a, 0x00, 0x08, 0x00, 0x30, 0x80,
+	0x00, 0x11, 0x02, 0x00, 0x03, 0x08, 0x00, 0x00, 0x08, 0x08, 0x6e, 0x00, 0x03, 0x09, 0x00, 0x00,
+	0x09, 0x09, 0x6e, 0x09, 0x08, 0x08, 0x34, 0x00, 0x03, 0x0a, 0x00, 0x01, 0x0a, 0x0a, 0x6e, 0x0a,
+	0x08, 0x08, 0x34, 0x00, 0x03, 0x0b, 0x00, 0x01, 0x0b, 0x0b, 0x6e, 0x0b, 0x08, 0x08, 0x34, 0x00,
+	0x03, 0x0c, 0x00, 0x04, 0x0c, 0x0c, 0x6e, 0x0c, 0x08, 0x08, 0x34, 0x00, 0x03, 0x0d, 0x00, 0x04,
+	0x0d, 0x0d, 0x6e, 0x0d, 0x08, 0x03, 0x34, 0x02, 0x03, 0x08, 0x6e, 0x05, 0x08, 0x08, 0x1e, 0x00,
+	0x08, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x09, 0x00, 0xc0, 0x02,
+	0x07, 0x0a, 0x35, 0x00, 0x08, 0x01, 0xb2, 0x00, 0x08, 0x00, 0xa9, 0x00, 0x08, 0x08, 0xad, 0x00,
+	0x03, 0x0b, 0x00, 0x09, 0x0b, 0x0a, 0xd2, 0x80, 0x00, 0x0c, 0x04, 0x80, 0x02, 0x0d, 0x04, 0x00,
+	0x0a, 0x02, 0xb0, 0x80, 0x10, 0x0b, 0x04, 0x00, 0x08, 0x02, 0xb0, 0x08, 0x0a, 0x08, 0x3d, 0x0b,
+	0x08, 0x04, 0x42, 0x00, 0x08, 0x08, 0xad, 0x00, 0x03, 0x0b, 0x00, 0x09, 0x0b, 0x0a, 0xd2, 0x80,
+	0x02, 0x0c, 0x04, 0x80, 0x04, 0x0d, 0x04, 0x00, 0x0a, 0x02, 0xb0, 0x80, 0x10, 0x0b, 0x04, 0x00,
+	0x08, 0x02, 0xb0, 0x08, 0x0a, 0x08, 0x3d, 0x0b, 0x08, 0x05, 0x42, 0x00, 0x08, 0x08, 0xad, 0x00,
+	0x03, 0x0b, 0x00, 0x09, 0x0b, 0x0a, 0xd2, 0x80, 0x04, 0x0c, 0x04, 0x80, 0x06, 0x0d, 0x04, 0x00,
+	0x0a, 0x02, 0xb0, 0x80, 0x10, 0x0b, 0x04, 0x00, 0x08, 0x02, 0xb0, 0x08, 0x0a, 0x08, 0x3d, 0x0b,
+	0x08, 0x06, 0x42, 0x00, 0x0c, 0x08, 0xad, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0, 0x00,
+	0x08, 0x09, 0x00, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x0c, 0x0a, 0xad, 0x00,
+	0x05, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0xb0, 0x00, 0x0a, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x32, 0x80,
+	0x00, 0x04, 0x02, 0x00, 0x0c, 0x0c, 0xad, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x0c, 0x01, 0xb0, 0x00,
+	0x0c, 0x0b, 0x00, 0x00, 0x0b, 0x09, 0x00, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00,
+	0x06, 0x08, 0x0b, 0x00, 0x09, 0x00, 0xc0, 0x02, 0x07, 0x0a, 0x35, 0x00, 0x08, 0x01, 0xb2, 0x00,
+	0x08, 0x00, 0xa9, 0x00, 0x0d, 0x07, 0x0b, 0x00, 0x0e, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0f,
+	0x0a, 0x09, 0xd2, 0x00, 0x07, 0x0b, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x05, 0x0d, 0x00, 0x00,
+	0x06, 0x0e, 0x00, 0x00, 0x09, 0x04, 0xb0, 0x00, 0x0d, 0x08, 0x7e, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x02, 0x09, 0x00, 0x07, 0x09, 0x08, 0x70, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x40, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x6f,
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49,
+	0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x01, 0x40, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x27, 0x67, 0x00, 0x00,
+	0x00, 0x03, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x00,
+	0x00, 0x42, 0x44, 0x00, 0x00, 0x50, 0x80, 0xa0, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x2a,
+	0x00, 0x44, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x22, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x08, 0x0a, 0x03, 0x4d, 0x89, 0x40, 0x00, 0x00, 0x00, 0x0b,
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x00,
+	0x00, 0x05, 0x98, 0x00, 0x06, 0x00, 0xc0, 0x00, 0x03, 0x02, 0xb1, 0x00, 0x03, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72,
+	0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x02, 0x6e, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x07,
+	0x6e, 0x00, 0x07, 0x03, 0x6e, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x07, 0x6e, 0x01, 0x07, 0x04,
+	0x6e, 0x00, 0x01, 0x07, 0x00, 0x01, 0x07, 0x07, 0x6e, 0x02, 0x07, 0x05, 0x6e, 0x00, 0x03, 0x07,
+	0xad, 0x00, 0x03, 0x09, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x08, 0x00, 0x00, 0x08, 0x00,
+	0x32, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x03, 0x09, 0xad, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x09, 0x01,
+	0xb0, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x32, 0x80, 0x00, 0x04, 0x02, 0x00, 0x03, 0x0b,
+	0xad, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x0a, 0x00, 0x00, 0x0a, 0x08,
+	0x00, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x04, 0x07, 0x0b, 0x00, 0x08, 0x00,
+	0xc0, 0x02, 0x05, 0x09, 0x35, 0x00, 0x07, 0x01, 0xb2, 0x00, 0x07, 0x00, 0xa9, 0x00, 0x06, 0x06,
+	0x0b, 0x00, 0x07, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x08, 0x09, 0x08, 0xd2, 0x00, 0x06, 0x0a,
+	0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x08, 0x03, 0xb0, 0x00, 0x06, 0x07,
+	0x7e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x09, 0x02, 0xc0, 0x00, 0x09, 0x0a,
+	0x03, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x0a, 0x0c, 0x03, 0x00, 0x06, 0x0d, 0x00, 0x04, 0x0a, 0x09,
+	0xc2, 0x09, 0x08, 0x07, 0x70, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x73, 0x4e,
+	0x61, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x13, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x6d, 0x6f,
+	0x64, 0x65, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x61,
+	0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x69, 0x6e,
+	0x69, 0x74, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x74, 0x74, 0x72,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x69, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x19, 0x37, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x41, 0x04, 0x12, 0x00, 0x00, 0x40, 0x54, 0x01, 0x12, 0x42, 0x08, 0x98, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03,
+	0x4a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f,
+	0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x01, 0x03,
+	0x02, 0x6e, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x04, 0xd2, 0x04, 0x02,
+	0x06, 0x6e, 0x05, 0x00, 0x07, 0x3a, 0x05, 0x01, 0x08, 0x3a, 0x00, 0x04, 0x03, 0xb0, 0x00, 0x06,
+	0x03, 0x0b, 0x00, 0x07, 0x03, 0x71, 0x00, 0x06, 0x03, 0x0b, 0x01, 0x08, 0x03, 0x71, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x77, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+	0x65, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63,
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x6f, 0x77, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x63, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x10, 0x0e, 0x00, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x12, 0x84,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x02,
+	0x02, 0x00, 0x00, 0x07, 0x0b, 0x01, 0x07, 0x06, 0x6e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x01,
+	0xb0, 0x00, 0x07, 0x01, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x0b,
+	0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x03, 0x04, 0x04, 0x01, 0x06, 0x6e, 0x06, 0x03, 0x06,
+	0x28, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x04, 0x02, 0x00, 0x03, 0x06,
+	0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x05, 0x02, 0x02, 0x36, 0x7f, 0xff, 0xfc, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x06, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x06, 0x08,
+	0x00, 0x07, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x08, 0x0a, 0x0b, 0x00, 0x07, 0x02,
+	0xb0, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x12, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x01, 0x05,
+	0x04, 0x09, 0x01, 0x06, 0x6e, 0x06, 0x05, 0x06, 0x2c, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x05, 0x06, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x00, 0x06,
+	0x0b, 0x00, 0x06, 0x08, 0x00, 0x0a, 0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x0a,
+	0x00, 0x80, 0x01, 0x0b, 0x04, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x07, 0x04, 0xb0, 0x7f, 0xff, 0xf5,
+	0x02, 0x00, 0x01, 0x00, 0xa2, 0x00, 0x0b, 0x06, 0xad, 0x00, 0x00, 0x08, 0x00, 0x00, 0x06, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74,
+	0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63,
+	0x6f, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65,
+	0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x73, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x72, 0x61, 0x77, 0x5f,
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x82,
+	0x44, 0x00, 0x88, 0x48, 0x20, 0x02, 0x40, 0x40, 0x08, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x80, 0x01, 0x04, 0x04, 0x80,
+	0x00, 0x01, 0x02, 0x80, 0x00, 0x04, 0x04, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x75, 0x72, 0x73, 0x5f,
+	0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0b,
+	0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00,
+	0xb0, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x03, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x6e, 0x64,
+	0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66,
+	0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00,
+	0x02, 0x0b, 0x01, 0x02, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x6e, 0x00, 0x01,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04,
+	0xa0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0xad, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+	0xb0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x04, 0xad, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+	0xb0, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x05, 0x00,
+	0xc0, 0x00, 0x03, 0x06, 0x35, 0x00, 0x04, 0x01, 0xb2, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x04, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x05, 0x06, 0x05, 0xd2, 0x00, 0x06, 0x07, 0x0b, 0x00, 0x05, 0x01,
+	0xb0, 0x00, 0x05, 0x07, 0x00, 0x07, 0x07, 0x06, 0xd2, 0x00, 0x00, 0x08, 0x98, 0x00, 0x06, 0x01,
+	0xb0, 0x00, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x36, 0x02, 0x00, 0x01, 0x04,
+	0x00, 0x08, 0x04, 0x04, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x09, 0x06, 0x05, 0xd2, 0x80, 0x04, 0x07,
+	0x04, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x02, 0x00, 0x00, 0x02, 0x04, 0x00, 0x08, 0x04, 0x04,
+	0x6e, 0x00, 0x02, 0x06, 0x00, 0x09, 0x06, 0x05, 0xd2, 0x80, 0x01, 0x07, 0x04, 0x00, 0x05, 0x01,
+	0xb0, 0x00, 0x05, 0x07, 0x00, 0x0a, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x06, 0x04, 0x02,
+	0x34, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x21, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x01, 0x03,
+	0x04, 0x0b, 0x02, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x28, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x1a, 0x02, 0x00, 0x03, 0x04, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x02, 0x04,
+	0x00, 0x03, 0x04, 0x04, 0x6c, 0x0c, 0x04, 0x04, 0x1a, 0x00, 0x04, 0x00, 0x30, 0x7f, 0xff, 0xf9,
+	0x02, 0x00, 0x02, 0x05, 0x00, 0x09, 0x05, 0x04, 0xd2, 0x80, 0x00, 0x06, 0x04, 0x00, 0x03, 0x07,
+	0x00, 0x00, 0x04, 0x02, 0xb0, 0x0d, 0x04, 0x04, 0x36, 0x00, 0x02, 0x05, 0x00, 0x0e, 0x03, 0x06,
+	0x36, 0x06, 0x05, 0x05, 0x6c, 0x00, 0x05, 0x08, 0x00, 0x0f, 0x08, 0x07, 0xd2, 0x00, 0x07, 0x00,
+	0xb0, 0x07, 0x04, 0x04, 0x34, 0x00, 0x02, 0x09, 0x00, 0x09, 0x09, 0x08, 0xd2, 0x10, 0x03, 0x0a,
+	0x36, 0x00, 0x08, 0x01, 0xb0, 0x08, 0x04, 0x02, 0x34, 0x7f, 0xff, 0xe6, 0x02, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x11, 0x04, 0x35, 0x12, 0x04, 0x04, 0x36, 0x00, 0x04, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45,
+	0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x12, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64,
+	0x20, 0x6b, 0x65, 0x79, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69,
+	0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x04, 0x66,
+	0x69, 0x6e, 0x64, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x11, 0x74,
+	0x6f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x65, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x74, 0x6f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x65, 0x55, 0x70, 0x70,
+	0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x00, 0x0f, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x6e, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x02, 0x03, 0x00, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x00, 0x03,
+	0x04, 0x04, 0x6e, 0x00, 0x04, 0x05, 0x0b, 0x05, 0x04, 0x03, 0x18, 0x00, 0x03, 0x00, 0x9d, 0x00,
+	0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x4b, 0x45, 0x59, 0x5f, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0f, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x25, 0x54, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xb5, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x12, 0x10, 0x16, 0x04, 0x92, 0x80, 0x28, 0x00,
+	0x28, 0x04, 0x04, 0x80, 0x80, 0x20, 0x25, 0x34, 0x40, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x65, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x69, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x01, 0x03, 0x02, 0x6e, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x02, 0x00,
+	0x02, 0x6e, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04,
+	0x03, 0xd2, 0x05, 0x00, 0x05, 0x6e, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x06, 0x00,
+	0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x01, 0x02, 0x00, 0x07, 0x02,
+	0x03, 0x6e, 0x08, 0x03, 0x03, 0x3a, 0x03, 0x07, 0x02, 0x71, 0x00, 0x01, 0x02, 0x00, 0x09, 0x02,
+	0x03, 0x6e, 0x08, 0x03, 0x03, 0x3a, 0x03, 0x09, 0x02, 0x71, 0x00, 0x02, 0x02, 0xc0, 0x00, 0x0a,
+	0x03, 0x03, 0x07, 0x01, 0x04, 0x6e, 0x00, 0x0b, 0x05, 0x03, 0x09, 0x01, 0x06, 0x6e, 0x04, 0x03,
+	0x02, 0xc2, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74,
+	0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x67, 0x65, 0x74, 0x6d, 0x61, 0x78, 0x79, 0x78, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68,
+	0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x79, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x63, 0x6f, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x15, 0x24, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04,
+	0x90, 0xa0, 0x49, 0x02, 0x05, 0x42, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b,
+	0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x77, 0x67, 0x65, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x13,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x30,
+	0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x03, 0x04, 0x03,
+	0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x04, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00,
+	0x05, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x02, 0x0b,
+	0x00, 0x02, 0x04, 0x00, 0x06, 0x04, 0x03, 0xd2, 0x07, 0x00, 0x05, 0x6e, 0x00, 0x06, 0x00, 0x08,
+	0x00, 0x03, 0x02, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x03, 0x03, 0xc0,
+	0x00, 0x08, 0x04, 0x03, 0x00, 0x09, 0x05, 0x03, 0x00, 0x0a, 0x06, 0x03, 0x07, 0x00, 0x07, 0x6e,
+	0x00, 0x0b, 0x08, 0x03, 0x00, 0x09, 0x02, 0xc0, 0x00, 0x0c, 0x0a, 0x03, 0x0c, 0x01, 0x0b, 0x6e,
+	0x00, 0x0d, 0x0c, 0x03, 0x0d, 0x01, 0x0d, 0x6e, 0x04, 0x0a, 0x09, 0xc2, 0x06, 0x04, 0x03, 0xc2,
+	0x03, 0x01, 0x02, 0x71, 0x00, 0x00, 0x02, 0x0b, 0x0e, 0x00, 0x03, 0x6e, 0x03, 0x0e, 0x02, 0x71,
+	0x00, 0x00, 0x02, 0x0b, 0x0f, 0x00, 0x03, 0x6e, 0x03, 0x0f, 0x02, 0x71, 0x00, 0x00, 0x02, 0x0b,
+	0x10, 0x00, 0x03, 0x6e, 0x03, 0x10, 0x02, 0x71, 0x00, 0x00, 0x02, 0x0b, 0x11, 0x00, 0x03, 0x6e,
+	0x03, 0x11, 0x02, 0x71, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x12, 0x04, 0x03, 0xd2,
+	0x00, 0x00, 0x05, 0x0b, 0x01, 0x05, 0x05, 0x6e, 0x0b, 0x05, 0x05, 0x6e, 0x00, 0x03, 0x01, 0xb0,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x23, 0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x68, 0x61, 0x73,
+	0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x69, 0x6e,
+	0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x69, 0x6e, 0x69, 0x74, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77,
+	0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x61,
+	0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x61, 0x6e, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x68, 0x61, 0x73, 0x5f,
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6d, 0x61, 0x78, 0x5f, 0x63,
+	0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6d,
+	0x61, 0x78, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x15, 0x73, 0x65,
+	0x74, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1a, 0x38,
+	0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x14, 0x10, 0x04, 0xa1,
+	0x08, 0x42, 0x08, 0x89, 0x20, 0x82, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80, 0x00, 0x00, 0x0a,
+	0x0b, 0x01, 0x0a, 0x00, 0x6e, 0x00, 0x00, 0x0a, 0x0b, 0x02, 0x0a, 0x01, 0x6e, 0x00, 0x00, 0x0a,
+	0x0b, 0x03, 0x0a, 0x02, 0x6e, 0x80, 0x03, 0x03, 0x04, 0x04, 0x00, 0x0a, 0x6e, 0x05, 0x0a, 0x0a,
+	0x1e, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x06, 0x0a, 0x0b, 0x07, 0x0a, 0x00, 0x6e, 0x80, 0x02, 0x03, 0x04, 0x00, 0x08, 0x0a,
+	0xad, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x0a, 0x03,
+	0xb0, 0x00, 0x06, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x09, 0x0c, 0x0b, 0xd2, 0x00, 0x00, 0x0d,
+	0x00, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x04, 0x00, 0x0a, 0x04, 0x0a, 0x6e, 0x02, 0x0a, 0x0a,
+	0x38, 0x02, 0x0a, 0x05, 0x36, 0x00, 0x0b, 0x06, 0x03, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x26,
+	0x02, 0x80, 0x00, 0x07, 0x02, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x0c, 0x0a, 0x0a,
+	0x6e, 0x0a, 0x07, 0x0a, 0x28, 0x00, 0x0a, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x1e,
+	0x02, 0x00, 0x07, 0x0a, 0x7a, 0x7f, 0xff, 0xf8, 0x02, 0x03, 0x07, 0x0a, 0x20, 0x00, 0x0a, 0x00,
+	0x30, 0x80, 0x00, 0x01, 0x02, 0x0d, 0x06, 0x06, 0x36, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x0e, 0x0b,
+	0x0b, 0x00, 0x0b, 0x0d, 0x00, 0x0f, 0x0d, 0x0c, 0xd2, 0x00, 0x00, 0x0e, 0x0b, 0x07, 0x0e, 0x0e,
+	0x6c, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x0e, 0x00, 0x10, 0x0e, 0x0d, 0xd2, 0x00, 0x11, 0x0f,
+	0x03, 0x00, 0x12, 0x10, 0x03, 0x00, 0x0d, 0x02, 0xb0, 0x00, 0x0d, 0x0f, 0x00, 0x10, 0x0f, 0x0e,
+	0xd2, 0x00, 0x13, 0x10, 0x03, 0x00, 0x14, 0x11, 0x03, 0x00, 0x0e, 0x02, 0xb0, 0x0e, 0x0a, 0x06,
+	0x34, 0x0c, 0x06, 0x0a, 0x6e, 0x05, 0x0a, 0x0a, 0x24, 0x00, 0x0a, 0x00, 0x30, 0x7f, 0xff, 0xe4,
+	0x02, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0xe2, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x0c, 0x06, 0x0a,
+	0x6e, 0x05, 0x0a, 0x0a, 0x20, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x06, 0x0b,
+	0x00, 0x15, 0x0b, 0x0a, 0xd2, 0x80, 0x00, 0x0c, 0x04, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x0a, 0x02,
+	0xb0, 0x00, 0x0a, 0x06, 0x00, 0x16, 0x00, 0x0a, 0x6e, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x02,
+	0x02, 0x00, 0x01, 0x0a, 0x00, 0x80, 0x00, 0x01, 0x02, 0x02, 0x01, 0x0a, 0x3a, 0x00, 0x0a, 0x08,
+	0x00, 0x16, 0x00, 0x0a, 0x6e, 0x00, 0x0a, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x0a,
+	0x00, 0x80, 0x00, 0x01, 0x02, 0x02, 0x02, 0x0a, 0x3a, 0x00, 0x0a, 0x09, 0x00, 0x16, 0x00, 0x0a,
+	0x6e, 0x00, 0x0a, 0x0a, 0x0d, 0x00, 0x0a, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x80, 0x00, 0x09,
+	0x02, 0x17, 0x04, 0x0c, 0x6e, 0x0c, 0x01, 0x0d, 0x18, 0x00, 0x0d, 0x00, 0x30, 0x80, 0x00, 0x04,
+	0x02, 0x0c, 0x06, 0x0e, 0x6e, 0x0e, 0x02, 0x0e, 0x34, 0x0a, 0x04, 0x0f, 0x6e, 0x0f, 0x0e, 0x0d,
+	0x20, 0x00, 0x0d, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x80, 0x00, 0x1d, 0x02, 0x00, 0x18, 0x0a,
+	0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x19, 0x0c, 0x0b, 0xd2, 0x1a, 0x00, 0x0d, 0x6e, 0x00, 0x08, 0x0e,
+	0x00, 0x00, 0x09, 0x0f, 0x00, 0x00, 0x0b, 0x03, 0xb0, 0x00, 0x18, 0x0a, 0x0b, 0x00, 0x0a, 0x0c,
+	0x00, 0x1b, 0x0c, 0x0b, 0xd2, 0x1a, 0x00, 0x0d, 0x6e, 0x00, 0x06, 0x0f, 0x00, 0x15, 0x0f, 0x0e,
+	0xd2, 0x80, 0x00, 0x10, 0x04, 0x0c, 0x06, 0x11, 0x6e, 0x02, 0x11, 0x11, 0x3a, 0x00, 0x0e, 0x02,
+	0xb0, 0x00, 0x0b, 0x02, 0xb0, 0x00, 0x18, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x1c, 0x0c, 0x0b,
+	0xd2, 0x1a, 0x00, 0x0d, 0x6e, 0x00, 0x06, 0x0f, 0x00, 0x15, 0x0f, 0x0e, 0xd2, 0x0c, 0x06, 0x10,
+	0x6e, 0x02, 0x10, 0x10, 0x3a, 0x00, 0x0e, 0x01, 0xb0, 0x00, 0x0b, 0x02, 0xb0, 0x80, 0x00, 0x0d,
+	0x02, 0x00, 0x18, 0x0a, 0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x19, 0x0c, 0x0b, 0xd2, 0x1a, 0x00, 0x0d,
+	0x6e, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x09, 0x0f, 0x00, 0x00, 0x0b, 0x03, 0xb0, 0x00, 0x18, 0x0a,
+	0x0b, 0x00, 0x0a, 0x0c, 0x00, 0x1b, 0x0c, 0x0b, 0xd2, 0x1a, 0x00, 0x0d, 0x6e, 0x00, 0x06, 0x0e,
+	0x00, 0x00, 0x0b, 0x02, 0xb0, 0x00, 0x1d, 0x0a, 0xad, 0x00, 0x0a, 0x00, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69,
+	0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x70, 0x6f, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x63, 0x6f, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe2, 0x86, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f,
+	0x72, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x61,
+	0x64, 0x64, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x69, 0x6e, 0x73, 0x73, 0x74,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x5f, 0x63, 0x75,
+	0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x3e,
+	0x9d, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x42, 0x11, 0x22, 0x22,
+	0x11, 0x41, 0x20, 0x82, 0x44, 0x80, 0x41, 0x15, 0x00, 0x80, 0x80, 0x00, 0x91, 0x12, 0xa1, 0x00,
+	0xa0, 0x20, 0x09, 0x00, 0x01, 0x00, 0x40, 0x00, 0x40, 0x02, 0x20, 0x08, 0x05, 0x20, 0x00, 0x00,
+	0x00, 0x03, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x6f, 0x77,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x10, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x5f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x77, 0x73, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x63, 0x6f, 0x6c, 0x73, 0x5f, 0x61, 0x76, 0x61,
+	0x69, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x79, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x0b,
+	0x01, 0x02, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00,
+	0x03, 0x03, 0x02, 0xd2, 0x04, 0x00, 0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64,
+	0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77,
+	0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64,
+	0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75,
+	0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0c, 0x00,
+	0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x64, 0x65,
+	0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x4d,
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b,
+	0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x02, 0x0b, 0x02, 0x02, 0x00, 0x6e, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00,
+	0x04, 0x04, 0x03, 0xd2, 0x05, 0x00, 0x05, 0x6e, 0x06, 0x01, 0x06, 0x6e, 0x07, 0x01, 0x07, 0x6e,
+	0x00, 0x08, 0x00, 0x08, 0x00, 0x03, 0x04, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x01, 0x08, 0x02, 0x71,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+	0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68,
+	0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x70, 0x61, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x11, 0x12, 0x00, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x0a,
+	0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x28, 0x00,
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x02, 0x01, 0x6e, 0x00,
+	0x03, 0x00, 0x08, 0x03, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x0b, 0x02, 0x00,
+	0x02, 0x04, 0xad, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x05, 0x00, 0x00,
+	0x05, 0x00, 0x32, 0x80, 0x00, 0x04, 0x02, 0x00, 0x03, 0x06, 0xad, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x06, 0x01, 0xb0, 0x04, 0x06, 0x05, 0x2a, 0x00, 0x05, 0x02, 0x00, 0x00, 0x02, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x06, 0x04, 0x35, 0x00,
+	0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x07, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x08,
+	0x04, 0x03, 0xd2, 0x09, 0x01, 0x05, 0x6e, 0x00, 0x07, 0x00, 0x08, 0x07, 0x00, 0x06, 0x18, 0x00,
+	0x06, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x7f, 0xff, 0x06, 0x04, 0x80, 0x00, 0x04, 0x02, 0x00,
+	0x03, 0x08, 0xad, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x06, 0x00, 0x00,
+	0x03, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69,
+	0x73, 0x4e, 0x61, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72,
+	0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x64,
+	0x65, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x77, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68,
+	0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x13, 0x28, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04,
+	0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x6e,
+	0x01, 0x00, 0x01, 0x18, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x01, 0x0b,
+	0x00, 0x02, 0x00, 0xc0, 0x00, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9,
+	0x00, 0x04, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x05, 0x03, 0x02, 0xd2, 0x06, 0x00, 0x04, 0x6e,
+	0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+	0x20, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62,
+	0x65, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x64, 0x65, 0x6c, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x0a,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x01, 0x03, 0x03, 0x6e, 0x03, 0x00,
+	0x03, 0x18, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x04,
+	0x00, 0xc0, 0x00, 0x03, 0x05, 0x03, 0x00, 0x03, 0x01, 0xb2, 0x00, 0x03, 0x00, 0xa9, 0x00, 0x04,
+	0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x05, 0x05, 0x04, 0xd2, 0x06, 0x00, 0x06, 0x6e, 0x07, 0x01,
+	0x07, 0x3a, 0x07, 0x02, 0x08, 0x3a, 0x00, 0x04, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x20, 0x63, 0x61,
+	0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6d, 0x76, 0x77, 0x69, 0x6e, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75,
+	0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00,
+	0x00, 0x00, 0x85, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x08, 0x00, 0x09, 0x08, 0x04, 0x08, 0x18, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x00, 0x00, 0x08, 0x0b, 0x01, 0x08, 0x04, 0x6e, 0x00, 0x02, 0x08, 0x0b, 0x00, 0x08,
+	0x0a, 0x00, 0x03, 0x0a, 0x09, 0xd2, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x04, 0x00,
+	0x0d, 0x3a, 0x04, 0x01, 0x0e, 0x3a, 0x00, 0x09, 0x04, 0xb0, 0x00, 0x09, 0x05, 0x00, 0x00, 0x02,
+	0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x05, 0x0a, 0x09, 0xd2, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x0c,
+	0x00, 0x08, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x09, 0x06, 0x00, 0x00, 0x08, 0x05, 0xc0, 0x00, 0x06,
+	0x09, 0x03, 0x00, 0x07, 0x0a, 0x03, 0x00, 0x08, 0x0b, 0x03, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x09,
+	0x0d, 0x03, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x0a, 0x0f, 0x03, 0x00, 0x10, 0x02, 0xc0, 0x00, 0x0b,
+	0x11, 0x03, 0x0b, 0x06, 0x12, 0x6e, 0x00, 0x0c, 0x13, 0x03, 0x0c, 0x06, 0x14, 0x6e, 0x04, 0x11,
+	0x10, 0xc2, 0x00, 0x0d, 0x11, 0x03, 0x00, 0x12, 0x02, 0xc0, 0x00, 0x0e, 0x13, 0x03, 0x00, 0x04,
+	0x14, 0x00, 0x00, 0x14, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x14, 0x3a, 0x80, 0x00,
+	0x01, 0x02, 0x00, 0x02, 0x14, 0x00, 0x00, 0x10, 0x15, 0x03, 0x00, 0x04, 0x16, 0x00, 0x00, 0x16,
+	0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x0f, 0x03, 0x16, 0x3a, 0x80, 0x00, 0x01, 0x02, 0x00, 0x03,
+	0x16, 0x00, 0x04, 0x13, 0x12, 0xc2, 0x0a, 0x09, 0x08, 0xc2, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00,
+	0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x11, 0x0a, 0x09, 0xd2, 0x00, 0x07, 0x0b, 0x00, 0x00, 0x09,
+	0x01, 0xb0, 0x00, 0x12, 0x08, 0xad, 0x00, 0x07, 0x0a, 0x00, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x07,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x5f, 0x42, 0x4f, 0x52, 0x44, 0x45,
+	0x52, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x65, 0x77,
+	0x77, 0x69, 0x6e, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69,
+	0x73, 0x5f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f,
+	0x72, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x70, 0x61, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x6f, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c,
+	0x65, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x62, 0x6f, 0x72,
+	0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x24, 0x41,
+	0x00, 0x00, 0x00, 0x9b, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0x23,
+	0x00, 0x00, 0x00, 0x10, 0xa0, 0x08, 0x02, 0x61, 0x08, 0x42, 0x10, 0x4a, 0x00, 0x80, 0x11, 0x12,
+	0x10, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x26, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x01,
+	0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x03, 0x00, 0x02,
+	0x01, 0x04, 0x2a, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x0b, 0x02, 0x03, 0x03, 0x05, 0x6e, 0x05,
+	0x01, 0x06, 0x20, 0x00, 0x06, 0x00, 0x32, 0x80, 0x00, 0x06, 0x02, 0x02, 0x02, 0x07, 0x2a, 0x00,
+	0x07, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x04, 0x03, 0x08, 0x6e, 0x08, 0x02, 0x07, 0x20, 0x00,
+	0x07, 0x06, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x0f, 0x02, 0x00,
+	0x05, 0x04, 0x0b, 0x00, 0x05, 0x00, 0xc0, 0x01, 0x06, 0x06, 0x35, 0x07, 0x06, 0x06, 0x36, 0x02,
+	0x06, 0x06, 0x34, 0x08, 0x06, 0x06, 0x36, 0x09, 0x06, 0x06, 0x36, 0x03, 0x03, 0x07, 0x6e, 0x07,
+	0x06, 0x06, 0x34, 0x0a, 0x06, 0x06, 0x36, 0x04, 0x03, 0x08, 0x6e, 0x08, 0x06, 0x06, 0x34, 0x0b,
+	0x06, 0x06, 0x36, 0x00, 0x04, 0x01, 0xb2, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f,
+	0x73, 0x69, 0x7a, 0x65, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x6f, 0x6c, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x12, 0x49, 0x6e,
+	0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x20, 0x66, 0x6f, 0x72,
+	0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6f, 0x66, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x20, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f,
+	0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x84, 0xc4, 0x44, 0x42, 0x21, 0x10, 0x90, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x08, 0x6e, 0x00, 0x08, 0x08, 0x0d, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x01,
+	0x02, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x02, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x02,
+	0x00, 0x04, 0x02, 0x08, 0x6e, 0x05, 0x08, 0x03, 0x3a, 0x06, 0x02, 0x08, 0x6e, 0x05, 0x08, 0x04,
+	0x3a, 0x00, 0x07, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x08, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b,
+	0x00, 0x00, 0x09, 0x01, 0xb0, 0x00, 0x09, 0x05, 0x00, 0x00, 0x07, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0a, 0x0c, 0x0b, 0x00, 0x09, 0x02,
+	0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b,
+	0x6e, 0x80, 0x00, 0x0c, 0x04, 0x80, 0x00, 0x0d, 0x04, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x08,
+	0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x0d, 0x01, 0x0c,
+	0x6e, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09,
+	0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x80, 0x00, 0x0c, 0x04, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x09, 0x03,
+	0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b,
+	0x6e, 0x0e, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x04, 0x0d,
+	0x00, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0f, 0x0a, 0x09,
+	0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x10, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x01, 0x08,
+	0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x00, 0x03, 0x0c,
+	0x00, 0x80, 0x00, 0x0d, 0x04, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x11, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02,
+	0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b,
+	0x6e, 0x80, 0x00, 0x0c, 0x04, 0x80, 0x01, 0x0d, 0x04, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x00, 0x00,
+	0xa1, 0x80, 0x00, 0x10, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x06, 0x04, 0x05, 0x04, 0x08,
+	0x3a, 0x08, 0x06, 0x08, 0x28, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x09,
+	0x02, 0x00, 0x06, 0x08, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x12, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02,
+	0xb0, 0x7f, 0xff, 0xf7, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x00, 0x03, 0x0c, 0x00, 0x80, 0x01, 0x0d,
+	0x04, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x00, 0xa1, 0x80, 0x00, 0x10, 0x02, 0x80, 0x00, 0x06,
+	0x02, 0x80, 0x00, 0x06, 0x04, 0x05, 0x04, 0x08, 0x3a, 0x08, 0x06, 0x08, 0x28, 0x00, 0x08, 0x00,
+	0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x09, 0x02, 0x00, 0x06, 0x08, 0x7a, 0x7f, 0xff, 0xf9,
+	0x02, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b,
+	0x6e, 0x13, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02, 0xb0, 0x7f, 0xff, 0xf7, 0x02, 0x00, 0x01, 0x00,
+	0xa2, 0x00, 0x02, 0x00, 0xa1, 0x80, 0x00, 0x24, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x01, 0x07,
+	0x04, 0x05, 0x03, 0x08, 0x3a, 0x08, 0x07, 0x08, 0x2c, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x03,
+	0x02, 0x80, 0x00, 0x1d, 0x02, 0x00, 0x07, 0x08, 0x7a, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x01, 0x08,
+	0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x00, 0x07, 0x0c,
+	0x00, 0x80, 0x00, 0x0d, 0x04, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a,
+	0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x14, 0x01, 0x0c, 0x6e, 0x00, 0x09, 0x02,
+	0xb0, 0x00, 0x01, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0b, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b,
+	0x6e, 0x00, 0x07, 0x0c, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x09, 0x03, 0xb0, 0x00, 0x01, 0x08,
+	0x0b, 0x00, 0x08, 0x0a, 0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x03, 0x00, 0x0b, 0x6e, 0x15, 0x01, 0x0c,
+	0x6e, 0x00, 0x09, 0x02, 0xb0, 0x7f, 0xff, 0xe3, 0x02, 0x00, 0x02, 0x00, 0xa2, 0x00, 0x07, 0x08,
+	0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x05, 0x0c,
+	0x00, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x16, 0x08, 0xad, 0x00, 0x08, 0x00, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x6d, 0x61, 0x78, 0x79, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x79, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74,
+	0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73,
+	0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x77, 0x61, 0x64, 0x64, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x69, 0x6e, 0x73, 0x73,
+	0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x62,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x65, 0x73,
+	0x74, 0x6f, 0x72, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x0b, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x40, 0xb4, 0x00, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xe5, 0x02,
+	0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf1, 0x02, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 0x52,
+	0x08, 0x42, 0x41, 0x00, 0x90, 0x20, 0x12, 0x04, 0x02, 0x40, 0x80, 0x24, 0x08, 0x04, 0x80, 0x20,
+	0x04, 0x02, 0x12, 0x00, 0x80, 0x10, 0x00, 0x40, 0x48, 0x08, 0x02, 0x01, 0x00, 0x40, 0x21, 0x20,
+	0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02,
+	0x01, 0xd2, 0x00, 0x02, 0x03, 0x0b, 0x03, 0x03, 0x03, 0x6e, 0x04, 0x03, 0x03, 0x6e, 0x00, 0x05,
+	0x04, 0x0b, 0x06, 0x04, 0x04, 0x6e, 0x07, 0x04, 0x04, 0x3a, 0x00, 0x05, 0x05, 0x0b, 0x08, 0x05,
+	0x05, 0x6e, 0x07, 0x05, 0x05, 0x3a, 0x00, 0x01, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 0x6d, 0x6f, 0x76, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74, 0x64, 0x73,
+	0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x6f, 0x77,
+	0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x6f,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65,
+	0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75, 0x69, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x01,
+	0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x75,
+	0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0xae, 0x2a, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x69, 0x00,
+	0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x02, 0x06, 0xc0, 0x84, 0x11, 0xa1,
+	0xf4, 0x36, 0x87, 0x94, 0xa4, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x48, 0x92, 0x49, 0x20, 0x00, 0x20,
+	0x82, 0x09, 0x41, 0x08, 0x42, 0x10, 0x86, 0x85, 0x42, 0x10, 0x84, 0x21, 0x08, 0x29, 0x08, 0x21,
+	0x08, 0x42, 0x00, 0x84, 0x21, 0x08, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x04, 0x21, 0x09, 0x4a,
+	0x10, 0x94, 0x20, 0x84, 0xa1, 0x08, 0x00, 0x4a, 0x10, 0x82, 0x10, 0x84, 0x21, 0x08, 0x42, 0x92,
+	0x68, 0x56, 0x85, 0x42, 0x1a, 0x18, 0x8d, 0x2d, 0xa9, 0xda, 0x4f, 0x4b, 0x34, 0x3e, 0x87, 0x68,
+	0x9d, 0x24, 0xd0, 0xf2, 0xd0, 0xd4, 0xd0, 0xd4, 0xd0, 0xb6, 0xd1, 0x1a, 0x85, 0xa2, 0x34, 0x93,
+	0x42, 0xcb, 0x42, 0xe9, 0x76, 0x89, 0xd6, 0xad, 0x0d, 0x6d, 0x11, 0x2d, 0x0d, 0xa2, 0x1a, 0x2b,
+	0x44, 0x34, 0x46, 0x86, 0x68, 0x8d, 0x0c, 0xd2, 0x1a, 0x69, 0xb4, 0x20, 0x00, 0x00, 0x00, 0x07,
+	0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x70, 0x6f,
+	0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x62, 0x6f,
+	0x72, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x65, 0x73, 0x74,
+	0x6f, 0x72, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x02, 0x6a, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x11, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x06, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x6e,
+	0x65, 0x78, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x09, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x61, 0x69, 0x72, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+	0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff,
+};
+
+static const unsigned char file_20[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1e, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x06, 0x00, 0xab, 0x00, 0x00, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x03,
+	0x00, 0x00, 0x06, 0x00, 0xab, 0x00, 0x01, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x04,
+	0x00, 0x00, 0x06, 0x00, 0xab, 0x00, 0x02, 0x08, 0x03, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x05,
+	0x00, 0x00, 0x04, 0x07, 0x00, 0x03, 0x07, 0x06, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x00, 0x09, 0x15,
+	0xc0, 0x00, 0x04, 0x0a, 0x03, 0x00, 0x01, 0x0b, 0x98, 0x00, 0x05, 0x0c, 0x03, 0x00, 0x02, 0x0d,
+	0x98, 0x00, 0x06, 0x0e, 0x03, 0x00, 0x03, 0x0f, 0x98, 0x00, 0x07, 0x10, 0x03, 0x00, 0x04, 0x11,
+	0x98, 0x00, 0x08, 0x12, 0x03, 0x00, 0x05, 0x13, 0x98, 0x00, 0x09, 0x14, 0x03, 0x00, 0x06, 0x15,
+	0x98, 0x00, 0x0a, 0x16, 0x03, 0x00, 0x07, 0x17, 0x98, 0x00, 0x0b, 0x18, 0x03, 0x00, 0x08, 0x19,
+	0x98, 0x00, 0x0c, 0x1a, 0x03, 0x00, 0x09, 0x1b, 0x98, 0x00, 0x0d, 0x1c, 0x03, 0x00, 0x0a, 0x1d,
+	0x98, 0x14, 0x0a, 0x09, 0xc2, 0x00, 0x0e, 0x0a, 0x03, 0x00, 0x0b, 0x0b, 0x98, 0x00, 0x0f, 0x0c,
+	0x03, 0x00, 0x0c, 0x0d, 0x98, 0x00, 0x10, 0x0e, 0x03, 0x00, 0x0d, 0x0f, 0x98, 0x00, 0x11, 0x10,
+	0x03, 0x00, 0x0e, 0x11, 0x98, 0x00, 0x12, 0x12, 0x03, 0x00, 0x0f, 0x13, 0x98, 0x00, 0x13, 0x14,
+	0x03, 0x00, 0x10, 0x15, 0x98, 0x00, 0x14, 0x16, 0x03, 0x00, 0x11, 0x17, 0x98, 0x00, 0x15, 0x18,
+	0x03, 0x00, 0x12, 0x19, 0x98, 0x00, 0x16, 0x1a, 0x03, 0x00, 0x13, 0x1b, 0x98, 0x00, 0x17, 0x1c,
+	0x03, 0x00, 0x14, 0x1d, 0x98, 0x14, 0x0a, 0x09, 0xc2, 0x00, 0x18, 0x0a, 0x03, 0x00, 0x15, 0x0b,
+	0x98, 0x02, 0x0a, 0x09, 0xc2, 0x00, 0x06, 0x02, 0xb0, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2e, 0x2f,
+	0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x2f,
+	0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x64, 0x6f, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x64, 0x6f, 0x5f, 0x64, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72,
+	0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67,
+	0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x67,
+	0x65, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x19, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64,
+	0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x67, 0x6f, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x68,
+	0x6f, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x67, 0x6f, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65,
+	0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x73, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x73, 0x65, 0x74, 0x5f, 0x69, 0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09,
+	0x73, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x73, 0x65,
+	0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x19, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+	0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x6e, 0x00,
+	0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x07, 0xc0, 0x00,
+	0x03, 0x06, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x05, 0x08, 0x03, 0x00, 0x06, 0x09, 0x03, 0x00,
+	0x07, 0x0a, 0x03, 0x00, 0x06, 0x0b, 0x03, 0x00, 0x08, 0x0c, 0x03, 0x80, 0x00, 0x0d, 0x04, 0x00,
+	0x09, 0x0e, 0x03, 0x00, 0x0a, 0x0f, 0x0b, 0x00, 0x0f, 0x11, 0x00, 0x0b, 0x11, 0x10, 0xd2, 0x00,
+	0x0a, 0x12, 0x0b, 0x0c, 0x12, 0x12, 0x6e, 0x00, 0x10, 0x01, 0xb0, 0x00, 0x10, 0x0f, 0x00, 0x00,
+	0x0d, 0x10, 0x03, 0x00, 0x0a, 0x11, 0x0b, 0x00, 0x11, 0x13, 0x00, 0x0b, 0x13, 0x12, 0xd2, 0x00,
+	0x0a, 0x14, 0x0b, 0x0c, 0x14, 0x14, 0x6e, 0x00, 0x12, 0x01, 0xb0, 0x00, 0x12, 0x11, 0x00, 0x00,
+	0x0e, 0x12, 0x03, 0x00, 0x13, 0x0c, 0xc1, 0x80, 0x00, 0x14, 0x04, 0x00, 0x0a, 0x15, 0x0b, 0x0f,
+	0x15, 0x15, 0x6e, 0x00, 0x10, 0x16, 0x03, 0x00, 0x0a, 0x17, 0x0b, 0x11, 0x17, 0x17, 0x6e, 0x00,
+	0x12, 0x18, 0x03, 0x00, 0x0a, 0x19, 0x0b, 0x13, 0x19, 0x19, 0x6e, 0x00, 0x14, 0x1a, 0x03, 0x00,
+	0x0a, 0x1b, 0x0b, 0x15, 0x1b, 0x1b, 0x6e, 0x00, 0x16, 0x1c, 0x03, 0x00, 0x0a, 0x1d, 0x0b, 0x17,
+	0x1d, 0x1d, 0x6e, 0x00, 0x18, 0x1e, 0x03, 0x00, 0x0a, 0x1f, 0x0b, 0x19, 0x1f, 0x1f, 0x6e, 0x00,
+	0x1a, 0x20, 0x03, 0x0d, 0x14, 0x13, 0xc6, 0x0e, 0x06, 0x05, 0xc2, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x02, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x69, 0x6e, 0x65,
+	0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x75, 0x70, 0x65, 0x72,
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x69, 0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0xed, 0xa0, 0xbe, 0xed,
+	0xbf, 0x84, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c,
+	0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x6e, 0x70,
+	0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x74,
+	0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x15, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+	0x6c, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x45,
+	0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x6c, 0x65,
+	0x66, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6f, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x48, 0x4f, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67,
+	0x6f, 0x5f, 0x68, 0x6f, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x45,
+	0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6f, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x4b, 0x45, 0x59, 0x5f, 0x42, 0x41, 0x43, 0x4b, 0x53, 0x50, 0x41, 0x43, 0x45, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x64, 0x6f, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x45, 0x4c, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x64, 0x6f, 0x5f, 0x64, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x4c,
+	0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69,
+	0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x10,
+	0x84, 0x21, 0x00, 0x20, 0x04, 0x10, 0x88, 0x44, 0x22, 0x11, 0x08, 0x84, 0x22, 0x62, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x00, 0x04, 0x03, 0xd2, 0x00,
+	0x03, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x01,
+	0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x02, 0x22, 0x00,
+	0x02, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x03,
+	0x04, 0x03, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x04, 0x06, 0x05, 0xd2, 0x80, 0x00, 0x07, 0x04, 0x05,
+	0x01, 0x08, 0x3a, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x06, 0xd2, 0x00,
+	0x01, 0x08, 0x00, 0x00, 0x06, 0x01, 0xb0, 0x06, 0x05, 0x05, 0x34, 0x00, 0x03, 0x01, 0xb0, 0x00,
+	0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x06, 0x04, 0x03, 0xd2, 0x05, 0x01, 0x05, 0x3a, 0x00,
+	0x03, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f,
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+	0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x01, 0x3f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65, 0x74, 0x5f, 0x63,
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69,
+	0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x21, 0x00, 0x00, 0x00, 0x32, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x09, 0x20, 0x80, 0x04, 0x40, 0x48, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x00, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00,
+	0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x01, 0x04, 0x03,
+	0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04,
+	0x00, 0x02, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x80, 0x00, 0x07,
+	0x04, 0x00, 0x01, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x00, 0x07, 0x00, 0x03, 0x07, 0x06,
+	0xd2, 0x04, 0x01, 0x08, 0x36, 0x00, 0x06, 0x01, 0xb0, 0x06, 0x05, 0x05, 0x34, 0x00, 0x03, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e,
+	0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73,
+	0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x65, 0x74, 0x5f, 0x69,
+	0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45,
+	0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x19, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x00, 0x00, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00,
+	0xb0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x00, 0x01, 0x06, 0x05,
+	0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x01, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06,
+	0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x02, 0x00, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x04, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x03,
+	0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x05, 0x06, 0x05,
+	0xd2, 0x00, 0x05, 0x00, 0xb0, 0x06, 0x02, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x34,
+	0x02, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00,
+	0xb0, 0x00, 0x09, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06,
+	0x00, 0x0a, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01, 0x08, 0x04, 0x80, 0x01, 0x09,
+	0x04, 0x0b, 0x03, 0x0a, 0x36, 0x02, 0x0a, 0x0a, 0x34, 0x00, 0x05, 0x04, 0xb0, 0x00, 0x07, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00,
+	0x06, 0x00, 0x08, 0x0a, 0x00, 0x0c, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x08,
+	0x00, 0x00, 0x05, 0x02, 0xb0, 0x06, 0x02, 0x04, 0x6e, 0x04, 0x01, 0x04, 0x28, 0x00, 0x04, 0x00,
+	0x30, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x0a, 0x06, 0x05,
+	0xd2, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01, 0x08, 0x04, 0x01, 0x0d, 0x09, 0x35, 0x00, 0x02, 0x0a,
+	0x00, 0x01, 0x0a, 0x0a, 0x6c, 0x00, 0x05, 0x04, 0xb0, 0x80, 0x00, 0x32, 0x02, 0x00, 0x07, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x0a, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01, 0x08,
+	0x04, 0x01, 0x0d, 0x09, 0x35, 0x00, 0x0b, 0x0a, 0x03, 0x00, 0x05, 0x04, 0xb0, 0x80, 0x00, 0x29,
+	0x02, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x0a, 0x00, 0x0e, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00,
+	0xb0, 0x00, 0x09, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06,
+	0x00, 0x0a, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01, 0x08, 0x04, 0x80, 0x01, 0x09,
+	0x04, 0x0b, 0x03, 0x0a, 0x36, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x0b, 0x0d, 0x00, 0x0f, 0x0d, 0x0c,
+	0xd2, 0x00, 0x0c, 0x00, 0xb0, 0x0c, 0x0a, 0x0a, 0x34, 0x00, 0x05, 0x04, 0xb0, 0x00, 0x07, 0x04,
+	0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00,
+	0x06, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x08,
+	0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x07, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x0a, 0x06, 0x05,
+	0xd2, 0x00, 0x00, 0x07, 0x00, 0x80, 0x01, 0x08, 0x04, 0x80, 0x01, 0x09, 0x04, 0x00, 0x03, 0x0a,
+	0x00, 0x00, 0x05, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65,
+	0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75,
+	0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74,
+	0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x69,
+	0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x75, 0x70, 0x65, 0x72, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x65,
+	0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x67, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x19, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c,
+	0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69,
+	0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x2b, 0x7a, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x53, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x09, 0x09, 0x20, 0x01, 0x00, 0x14, 0x00,
+	0x81, 0x00, 0x04, 0x40, 0x09, 0x80, 0x04, 0x00, 0x04, 0x80, 0x20, 0x04, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f,
+	0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x5f, 0x63,
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69,
+	0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x65, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64,
+	0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x69,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x5f, 0x69, 0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e,
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x6e,
+	0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77,
+	0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65,
+	0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e,
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5f, 0x70, 0x6c,
+	0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77,
+	0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02,
+	0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03,
+	0x00, 0x01, 0x03, 0x02, 0xd2, 0x02, 0x00, 0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x73, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70,
+	0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e,
+	0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00,
+	0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x80, 0x00, 0x03,
+	0x04, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65,
+	0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65,
+	0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x02, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x03, 0x06, 0x05, 0xd2, 0x04, 0x00, 0x07, 0x3a, 0x80,
+	0x00, 0x08, 0x04, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73,
+	0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65, 0x74, 0x5f, 0x63,
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4d, 0x61,
+	0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x78, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77,
+	0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x16, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x00,
+	0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00,
+	0x02, 0x04, 0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00,
+	0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x05, 0x0b, 0x00,
+	0x05, 0x07, 0x00, 0x04, 0x07, 0x06, 0xd2, 0x05, 0x01, 0x08, 0x36, 0x06, 0x00, 0x09, 0x6e, 0x00,
+	0x06, 0x02, 0xb0, 0x00, 0x06, 0x05, 0x00, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f,
+	0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x6d, 0x69, 0x6e, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74,
+	0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x04, 0x04, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x01, 0x06, 0x05, 0xd2, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x04, 0x00, 0x9d, 0x02, 0x00, 0x04, 0x2a, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x01,
+	0x02, 0x03, 0x00, 0x04, 0x22, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x04, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x05, 0x06, 0x05,
+	0xd2, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x01, 0x00, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x04, 0x06, 0x00, 0x06, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x05, 0x02,
+	0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x00, 0x07, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00,
+	0xb0, 0x00, 0x05, 0x03, 0x00, 0x08, 0x02, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x24, 0x00, 0x04, 0x00,
+	0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x00, 0x09, 0x06, 0x05,
+	0xd2, 0x01, 0x02, 0x07, 0x34, 0x00, 0x05, 0x01, 0xb0, 0x80, 0x00, 0x0f, 0x02, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x04, 0x06, 0x00, 0x09, 0x06, 0x05, 0xd2, 0x00, 0x02, 0x08, 0x00, 0x0a, 0x08, 0x07,
+	0xd2, 0x80, 0x00, 0x09, 0x04, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0, 0x01, 0x07, 0x07,
+	0x34, 0x00, 0x02, 0x09, 0x00, 0x0a, 0x09, 0x08, 0xd2, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x08, 0x01,
+	0xb0, 0x08, 0x07, 0x07, 0x34, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06,
+	0x00, 0x0b, 0x06, 0x05, 0xd2, 0x0c, 0x03, 0x07, 0x36, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x75,
+	0x70, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79,
+	0x01, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x6f, 0xe0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73,
+	0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x75, 0x62,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x65, 0x74, 0x5f, 0x63,
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75,
+	0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa9,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x04, 0x28, 0x10, 0x10, 0x12, 0x20, 0x22,
+	0x08, 0x00, 0x22, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04,
+	0x00, 0x00, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x02,
+	0x2a, 0x00, 0x02, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x02, 0x01, 0x03, 0x6e, 0x03, 0x00, 0x02,
+	0x20, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x03, 0x00,
+	0xc0, 0x00, 0x04, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x02, 0x00,
+	0x06, 0x00, 0x05, 0x02, 0x71, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x04, 0x00, 0x06, 0x04, 0x03,
+	0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65,
+	0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x16, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72,
+	0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x3a, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c,
+	0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11,
+	0x18, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x02, 0x02, 0x90,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00,
+	0x06, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0x01, 0xb0, 0x03, 0x01, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03,
+	0x00, 0x04, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x75, 0x74, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f,
+	0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0f, 0x0e, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x10, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x69, 0x63, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69,
+	0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69,
+	0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xbe, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00,
+	0x03, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x00, 0x06, 0x01, 0x05, 0x05, 0x6e, 0x04, 0x00, 0x06, 0x6e,
+	0x00, 0x03, 0x02, 0xb0, 0x03, 0x01, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00,
+	0x05, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00,
+	0x06, 0x03, 0x02, 0xd2, 0x00, 0x07, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61,
+	0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x66, 0x69, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+	0x65, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75,
+	0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40,
+	0x04, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71,
+	0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68,
+	0x6f, 0x6c, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+	0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5f, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+	0x6c, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e,
+	0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00,
+	0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x36, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+	0x00, 0xd6, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x09, 0x10, 0x35, 0x60, 0x8d, 0x15, 0x3a,
+	0x16, 0x74, 0xd4, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xae, 0x66, 0x6e, 0x74, 0x2c, 0xe9,
+	0x79, 0xd1, 0x33, 0x73, 0x53, 0xa1, 0xa6, 0xa5, 0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72,
+	0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x69, 0x6e, 0x65, 0x45, 0x64, 0x69, 0x74, 0x6f,
+	0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x04, 0x75, 0x74, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff,
+};
+
+static const unsigned char file_21[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x17, 0x00, 0x1f, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x16, 0x03, 0x98, 0x00, 0x07, 0x00, 0xab, 0x00, 0x00, 0x09, 0x03, 0x00, 0x07, 0x01,
+	0xb0, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x00, 0xab, 0x00, 0x01, 0x09, 0x03, 0x00, 0x07, 0x01,
+	0xb0, 0x00, 0x07, 0x05, 0x00, 0x00, 0x07, 0x00, 0xab, 0x00, 0x02, 0x09, 0x03, 0x00, 0x07, 0x01,
+	0xb0, 0x00, 0x07, 0x06, 0x00, 0x00, 0x05, 0x08, 0x00, 0x03, 0x08, 0x07, 0xd2, 0x00, 0x02, 0x09,
+	0x00, 0x00, 0x0a, 0x15, 0xc0, 0x00, 0x04, 0x0b, 0x03, 0x00, 0x01, 0x0c, 0x98, 0x00, 0x05, 0x0d,
+	0x03, 0x00, 0x02, 0x0e, 0x98, 0x00, 0x06, 0x0f, 0x03, 0x00, 0x03, 0x10, 0x98, 0x00, 0x07, 0x11,
+	0x03, 0x00, 0x04, 0x12, 0x98, 0x00, 0x08, 0x13, 0x03, 0x00, 0x05, 0x14, 0x98, 0x00, 0x09, 0x15,
+	0x03, 0x00, 0x06, 0x16, 0x98, 0x00, 0x0a, 0x17, 0x03, 0x00, 0x07, 0x18, 0x98, 0x00, 0x0b, 0x19,
+	0x03, 0x00, 0x08, 0x1a, 0x98, 0x00, 0x0c, 0x1b, 0x03, 0x00, 0x09, 0x1c, 0x98, 0x00, 0x0d, 0x1d,
+	0x03, 0x00, 0x0a, 0x1e, 0x98, 0x14, 0x0b, 0x0a, 0xc2, 0x00, 0x0e, 0x0b, 0x03, 0x00, 0x0b, 0x0c,
+	0x98, 0x00, 0x0f, 0x0d, 0x03, 0x00, 0x0c, 0x0e, 0x98, 0x00, 0x10, 0x0f, 0x03, 0x00, 0x0d, 0x10,
+	0x98, 0x00, 0x11, 0x11, 0x03, 0x00, 0x0e, 0x12, 0x98, 0x00, 0x12, 0x13, 0x03, 0x00, 0x0f, 0x14,
+	0x98, 0x00, 0x13, 0x15, 0x03, 0x00, 0x10, 0x16, 0x98, 0x00, 0x14, 0x17, 0x03, 0x00, 0x11, 0x18,
+	0x98, 0x00, 0x15, 0x19, 0x03, 0x00, 0x12, 0x1a, 0x98, 0x00, 0x16, 0x1b, 0x03, 0x00, 0x13, 0x1c,
+	0x98, 0x00, 0x17, 0x1d, 0x03, 0x00, 0x14, 0x1e, 0x98, 0x14, 0x0b, 0x0a, 0xc2, 0x00, 0x18, 0x0b,
+	0x03, 0x00, 0x15, 0x0c, 0x98, 0x02, 0x0b, 0x0a, 0xc2, 0x00, 0x07, 0x02, 0xb0, 0x00, 0x02, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x2e, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x2e, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2f, 0x75, 0x74, 0x69,
+	0x6c, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x65,
+	0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x65, 0x74,
+	0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x13, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f,
+	0x70, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x12, 0x67, 0x65,
+	0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x16, 0x67, 0x65, 0x74, 0x5f, 0x73,
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x67, 0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f,
+	0x5f, 0x68, 0x6f, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6f, 0x5f, 0x65, 0x6e, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x70, 0x61, 0x67,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x61,
+	0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65,
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x14, 0x73, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+	0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73,
+	0x65, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x13, 0x73, 0x65, 0x74,
+	0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76,
+	0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x34, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x6e, 0x00,
+	0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x05, 0xc0, 0x00,
+	0x03, 0x06, 0x03, 0x00, 0x04, 0x07, 0x0b, 0x00, 0x05, 0x08, 0x03, 0x00, 0x09, 0x00, 0xc1, 0x00,
+	0x06, 0x0a, 0x03, 0x00, 0x07, 0x0b, 0x0b, 0x00, 0x0b, 0x0d, 0x00, 0x08, 0x0d, 0x0c, 0xd2, 0x00,
+	0x07, 0x0e, 0x0b, 0x09, 0x0e, 0x0e, 0x6e, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x0b, 0x00, 0x00,
+	0x0a, 0x0c, 0x03, 0x00, 0x07, 0x0d, 0x0b, 0x00, 0x0d, 0x0f, 0x00, 0x08, 0x0f, 0x0e, 0xd2, 0x00,
+	0x07, 0x10, 0x0b, 0x09, 0x10, 0x10, 0x6e, 0x00, 0x0e, 0x01, 0xb0, 0x00, 0x0e, 0x0d, 0x00, 0x00,
+	0x0b, 0x0e, 0x03, 0x00, 0x0f, 0x0c, 0xc1, 0x80, 0x00, 0x10, 0x04, 0x00, 0x07, 0x11, 0x0b, 0x0c,
+	0x11, 0x11, 0x6e, 0x00, 0x0d, 0x12, 0x03, 0x00, 0x07, 0x13, 0x0b, 0x0e, 0x13, 0x13, 0x6e, 0x00,
+	0x0f, 0x14, 0x03, 0x00, 0x07, 0x15, 0x0b, 0x10, 0x15, 0x15, 0x6e, 0x00, 0x11, 0x16, 0x03, 0x00,
+	0x07, 0x17, 0x0b, 0x12, 0x17, 0x17, 0x6e, 0x00, 0x13, 0x18, 0x03, 0x00, 0x07, 0x19, 0x0b, 0x14,
+	0x19, 0x19, 0x6e, 0x00, 0x15, 0x1a, 0x03, 0x00, 0x07, 0x1b, 0x0b, 0x16, 0x1b, 0x1b, 0x6e, 0x00,
+	0x17, 0x1c, 0x03, 0x0d, 0x10, 0x0f, 0xc6, 0x0a, 0x06, 0x05, 0xc2, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x02, 0x03, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x69, 0x73, 0x74,
+	0x42, 0x6f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6c, 0x61,
+	0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66,
+	0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x67, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x69, 0x74, 0x65,
+	0x6d, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f,
+	0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x67, 0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f,
+	0x48, 0x4f, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x68, 0x6f, 0x6d, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x67, 0x6f, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f,
+	0x50, 0x50, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65,
+	0x76, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x4e,
+	0x50, 0x41, 0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74,
+	0x5f, 0x70, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x69, 0x73,
+	0x74, 0x42, 0x6f, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74,
+	0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1c, 0x34, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x10, 0x84, 0x00, 0x80, 0x10, 0x42, 0x21, 0x10, 0x88,
+	0x44, 0x22, 0x10, 0x89, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08,
+	0x0a, 0x00, 0x00, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x06, 0x00, 0x08, 0x0a, 0x00, 0x01, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09,
+	0x01, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x0a, 0x00, 0x02, 0x0a, 0x09, 0xd2, 0x00, 0x09,
+	0x00, 0xb0, 0x00, 0x09, 0x02, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x0a, 0x00, 0x03, 0x0a,
+	0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x00, 0x09, 0x03, 0x00, 0x00, 0x08, 0x00, 0x06, 0x04, 0x08,
+	0x08, 0x6e, 0x00, 0x08, 0x0a, 0x00, 0x05, 0x0a, 0x09, 0xd2, 0x00, 0x09, 0x00, 0xb0, 0x80, 0x01,
+	0x04, 0x04, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x08,
+	0x0a, 0x00, 0x07, 0x0a, 0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0c,
+	0x0e, 0x00, 0x08, 0x0e, 0x0d, 0xd2, 0x00, 0x0d, 0x00, 0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x09,
+	0x02, 0xb0, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x00,
+	0x0b, 0x00, 0x80, 0x01, 0x0c, 0x04, 0x80, 0x01, 0x0d, 0x04, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x09,
+	0x04, 0xb0, 0x80, 0x03, 0x04, 0x04, 0x00, 0x0a, 0x08, 0xad, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x08,
+	0x01, 0xb0, 0x00, 0x08, 0x05, 0x00, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0a,
+	0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0c, 0x0e, 0x00, 0x0b, 0x0e,
+	0x0d, 0xd2, 0x00, 0x0d, 0x00, 0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x00,
+	0x00, 0xa1, 0x80, 0x00, 0x3b, 0x02, 0x80, 0x00, 0x0b, 0x02, 0x00, 0x04, 0x06, 0x00, 0x00, 0x05,
+	0x07, 0x00, 0x0c, 0x03, 0x08, 0x6e, 0x08, 0x06, 0x09, 0x2c, 0x00, 0x09, 0x00, 0x30, 0x80, 0x00,
+	0x02, 0x02, 0x0d, 0x02, 0x0a, 0x6e, 0x0a, 0x07, 0x09, 0x28, 0x00, 0x09, 0x00, 0x32, 0x80, 0x00,
+	0x04, 0x02, 0x80, 0x00, 0x2f, 0x02, 0x00, 0x06, 0x08, 0x7a, 0x00, 0x07, 0x09, 0x7a, 0x7f, 0xff,
+	0xf4, 0x02, 0x00, 0x08, 0x00, 0x06, 0x0e, 0x08, 0x08, 0x6e, 0x08, 0x07, 0x08, 0x18, 0x00, 0x08,
+	0x00, 0x30, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0a,
+	0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0c, 0x0e, 0x00, 0x0f, 0x0e,
+	0x0d, 0xd2, 0x00, 0x0d, 0x00, 0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x09, 0x02, 0xb0, 0x00, 0x06,
+	0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x0a, 0x09, 0xd2, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x0b,
+	0x0d, 0x00, 0x00, 0x0d, 0x0c, 0xd2, 0x00, 0x0c, 0x00, 0xb0, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x06,
+	0x0c, 0x00, 0x80, 0x01, 0x0d, 0x04, 0x00, 0x02, 0x0e, 0x00, 0x07, 0x0e, 0x0e, 0x6c, 0x00, 0x09,
+	0x04, 0xb0, 0x00, 0x08, 0x00, 0x06, 0x0e, 0x08, 0x08, 0x6e, 0x08, 0x07, 0x08, 0x18, 0x00, 0x08,
+	0x00, 0x30, 0x7f, 0xff, 0xdc, 0x02, 0x00, 0x06, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0a,
+	0x09, 0xd2, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0c, 0x0e, 0x00, 0x0b, 0x0e,
+	0x0d, 0xd2, 0x00, 0x0d, 0x00, 0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x09, 0x02, 0xb0, 0x7f, 0xff,
+	0xd1, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67,
+	0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x65, 0x74, 0x5f, 0x68,
+	0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x74,
+	0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x75, 0x70, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64,
+	0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x73, 0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x69,
+	0x74, 0x65, 0x6d, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x13, 0x67, 0x65,
+	0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63,
+	0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x16, 0x67, 0x65,
+	0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f,
+	0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x2c, 0x7c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x42, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x09, 0x09, 0x94, 0x00, 0x20, 0x04, 0x50,
+	0x90, 0x00, 0x00, 0x40, 0x04, 0x12, 0x10, 0x00, 0xa0, 0x00, 0x90, 0x80, 0x04, 0xa0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69,
+	0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77,
+	0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0d, 0x04, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73,
+	0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x6d,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69,
+	0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04,
+	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0,
+	0x01, 0x02, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0xd2,
+	0x00, 0x02, 0x00, 0xb0, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x3a,
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74,
+	0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x01, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x09, 0x04, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e,
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73, 0x65,
+	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74,
+	0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x91, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x6e, 0x01, 0x00, 0x00, 0x6c, 0x00,
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x74, 0x65,
+	0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
+	0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5f, 0x73, 0x65, 0x6c, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69,
+	0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x7f, 0xff, 0x03, 0x04, 0x00, 0x01, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f,
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0xd2, 0x80, 0x01, 0x03, 0x04, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65,
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+	0xd2, 0x00, 0x03, 0x00, 0x06, 0x01, 0x03, 0x03, 0x6e, 0x00, 0x03, 0x03, 0x0e, 0x00, 0x01, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f,
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73,
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73,
+	0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0xc4,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x00, 0x03, 0x00, 0x06, 0x01, 0x03, 0x03,
+	0x6e, 0x02, 0x03, 0x03, 0x6e, 0x00, 0x04, 0x00, 0x06, 0x03, 0x04, 0x04, 0x6e, 0x04, 0x03, 0x03,
+	0x38, 0x04, 0x03, 0x03, 0x3a, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73, 0x65, 0x6c,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x01, 0x3f, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2,
+	0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0,
+	0x00, 0x04, 0x04, 0x0e, 0x00, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x67,
+	0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x01, 0xd2, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x04,
+	0x00, 0xb0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69,
+	0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x5f,
+	0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42,
+	0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00,
+	0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74,
+	0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xf7, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2,
+	0x80, 0x00, 0x04, 0x04, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00,
+	0x02, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x65, 0x74, 0x5f,
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00,
+	0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73,
+	0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0c, 0x00, 0x00, 0x00, 0x03,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01,
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02,
+	0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x05, 0x6e, 0x00, 0x03,
+	0x01, 0xb0, 0x03, 0x01, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x04, 0x03,
+	0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5f,
+	0x69, 0x74, 0x65, 0x6d, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x13, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x75, 0x74, 0x69, 0x6c,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x64, 0x72, 0x61,
+	0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c,
+	0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40,
+	0x84, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x2a, 0x00, 0x01, 0x00, 0x32, 0x80,
+	0x00, 0x0a, 0x02, 0x00, 0x02, 0x00, 0x06, 0x01, 0x02, 0x02, 0x6e, 0x02, 0x02, 0x03, 0x6e, 0x00,
+	0x03, 0x00, 0x30, 0x80, 0x00, 0x04, 0x02, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x04, 0x6e, 0x02,
+	0x04, 0x04, 0x6e, 0x04, 0x00, 0x03, 0x24, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0b, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x04, 0x03, 0x35, 0x00,
+	0x01, 0x01, 0xb2, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x01, 0x00, 0x06, 0x00, 0x05, 0x01, 0x71, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x06, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x07, 0x03, 0x02, 0xd2, 0x00, 0x08, 0x04, 0x03, 0x00,
+	0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x64,
+	0x65, 0x78, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+	0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76,
+	0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x66, 0x69, 0x72,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x15, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69,
+	0x74, 0x65, 0x6d, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42,
+	0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x90, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x6e, 0x00, 0x02, 0x02, 0x34, 0x02, 0x00, 0x01, 0x71, 0x00,
+	0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x02, 0x04, 0x03, 0xd2, 0x80,
+	0x00, 0x05, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x06, 0x6e, 0x00, 0x03, 0x02, 0xb0, 0x03,
+	0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03,
+	0x04, 0x03, 0xd2, 0x00, 0x05, 0x00, 0x06, 0x04, 0x05, 0x05, 0x6e, 0x05, 0x05, 0x05, 0x6e, 0x06,
+	0x05, 0x05, 0x3a, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x06, 0x6e, 0x00, 0x03, 0x02, 0xb0, 0x03,
+	0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x07, 0x03, 0x02, 0xd2, 0x00,
+	0x02, 0x00, 0xb0, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x08, 0x03, 0x02, 0xd2, 0x00,
+	0x09, 0x04, 0x03, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0f,
+	0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x69, 0x74,
+	0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x3f,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61,
+	0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x66, 0x69, 0x72, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x15, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x74,
+	0x65, 0x6d, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x23, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x10, 0x01, 0x02, 0x04, 0x21, 0x22, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x06, 0xd2, 0x00, 0x06, 0x00, 0xb0, 0x00, 0x06, 0x01, 0x00,
+	0x00, 0x01, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00, 0x02, 0x08, 0x07, 0xd2, 0x03, 0x01, 0x09, 0x42,
+	0x00, 0x07, 0x01, 0xb0, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x07, 0x06, 0xd2,
+	0x00, 0x06, 0x00, 0xb0, 0x05, 0x06, 0x03, 0x6e, 0x00, 0x00, 0x07, 0x00, 0x06, 0x07, 0x06, 0xd2,
+	0x00, 0x06, 0x00, 0xb0, 0x00, 0x06, 0x04, 0x00, 0x02, 0x04, 0x05, 0x38, 0x00, 0x01, 0x06, 0x0b,
+	0x00, 0x06, 0x08, 0x00, 0x07, 0x08, 0x07, 0xd2, 0x00, 0x05, 0x09, 0x00, 0x01, 0x03, 0x0a, 0x38,
+	0x00, 0x07, 0x02, 0xb0, 0x00, 0x07, 0x05, 0x00, 0x00, 0x01, 0x06, 0x0b, 0x00, 0x06, 0x08, 0x00,
+	0x08, 0x08, 0x07, 0xd2, 0x80, 0x00, 0x09, 0x04, 0x00, 0x05, 0x0a, 0x00, 0x00, 0x07, 0x02, 0xb0,
+	0x00, 0x07, 0x05, 0x00, 0x00, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x6c, 0x6f, 0x6f,
+	0x72, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67,
+	0x65, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e,
+	0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x12, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65,
+	0x63, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d,
+	0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x69, 0x74, 0x65, 0x6d,
+	0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69,
+	0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x23, 0x00, 0x00, 0x00,
+	0x42, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x08, 0x10, 0x26, 0x40, 0x80, 0x26, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x77, 0x75, 0x69, 0x2f, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x45, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x4f, 0x01, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x88, 0x1a, 0xa0, 0x46, 0xa3,
+	0xd1, 0x13, 0xa2, 0x27, 0x44, 0x4e, 0x88, 0x9d, 0x11, 0xa2, 0x34, 0x44, 0xe8, 0x89, 0xd1, 0x33,
+	0xa2, 0x27, 0x44, 0x27, 0x44, 0x4e, 0x88, 0x9d, 0x11, 0x3a, 0x22, 0x74, 0x45, 0x68, 0x8a, 0xd1,
+	0x37, 0xa2, 0x34, 0x3e, 0x89, 0xd1, 0x3a, 0x31, 0xa2, 0xd0, 0x80, 0x00, 0x00, 0x00, 0x07, 0x72,
+	0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x4c, 0x69, 0x73, 0x74, 0x42, 0x6f, 0x78, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x67, 0x65, 0x74, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f,
+	0x69, 0x74, 0x65, 0x6d, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x64,
+	0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x75, 0x74, 0x69, 0x6c, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_22[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1d, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x05, 0x00, 0xab, 0x00, 0x00, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x03,
+	0x00, 0x00, 0x05, 0x00, 0xab, 0x00, 0x01, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04,
+	0x00, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x02, 0x07, 0x00, 0x00, 0x08, 0x11,
+	0xc0, 0x00, 0x03, 0x09, 0x03, 0x00, 0x01, 0x0a, 0x98, 0x00, 0x04, 0x0b, 0x03, 0x00, 0x02, 0x0c,
+	0x98, 0x00, 0x05, 0x0d, 0x03, 0x00, 0x03, 0x0e, 0x98, 0x00, 0x06, 0x0f, 0x03, 0x00, 0x04, 0x10,
+	0x98, 0x00, 0x07, 0x11, 0x03, 0x00, 0x05, 0x12, 0x98, 0x00, 0x08, 0x13, 0x03, 0x00, 0x06, 0x14,
+	0x98, 0x00, 0x09, 0x15, 0x03, 0x00, 0x07, 0x16, 0x98, 0x00, 0x0a, 0x17, 0x03, 0x00, 0x08, 0x18,
+	0x98, 0x00, 0x0b, 0x19, 0x03, 0x00, 0x09, 0x1a, 0x98, 0x00, 0x0c, 0x1b, 0x03, 0x00, 0x0a, 0x1c,
+	0x98, 0x14, 0x09, 0x08, 0xc2, 0x00, 0x0d, 0x09, 0x03, 0x00, 0x0b, 0x0a, 0x98, 0x00, 0x0e, 0x0b,
+	0x03, 0x00, 0x0c, 0x0c, 0x98, 0x00, 0x0f, 0x0d, 0x03, 0x00, 0x0d, 0x0e, 0x98, 0x00, 0x10, 0x0f,
+	0x03, 0x00, 0x0e, 0x10, 0x98, 0x00, 0x11, 0x11, 0x03, 0x00, 0x0f, 0x12, 0x98, 0x00, 0x12, 0x13,
+	0x03, 0x00, 0x10, 0x14, 0x98, 0x00, 0x13, 0x15, 0x03, 0x00, 0x11, 0x16, 0x98, 0x0e, 0x09, 0x08,
+	0xc2, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2e, 0x2f, 0x57, 0x69, 0x64, 0x67,
+	0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67,
+	0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x65,
+	0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f,
+	0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x13, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f, 0x64,
+	0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74,
+	0x5f, 0x70, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67,
+	0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x6e, 0x65,
+	0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x68, 0x6f, 0x6d, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x67, 0x6f, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f,
+	0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67,
+	0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x73, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x14, 0x73,
+	0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x13, 0x73, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x73,
+	0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x6e, 0x00, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02,
+	0xd2, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x05, 0xc0, 0x00, 0x03, 0x06, 0x03, 0x00, 0x04, 0x07,
+	0x0b, 0x00, 0x05, 0x08, 0x03, 0x00, 0x09, 0x00, 0xc1, 0x00, 0x06, 0x0a, 0x03, 0x00, 0x07, 0x0b,
+	0x0b, 0x00, 0x0b, 0x0d, 0x00, 0x08, 0x0d, 0x0c, 0xd2, 0x00, 0x07, 0x0e, 0x0b, 0x09, 0x0e, 0x0e,
+	0x6e, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x0a, 0x0c, 0x03, 0x00, 0x07, 0x0d,
+	0x0b, 0x00, 0x0d, 0x0f, 0x00, 0x08, 0x0f, 0x0e, 0xd2, 0x00, 0x07, 0x10, 0x0b, 0x09, 0x10, 0x10,
+	0x6e, 0x00, 0x0e, 0x01, 0xb0, 0x00, 0x0e, 0x0d, 0x00, 0x00, 0x0b, 0x0e, 0x03, 0x00, 0x0f, 0x0c,
+	0xc1, 0x80, 0x00, 0x10, 0x04, 0x00, 0x07, 0x11, 0x0b, 0x0c, 0x11, 0x11, 0x6e, 0x00, 0x0d, 0x12,
+	0x03, 0x00, 0x07, 0x13, 0x0b, 0x0e, 0x13, 0x13, 0x6e, 0x00, 0x0f, 0x14, 0x03, 0x00, 0x07, 0x15,
+	0x0b, 0x10, 0x15, 0x15, 0x6e, 0x00, 0x11, 0x16, 0x03, 0x00, 0x07, 0x17, 0x0b, 0x12, 0x17, 0x17,
+	0x6e, 0x00, 0x13, 0x18, 0x03, 0x00, 0x07, 0x19, 0x0b, 0x14, 0x19, 0x19, 0x6e, 0x00, 0x15, 0x1a,
+	0x03, 0x00, 0x07, 0x1b, 0x0b, 0x16, 0x1b, 0x1b, 0x6e, 0x00, 0x17, 0x1c, 0x03, 0x0d, 0x10, 0x0f,
+	0xc6, 0x0a, 0x06, 0x05, 0xc2, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x03, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72,
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74,
+	0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f,
+	0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6b, 0x65,
+	0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f,
+	0x6e, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x48, 0x4f, 0x4d,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x6f, 0x5f, 0x68, 0x6f, 0x6d, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6f,
+	0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x50, 0x50, 0x41,
+	0x47, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x70,
+	0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x4e, 0x50, 0x41, 0x47,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6f, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x70, 0x61,
+	0x67, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69,
+	0x65, 0x77, 0x65, 0x72, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74,
+	0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x1c, 0x34, 0x00, 0x00,
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x10, 0x84, 0x00, 0x80, 0x10, 0x42,
+	0x21, 0x10, 0x88, 0x44, 0x22, 0x10, 0x89, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x07, 0x00,
+	0x06, 0x00, 0x07, 0x09, 0x00, 0x00, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x00, 0xb0, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x07, 0x09, 0x00, 0x01, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x00,
+	0xb0, 0x00, 0x08, 0x01, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x07, 0x09, 0x00, 0x02, 0x09, 0x08,
+	0xd2, 0x00, 0x08, 0x00, 0xb0, 0x00, 0x08, 0x02, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x07, 0x09,
+	0x00, 0x03, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x00, 0xb0, 0x00, 0x08, 0x03, 0x00, 0x00, 0x07, 0x00,
+	0x06, 0x04, 0x07, 0x07, 0x6e, 0x00, 0x07, 0x09, 0x00, 0x05, 0x09, 0x08, 0xd2, 0x00, 0x08, 0x00,
+	0xb0, 0x80, 0x01, 0x04, 0x04, 0x00, 0x01, 0x00, 0x30, 0x80, 0x00, 0x13, 0x02, 0x00, 0x06, 0x07,
+	0x0b, 0x00, 0x07, 0x09, 0x00, 0x07, 0x09, 0x08, 0xd2, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0b, 0x00,
+	0x06, 0x00, 0x0b, 0x0d, 0x00, 0x08, 0x0d, 0x0c, 0xd2, 0x00, 0x0c, 0x00, 0xb0, 0x00, 0x0c, 0x0b,
+	0x00, 0x00, 0x08, 0x02, 0xb0, 0x00, 0x06, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x09, 0x09, 0x08,
+	0xd2, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x01, 0x0b, 0x04, 0x80, 0x01, 0x0c, 0x04, 0x00, 0x01, 0x0d,
+	0x00, 0x00, 0x08, 0x04, 0xb0, 0x80, 0x03, 0x04, 0x04, 0x00, 0x06, 0x07, 0x0b, 0x00, 0x07, 0x09,
+	0x00, 0x07, 0x09, 0x08, 0xd2, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x0b, 0x0d,
+	0x00, 0x0a, 0x0d, 0x0c, 0xd2, 0x00, 0x0c, 0x00, 0xb0, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x08, 0x02,
+	0xb0, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00, 0x1e, 0x02, 0x80, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x05,
+	0x00, 0x00, 0x09, 0x00, 0x06, 0x0b, 0x09, 0x06, 0x6e, 0x0c, 0x03, 0x07, 0x6e, 0x07, 0x05, 0x08,
+	0x2c, 0x00, 0x08, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x0d, 0x02, 0x09, 0x6e, 0x09, 0x06, 0x08,
+	0x28, 0x00, 0x08, 0x00, 0x32, 0x80, 0x00, 0x04, 0x02, 0x80, 0x00, 0x11, 0x02, 0x00, 0x05, 0x07,
+	0x7a, 0x00, 0x06, 0x08, 0x7a, 0x7f, 0xff, 0xf4, 0x02, 0x00, 0x06, 0x07, 0x0b, 0x00, 0x07, 0x09,
+	0x00, 0x09, 0x09, 0x08, 0xd2, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0x0c, 0x0b,
+	0xd2, 0x00, 0x0b, 0x00, 0xb0, 0x00, 0x0b, 0x0a, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x80, 0x01, 0x0c,
+	0x04, 0x00, 0x02, 0x0d, 0x00, 0x06, 0x0d, 0x0d, 0x6c, 0x00, 0x08, 0x04, 0xb0, 0x7f, 0xff, 0xef,
+	0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65,
+	0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x09, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e,
+	0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x73, 0x75, 0x70, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72,
+	0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73,
+	0x65, 0x74, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77,
+	0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x13, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x66, 0x69, 0x72,
+	0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69,
+	0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x26, 0x5b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3a, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x09, 0x09, 0x94, 0x00, 0x20, 0x04, 0x50,
+	0x00, 0x51, 0x00, 0x01, 0x04, 0x80, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77,
+	0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f,
+	0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0d, 0x04, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78,
+	0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00,
+	0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f,
+	0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03,
+	0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x01, 0x02, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01,
+	0x03, 0x00, 0x02, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00,
+	0x01, 0x02, 0x03, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74,
+	0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x04, 0x54, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x7f, 0xff, 0x03,
+	0x04, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x73,
+	0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e,
+	0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x02, 0x01, 0xd2, 0x80, 0x01, 0x03, 0x04, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74,
+	0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00,
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x02,
+	0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69,
+	0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65,
+	0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x91, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x01, 0x6e, 0x01, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0x02, 0x0b,
+	0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2, 0x80, 0x00, 0x05, 0x04, 0x00, 0x06, 0x00, 0x06,
+	0x00, 0x06, 0x08, 0x00, 0x05, 0x08, 0x07, 0xd2, 0x00, 0x07, 0x00, 0xb0, 0x07, 0x00, 0x07, 0x38,
+	0x06, 0x07, 0x06, 0x36, 0x00, 0x03, 0x02, 0xb0, 0x03, 0x02, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x01, 0x03, 0x00, 0x07, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x01,
+	0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76,
+	0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65,
+	0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x15, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x24, 0x44, 0x02, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x05,
+	0x00, 0x01, 0x05, 0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x04, 0x04, 0x0e, 0x00, 0x04, 0x03,
+	0x00, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x73,
+	0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61,
+	0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65,
+	0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x01, 0xd2, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x05, 0x00, 0x01, 0x05,
+	0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f,
+	0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0e, 0x0a, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69,
+	0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xbd,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00,
+	0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02,
+	0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x68,
+	0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65,
+	0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x07,
+	0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b,
+	0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x02, 0x01, 0x01,
+	0x73, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x03, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00,
+	0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+	0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65,
+	0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x09,
+	0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01,
+	0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x6d,
+	0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61,
+	0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75,
+	0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x04, 0x6e, 0x01, 0x04, 0x01,
+	0x6e, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x00, 0x02, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00,
+	0xb0, 0x03, 0x05, 0x02, 0x6e, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x03, 0x6e, 0x00, 0x03, 0x03,
+	0x34, 0x00, 0x05, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x06, 0x06, 0x05, 0xd2, 0x02, 0x01, 0x07,
+	0x38, 0x07, 0x07, 0x07, 0x36, 0x00, 0x03, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x05, 0x03,
+	0x00, 0x00, 0x05, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x08, 0x06, 0x05, 0xd2, 0x80, 0x00, 0x07,
+	0x04, 0x00, 0x03, 0x08, 0x00, 0x00, 0x05, 0x02, 0xb0, 0x00, 0x05, 0x03, 0x00, 0x00, 0x04, 0x00,
+	0x06, 0x04, 0x04, 0x04, 0x6e, 0x04, 0x03, 0x04, 0x1c, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x06,
+	0x02, 0x00, 0x04, 0x00, 0x06, 0x03, 0x04, 0x04, 0x71, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06,
+	0x00, 0x09, 0x06, 0x05, 0xd2, 0x00, 0x05, 0x00, 0xb0, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04,
+	0x6e, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x6c,
+	0x69, 0x6e, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x4d, 0x61, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x69, 0x6e, 0x01, 0x3f, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x61, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74,
+	0x56, 0x69, 0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x15, 0x29, 0x00, 0x00,
+	0x00, 0xf2, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x25, 0x30, 0x02, 0x00, 0x90, 0x84,
+	0x0a, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x77, 0x75, 0x69, 0x2f, 0x54, 0x65, 0x78, 0x74, 0x56, 0x69,
+	0x65, 0x77, 0x65, 0x72, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x34, 0x34, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x1a, 0x88, 0x46, 0x99, 0xd1, 0x13, 0xa2, 0x27,
+	0x44, 0x4e, 0x88, 0x9d, 0x11, 0xa2, 0x34, 0x3c, 0xe8, 0x79, 0xd0, 0xf5, 0xa1, 0xf4, 0x46, 0x87,
+	0x4e, 0x87, 0x9d, 0x11, 0x5a, 0x22, 0xb4, 0x45, 0xe8, 0x8a, 0xd2, 0x1a, 0x41, 0x13, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x54, 0x65, 0x78, 0x74, 0x56,
+	0x69, 0x65, 0x77, 0x65, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_23[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1b, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02,
+	0x98, 0x00, 0x05, 0x00, 0xab, 0x00, 0x00, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x03,
+	0x00, 0x00, 0x05, 0x00, 0xab, 0x00, 0x01, 0x07, 0x03, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x04,
+	0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x06, 0x0c, 0xc0, 0x00, 0x03, 0x07, 0x03, 0x00, 0x01, 0x08,
+	0x98, 0x00, 0x04, 0x09, 0x03, 0x00, 0x02, 0x0a, 0x98, 0x00, 0x05, 0x0b, 0x03, 0x00, 0x03, 0x0c,
+	0x98, 0x00, 0x06, 0x0d, 0x03, 0x00, 0x04, 0x0e, 0x98, 0x00, 0x07, 0x0f, 0x03, 0x00, 0x05, 0x10,
+	0x98, 0x00, 0x08, 0x11, 0x03, 0x00, 0x06, 0x12, 0x98, 0x00, 0x09, 0x13, 0x03, 0x00, 0x07, 0x14,
+	0x98, 0x00, 0x0a, 0x15, 0x03, 0x00, 0x08, 0x16, 0x98, 0x00, 0x0b, 0x17, 0x03, 0x00, 0x09, 0x18,
+	0x98, 0x00, 0x0c, 0x19, 0x03, 0x00, 0x0a, 0x1a, 0x98, 0x14, 0x07, 0x06, 0xc2, 0x00, 0x0d, 0x07,
+	0x03, 0x00, 0x0b, 0x08, 0x98, 0x00, 0x0e, 0x09, 0x03, 0x00, 0x0c, 0x0a, 0x98, 0x04, 0x07, 0x06,
+	0xc2, 0x06, 0x02, 0x05, 0x71, 0x00, 0x02, 0x05, 0x00, 0x00, 0x0d, 0x06, 0x98, 0x06, 0x0f, 0x05,
+	0x71, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65,
+	0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70,
+	0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69,
+	0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69, 0x73,
+	0x5f, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6d, 0x65,
+	0x72, 0x67, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73,
+	0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x73, 0x65, 0x74, 0x5f,
+	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x65, 0x74,
+	0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x73, 0x65, 0x74, 0x5f,
+	0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x65,
+	0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x66, 0x69, 0x72, 0x65, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x65, 0x00, 0x00, 0x00, 0x49, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0xc0, 0x00,
+	0x05, 0x04, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x05, 0x0b, 0x05,
+	0x00, 0x04, 0x71, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x05, 0x0b, 0x05, 0x02, 0x04, 0x71, 0x00,
+	0x04, 0x00, 0x06, 0x00, 0x05, 0x00, 0x09, 0x05, 0x03, 0x04, 0x71, 0x00, 0x04, 0x00, 0x06, 0x00,
+	0x05, 0x00, 0x0a, 0x05, 0x04, 0x04, 0x71, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x00, 0xc0, 0x05,
+	0x05, 0x04, 0x71, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x00, 0xc0, 0x05, 0x06, 0x04, 0x71, 0x00,
+	0x04, 0x00, 0x06, 0x00, 0x08, 0x05, 0x0b, 0x00, 0x05, 0x07, 0x00, 0x09, 0x07, 0x06, 0xd2, 0x00,
+	0x08, 0x00, 0x06, 0x00, 0x06, 0x01, 0xb0, 0x0a, 0x06, 0x06, 0x6e, 0x06, 0x07, 0x04, 0x71, 0x00,
+	0x04, 0x00, 0x06, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x05, 0x0b, 0x00,
+	0x05, 0x07, 0x00, 0x0c, 0x07, 0x06, 0xd2, 0x00, 0x08, 0x00, 0x06, 0x07, 0x08, 0x08, 0x6e, 0x0d,
+	0x08, 0x08, 0x6e, 0x0e, 0x08, 0x08, 0x6e, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x06, 0x08, 0x00, 0x0f,
+	0x08, 0x07, 0xd2, 0x00, 0x00, 0x09, 0x98, 0x00, 0x0a, 0x00, 0xc0, 0x00, 0x07, 0x02, 0xb0, 0x07,
+	0x0b, 0x04, 0x71, 0x00, 0x08, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x10, 0x06, 0x05, 0xd2, 0x00,
+	0x07, 0x00, 0xc0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x05, 0x03, 0xb0, 0x00,
+	0x05, 0x03, 0x00, 0x00, 0x08, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x06, 0x05, 0xd2, 0x00,
+	0x03, 0x07, 0x00, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x05, 0x07, 0x00, 0x11, 0x07, 0x06, 0xd2, 0x00,
+	0x01, 0x08, 0x98, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+	0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x77, 0x69, 0x6e, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x5f, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5f, 0x6c, 0x69, 0x73,
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x61, 0x73, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x67, 0x65, 0x74, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x4f, 0x66, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x73, 0x75, 0x70, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74,
+	0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6c,
+	0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45,
+	0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x01, 0x04, 0x00, 0x00, 0x04, 0x02, 0x6e, 0x00, 0x02, 0x04, 0x99, 0x01, 0x04, 0x04, 0x1e, 0x00,
+	0x04, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x01, 0x04, 0x00, 0x02,
+	0x04, 0x03, 0x6e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x02, 0x07, 0x00, 0x03,
+	0x07, 0x06, 0xd2, 0x00, 0x04, 0x08, 0x0b, 0x00, 0x06, 0x01, 0xb0, 0x06, 0x05, 0x04, 0x70, 0x00,
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x62, 0x69, 0x6e, 0x64, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x6c, 0x66, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x11, 0x12, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x48, 0x8a, 0x48, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x00,
+	0x02, 0x00, 0x01, 0x02, 0x02, 0x6e, 0x02, 0x02, 0x02, 0x35, 0x00, 0x01, 0x04, 0x00, 0x02, 0x04,
+	0x03, 0xd0, 0x00, 0x00, 0x05, 0x00, 0x03, 0x05, 0x05, 0x6e, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x00,
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x6c, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x74, 0x5f, 0x01, 0x3f, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57,
+	0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x25, 0x49, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x04, 0x02, 0x48, 0x20, 0x82, 0x08, 0x24, 0x04, 0xa4, 0x00, 0xd1, 0xb1, 0x09, 0x01, 0x20, 0x04,
+	0xa0, 0x00, 0x00, 0x00, 0x0c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x50, 0x72, 0x6f, 0x70,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x72, 0x6f, 0x70, 0x73, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x73, 0x65, 0x6c, 0x66, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x0c, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x64, 0x5f, 0x70, 0x72, 0x6f, 0x70, 0x73, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74,
+	0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e,
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x77, 0x69,
+	0x6e, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64,
+	0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x09, 0x01, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x5f, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a,
+	0x73, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x64, 0x69, 0x73, 0x61,
+	0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x0d, 0x04, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04,
+	0x0b, 0x80, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x00, 0x00, 0xa1, 0x80, 0x00,
+	0x11, 0x02, 0x80, 0x00, 0x06, 0x02, 0x80, 0x00, 0x02, 0x04, 0x01, 0x00, 0x03, 0x6e, 0x03, 0x02,
+	0x03, 0x28, 0x00, 0x03, 0x00, 0x32, 0x80, 0x00, 0x03, 0x02, 0x80, 0x00, 0x0a, 0x02, 0x02, 0x02,
+	0x02, 0x36, 0x7f, 0xff, 0xf9, 0x02, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04,
+	0x04, 0x6c, 0x00, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x36, 0x06, 0x05, 0x05, 0x6c, 0x05, 0x04,
+	0x03, 0x70, 0x7f, 0xff, 0xf6, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c,
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x11, 0x17, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x09, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x01,
+	0x6e, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x02, 0x6c, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x0a,
+	0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x03, 0x6c, 0x00, 0x02, 0x05,
+	0x00, 0x03, 0x05, 0x04, 0xd0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x05, 0x00,
+	0x0a, 0x05, 0x04, 0x04, 0x1c, 0x00, 0x04, 0x00, 0x9d, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x02,
+	0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x01, 0x03,
+	0x00, 0x01, 0x03, 0x03, 0x6e, 0x00, 0x02, 0x05, 0x00, 0x03, 0x05, 0x04, 0xd0, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x0a, 0x05, 0x04, 0x04, 0x1c, 0x00, 0x04, 0x00,
+	0x9d, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57,
+	0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x13, 0x21, 0x00, 0x00, 0x00,
+	0x84, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x80, 0x05, 0x08, 0x00, 0x52, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x5f, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64,
+	0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x99, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00,
+	0x02, 0x00, 0xc0, 0x02, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00, 0x01,
+	0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x6d, 0x65, 0x72, 0x67, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67,
+	0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00,
+	0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5f, 0x6c, 0x69, 0x73,
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0x01, 0xb0, 0x03, 0x01, 0x01, 0x71, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x03, 0x00,
+	0x04, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x77, 0x69, 0x6e, 0x5f, 0x73,
+	0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e, 0x76,
+	0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x40, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x03, 0x6e, 0x00,
+	0x03, 0x02, 0x6c, 0x00, 0x02, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x03, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x03, 0x02, 0xab, 0x00, 0x05, 0x00, 0x06, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x07, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02, 0x00,
+	0x08, 0x00, 0xc0, 0x00, 0x08, 0x07, 0x00, 0x00, 0x03, 0x03, 0xb0, 0x00, 0x03, 0x00, 0x09, 0x00,
+	0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5f, 0x6c, 0x69, 0x73,
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x11, 0x14, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x24,
+	0x85, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1b,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b, 0x03, 0x02, 0x03, 0x18,
+	0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x0b,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x04, 0x0b, 0x00, 0x04, 0x06, 0x00, 0x04, 0x06, 0x05, 0xd2,
+	0x00, 0x03, 0x07, 0x0b, 0x00, 0x07, 0x09, 0x00, 0x05, 0x09, 0x08, 0xd2, 0x02, 0x01, 0x0a, 0x6e,
+	0x00, 0x08, 0x01, 0xb0, 0x00, 0x08, 0x07, 0x00, 0x00, 0x08, 0x01, 0xc0, 0x00, 0x06, 0x09, 0x03,
+	0x00, 0x00, 0x0a, 0x00, 0x02, 0x09, 0x08, 0xc2, 0x00, 0x02, 0x09, 0x00, 0x00, 0x05, 0x03, 0xb0,
+	0x05, 0x02, 0x03, 0x71, 0x00, 0x00, 0x03, 0x00, 0x01, 0x07, 0x03, 0x71, 0x00, 0x00, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+	0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x09, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x73, 0x73, 0x69, 0x67,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65,
+	0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x1b, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x11, 0x14, 0x20, 0x10, 0x22, 0x12, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	0x77, 0x75, 0x69, 0x2f, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x2d, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x1a, 0xdd,
+	0xa1, 0x9a, 0x1e, 0x74, 0x3c, 0xe8, 0x69, 0xd0, 0xf3, 0xa4, 0x74, 0x36, 0x8a, 0xd1, 0x9a, 0x26,
+	0x74, 0x8d, 0x68, 0x79, 0xd1, 0x0b, 0xd1, 0x5a, 0x29, 0x1a, 0x2b, 0x47, 0xa6, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x57, 0x69, 0x64, 0x67, 0x65, 0x74,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_24[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0e, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x0c, 0x02,
+	0x98, 0x00, 0x0d, 0x03, 0x98, 0x00, 0x0e, 0x04, 0x98, 0x00, 0x0b, 0x00, 0xab, 0x00, 0x00, 0x0d,
+	0x03, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x0b, 0x00, 0xab, 0x00, 0x01, 0x0d,
+	0x03, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x06, 0x00, 0x00, 0x0b, 0x00, 0xab, 0x00, 0x02, 0x0d,
+	0x03, 0x00, 0x0b, 0x01, 0xb0, 0x00, 0x0b, 0x07, 0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0b, 0x00,
+	0xc0, 0x00, 0x0b, 0x09, 0x00, 0x00, 0x0b, 0x00, 0xc0, 0x00, 0x0b, 0x0a, 0x00, 0x00, 0x09, 0x0b,
+	0x00, 0x00, 0x00, 0x0c, 0x98, 0x0c, 0x03, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x01, 0x0c,
+	0x98, 0x0c, 0x04, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x02, 0x0c, 0x98, 0x0c, 0x05, 0x0b,
+	0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x03, 0x0c, 0x98, 0x0c, 0x06, 0x0b, 0x71, 0x00, 0x09, 0x0b,
+	0x00, 0x00, 0x04, 0x0c, 0x98, 0x0c, 0x07, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x05, 0x0c,
+	0x98, 0x0c, 0x08, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x06, 0x0c, 0x98, 0x0c, 0x09, 0x0b,
+	0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x07, 0x0c, 0x98, 0x0c, 0x0a, 0x0b, 0x71, 0x00, 0x09, 0x0b,
+	0x00, 0x00, 0x08, 0x0c, 0x98, 0x0c, 0x0b, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x09, 0x0c,
+	0x98, 0x0c, 0x0c, 0x0b, 0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x0a, 0x0c, 0x98, 0x0c, 0x0d, 0x0b,
+	0x71, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x0b, 0x0c, 0x98, 0x0c, 0x0e, 0x0b, 0x71, 0x00, 0x09, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x61, 0x64, 0x64, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x65, 0x6c, 0x5f,
+	0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65,
+	0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x67, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x67, 0x65,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x64, 0x72, 0x61,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x65, 0x6e, 0x64, 0x5f,
+	0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x11, 0x73, 0x65, 0x74, 0x5f, 0x64, 0x65, 0x62, 0x75,
+	0x67, 0x5f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x02, 0x6c, 0x00, 0x02, 0x00,
+	0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x02, 0x04,
+	0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x03, 0x02, 0xad, 0x00, 0x04, 0x04,
+	0x03, 0x00, 0x05, 0x05, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x03, 0xb0, 0x00, 0x00, 0x02,
+	0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x04, 0xc0, 0x00, 0x06, 0x05, 0x03, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x07, 0x07, 0x03, 0x00, 0x01, 0x08, 0x00, 0x00, 0x08, 0x09, 0x03, 0x00, 0x0a, 0x01,
+	0xab, 0x00, 0x09, 0x0c, 0x0b, 0x00, 0x0c, 0x0e, 0x00, 0x0a, 0x0e, 0x0d, 0xd2, 0x00, 0x09, 0x0f,
+	0x0b, 0x0b, 0x0f, 0x0f, 0x6e, 0x00, 0x0d, 0x01, 0xb0, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x0a, 0x01,
+	0xb0, 0x00, 0x0c, 0x0b, 0x03, 0x00, 0x0d, 0x0c, 0x0b, 0x08, 0x05, 0x04, 0xc2, 0x04, 0x03, 0x02,
+	0x70, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0f,
+	0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x3a, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75,
+	0x69, 0x00, 0x00, 0x00, 0x00, 0x07, 0x61, 0x64, 0x64, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67,
+	0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x24, 0x00, 0x00, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x14, 0x12, 0x42, 0x10, 0x00, 0x82, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0e,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x02, 0x04, 0x00, 0x00, 0x04, 0x00, 0x32, 0x80, 0x00, 0x02, 0x02,
+	0x00, 0x05, 0x00, 0xc0, 0x00, 0x05, 0x04, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0b,
+	0x00, 0x04, 0x03, 0x6c, 0x00, 0x03, 0x04, 0x0d, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x04, 0x0b, 0x00, 0x05, 0x00, 0xc0, 0x00, 0x02, 0x06, 0x35, 0x00, 0x04, 0x01, 0xb2,
+	0x00, 0x04, 0x00, 0xa9, 0x03, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x30, 0x80, 0x00, 0x0d, 0x02,
+	0x00, 0x04, 0x04, 0xad, 0x05, 0x01, 0x06, 0x6e, 0x06, 0x06, 0x06, 0x6e, 0x07, 0x06, 0x06, 0x36,
+	0x08, 0x03, 0x07, 0x6e, 0x07, 0x06, 0x06, 0x34, 0x00, 0x09, 0x07, 0x03, 0x00, 0x0a, 0x08, 0x0b,
+	0x00, 0x04, 0x03, 0xb0, 0x03, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x09, 0x06, 0x05, 0xd2,
+	0x00, 0x05, 0x00, 0xb0, 0x00, 0x04, 0x04, 0xad, 0x00, 0x01, 0x06, 0x00, 0x00, 0x0b, 0x07, 0x03,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x03, 0xb0, 0x00, 0x03, 0x04, 0x00, 0x01, 0x03, 0x04, 0x71,
+	0x00, 0x01, 0x05, 0x00, 0x09, 0x05, 0x04, 0xd2, 0x0c, 0x03, 0x06, 0x6e, 0x00, 0x04, 0x01, 0xb0,
+	0x00, 0x01, 0x05, 0x00, 0x0d, 0x05, 0x04, 0xd2, 0x00, 0x04, 0x00, 0xb0, 0x00, 0x01, 0x00, 0x9d,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x17, 0x57,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65,
+	0x78, 0x69, 0x73, 0x74, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67, 0x65,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x73, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65,
+	0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x6e,
+	0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x04, 0xa4, 0x80, 0xa2, 0x00, 0x20, 0x50, 0x4a, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x03, 0x0b, 0x00, 0x03, 0x01, 0x6c, 0x00, 0x01, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x02, 0x05, 0x35, 0x00,
+	0x03, 0x01, 0xb2, 0x00, 0x03, 0x00, 0xa9, 0x03, 0x01, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80,
+	0x00, 0x0c, 0x02, 0x00, 0x04, 0x03, 0xad, 0x05, 0x02, 0x05, 0x6e, 0x06, 0x05, 0x05, 0x6e, 0x07,
+	0x05, 0x05, 0x36, 0x08, 0x01, 0x06, 0x6e, 0x06, 0x05, 0x05, 0x34, 0x00, 0x09, 0x06, 0x03, 0x00,
+	0x0a, 0x07, 0x0b, 0x00, 0x03, 0x03, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x09, 0x04, 0x03, 0xd2, 0x00,
+	0x03, 0x00, 0xb0, 0x00, 0x04, 0x03, 0xad, 0x00, 0x0b, 0x05, 0x03, 0x00, 0x0c, 0x06, 0x03, 0x00,
+	0x00, 0x07, 0x00, 0x00, 0x03, 0x03, 0xb0, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x03, 0x03, 0x74, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x17, 0x57, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78,
+	0x69, 0x73, 0x74, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63,
+	0x6c, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73,
+	0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66,
+	0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x64, 0x65, 0x6c, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73,
+	0x00, 0x00, 0x00, 0x14, 0x21, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x49, 0x01, 0x52, 0x80, 0x08, 0x28, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x03, 0x0b,
+	0x00, 0x03, 0x01, 0x6c, 0x00, 0x01, 0x03, 0x0d, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02,
+	0x00, 0x01, 0x03, 0x0b, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x02, 0x05, 0x35, 0x00, 0x03, 0x01, 0xb2,
+	0x00, 0x03, 0x00, 0xa9, 0x03, 0x01, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x0c, 0x02,
+	0x00, 0x04, 0x03, 0xad, 0x05, 0x02, 0x05, 0x6e, 0x06, 0x05, 0x05, 0x6e, 0x07, 0x05, 0x05, 0x36,
+	0x08, 0x01, 0x06, 0x6e, 0x06, 0x05, 0x05, 0x34, 0x00, 0x09, 0x06, 0x03, 0x00, 0x0a, 0x07, 0x0b,
+	0x00, 0x03, 0x03, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x09, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0,
+	0x00, 0x04, 0x03, 0xad, 0x00, 0x0b, 0x05, 0x03, 0x00, 0x0c, 0x06, 0x03, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x03, 0x03, 0xb0, 0x00, 0x01, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x0b, 0x04, 0x03, 0x03, 0x71,
+	0x00, 0x0d, 0x03, 0x0b, 0x00, 0x03, 0x05, 0x00, 0x0e, 0x05, 0x04, 0xd2, 0x0f, 0x01, 0x06, 0x6e,
+	0x00, 0x04, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72,
+	0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x17, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x6f,
+	0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x3a, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65,
+	0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e,
+	0x6e, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x69, 0x6e, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x16, 0x28, 0x00, 0x00, 0x00, 0x77, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x49, 0x01, 0x52, 0x80, 0x08, 0x28, 0x24, 0x80, 0x98, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x01, 0x02, 0x0d,
+	0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0,
+	0x00, 0x02, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x03, 0x01, 0x02, 0x6e,
+	0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74,
+	0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x17, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e,
+	0x6f, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77,
+	0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x10, 0x0d, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x49, 0x01, 0x48,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x01, 0x02,
+	0x0d, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x05, 0x02, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x03, 0x00,
+	0xc0, 0x00, 0x02, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x03, 0x01, 0x02,
+	0x6e, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e,
+	0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x17, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20,
+	0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x0d,
+	0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x49, 0x01, 0x48, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0xd2, 0x00,
+	0x01, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x01, 0xd2, 0x00,
+	0x03, 0x00, 0x0a, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x03,
+	0x02, 0x01, 0xd2, 0x00, 0x01, 0x00, 0xb0, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x05,
+	0x02, 0x01, 0xd2, 0x00, 0x00, 0x03, 0x0b, 0x06, 0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb0, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x63, 0x75, 0x72, 0x73, 0x5f, 0x73, 0x65,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x74, 0x65, 0x78, 0x69, 0x74, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00,
+	0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10,
+	0x10, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0, 0x00,
+	0x01, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x00,
+	0xc8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00,
+	0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x0b, 0x02, 0x04,
+	0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x01, 0xad, 0x00, 0x04,
+	0x03, 0x03, 0x00, 0x05, 0x04, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x03, 0xb0, 0x00, 0x06,
+	0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x07, 0x03, 0x02, 0xd2, 0x00, 0x08, 0x04, 0x0b, 0x00, 0x02,
+	0x01, 0xb0, 0x00, 0x02, 0x04, 0x00, 0x09, 0x04, 0x03, 0xd2, 0x00, 0x00, 0x05, 0x98, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x65, 0x6c,
+	0x61, 0x79, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45,
+	0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x04, 0x0b, 0x00,
+	0x02, 0x01, 0xb0, 0x02, 0x00, 0x01, 0x71, 0x03, 0x00, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x03, 0x00, 0x01, 0x6e, 0x00, 0x01, 0x03, 0x00, 0x04, 0x03, 0x02, 0xd2, 0x00,
+	0x00, 0x04, 0x6e, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67,
+	0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0xdb, 0x00,
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x12, 0x16, 0x00, 0x00,
+	0x00, 0xd6, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x42, 0x40, 0xd0, 0xc8, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x00, 0xa1, 0x80, 0x00, 0x29, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x09, 0x00,
+	0x02, 0x00, 0x30, 0x80, 0x00, 0x25, 0x02, 0x00, 0x00, 0x02, 0xad, 0x00, 0x02, 0x00, 0xb0, 0x00,
+	0x01, 0x02, 0xad, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x03,
+	0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x02, 0xad, 0x00,
+	0x05, 0x04, 0x03, 0x00, 0x03, 0x05, 0x03, 0x00, 0x01, 0x06, 0x00, 0x00, 0x02, 0x03, 0xb0, 0x00,
+	0x02, 0x02, 0x0b, 0x06, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x80,
+	0x00, 0x05, 0x02, 0x00, 0x05, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x07, 0x04, 0x03, 0xd2, 0x00,
+	0x03, 0x00, 0xb0, 0x7f, 0xff, 0xe5, 0x02, 0x00, 0x02, 0x00, 0xab, 0x00, 0x01, 0x04, 0x00, 0x00,
+	0x02, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x0a, 0x03, 0x02, 0x02, 0x18, 0x00, 0x02, 0x00, 0x30, 0x7f,
+	0xff, 0xde, 0x02, 0x00, 0x04, 0x02, 0xad, 0x00, 0x05, 0x04, 0x03, 0x00, 0x08, 0x05, 0x03, 0x00,
+	0x02, 0x02, 0xb0, 0x80, 0x00, 0x01, 0x02, 0x7f, 0xff, 0xd8, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00,
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x67, 0x65, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x45, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x72, 0x65, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x78, 0x69,
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x17, 0x2d, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x21, 0x21,
+	0x21, 0x21, 0x02, 0x28, 0x08, 0x11, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x01, 0x00, 0x0a,
+	0x00, 0x00, 0x02, 0xad, 0x00, 0x01, 0x04, 0x03, 0x00, 0x02, 0x05, 0x03, 0x00, 0x00, 0x06, 0x00,
+	0x00, 0x02, 0x03, 0xb0, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2,
+	0x00, 0x05, 0x05, 0x0b, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x05, 0x00, 0x06, 0x05, 0x04, 0xd2,
+	0x00, 0x00, 0x06, 0x98, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x01, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77,
+	0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76,
+	0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x01, 0x03,
+	0x0d, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x04,
+	0x00, 0x01, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x02, 0x00, 0x04, 0x6e, 0x04, 0x03, 0x03,
+	0x1c, 0x00, 0x03, 0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x03, 0x03, 0x0b, 0x00, 0x04, 0x00,
+	0xc0, 0x04, 0x00, 0x05, 0x6e, 0x05, 0x05, 0x05, 0x35, 0x00, 0x03, 0x01, 0xb2, 0x00, 0x03, 0x00,
+	0xa9, 0x00, 0x01, 0x04, 0x00, 0x06, 0x04, 0x03, 0xd2, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x03, 0x00,
+	0x30, 0x80, 0x00, 0x09, 0x02, 0x00, 0x07, 0x03, 0xad, 0x08, 0x01, 0x05, 0x6e, 0x09, 0x05, 0x05,
+	0x6e, 0x0a, 0x05, 0x05, 0x36, 0x04, 0x00, 0x06, 0x6e, 0x06, 0x05, 0x05, 0x34, 0x00, 0x0b, 0x06,
+	0x03, 0x00, 0x03, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x04, 0x00, 0x0c, 0x04, 0x03,
+	0xd2, 0x00, 0x0d, 0x05, 0x0b, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x03, 0x02, 0x00, 0x00, 0x07, 0x03,
+	0xad, 0x08, 0x01, 0x05, 0x6e, 0x09, 0x05, 0x05, 0x6e, 0x0a, 0x05, 0x05, 0x36, 0x04, 0x00, 0x06,
+	0x6e, 0x06, 0x05, 0x05, 0x34, 0x00, 0x0c, 0x06, 0x03, 0x00, 0x0d, 0x07, 0x0b, 0x00, 0x02, 0x08,
+	0x00, 0x00, 0x03, 0x04, 0xb0, 0x00, 0x0e, 0x03, 0x0b, 0x02, 0x03, 0x03, 0x50, 0x00, 0x0e, 0x03,
+	0x9b, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65, 0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+	0x64, 0x20, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69,
+	0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x69,
+	0x73, 0x5f, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64,
+	0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x12, 0x73, 0x6b, 0x69, 0x70, 0x70, 0x65, 0x64, 0x20, 0x28, 0x64, 0x69, 0x73, 0x61, 0x62,
+	0x6c, 0x65, 0x64, 0x29, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x65, 0x6e, 0x64, 0x5f, 0x6b, 0x65,
+	0x79, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65,
+	0x73, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x17,
+	0x33, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x92, 0x28, 0x08, 0x05,
+	0x04, 0x00, 0x8a, 0x09, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x03,
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x90, 0x90, 0x34, 0xaa, 0x60, 0x00, 0x00, 0x00, 0x03,
+	0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6c,
+	0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x65, 0x6e, 0x61, 0x62,
+	0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0d, 0x02,
+	0x00, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x14, 0x0b, 0x80,
+	0x00, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x02, 0x0d, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x01, 0x02,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x02, 0x0b, 0x02, 0x02, 0x02, 0x6e, 0x03, 0x02, 0x02, 0x6e,
+	0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x05, 0x0b, 0x00, 0x03, 0x01, 0xb0,
+	0x00, 0x03, 0x05, 0x00, 0x03, 0x05, 0x04, 0xd2, 0x80, 0x01, 0x06, 0x04, 0x00, 0x04, 0x01, 0xb0,
+	0x00, 0x04, 0x01, 0x00, 0x06, 0x00, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x07, 0x02,
+	0x00, 0x01, 0x03, 0x00, 0x07, 0x03, 0x02, 0xd2, 0x06, 0x00, 0x04, 0x6e, 0x08, 0x04, 0x04, 0x6e,
+	0x09, 0x04, 0x04, 0x36, 0x00, 0x02, 0x01, 0xb0, 0x80, 0x00, 0x04, 0x02, 0x00, 0x01, 0x03, 0x00,
+	0x07, 0x03, 0x02, 0xd2, 0x09, 0x00, 0x04, 0x36, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x0a, 0x02, 0x0b,
+	0x0b, 0x02, 0x02, 0x6e, 0x00, 0x02, 0x04, 0x00, 0x0c, 0x04, 0x03, 0xd2, 0x00, 0x05, 0x00, 0x08,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x03, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+	0x0d, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x72, 0x6f,
+	0x74, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x6c, 0x69, 0x63, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x72,
+	0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x61, 0x73,
+	0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x75, 0x6e, 0x73, 0x68, 0x69, 0x66, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x6c,
+	0x6e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69,
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x14, 0x27, 0x00, 0x00,
+	0x00, 0x2c, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x11, 0x40, 0x02, 0x48, 0x04, 0x40, 0xa0,
+	0x20, 0x00, 0x00, 0x00, 0x06, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x61, 0x72, 0x67, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x00, 0x01, 0x02,
+	0x03, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x02, 0xb0, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x02,
+	0x00, 0x04, 0x02, 0x01, 0xd2, 0x00, 0x05, 0x03, 0x0b, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x01, 0x03,
+	0x00, 0x06, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x98, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x61, 0x6c, 0x75,
+	0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+	0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x01, 0x02, 0x0d, 0x00, 0x02,
+	0x00, 0x30, 0x80, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03,
+	0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x02, 0x00, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x1c, 0x00, 0x02,
+	0x00, 0x30, 0x80, 0x00, 0x06, 0x02, 0x00, 0x03, 0x02, 0x0b, 0x00, 0x03, 0x00, 0xc0, 0x04, 0x00,
+	0x04, 0x6e, 0x04, 0x05, 0x04, 0x35, 0x00, 0x02, 0x01, 0xb2, 0x00, 0x02, 0x00, 0xa9, 0x06, 0x01,
+	0x02, 0x6e, 0x00, 0x02, 0x00, 0x30, 0x80, 0x00, 0x18, 0x02, 0x00, 0x07, 0x02, 0xad, 0x00, 0x08,
+	0x04, 0x03, 0x00, 0x09, 0x05, 0x03, 0x04, 0x00, 0x06, 0x6e, 0x00, 0x02, 0x03, 0xb0, 0x00, 0x0a,
+	0x02, 0x0b, 0x00, 0x02, 0x04, 0x00, 0x09, 0x04, 0x03, 0xd2, 0x02, 0x00, 0x05, 0x6e, 0x00, 0x03,
+	0x01, 0xb0, 0x00, 0x07, 0x02, 0xad, 0x0b, 0x01, 0x04, 0x6e, 0x0c, 0x04, 0x04, 0x6e, 0x0d, 0x04,
+	0x04, 0x36, 0x04, 0x00, 0x05, 0x6e, 0x05, 0x04, 0x04, 0x34, 0x00, 0x0e, 0x05, 0x03, 0x00, 0x02,
+	0x02, 0xb0, 0x00, 0x01, 0x03, 0x00, 0x0e, 0x03, 0x02, 0xd2, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x01,
+	0x02, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x03, 0x06, 0x02, 0x71, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x07, 0x67, 0x65,
+	0x74, 0x5f, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x69, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0x64, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x77, 0x69, 0x64, 0x67, 0x65,
+	0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+	0x77, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x03, 0x77,
+	0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00,
+	0x00, 0x16, 0x2e, 0x00, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x92, 0x28,
+	0x08, 0x05, 0x10, 0x10, 0x12, 0x02, 0x09, 0x24, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00, 0x00, 0x0c,
+	0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10,
+	0x0e, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x06, 0x94, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x0b, 0x80, 0x00, 0x00, 0x00, 0xad, 0x00, 0x01, 0x02, 0x03, 0x00, 0x02, 0x03, 0x03,
+	0x00, 0x00, 0x02, 0xb0, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x01, 0xd2,
+	0x00, 0x03, 0x03, 0x0b, 0x04, 0x03, 0x03, 0x6e, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x05, 0x00, 0x0b,
+	0x00, 0x00, 0x02, 0x00, 0x06, 0x02, 0x01, 0xd2, 0x00, 0x07, 0x03, 0x0b, 0x00, 0x01, 0x01, 0xb0,
+	0x00, 0x01, 0x03, 0x00, 0x08, 0x03, 0x02, 0xd2, 0x00, 0x00, 0x04, 0x98, 0x00, 0x02, 0x01, 0xb0,
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x77, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66, 0x72, 0x65,
+	0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73,
+	0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0x6f, 0x72, 0x45,
+	0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00,
+	0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x02, 0x00, 0x04, 0x6e, 0x00,
+	0x02, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x77, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77,
+	0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x0e, 0x06,
+	0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66,
+	0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x12, 0x09, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x77, 0x75, 0x69, 0x2f,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x35, 0x3a, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0d, 0x2f, 0xa1, 0x52, 0xd1, 0x1a,
+	0x35, 0xa2, 0xf4, 0xab, 0x43, 0xe9, 0x16, 0x88, 0xd2, 0x8d, 0x11, 0xa2, 0x1a, 0x23, 0x44, 0x34,
+	0x2e, 0x86, 0x69, 0x2a, 0x68, 0xbd, 0x18, 0xd0, 0xda, 0x4d, 0xa2, 0x34, 0xeb, 0x42, 0xcb, 0x5f,
+	0xc0, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x64, 0x65, 0x62,
+	0x75, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x64, 0x72, 0x61, 0x77, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x04, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x04, 0x74, 0x65, 0x72, 0x6d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x65, 0x6e,
+	0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x77, 0x75, 0x69,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00,
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char file_25[] = {
+	0xbf, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x0b, 0x80, 0x00, 0x04, 0x00,
+	0xab, 0x00, 0x00, 0x06, 0x03, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x00,
+	0xc0, 0x00, 0x04, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x05, 0x98, 0x05, 0x01, 0x04,
+	0x71, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75,
+	0x69, 0x00, 0x00, 0x00, 0x00, 0x11, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x64, 0x72,
+	0x61, 0x77, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x04, 0x0b, 0x80, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0xd2, 0x00,
+	0x04, 0x00, 0xc0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x02, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x01, 0x6e, 0x00, 0x03, 0x02, 0x0b, 0x04, 0x02, 0x02, 0x6e, 0x02, 0x01, 0x01, 0x4c, 0x00,
+	0x01, 0x00, 0x30, 0x80, 0x00, 0x08, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x6e, 0x00,
+	0x03, 0x03, 0x0b, 0x04, 0x03, 0x03, 0x6e, 0x00, 0x03, 0x03, 0x0c, 0x03, 0x02, 0x02, 0x4c, 0x02,
+	0x02, 0x01, 0x71, 0x80, 0x00, 0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x6e, 0x00,
+	0x03, 0x03, 0x0b, 0x04, 0x03, 0x03, 0x6e, 0x03, 0x02, 0x02, 0x50, 0x02, 0x02, 0x01, 0x71, 0x00,
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x41, 0x5f, 0x52, 0x45, 0x56, 0x45, 0x52, 0x53, 0x45, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x74,
+	0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00,
+	0x12, 0x1d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x41, 0x00,
+	0x44, 0x02, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x75, 0x69, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x72,
+	0x6e, 0x61, 0x6c, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x2e, 0x6a, 0x73, 0x00, 0x00, 0x00, 0x11, 0x0b,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x9d, 0x14, 0x98, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x74, 0x75, 0x69, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x75, 0x74, 0x69, 0x6c, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+};
+
+size_t joshi_embedded_files_count = 26;
+JOSHI_EMBEDDED_FILE joshi_embedded_files[] = {
+	{ "bundle.js", file_0, sizeof(file_0) },
+	{ "bundle/index.js", file_1, sizeof(file_1) },
+	{ "crypto/index.js", file_2, sizeof(file_2) },
+	{ "dbus/index.js", file_3, sizeof(file_3) },
+	{ "errno/index.js", file_4, sizeof(file_4) },
+	{ "fs/index.js", file_5, sizeof(file_5) },
+	{ "init.js", file_6, sizeof(file_6) },
+	{ "io/index.js", file_7, sizeof(file_7) },
+	{ "kern/index.js", file_8, sizeof(file_8) },
+	{ "perf/index.js", file_9, sizeof(file_9) },
+	{ "proc/index.js", file_10, sizeof(file_10) },
+	{ "repl.js", file_11, sizeof(file_11) },
+	{ "shell/Capture.js", file_12, sizeof(file_12) },
+	{ "shell/EphemeralFd.js", file_13, sizeof(file_13) },
+	{ "shell/Proc.js", file_14, sizeof(file_14) },
+	{ "shell/index.js", file_15, sizeof(file_15) },
+	{ "shims/index.js", file_16, sizeof(file_16) },
+	{ "stream/index.js", file_17, sizeof(file_17) },
+	{ "term/index.js", file_18, sizeof(file_18) },
+	{ "tui/index.js", file_19, sizeof(file_19) },
+	{ "wui/LineEditor.js", file_20, sizeof(file_20) },
+	{ "wui/ListBox.js", file_21, sizeof(file_21) },
+	{ "wui/TextViewer.js", file_22, sizeof(file_22) },
+	{ "wui/Widget.js", file_23, sizeof(file_23) },
+	{ "wui/index.js", file_24, sizeof(file_24) },
+	{ "wui/internal/util.js", file_25, sizeof(file_25) },
+};
@@ -0,0 +1,4 @@
+const bundle = require('bundle');
+const fs = require('fs');
+
+fs.write_file(argv[3], bundle.library(fs.realpath(argv[2])));
@@ -87,6 +87,16 @@ return {
 		throws: 'nothing',
 	},
 
+	fcntl: {
+		args: [
+			{ type: 'int', name: 'fd' },
+			{ type: 'int', name: 'cmd' },
+			{ type: 'int', name: 'arg' },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
 	fork: {
 		args: [],
 		returns: { type: 'pid_t' },
@@ -145,6 +155,12 @@ return {
 		throws: 'errno',
 	},
 
+	isatty: {
+		args: [{ type: 'int', name: 'fd' }],
+		returns: { type: 'int' },
+		throws: 'nothing',
+	},
+
 	kill: {
 		args: [
 			{ type: 'pid_t', name: 'pid' },
@@ -164,6 +180,15 @@ return {
 		throws: 'errno',
 	},
 
+	listen: {
+		args: [
+			{ type: 'int', name: 'sockfd' },
+			{ type: 'int', name: 'backlog' },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
 	lseek: {
 		args: [
 			{ type: 'int', name: 'fildes' },
@@ -223,6 +248,15 @@ return {
 		throws: 'errno',
 	},
 
+	pipe2: {
+		args: [
+			{ type: 'int[]', name: 'fildes', in_out: true },
+			{ type: 'int', name: 'flags' },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
 	poll: {
 		args: [
 			{ type: 'struct pollfd[]', name: 'fds', in_out: true },
@@ -233,6 +267,28 @@ return {
 		throws: 'errno',
 	},
 
+	pread: {
+		args: [
+			{ type: 'int', name: 'fd' },
+			{ type: 'void*', name: 'buf' },
+			{ type: 'size_t', name: 'count' },
+			{ type: 'off_t', name: 'offset' },
+		],
+		returns: { type: 'ssize_t' },
+		throws: 'errno',
+	},
+
+	pwrite: {
+		args: [
+			{ type: 'int', name: 'fd' },
+			{ type: 'void*', name: 'buf' },
+			{ type: 'size_t', name: 'count' },
+			{ type: 'off_t', name: 'offset' },
+		],
+		returns: { type: 'ssize_t' },
+		throws: 'errno',
+	},
+
 	read: {
 		args: [
 			{ type: 'int', name: 'fd' },
@@ -296,12 +352,42 @@ return {
 		throws: 'errno',
 	},
 
+	shutdown: {
+		args: [
+			{ type: 'int', name: 'sockfd' },
+			{ type: 'int', name: 'how' },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
 	sleep: {
 		args: [{ type: 'unsigned int', name: 'seconds' }],
 		returns: { type: 'unsigned int' },
 		throws: 'errno',
 	},
 
+	socket: {
+		args: [
+			{ type: 'int', name: 'domain' },
+			{ type: 'int', name: 'type' },
+			{ type: 'int', name: 'protocol' },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
+	socketpair: {
+		args: [
+			{ type: 'int', name: 'domain' },
+			{ type: 'int', name: 'type' },
+			{ type: 'int', name: 'protocol' },
+			{ type: 'int[]', name: 'sv', in_out: true },
+		],
+		returns: { type: 'int' },
+		throws: 'errno',
+	},
+
 	symlink: {
 		args: [
 			{ type: 'char*', name: 'path1' },
@@ -346,11 +432,23 @@ return {
 	/* Custom helper functions */
 	atexit: CUSTOMIZED(1),
 	compile_function: CUSTOMIZED(2),
+	compile_module: CUSTOMIZED(3),
 	connect: CUSTOMIZED(2),
+	copy_file_range: CUSTOMIZED(5),
+	dump_function: CUSTOMIZED(1),
 	printk: CUSTOMIZED(1),
+	read_all: CUSTOMIZED(1),
+	read_dir: CUSTOMIZED(2),
 	read_file: CUSTOMIZED(1),
+	readv: CUSTOMIZED(2),
 	require_so: CUSTOMIZED(1),
+	resolve_path: CUSTOMIZED(1),
+	sendfile: CUSTOMIZED(4),
 	set_term_mode: CUSTOMIZED(1),
 	sha256: CUSTOMIZED(2),
 	signal: CUSTOMIZED(2),
+	splice: CUSTOMIZED(6),
+	stat_many: CUSTOMIZED(4),
+	tee: CUSTOMIZED(4),
+	writev: CUSTOMIZED(2),
 };
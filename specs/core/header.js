@@ -1,18 +1,25 @@
 return [
+	'#define _GNU_SOURCE',
+	'',
 	'#include <dirent.h>',
 	'#include <dlfcn.h>',
 	'#include <fcntl.h>',
 	'#include <poll.h>',
 	'#include <signal.h>',
+	'#include <stdint.h>',
 	'#include <stdio.h>',
 	'#include <stdlib.h>',
 	'#include <string.h>',
 	'#include <sys/random.h>',
+	'#include <sys/sendfile.h>',
 	'#include <sys/stat.h>',
+	'#include <sys/syscall.h>',
 	'#include <sys/socket.h>',
 	'#include <sys/types.h>',
+	'#include <sys/uio.h>',
 	'#include <sys/un.h>',
 	'#include <sys/wait.h>',
 	'#include <termios.h>',
 	'#include <unistd.h>',
+	'#include "joshi_signal.h"',
 ];
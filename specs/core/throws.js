@@ -1,6 +1,6 @@
 const generate = require('generate.js');
 
-return {
+const throws = {
 	errno: function (v, types, cleanup_code) {
 		const name = v.name;
 
@@ -36,3 +36,19 @@ return {
 		return [];
 	},
 };
+
+// Conditions telling that a call failed, so that calls interrupted by a signal
+// can be restarted
+throws.errno.failed = function (v) {
+	return v.name + ' == -1';
+};
+
+throws['errno-alone'].failed = function (v) {
+	return 'errno';
+};
+
+throws['errno-on-null'].failed = function (v) {
+	return v.name + ' == NULL';
+};
+
+return throws;
@@ -24,8 +24,8 @@ return {
 	long: ATOMIC('number'),
 	off_t: ATOMIC('number'),
 	pid_t: ATOMIC('int'),
-	size_t: ATOMIC('int'),
-	ssize_t: ATOMIC('int'),
+	size_t: ATOMIC('number'),
+	ssize_t: ATOMIC('number'),
 	'short int': ATOMIC('int'),
 	uid_t: ATOMIC('int'),
 	unsigned: ATOMIC('int'),
@@ -1 +1 @@
-return ['#include <dbus/dbus.h>'];
+return ['#include <dbus/dbus.h>', '#include "joshi_signal.h"'];
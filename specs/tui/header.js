@@ -1 +1,5 @@
-return ['#include <locale.h>', '#include <ncurses.h>'];
+return [
+	'#include <locale.h>',
+	'#include <ncurses.h>',
+	'#include "joshi_signal.h"',
+];
@@ -2,21 +2,39 @@
 #include <libgen.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
 #include "joshi.h"
+#include "joshi_alloc.h"
 #include "joshi_core.h"
+#include "joshi_embedded.h"
+#include "joshi_loop.h"
+#include "joshi_mmap.h"
+#include "joshi_shims.h"
+#include "joshi_signal.h"
+#include "joshi_socket.h"
+#include "joshi_stream.h"
+#include "joshi_prof.h"
+#include "joshi_uring.h"
+#include "joshi_walk.h"
+#include "joshi_worker.h"
+#include "joshi_writer.h"
 
 // This is patched by release script, don't touch
 #define VERSION "1.8.2-next"
 
 char LIB_DIR[1024];
+int USE_EMBEDDED_LIB = 0;
 
-duk_context* _joshi_duk_context;
+__thread duk_context* _joshi_duk_context;
 
 static void fatal_handler(void *udata, const char *msg);
-static int run_js(
-	duk_context *ctx, const char* filepath, int argc, const char *argv[]);
+static JOSHI_EMBEDDED_FILE* find_embedded_file(const char* name);
 
 void main(int argc, const char *argv[]) {
 	// Show version when asked
@@ -36,20 +54,35 @@ void main(int argc, const char *argv[]) {
 		dirname(LIB_DIR);
 		dirname(LIB_DIR);
 		strcat(LIB_DIR, "/lib/joshi");
+
+		// Prefer the embedded library (if any) over the one on disk
+		USE_EMBEDDED_LIB = joshi_embedded_files_count > 0;
 	}
 
 	// Init context
-	duk_context *ctx = duk_create_heap(NULL, NULL, NULL, NULL, fatal_handler);
+	duk_context *ctx = joshi_create_context();
 
 	if (!ctx) {
-		fprintf(stderr, "Cannot allocate heap.\n");
 		exit(-1);
 	}
 
-	_joshi_duk_context = ctx;
+	// Start profiler if requested
+	joshi_prof_init(getenv("JOSHI_PROF"));
+	joshi_signal_init();
+	joshi_writer_init();
+
+	// Run script file (or bundler when asked)
+	const char* filepath = argc >= 2 ? argv[1] : NULL;
+	char bundle_path[PATH_MAX+1];
+
+	if (argc >= 2 && !strcmp(argv[1], "bundle")) {
+		strcpy(bundle_path, LIB_DIR);
+		strcat(bundle_path, "/bundle.js");
 
-	// Run script file
-	int retval = run_js(ctx, argc>=2 ? argv[1] : NULL, argc, argv);
+		filepath = bundle_path;
+	}
+
+	int retval = joshi_run_js(ctx, filepath, argc, argv);
 
 	// Don't cleanup before exit because atexit would crash
 	// duk_destroy_heap(ctx);
@@ -57,69 +90,443 @@ void main(int argc, const char *argv[]) {
 	exit(retval);
 }
 
+duk_context* joshi_create_context(void) {
+	// Init allocator
+	const char* joshi_alloc = getenv("JOSHI_ALLOC");
+	JOSHI_ALLOC* alloc = joshi_alloc_new(joshi_alloc);
+
+	if (!alloc) {
+		fprintf(stderr, "Invalid JOSHI_ALLOC value: %s\n", joshi_alloc);
+		return NULL;
+	}
+
+	// Init context
+	duk_context *ctx = duk_create_heap(
+		joshi_alloc_malloc, joshi_alloc_realloc, joshi_alloc_free, alloc, 
+		fatal_handler);
+
+	if (!ctx) {
+		fprintf(stderr, "Cannot allocate heap.\n");
+		joshi_alloc_delete(alloc);
+		return NULL;
+	}
+
+	_joshi_duk_context = ctx;
+
+	joshi_shims_install(ctx);
+
+	return ctx;
+}
+
+void joshi_destroy_context(duk_context* ctx) {
+	duk_memory_functions funcs;
+
+	duk_get_memory_functions(ctx, &funcs);
+	duk_destroy_heap(ctx);
+	joshi_alloc_delete(funcs.udata);
+
+	// The arena is per thread and workers' threads end with their context
+	joshi_mblock_release();
+
+	if (_joshi_duk_context == ctx) {
+		_joshi_duk_context = NULL;
+	}
+}
+
+/*
+ * Scratch arena for temporary memory blocks needed while running native 
+ * functions (converted strings, arrays, ...). Blocks are carved from a chunk
+ * which grows geometrically and are all released at once by
+ * joshi_mblock_free_all().
+ */
+#define MBLOCK_CHUNK_MIN_SIZE (4 * 1024)
+#define MBLOCK_CHUNK_MAX_SIZE (1024 * 1024)
+
+typedef struct MBLOCK_CHUNK {
+	struct MBLOCK_CHUNK* prev;
+	size_t size;
+	size_t used;
+	long double data[];
+} MBLOCK_CHUNK;
+
+static __thread MBLOCK_CHUNK* mblock_chunk = NULL;
+
 JOSHI_MBLOCK* joshi_mblock_alloc(duk_context* ctx, duk_size_t size) {
-	duk_push_heap_stash(ctx);
-	duk_get_prop_string(ctx, -1, "_joshi_mblocks");
+	size_t block_size = sizeof(JOSHI_MBLOCK) + size;
+	block_size = (block_size + 15) & ~(size_t)15;
+
+	MBLOCK_CHUNK* chunk = mblock_chunk;
+
+	if (!chunk || chunk->size - chunk->used < block_size) {
+		size_t chunk_size = chunk ? 2 * chunk->size : MBLOCK_CHUNK_MIN_SIZE;
+
+		while (chunk_size < block_size) {
+			chunk_size *= 2;
+		}
+
+		MBLOCK_CHUNK* new_chunk = malloc(sizeof(MBLOCK_CHUNK) + chunk_size);
 
-	if (duk_is_undefined(ctx, -1)) {
-		duk_pop(ctx);
-		duk_push_array(ctx);
-		duk_put_prop_string(ctx, -2, "_joshi_mblocks");
-		duk_get_prop_string(ctx, -1, "_joshi_mblocks");
+		if (!new_chunk) {
+			duk_error(ctx, DUK_ERR_ERROR, "Out of memory");
+			return NULL;
+		}
+
+		new_chunk->prev = chunk;
+		new_chunk->size = chunk_size;
+		new_chunk->used = 0;
+
+		mblock_chunk = chunk = new_chunk;
 	}
 
-	JOSHI_MBLOCK* mblock = 
-		duk_push_fixed_buffer(ctx, sizeof(duk_size_t) + size);
+	JOSHI_MBLOCK* mblock = (JOSHI_MBLOCK*)(((char*)chunk->data) + chunk->used);
 	mblock->size = size;
-	duk_put_prop_index(ctx, -2, duk_get_length(ctx, -2));
-	duk_pop_2(ctx);
+
+	chunk->used += block_size;
 
 	return mblock;
 }
 
+/*
+ * Get a string argument as UTF-8.
+ *
+ * Strings without surrogate pairs are already valid UTF-8, so Duktape's own
+ * buffer is returned (it lives as long as the value stays in the stack and must
+ * not be modified). Otherwise the string is converted into an mblock.
+ */
+const char* joshi_require_utf(duk_context* ctx, duk_idx_t idx, duk_size_t* size) {
+	duk_size_t cesu_size;
+	const char* cesu = duk_require_lstring(ctx, idx, &cesu_size);
+
+	size_t offset = cnv_cesu_find_surrogate(cesu, cesu_size);
+
+	if (offset == cesu_size) {
+		if (size) {
+			*size = cesu_size;
+		}
+
+		return cesu;
+	}
+
+	// UTF-8 is never longer than CESU-8 (and the head needs no conversion)
+	char* utf = joshi_mblock_alloc(ctx, cesu_size + 1)->data;
+
+	memcpy(utf, cesu, offset);
+
+	duk_size_t utf_size =
+		offset + cnv_cesu_to_utf_n(cesu + offset, cesu_size - offset, utf + offset);
+
+	if (size) {
+		*size = utf_size;
+	}
+
+	return utf;
+}
+
+/*
+ * Push a UTF-8 string converting it to CESU-8 (like duk_push_lstring).
+ *
+ * Strings without non-BMP characters are valid CESU-8 already, so they are
+ * pushed as is. Otherwise the string is converted into an mblock.
+ */
+const char* joshi_push_lutf(duk_context* ctx, const char* utf, duk_size_t size) {
+	size_t offset = cnv_utf_find_nonbmp(utf, size);
+
+	if (offset == size) {
+		return duk_push_lstring(ctx, utf, size);
+	}
+
+	// Each 4 byte sequence becomes a 6 byte surrogate pair
+	char* cesu = joshi_mblock_alloc(ctx, size / 2 * 3 + 4)->data;
+
+	memcpy(cesu, utf, offset);
+
+	duk_size_t cesu_size =
+		offset + cnv_utf_to_cesu_n(utf + offset, size - offset, cesu + offset);
+
+	return duk_push_lstring(ctx, cesu, cesu_size);
+}
+
+const char* joshi_push_utf(duk_context* ctx, const char* utf) {
+	if (!utf) {
+		duk_push_null(ctx);
+		return NULL;
+	}
+
+	return joshi_push_lutf(ctx, utf, strlen(utf));
+}
+
+void joshi_mblock_release() {
+	while (mblock_chunk) {
+		MBLOCK_CHUNK* prev = mblock_chunk->prev;
+
+		free(mblock_chunk);
+		mblock_chunk = prev;
+	}
+}
+
 void joshi_mblock_free_all(duk_context* ctx) {
-	duk_push_heap_stash(ctx);
-	duk_del_prop_string(ctx, -1, "_joshi_mblocks");
-	duk_pop(ctx);
+	MBLOCK_CHUNK* chunk = mblock_chunk;
+
+	// Native functions end here: a good moment to sample the call stack
+	joshi_prof_check(ctx);
+
+	if (!chunk) {
+		return;
+	}
+
+	// Several chunks were needed: keep just the last (biggest) one so that
+	// next time everything fits in it
+	while (chunk->prev) {
+		MBLOCK_CHUNK* prev = chunk->prev;
+
+		chunk->prev = prev->prev;
+		free(prev);
+	}
+
+	// Don't hold too much memory after a call needing lots of it
+	if (chunk->size > MBLOCK_CHUNK_MAX_SIZE) {
+		free(chunk);
+		mblock_chunk = NULL;
+		return;
+	}
+
+	chunk->used = 0;
 }
 
-void cnv_cesu_to_utf(const char* cesu, char* utf) {
-	unsigned const char* pc = cesu;
-	unsigned char* pu = utf;
+/*
+ * Duktape stores strings as CESU-8, which only differs from UTF-8 in non-BMP
+ * characters (encoded as a surrogate pair: two 3 byte sequences starting with
+ * 0xED and a second byte >= 0xA0). Most strings (and almost all paths) don't
+ * have any, so the conversion functions look for surrogates in 16/32 byte
+ * blocks and copy the runs between them as a whole.
+ */
+#define IS_SURROGATE(pc, end) ((pc)[0] == 0xED && (pc) + 1 < (end) && (pc)[1] >= 0xA0)
+
+/*
+ * Well formed 4 byte UTF-8 sequences (names from the kernel are arbitrary
+ * bytes, so anything else must be left untouched to be usable again).
+ */
+#define IS_CONT(c) (((c) & 0xC0) == 0x80)
+#define IS_NONBMP(pu, end) \
+	((pu)[0] >= 0xF0 && (pu)[0] <= 0xF4 && (pu) + 3 < (end) && \
+	 IS_CONT((pu)[1]) && IS_CONT((pu)[2]) && IS_CONT((pu)[3]) && \
+	 ((pu)[0] != 0xF0 || (pu)[1] >= 0x90) && \
+	 ((pu)[0] != 0xF4 || (pu)[1] < 0x90))
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+static size_t find_surrogate_sse2(const unsigned char* pc, size_t length) {
+	const __m128i ed = _mm_set1_epi8((char)0xED);
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i*)(pc + i));
+		unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, ed));
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (IS_SURROGATE(pc + j, pc + length)) {
+				return j;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	for (; i < length; i++) {
+		if (IS_SURROGATE(pc + i, pc + length)) {
+			return i;
+		}
+	}
+
+	return length;
+}
+
+__attribute__((target("avx2")))
+static size_t find_surrogate_avx2(const unsigned char* pc, size_t length) {
+	const __m256i ed = _mm256_set1_epi8((char)0xED);
+	size_t i = 0;
+
+	for (; i + 32 <= length; i += 32) {
+		__m256i block = _mm256_loadu_si256((const __m256i*)(pc + i));
+		unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, ed));
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (IS_SURROGATE(pc + j, pc + length)) {
+				return j;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	return i + find_surrogate_sse2(pc + i, length - i);
+}
+
+static size_t find_nonbmp_sse2(const unsigned char* pu, size_t length) {
+	const __m128i f0 = _mm_set1_epi8((char)0xF0);
+	size_t i = 0;
+
+	// Bytes >= 0xF0 are those for which max(byte, 0xF0) == byte
+	for (; i + 16 <= length; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i*)(pu + i));
+		unsigned mask = _mm_movemask_epi8(
+			_mm_cmpeq_epi8(_mm_max_epu8(block, f0), block));
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (IS_NONBMP(pu + j, pu + length)) {
+				return j;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	for (; i < length; i++) {
+		if (IS_NONBMP(pu + i, pu + length)) {
+			return i;
+		}
+	}
+
+	return length;
+}
+
+#else
+
+static size_t find_surrogate_scalar(const unsigned char* pc, size_t length) {
+	const unsigned char* end = pc + length;
+	const unsigned char* p = pc;
 
-	while (*pc) {
-		if (*pc == 0xED) {
+	while ((p = memchr(p, 0xED, end - p))) {
+		if (IS_SURROGATE(p, end)) {
+			return p - pc;
+		}
+
+		p++;
+	}
+
+	return length;
+}
+
+static size_t find_nonbmp_scalar(const unsigned char* pu, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		if (IS_NONBMP(pu + i, pu + length)) {
+			return i;
+		}
+	}
+
+	return length;
+}
+
+#endif
+
+size_t cnv_cesu_find_surrogate(const char* cesu, size_t length) {
+#if defined(__x86_64__) && defined(__GNUC__)
+	// Strings shorter than an AVX2 block gain nothing from it
+	if (length >= 64 && __builtin_cpu_supports("avx2")) {
+		return find_surrogate_avx2((const unsigned char*)cesu, length);
+	}
+
+	return find_surrogate_sse2((const unsigned char*)cesu, length);
+#else
+	return find_surrogate_scalar((const unsigned char*)cesu, length);
+#endif
+}
+
+size_t cnv_cesu_to_utf_n(const char* cesu, size_t length, char* utf) {
+	const char* pc = cesu;
+	const char* end = cesu + length;
+	char* pu = utf;
+
+	while (pc < end) {
+		size_t run = cnv_cesu_find_surrogate(pc, end - pc);
+
+		memcpy(pu, pc, run);
+		pc += run;
+		pu += run;
+
+		if (pc + 6 <= end) {
 			cnv_nonbpm_uc_to_utf(cnv_nonbpm_cesu_to_uc(pc), pu);
 
 			pc += 6;
 			pu += 4;
 		}
-		else {
-			*pu = *pc;
-
-			pc++;
-			pu++;
+		else if (pc < end) {
+			// Truncated surrogate pair: copy as is
+			memcpy(pu, pc, end - pc);
+			pu += end - pc;
+			pc = end;
 		}
 	}
 
 	*pu = 0;
+
+	return pu - utf;
 }
 
-size_t cnv_cesu_to_utf_length(const char* cesu) {
-	size_t len = 0;
+/*
+ * UTF-8 only differs from CESU-8 in non-BMP characters, which are the only ones
+ * encoded with 4 bytes (with a lead byte >= 0xF0). Invalid sequences are not
+ * reported (and thus copied as is by the conversion).
+ */
+size_t cnv_utf_find_nonbmp(const char* utf, size_t length) {
+#if defined(__x86_64__) && defined(__GNUC__)
+	return find_nonbmp_sse2((const unsigned char*)utf, length);
+#else
+	return find_nonbmp_scalar((const unsigned char*)utf, length);
+#endif
+}
+
+size_t cnv_utf_to_cesu_n(const char* utf, size_t length, char* cesu) {
+	const char* pu = utf;
+	const char* end = utf + length;
+	char* pc = cesu;
+
+	while (pu < end) {
+		size_t run = cnv_utf_find_nonbmp(pu, end - pu);
+
+		memcpy(pc, pu, run);
+		pu += run;
+		pc += run;
 
-	while(*cesu) {
-		if (*cesu == 0xED) {
-			len += 4;
-			cesu += 6;
+		if (pu < end) {
+			cnv_nonbpm_uc_to_cesu(cnv_nonbpm_utf_to_uc(pu), pc);
+
+			pu += 4;
+			pc += 6;
 		}
-		else {
-			len++;
-			cesu++;
+	}
+
+	*pc = 0;
+
+	return pc - cesu;
+}
+
+void cnv_cesu_to_utf(const char* cesu, char* utf) {
+	cnv_cesu_to_utf_n(cesu, strlen(cesu), utf);
+}
+
+size_t cnv_cesu_to_utf_length(const char* cesu) {
+	size_t length = strlen(cesu);
+	size_t utf_length = length;
+	size_t i = 0;
+
+	while (i < length) {
+		i += cnv_cesu_find_surrogate(cesu + i, length - i);
+
+		if (i + 6 <= length) {
+			utf_length -= 2;
 		}
+
+		i += 6;
 	}
 
-	return len;
+	return utf_length;
 }
 
 void cnv_nonbpm_uc_to_utf(unsigned int x, char utf[4]) {
@@ -248,6 +655,23 @@ duk_ret_t joshi_dump_stack(duk_context* ctx) {
 	}
 }
 
+duk_ret_t joshi_load_embedded(duk_context* ctx) {
+	const char* name = duk_require_string(ctx, 0);
+
+	JOSHI_EMBEDDED_FILE* file = find_embedded_file(name);
+
+	if (!file) {
+		duk_push_null(ctx);
+		return 1;
+	}
+
+	duk_push_external_buffer(ctx);
+	duk_config_buffer(ctx, -1, (void*)file->bytecode, file->size);
+	duk_load_function(ctx);
+
+	return 1;
+}
+
 duk_ret_t joshi_throw_syserror(duk_context* ctx) {
 	int err = errno;
 
@@ -296,21 +720,45 @@ static void push_file_contents(duk_context* ctx, const char* filepath) {
 	free(contents);
 }
 
-static int run_js(
+static JOSHI_EMBEDDED_FILE* find_embedded_file(const char* name) {
+	if (!USE_EMBEDDED_LIB) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < joshi_embedded_files_count; i++) {
+		if (!strcmp(joshi_embedded_files[i].name, name)) {
+			return joshi_embedded_files + i;
+		}
+	}
+
+	return NULL;
+}
+
+int joshi_run_js(
 	duk_context *ctx, const char* filepath, int argc, const char *argv[]) {
 
 	// Load init.js file
-	char init_path[PATH_MAX+1];
+	JOSHI_EMBEDDED_FILE* init_file = find_embedded_file("init.js");
+
+	if (init_file) {
+		duk_push_external_buffer(ctx);
+		duk_config_buffer(
+			ctx, -1, (void*)init_file->bytecode, init_file->size);
+		duk_load_function(ctx);
+	}
+	else {
+		char init_path[PATH_MAX+1];
 
-	strcpy(init_path, LIB_DIR);
-	strcat(init_path, "/init.js");
+		strcpy(init_path, LIB_DIR);
+		strcat(init_path, "/init.js");
 
-	push_file_contents(ctx, init_path);
-	duk_push_string(ctx, init_path);
+		push_file_contents(ctx, init_path);
+		duk_push_string(ctx, init_path);
 
-	// [ ... source filepath ]
+		// [ ... source filepath ]
 
-	duk_compile(ctx, DUK_COMPILE_FUNCTION);
+		duk_compile(ctx, DUK_COMPILE_FUNCTION);
+	}
 
 	// [ ... init ]
 
@@ -328,6 +776,75 @@ static int run_js(
 	duk_push_c_function(ctx, joshi_throw_syserror, 0);
 	duk_put_prop_string(ctx, idx, "throw_syserror");
 
+	duk_push_c_function(ctx, joshi_load_embedded, 1);
+	duk_put_prop_string(ctx, idx, "load_embedded");
+
+	duk_push_c_function(ctx, joshi_alloc_stats, 0);
+	duk_put_prop_string(ctx, idx, "alloc_stats");
+
+	duk_push_c_function(ctx, joshi_prof_start, 1);
+	duk_put_prop_string(ctx, idx, "profile_start");
+
+	duk_push_c_function(ctx, joshi_prof_stop, 0);
+	duk_put_prop_string(ctx, idx, "profile_stop");
+
+	const JOSHI_FN_DECL native_fn_decls[] = {
+		{ "loop_add", joshi_loop_add, 4 },
+		{ "loop_create", joshi_loop_create, 0 },
+		{ "loop_modify", joshi_loop_modify, 4 },
+		{ "loop_remove", joshi_loop_remove, 2 },
+		{ "loop_timer", joshi_loop_timer, 4 },
+		{ "loop_wait", joshi_loop_wait, 3 },
+		{ "madvise", joshi_madvise, 2 },
+		{ "mmap", joshi_mmap, 5 },
+		{ "munmap", joshi_munmap, 1 },
+		{ "signal_dispatch", joshi_signal_dispatch, 0 },
+		{ "signal_fd", joshi_signal_fd, 0 },
+		{ "socket_accept", joshi_socket_accept, 2 },
+		{ "socket_bind", joshi_socket_bind, 2 },
+		{ "socket_connect", joshi_socket_connect, 2 },
+		{ "socket_getsockname", joshi_socket_getsockname, 1 },
+		{ "socket_getsockopt", joshi_socket_getsockopt, 3 },
+		{ "socket_recv_fds", joshi_socket_recv_fds, 3 },
+		{ "socket_recvmmsg", joshi_socket_recvmmsg, 3 },
+		{ "socket_recvmsg", joshi_socket_recvmsg, 3 },
+		{ "socket_send_fds", joshi_socket_send_fds, 3 },
+		{ "socket_sendmmsg", joshi_socket_sendmmsg, 3 },
+		{ "socket_sendmsg", joshi_socket_sendmsg, 4 },
+		{ "socket_setsockopt", joshi_socket_setsockopt, 4 },
+		{ "stream_create", joshi_stream_create, 1 },
+		{ "stream_read_until", joshi_stream_read_until, 3 },
+		{ "uring_close", joshi_uring_close, 1 },
+		{ "uring_create", joshi_uring_create, 2 },
+		{ "uring_prep", joshi_uring_prep, 8 },
+		{ "uring_submit", joshi_uring_submit, 1 },
+		{ "uring_wait", joshi_uring_wait, 2 },
+		{ "walk_close", joshi_walk_close, 1 },
+		{ "walk_next", joshi_walk_next, 1 },
+		{ "walk_open", joshi_walk_open, 7 },
+		{ "walk_remove_contents", joshi_walk_remove_contents, 2 },
+		{ "worker_alloc", joshi_worker_alloc, 1 },
+		{ "worker_close", joshi_worker_close, 1 },
+		{ "worker_create", joshi_worker_create, 2 },
+		{ "worker_fd", joshi_worker_fd, 1 },
+		{ "worker_is_child", joshi_worker_is_child, 0 },
+		{ "worker_join", joshi_worker_join, 1 },
+		{ "worker_recv", joshi_worker_recv, 2 },
+		{ "worker_send", joshi_worker_send, 2 },
+		{ "writer_close", joshi_writer_close, 1 },
+		{ "writer_create", joshi_writer_create, 3 },
+		{ "writer_flush", joshi_writer_flush, 1 },
+		{ "writer_flush_all", joshi_writer_flush_all, 0 },
+		{ "writer_write", joshi_writer_write, 3 },
+	};
+
+	for (int i = 0; i < sizeof(native_fn_decls)/sizeof(JOSHI_FN_DECL); i++) {
+		const JOSHI_FN_DECL* bin = native_fn_decls+i;
+
+		duk_push_c_function(ctx, bin->func, bin->argc);
+		duk_put_prop_string(ctx, idx, bin->name);
+	}
+
 	for(int i=0; i<joshi_fn_decls_count; i++) {
 		JOSHI_FN_DECL* bin = joshi_fn_decls+i;
 
@@ -341,17 +858,30 @@ static int run_js(
 	duk_push_string(ctx, VERSION);
 	duk_put_prop_string(ctx, idx, "version");
 
+	if (USE_EMBEDDED_LIB) {
+		duk_push_object(ctx);
+
+		for (size_t i = 0; i < joshi_embedded_files_count; i++) {
+			duk_push_true(ctx);
+			duk_put_prop_string(ctx, -2, joshi_embedded_files[i].name);
+		}
+	}
+	else {
+		duk_push_null(ctx);
+	}
+	duk_put_prop_string(ctx, idx, "embedded");
+
 	// [ ... init global joshi ]
 
 	if (filepath) {
-		duk_push_string(ctx, filepath);
+		joshi_push_utf(ctx, filepath);
 	} 
 	else {
 		duk_push_null(ctx);
 	}
 
 	for( int i=0; i<argc; i++) {
-		duk_push_string(ctx, argv[i]);
+		joshi_push_utf(ctx, argv[i]);
 	}
 
 	// [ ... init global joshi filepath arg0 ... argN ]
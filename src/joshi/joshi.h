@@ -18,16 +18,30 @@ typedef struct {
 	char data[];
 } JOSHI_MBLOCK;
 
-extern duk_context* _joshi_duk_context;
+extern __thread duk_context* _joshi_duk_context;
+
+duk_context* joshi_create_context(void);
+void joshi_destroy_context(duk_context* ctx);
+int joshi_run_js(
+	duk_context *ctx, const char* filepath, int argc, const char *argv[]);
 
 duk_ret_t joshi_dump_stack(duk_context* ctx);
 duk_ret_t joshi_throw_syserror(duk_context* ctx);
 
 JOSHI_MBLOCK* joshi_mblock_alloc(duk_context* ctx, duk_size_t size);
 void joshi_mblock_free_all(duk_context* ctx);
+void joshi_mblock_release();
+
+const char* joshi_push_lutf(duk_context* ctx, const char* utf, duk_size_t size);
+const char* joshi_push_utf(duk_context* ctx, const char* utf);
+const char* joshi_require_utf(duk_context* ctx, duk_idx_t idx, duk_size_t* size);
 
+size_t cnv_cesu_find_surrogate(const char* cesu, size_t length);
+size_t cnv_cesu_to_utf_n(const char* cesu, size_t length, char* utf);
 size_t cnv_cesu_to_utf_length(const char* cesu);
 void cnv_cesu_to_utf(const char* cesu, char* utf);
+size_t cnv_utf_find_nonbmp(const char* utf, size_t length);
+size_t cnv_utf_to_cesu_n(const char* utf, size_t length, char* cesu);
 void cnv_nonbpm_uc_to_utf(unsigned int x, char utf[4]);
 void cnv_nonbpm_uc_to_cesu(unsigned int x, char cesu[6]);
 unsigned int cnv_nonbpm_cesu_to_uc(const char cesu[6]);
@@ -0,0 +1,501 @@
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "joshi_alloc.h"
+
+/*
+ * Duktape heap allocators.
+ *
+ * Three allocators are available (selected with JOSHI_ALLOC env var):
+ *
+ *   - malloc: plain libc malloc/realloc/free (the default)
+ *   - slab: size-class pools for small blocks, libc for big ones
+ *   - arena: bump allocator which never reuses memory (for short scripts)
+ *
+ * The slab and arena allocators prefix each block with a BLOCK_HEADER that
+ * keeps the requested size (the header is 16 bytes to keep the payload aligned
+ * like malloc does).
+ */
+
+#define GRANULE 16
+
+#define SLAB_MAX_SIZE 512
+#define SLAB_CLASSES (SLAB_MAX_SIZE / GRANULE)
+#define SLAB_CHUNK_SIZE (64 * 1024)
+
+#define ARENA_CHUNK_SIZE (1024 * 1024)
+#define ARENA_MAX_SIZE (ARENA_CHUNK_SIZE / 4)
+
+#define ROUND_UP(size) (((size) + GRANULE - 1) & ~(size_t)(GRANULE - 1))
+
+typedef enum {
+	KIND_MALLOC,
+	KIND_SLAB,
+	KIND_ARENA,
+} KIND;
+
+typedef struct {
+	size_t size;
+	size_t pooled;
+} BLOCK_HEADER;
+
+typedef struct FREE_BLOCK {
+	struct FREE_BLOCK* next;
+} FREE_BLOCK;
+
+struct JOSHI_ALLOC {
+	KIND kind;
+	JOSHI_ALLOC_STATS stats;
+
+	/* Allocated chunks (slab and arena), linked by their first word */
+	void* chunks;
+
+	/* Current chunk (slab and arena) */
+	char* chunk_next;
+	char* chunk_end;
+
+	/* Last allocated block (arena) */
+	BLOCK_HEADER* last;
+
+	/* Free lists by size class (slab) */
+	FREE_BLOCK* free_lists[SLAB_CLASSES];
+};
+
+static const char* KIND_NAMES[] = { "malloc", "slab", "arena" };
+
+static void account_alloc(JOSHI_ALLOC* alloc, size_t size) {
+	alloc->stats.allocs++;
+	alloc->stats.live_bytes += size;
+
+	if (alloc->stats.live_bytes > alloc->stats.peak_bytes) {
+		alloc->stats.peak_bytes = alloc->stats.live_bytes;
+	}
+}
+
+static void account_free(JOSHI_ALLOC* alloc, size_t size) {
+	alloc->stats.frees++;
+	alloc->stats.live_bytes -= size;
+}
+
+static void account_realloc(JOSHI_ALLOC* alloc, size_t old_size, size_t size) {
+	alloc->stats.reallocs++;
+	alloc->stats.live_bytes += size;
+	alloc->stats.live_bytes -= old_size;
+
+	if (alloc->stats.live_bytes > alloc->stats.peak_bytes) {
+		alloc->stats.peak_bytes = alloc->stats.live_bytes;
+	}
+}
+
+static void* carve(JOSHI_ALLOC* alloc, size_t block_size, size_t chunk_size) {
+	if (alloc->chunk_end - alloc->chunk_next < block_size) {
+		char* chunk = malloc(chunk_size);
+
+		if (!chunk) {
+			return NULL;
+		}
+
+		*(void**)chunk = alloc->chunks;
+		alloc->chunks = chunk;
+
+		alloc->stats.reserved_bytes += chunk_size;
+		alloc->chunk_next = chunk + GRANULE;
+		alloc->chunk_end = chunk + chunk_size;
+	}
+
+	void* block = alloc->chunk_next;
+	alloc->chunk_next += block_size;
+
+	return block;
+}
+
+static BLOCK_HEADER* alloc_unpooled(JOSHI_ALLOC* alloc, size_t size) {
+	BLOCK_HEADER* hdr = malloc(sizeof(BLOCK_HEADER) + size);
+
+	if (!hdr) {
+		return NULL;
+	}
+
+	hdr->size = size;
+	hdr->pooled = 0;
+
+	alloc->stats.reserved_bytes += sizeof(BLOCK_HEADER) + size;
+
+	return hdr;
+}
+
+static void free_unpooled(JOSHI_ALLOC* alloc, BLOCK_HEADER* hdr) {
+	alloc->stats.reserved_bytes -= sizeof(BLOCK_HEADER) + hdr->size;
+
+	free(hdr);
+}
+
+/*
+ * malloc allocator
+ */
+static void* malloc_alloc(JOSHI_ALLOC* alloc, size_t size) {
+	void* ptr = malloc(size);
+
+	if (ptr) {
+		account_alloc(alloc, malloc_usable_size(ptr));
+	}
+
+	return ptr;
+}
+
+static void* malloc_realloc(JOSHI_ALLOC* alloc, void* ptr, size_t size) {
+	size_t old_size = malloc_usable_size(ptr);
+
+	void* new_ptr = realloc(ptr, size);
+
+	if (new_ptr) {
+		account_realloc(alloc, old_size, malloc_usable_size(new_ptr));
+	}
+
+	return new_ptr;
+}
+
+static void malloc_free(JOSHI_ALLOC* alloc, void* ptr) {
+	account_free(alloc, malloc_usable_size(ptr));
+
+	free(ptr);
+}
+
+/*
+ * slab allocator
+ */
+static void* slab_alloc(JOSHI_ALLOC* alloc, size_t size) {
+	BLOCK_HEADER* hdr;
+
+	if (size > SLAB_MAX_SIZE) {
+		hdr = alloc_unpooled(alloc, size);
+	}
+	else {
+		size_t cls = size ? (size - 1) / GRANULE : 0;
+
+		if (alloc->free_lists[cls]) {
+			hdr = (BLOCK_HEADER*)alloc->free_lists[cls];
+			alloc->free_lists[cls] = alloc->free_lists[cls]->next;
+		}
+		else {
+			hdr = carve(
+				alloc,
+				sizeof(BLOCK_HEADER) + (cls + 1) * GRANULE,
+				SLAB_CHUNK_SIZE);
+		}
+
+		if (hdr) {
+			hdr->pooled = 1;
+		}
+	}
+
+	if (!hdr) {
+		return NULL;
+	}
+
+	hdr->size = size;
+	account_alloc(alloc, size);
+
+	return hdr + 1;
+}
+
+static void slab_free(JOSHI_ALLOC* alloc, void* ptr) {
+	BLOCK_HEADER* hdr = ((BLOCK_HEADER*)ptr) - 1;
+
+	account_free(alloc, hdr->size);
+
+	if (hdr->pooled) {
+		size_t cls = hdr->size ? (hdr->size - 1) / GRANULE : 0;
+		FREE_BLOCK* block = (FREE_BLOCK*)hdr;
+
+		block->next = alloc->free_lists[cls];
+		alloc->free_lists[cls] = block;
+	}
+	else {
+		free_unpooled(alloc, hdr);
+	}
+}
+
+static void* slab_realloc(JOSHI_ALLOC* alloc, void* ptr, size_t size) {
+	BLOCK_HEADER* hdr = ((BLOCK_HEADER*)ptr) - 1;
+	size_t old_size = hdr->size;
+
+	// Same size class: nothing to move
+	if (hdr->pooled && size <= SLAB_MAX_SIZE &&
+		(size ? (size - 1) / GRANULE : 0) ==
+			(old_size ? (old_size - 1) / GRANULE : 0)) {
+
+		hdr->size = size;
+		account_realloc(alloc, old_size, size);
+
+		return ptr;
+	}
+
+	// Both unpooled: let libc do its best
+	if (!hdr->pooled && size > SLAB_MAX_SIZE) {
+		BLOCK_HEADER* new_hdr = realloc(hdr, sizeof(BLOCK_HEADER) + size);
+
+		if (!new_hdr) {
+			return NULL;
+		}
+
+		alloc->stats.reserved_bytes += size;
+		alloc->stats.reserved_bytes -= old_size;
+
+		new_hdr->size = size;
+		account_realloc(alloc, old_size, size);
+
+		return new_hdr + 1;
+	}
+
+	// Otherwise: move block
+	void* new_ptr = slab_alloc(alloc, size);
+
+	if (!new_ptr) {
+		return NULL;
+	}
+
+	memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+	slab_free(alloc, ptr);
+
+	// Account as a single realloc
+	alloc->stats.allocs--;
+	alloc->stats.frees--;
+	alloc->stats.reallocs++;
+
+	return new_ptr;
+}
+
+/*
+ * arena allocator
+ */
+static void* arena_alloc(JOSHI_ALLOC* alloc, size_t size) {
+	BLOCK_HEADER* hdr;
+
+	if (size > ARENA_MAX_SIZE) {
+		hdr = alloc_unpooled(alloc, size);
+	}
+	else {
+		hdr = carve(
+			alloc, sizeof(BLOCK_HEADER) + ROUND_UP(size), ARENA_CHUNK_SIZE);
+
+		if (hdr) {
+			hdr->pooled = 1;
+			alloc->last = hdr;
+		}
+	}
+
+	if (!hdr) {
+		return NULL;
+	}
+
+	hdr->size = size;
+	account_alloc(alloc, size);
+
+	return hdr + 1;
+}
+
+static void arena_free(JOSHI_ALLOC* alloc, void* ptr) {
+	BLOCK_HEADER* hdr = ((BLOCK_HEADER*)ptr) - 1;
+
+	account_free(alloc, hdr->size);
+
+	if (!hdr->pooled) {
+		free_unpooled(alloc, hdr);
+	}
+}
+
+static void* arena_realloc(JOSHI_ALLOC* alloc, void* ptr, size_t size) {
+	BLOCK_HEADER* hdr = ((BLOCK_HEADER*)ptr) - 1;
+	size_t old_size = hdr->size;
+
+	if (hdr->pooled) {
+		// Shrinking or growing the last block (if it fits): done in place
+		char* end = ((char*)ptr) + ROUND_UP(size);
+
+		if (size <= ROUND_UP(old_size) ||
+			(hdr == alloc->last && end <= alloc->chunk_end)) {
+
+			if (hdr == alloc->last) {
+				alloc->chunk_next =
+					((char*)ptr) + ROUND_UP(size > old_size ? size : old_size);
+			}
+
+			hdr->size = size;
+			account_realloc(alloc, old_size, size);
+
+			return ptr;
+		}
+	}
+	else if (size > ARENA_MAX_SIZE) {
+		BLOCK_HEADER* new_hdr = realloc(hdr, sizeof(BLOCK_HEADER) + size);
+
+		if (!new_hdr) {
+			return NULL;
+		}
+
+		alloc->stats.reserved_bytes += size;
+		alloc->stats.reserved_bytes -= old_size;
+
+		new_hdr->size = size;
+		account_realloc(alloc, old_size, size);
+
+		return new_hdr + 1;
+	}
+
+	// Otherwise: move block
+	void* new_ptr = arena_alloc(alloc, size);
+
+	if (!new_ptr) {
+		return NULL;
+	}
+
+	memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+	arena_free(alloc, ptr);
+
+	// Account as a single realloc
+	alloc->stats.allocs--;
+	alloc->stats.frees--;
+	alloc->stats.reallocs++;
+
+	return new_ptr;
+}
+
+/*
+ * Public interface
+ */
+JOSHI_ALLOC* joshi_alloc_new(const char* kind) {
+	JOSHI_ALLOC* alloc = calloc(1, sizeof(JOSHI_ALLOC));
+
+	if (!alloc) {
+		return NULL;
+	}
+
+	if (kind == NULL || !strcmp(kind, "") || !strcmp(kind, "malloc")) {
+		alloc->kind = KIND_MALLOC;
+	}
+	else if (!strcmp(kind, "slab")) {
+		alloc->kind = KIND_SLAB;
+	}
+	else if (!strcmp(kind, "arena")) {
+		alloc->kind = KIND_ARENA;
+	}
+	else {
+		free(alloc);
+		return NULL;
+	}
+
+	return alloc;
+}
+
+void joshi_alloc_delete(JOSHI_ALLOC* alloc) {
+	// Note that unpooled blocks are freed by Duktape when heap is destroyed
+	while (alloc->chunks) {
+		void* chunk = alloc->chunks;
+
+		alloc->chunks = *(void**)chunk;
+		free(chunk);
+	}
+
+	free(alloc);
+}
+
+void* joshi_alloc_malloc(void* udata, duk_size_t size) {
+	JOSHI_ALLOC* alloc = udata;
+
+	switch (alloc->kind) {
+		case KIND_SLAB:
+			return slab_alloc(alloc, size);
+
+		case KIND_ARENA:
+			return arena_alloc(alloc, size);
+
+		default:
+			return malloc_alloc(alloc, size);
+	}
+}
+
+void* joshi_alloc_realloc(void* udata, void* ptr, duk_size_t size) {
+	JOSHI_ALLOC* alloc = udata;
+
+	if (ptr == NULL) {
+		return joshi_alloc_malloc(udata, size);
+	}
+
+	if (size == 0) {
+		joshi_alloc_free(udata, ptr);
+		return NULL;
+	}
+
+	switch (alloc->kind) {
+		case KIND_SLAB:
+			return slab_realloc(alloc, ptr, size);
+
+		case KIND_ARENA:
+			return arena_realloc(alloc, ptr, size);
+
+		default:
+			return malloc_realloc(alloc, ptr, size);
+	}
+}
+
+void joshi_alloc_free(void* udata, void* ptr) {
+	JOSHI_ALLOC* alloc = udata;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	switch (alloc->kind) {
+		case KIND_SLAB:
+			slab_free(alloc, ptr);
+			break;
+
+		case KIND_ARENA:
+			arena_free(alloc, ptr);
+			break;
+
+		default:
+			malloc_free(alloc, ptr);
+			break;
+	}
+}
+
+duk_ret_t joshi_alloc_stats(duk_context* ctx) {
+	duk_memory_functions funcs;
+
+	duk_get_memory_functions(ctx, &funcs);
+
+	JOSHI_ALLOC* alloc = funcs.udata;
+	JOSHI_ALLOC_STATS* stats = &alloc->stats;
+
+	duk_idx_t idx = duk_push_object(ctx);
+
+	duk_push_string(ctx, KIND_NAMES[alloc->kind]);
+	duk_put_prop_string(ctx, idx, "allocator");
+
+	duk_push_number(ctx, stats->allocs);
+	duk_put_prop_string(ctx, idx, "allocs");
+
+	duk_push_number(ctx, stats->reallocs);
+	duk_put_prop_string(ctx, idx, "reallocs");
+
+	duk_push_number(ctx, stats->frees);
+	duk_put_prop_string(ctx, idx, "frees");
+
+	duk_push_number(ctx, stats->live_bytes);
+	duk_put_prop_string(ctx, idx, "live_bytes");
+
+	duk_push_number(ctx, stats->peak_bytes);
+	duk_put_prop_string(ctx, idx, "peak_bytes");
+
+	duk_push_number(
+		ctx,
+		alloc->kind == KIND_MALLOC
+			? stats->live_bytes
+			: stats->reserved_bytes);
+	duk_put_prop_string(ctx, idx, "reserved_bytes");
+
+	return 1;
+}
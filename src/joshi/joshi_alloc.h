@@ -0,0 +1,27 @@
+#ifndef _JOSHI_ALLOC_H
+#define _JOSHI_ALLOC_H
+
+#include "joshi.h"
+
+/* Allocation statistics of a Duktape heap */
+typedef struct {
+	size_t allocs;
+	size_t reallocs;
+	size_t frees;
+	size_t live_bytes;
+	size_t peak_bytes;
+	size_t reserved_bytes;
+} JOSHI_ALLOC_STATS;
+
+typedef struct JOSHI_ALLOC JOSHI_ALLOC;
+
+JOSHI_ALLOC* joshi_alloc_new(const char* kind);
+void joshi_alloc_delete(JOSHI_ALLOC* alloc);
+
+void* joshi_alloc_malloc(void* udata, duk_size_t size);
+void* joshi_alloc_realloc(void* udata, void* ptr, duk_size_t size);
+void joshi_alloc_free(void* udata, void* ptr);
+
+duk_ret_t joshi_alloc_stats(duk_context* ctx);
+
+#endif
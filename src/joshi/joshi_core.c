@@ -1,19 +1,26 @@
+#define _GNU_SOURCE
+
 #include <dirent.h>
 #include <dlfcn.h>
 #include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/random.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #include <sys/wait.h>
 #include <termios.h>
 #include <unistd.h>
+#include "joshi_signal.h"
 #include <errno.h>
 
 #include "joshi.h"
@@ -23,11 +30,11 @@
 #define duk_get_blksize_t(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_blksize_t(ctx,value) duk_push_int((ctx),(value))
 #define duk_get_char_arr(ctx,idx,out_value) cnv_cesu_to_utf(require_string((ctx),(idx)),(out_value))
-#define duk_push_char_arr(ctx,value) duk_push_string((ctx),(value))
+#define duk_push_char_arr(ctx,value) joshi_push_utf((ctx),(value))
 static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx);
-#define duk_push_char_pt(ctx,value) duk_push_string((ctx),(value))
+#define duk_push_char_pt(ctx,value) joshi_push_utf((ctx),(value))
 static const char* duk_get_const_char_pt(duk_context* ctx, duk_idx_t idx);
-#define duk_push_const_char_pt(ctx,value) duk_push_string((ctx),(value))
+#define duk_push_const_char_pt(ctx,value) joshi_push_utf((ctx),(value))
 #define duk_get_dev_t(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_dev_t(ctx,value) duk_push_int((ctx),(value))
 #define duk_get_gid_t(ctx,idx) duk_require_int((ctx),(idx))
@@ -46,10 +53,10 @@ static const char* duk_get_const_char_pt(duk_context* ctx, duk_idx_t idx);
 #define duk_push_off_t(ctx,value) duk_push_number((ctx),(value))
 #define duk_get_pid_t(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_pid_t(ctx,value) duk_push_int((ctx),(value))
-#define duk_get_size_t(ctx,idx) duk_require_int((ctx),(idx))
-#define duk_push_size_t(ctx,value) duk_push_int((ctx),(value))
-#define duk_get_ssize_t(ctx,idx) duk_require_int((ctx),(idx))
-#define duk_push_ssize_t(ctx,value) duk_push_int((ctx),(value))
+#define duk_get_size_t(ctx,idx) duk_require_number((ctx),(idx))
+#define duk_push_size_t(ctx,value) duk_push_number((ctx),(value))
+#define duk_get_ssize_t(ctx,idx) duk_require_number((ctx),(idx))
+#define duk_push_ssize_t(ctx,value) duk_push_number((ctx),(value))
 #define duk_get_short_int(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_short_int(ctx,value) duk_push_int((ctx),(value))
 #define duk_get_uid_t(ctx,idx) duk_require_int((ctx),(idx))
@@ -84,13 +91,7 @@ static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx) {
 		return NULL;
 	}
 
-	const char* cesu = duk_require_string(ctx, idx);
-	JOSHI_MBLOCK* blk = joshi_mblock_alloc(ctx, cnv_cesu_to_utf_length(cesu) + 1);
-	char* utf = (char*)blk->data;
-
-	cnv_cesu_to_utf(cesu, utf);
-
-	return utf;
+	return (char*)joshi_require_utf(ctx, idx, NULL);
 }
 
 static const char* duk_get_const_char_pt(duk_context* ctx, duk_idx_t idx) {
@@ -98,13 +99,7 @@ static const char* duk_get_const_char_pt(duk_context* ctx, duk_idx_t idx) {
 		return NULL;
 	}
 
-	const char* cesu = duk_require_string(ctx, idx);
-	JOSHI_MBLOCK* blk = joshi_mblock_alloc(ctx, cnv_cesu_to_utf_length(cesu) + 1);
-	char* utf = (char*)blk->data;
-
-	cnv_cesu_to_utf(cesu, utf);
-
-	return utf;
+	return (const char*)joshi_require_utf(ctx, idx, NULL);
 }
 
 static DIR* duk_get_DIR_pt(duk_context* ctx, duk_idx_t idx) {
@@ -216,7 +211,7 @@ static void duk_push_struct_dirent(duk_context* ctx, struct dirent* value) {
 	duk_put_prop_string(ctx, -2, "d_reclen");
 	duk_push_unsigned_char(ctx, value->d_type);
 	duk_put_prop_string(ctx, -2, "d_type");
-	duk_push_string(ctx, value->d_name);
+	joshi_push_utf(ctx, value->d_name);
 	duk_put_prop_string(ctx, -2, "d_name");
 }
 
@@ -334,6 +329,8 @@ static void duk_push_struct_timespec(duk_context* ctx, struct timespec* value) {
 static duk_ret_t _js_alarm(duk_context* ctx) {
 	int seconds;
 
+	joshi_signal_run_pending(ctx);
+
 	seconds = duk_get_int(ctx, 0);
 
 	errno = 0;
@@ -352,13 +349,16 @@ static duk_ret_t _js_alarm(duk_context* ctx) {
 static duk_ret_t _js_chdir(duk_context* ctx) {
 	char* path;
 
+	joshi_signal_run_pending(ctx);
+
 	path = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	chdir(path);
+	do {
+		errno = 0;
+		ret_value = chdir(path);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -374,13 +374,16 @@ static duk_ret_t _js_chdir(duk_context* ctx) {
 static duk_ret_t _js_close(duk_context* ctx) {
 	int fd;
 
+	joshi_signal_run_pending(ctx);
+
 	fd = duk_get_int(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	close(fd);
+	do {
+		errno = 0;
+		ret_value = close(fd);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -396,13 +399,16 @@ static duk_ret_t _js_close(duk_context* ctx) {
 static duk_ret_t _js_closedir(duk_context* ctx) {
 	DIR* dirp;
 
+	joshi_signal_run_pending(ctx);
+
 	dirp = duk_get_DIR_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	closedir(dirp);
+	do {
+		errno = 0;
+		ret_value = closedir(dirp);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -419,14 +425,17 @@ static duk_ret_t _js_crypt(duk_context* ctx) {
 	char* phrase;
 	char* setting;
 
+	joshi_signal_run_pending(ctx);
+
 	phrase = duk_get_char_pt(ctx, 0);
 	setting = duk_get_char_pt(ctx, 1);
 
-	errno = 0;
 	char* ret_value;
-	ret_value = 
 
-	crypt(phrase,setting);
+	do {
+		errno = 0;
+		ret_value = crypt(phrase,setting);
+	} while (errno && joshi_signal_interrupted(ctx));
 
 	if (errno) {
 		joshi_mblock_free_all(ctx);
@@ -442,13 +451,16 @@ static duk_ret_t _js_crypt(duk_context* ctx) {
 static duk_ret_t _js_dup(duk_context* ctx) {
 	int fildes;
 
+	joshi_signal_run_pending(ctx);
+
 	fildes = duk_get_int(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	dup(fildes);
+	do {
+		errno = 0;
+		ret_value = dup(fildes);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -465,14 +477,17 @@ static duk_ret_t _js_dup2(duk_context* ctx) {
 	int fildes;
 	int fildes2;
 
+	joshi_signal_run_pending(ctx);
+
 	fildes = duk_get_int(ctx, 0);
 	fildes2 = duk_get_int(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	dup2(fildes,fildes2);
+	do {
+		errno = 0;
+		ret_value = dup2(fildes,fildes2);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -489,14 +504,17 @@ static duk_ret_t _js_execv(duk_context* ctx) {
 	char* pathname;
 	JOSHI_MBLOCK* argv;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	argv = duk_get_char_pt_arr(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	execv(pathname,((char**)argv->data));
+	do {
+		errno = 0;
+		ret_value = execv(pathname,((char**)argv->data));
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -513,14 +531,17 @@ static duk_ret_t _js_execvp(duk_context* ctx) {
 	char* file;
 	JOSHI_MBLOCK* argv;
 
+	joshi_signal_run_pending(ctx);
+
 	file = duk_get_char_pt(ctx, 0);
 	argv = duk_get_char_pt_arr(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	execvp(file,((char**)argv->data));
+	do {
+		errno = 0;
+		ret_value = execvp(file,((char**)argv->data));
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -536,6 +557,8 @@ static duk_ret_t _js_execvp(duk_context* ctx) {
 static duk_ret_t _js_exit(duk_context* ctx) {
 	int status;
 
+	joshi_signal_run_pending(ctx);
+
 	status = duk_get_int(ctx, 0);
 
 	errno = 0;
@@ -548,14 +571,46 @@ static duk_ret_t _js_exit(duk_context* ctx) {
 	return 0;
 }
 
+static duk_ret_t _js_fcntl(duk_context* ctx) {
+	int fd;
+	int cmd;
+	int arg;
+
+	joshi_signal_run_pending(ctx);
+
+	fd = duk_get_int(ctx, 0);
+	cmd = duk_get_int(ctx, 1);
+	arg = duk_get_int(ctx, 2);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = fcntl(fd,cmd,arg);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
 static duk_ret_t _js_fork(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	pid_t ret_value;
-	ret_value = 
 
-	fork();
+	do {
+		errno = 0;
+		ret_value = fork();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -570,12 +625,15 @@ static duk_ret_t _js_fork(duk_context* ctx) {
 
 static duk_ret_t _js_getegid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	uid_t ret_value;
-	ret_value = 
 
-	getegid();
+	do {
+		errno = 0;
+		ret_value = getegid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -591,6 +649,8 @@ static duk_ret_t _js_getegid(duk_context* ctx) {
 static duk_ret_t _js_getenv(duk_context* ctx) {
 	char* name;
 
+	joshi_signal_run_pending(ctx);
+
 	name = duk_get_char_pt(ctx, 0);
 
 	errno = 0;
@@ -608,12 +668,15 @@ static duk_ret_t _js_getenv(duk_context* ctx) {
 
 static duk_ret_t _js_geteuid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	uid_t ret_value;
-	ret_value = 
 
-	geteuid();
+	do {
+		errno = 0;
+		ret_value = geteuid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -628,12 +691,15 @@ static duk_ret_t _js_geteuid(duk_context* ctx) {
 
 static duk_ret_t _js_getgid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	uid_t ret_value;
-	ret_value = 
 
-	getgid();
+	do {
+		errno = 0;
+		ret_value = getgid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -648,12 +714,15 @@ static duk_ret_t _js_getgid(duk_context* ctx) {
 
 static duk_ret_t _js_getpid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	pid_t ret_value;
-	ret_value = 
 
-	getpid();
+	do {
+		errno = 0;
+		ret_value = getpid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -668,12 +737,15 @@ static duk_ret_t _js_getpid(duk_context* ctx) {
 
 static duk_ret_t _js_getppid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	pid_t ret_value;
-	ret_value = 
 
-	getppid();
+	do {
+		errno = 0;
+		ret_value = getppid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -691,15 +763,18 @@ static duk_ret_t _js_getrandom(duk_context* ctx) {
 	size_t buflen;
 	unsigned int flags;
 
+	joshi_signal_run_pending(ctx);
+
 	buf = duk_get_void_pt(ctx, 0);
 	buflen = duk_get_size_t(ctx, 1);
 	flags = duk_get_unsigned_int(ctx, 2);
 
-	errno = 0;
 	ssize_t ret_value;
-	ret_value = 
 
-	getrandom(buf,buflen,flags);
+	do {
+		errno = 0;
+		ret_value = getrandom(buf,buflen,flags);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -714,12 +789,15 @@ static duk_ret_t _js_getrandom(duk_context* ctx) {
 
 static duk_ret_t _js_getuid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	uid_t ret_value;
-	ret_value = 
 
-	getuid();
+	do {
+		errno = 0;
+		ret_value = getuid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -732,18 +810,41 @@ static duk_ret_t _js_getuid(duk_context* ctx) {
 	return 1;
 }
 
+static duk_ret_t _js_isatty(duk_context* ctx) {
+	int fd;
+
+	joshi_signal_run_pending(ctx);
+
+	fd = duk_get_int(ctx, 0);
+
+	errno = 0;
+	int ret_value;
+	ret_value = 
+
+	isatty(fd);
+
+
+	duk_push_int(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
 static duk_ret_t _js_kill(duk_context* ctx) {
 	pid_t pid;
 	int sig;
 
+	joshi_signal_run_pending(ctx);
+
 	pid = duk_get_pid_t(ctx, 0);
 	sig = duk_get_int(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	kill(pid,sig);
+	do {
+		errno = 0;
+		ret_value = kill(pid,sig);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -761,15 +862,45 @@ static duk_ret_t _js_lchown(duk_context* ctx) {
 	uid_t owner;
 	gid_t group;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	owner = duk_get_uid_t(ctx, 1);
 	group = duk_get_gid_t(ctx, 2);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	lchown(pathname,owner,group);
+	do {
+		errno = 0;
+		ret_value = lchown(pathname,owner,group);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
+static duk_ret_t _js_listen(duk_context* ctx) {
+	int sockfd;
+	int backlog;
+
+	joshi_signal_run_pending(ctx);
+
+	sockfd = duk_get_int(ctx, 0);
+	backlog = duk_get_int(ctx, 1);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = listen(sockfd,backlog);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -787,15 +918,18 @@ static duk_ret_t _js_lseek(duk_context* ctx) {
 	off_t offset;
 	int whence;
 
+	joshi_signal_run_pending(ctx);
+
 	fildes = duk_get_int(ctx, 0);
 	offset = duk_get_off_t(ctx, 1);
 	whence = duk_get_int(ctx, 2);
 
-	errno = 0;
 	off_t ret_value;
-	ret_value = 
 
-	lseek(fildes,offset,whence);
+	do {
+		errno = 0;
+		ret_value = lseek(fildes,offset,whence);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -812,13 +946,16 @@ static duk_ret_t _js_lstat(duk_context* ctx) {
 	char* pathname;
 	struct stat statbuf;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	lstat(pathname,&(statbuf));
+	do {
+		errno = 0;
+		ret_value = lstat(pathname,&(statbuf));
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -839,14 +976,17 @@ static duk_ret_t _js_mkdir(duk_context* ctx) {
 	char* pathname;
 	mode_t mode;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	mode = duk_get_mode_t(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	mkdir(pathname,mode);
+	do {
+		errno = 0;
+		ret_value = mkdir(pathname,mode);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -863,14 +1003,17 @@ static duk_ret_t _js_mkfifo(duk_context* ctx) {
 	char* pathname;
 	mode_t mode;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	mode = duk_get_mode_t(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	mkfifo(pathname,mode);
+	do {
+		errno = 0;
+		ret_value = mkfifo(pathname,mode);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -888,15 +1031,18 @@ static duk_ret_t _js_open(duk_context* ctx) {
 	int flags;
 	mode_t mode;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	flags = duk_get_int(ctx, 1);
 	mode = duk_get_mode_t(ctx, 2);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	open(pathname,flags,mode);
+	do {
+		errno = 0;
+		ret_value = open(pathname,flags,mode);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -912,13 +1058,16 @@ static duk_ret_t _js_open(duk_context* ctx) {
 static duk_ret_t _js_opendir(duk_context* ctx) {
 	char* name;
 
+	joshi_signal_run_pending(ctx);
+
 	name = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	DIR* ret_value;
-	ret_value = 
 
-	opendir(name);
+	do {
+		errno = 0;
+		ret_value = opendir(name);
+	} while (ret_value == NULL && joshi_signal_interrupted(ctx));
 
 	if (ret_value == NULL) {
 		joshi_mblock_free_all(ctx);
@@ -934,13 +1083,47 @@ static duk_ret_t _js_opendir(duk_context* ctx) {
 static duk_ret_t _js_pipe(duk_context* ctx) {
 	JOSHI_MBLOCK* fildes;
 
+	joshi_signal_run_pending(ctx);
+
 	fildes = duk_get_int_arr(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	pipe(((int*)fildes->data));
+	do {
+		errno = 0;
+		ret_value = pipe(((int*)fildes->data));
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_object(ctx);
+	duk_push_int_arr(ctx, fildes);
+	duk_put_prop_string(ctx, -2, "fildes");
+	duk_push_int(ctx, ret_value);
+	duk_put_prop_string(ctx, -2, "value");
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
+static duk_ret_t _js_pipe2(duk_context* ctx) {
+	JOSHI_MBLOCK* fildes;
+	int flags;
+
+	joshi_signal_run_pending(ctx);
+
+	fildes = duk_get_int_arr(ctx, 0);
+	flags = duk_get_int(ctx, 1);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = pipe2(((int*)fildes->data),flags);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -962,15 +1145,18 @@ static duk_ret_t _js_poll(duk_context* ctx) {
 	nfds_t nfds;
 	int timeout;
 
+	joshi_signal_run_pending(ctx);
+
 	fds = duk_get_struct_pollfd_arr(ctx, 0);
 	nfds = duk_get_nfds_t(ctx, 1);
 	timeout = duk_get_int(ctx, 2);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	poll(((struct pollfd*)fds->data),nfds,timeout);
+	do {
+		errno = 0;
+		ret_value = poll(((struct pollfd*)fds->data),nfds,timeout);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -987,20 +1173,85 @@ static duk_ret_t _js_poll(duk_context* ctx) {
 	return 1;
 }
 
+static duk_ret_t _js_pread(duk_context* ctx) {
+	int fd;
+	void* buf;
+	size_t count;
+	off_t offset;
+
+	joshi_signal_run_pending(ctx);
+
+	fd = duk_get_int(ctx, 0);
+	buf = duk_get_void_pt(ctx, 1);
+	count = duk_get_size_t(ctx, 2);
+	offset = duk_get_off_t(ctx, 3);
+
+	ssize_t ret_value;
+
+	do {
+		errno = 0;
+		ret_value = pread(fd,buf,count,offset);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_ssize_t(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
+static duk_ret_t _js_pwrite(duk_context* ctx) {
+	int fd;
+	void* buf;
+	size_t count;
+	off_t offset;
+
+	joshi_signal_run_pending(ctx);
+
+	fd = duk_get_int(ctx, 0);
+	buf = duk_get_void_pt(ctx, 1);
+	count = duk_get_size_t(ctx, 2);
+	offset = duk_get_off_t(ctx, 3);
+
+	ssize_t ret_value;
+
+	do {
+		errno = 0;
+		ret_value = pwrite(fd,buf,count,offset);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_ssize_t(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
 static duk_ret_t _js_read(duk_context* ctx) {
 	int fd;
 	void* buf;
 	size_t count;
 
+	joshi_signal_run_pending(ctx);
+
 	fd = duk_get_int(ctx, 0);
 	buf = duk_get_void_pt(ctx, 1);
 	count = duk_get_size_t(ctx, 2);
 
-	errno = 0;
 	ssize_t ret_value;
-	ret_value = 
 
-	read(fd,buf,count);
+	do {
+		errno = 0;
+		ret_value = read(fd,buf,count);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1016,13 +1267,16 @@ static duk_ret_t _js_read(duk_context* ctx) {
 static duk_ret_t _js_readdir(duk_context* ctx) {
 	DIR* dirp;
 
+	joshi_signal_run_pending(ctx);
+
 	dirp = duk_get_DIR_pt(ctx, 0);
 
-	errno = 0;
 	struct dirent* ret_value;
-	ret_value = 
 
-	readdir(dirp);
+	do {
+		errno = 0;
+		ret_value = readdir(dirp);
+	} while (ret_value == NULL && joshi_signal_interrupted(ctx));
 
 	if (ret_value == NULL) {
 		joshi_mblock_free_all(ctx);
@@ -1040,15 +1294,18 @@ static duk_ret_t _js_readlink(duk_context* ctx) {
 	void* buf;
 	size_t bufsiz;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 	buf = duk_get_void_pt(ctx, 1);
 	bufsiz = duk_get_size_t(ctx, 2);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	readlink(pathname,buf,bufsiz);
+	do {
+		errno = 0;
+		ret_value = readlink(pathname,buf,bufsiz);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1065,14 +1322,17 @@ static duk_ret_t _js_rename(duk_context* ctx) {
 	char* oldpath;
 	char* newpath;
 
+	joshi_signal_run_pending(ctx);
+
 	oldpath = duk_get_char_pt(ctx, 0);
 	newpath = duk_get_char_pt(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	rename(oldpath,newpath);
+	do {
+		errno = 0;
+		ret_value = rename(oldpath,newpath);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1088,13 +1348,16 @@ static duk_ret_t _js_rename(duk_context* ctx) {
 static duk_ret_t _js_rmdir(duk_context* ctx) {
 	char* pathname;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	rmdir(pathname);
+	do {
+		errno = 0;
+		ret_value = rmdir(pathname);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1112,15 +1375,18 @@ static duk_ret_t _js_setenv(duk_context* ctx) {
 	char* value;
 	int overwrite;
 
+	joshi_signal_run_pending(ctx);
+
 	name = duk_get_char_pt(ctx, 0);
 	value = duk_get_char_pt(ctx, 1);
 	overwrite = duk_get_int(ctx, 2);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	setenv(name,value,overwrite);
+	do {
+		errno = 0;
+		ret_value = setenv(name,value,overwrite);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1135,12 +1401,15 @@ static duk_ret_t _js_setenv(duk_context* ctx) {
 
 static duk_ret_t _js_setsid(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
-	errno = 0;
 	pid_t ret_value;
-	ret_value = 
 
-	setsid();
+	do {
+		errno = 0;
+		ret_value = setsid();
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1153,16 +1422,46 @@ static duk_ret_t _js_setsid(duk_context* ctx) {
 	return 1;
 }
 
+static duk_ret_t _js_shutdown(duk_context* ctx) {
+	int sockfd;
+	int how;
+
+	joshi_signal_run_pending(ctx);
+
+	sockfd = duk_get_int(ctx, 0);
+	how = duk_get_int(ctx, 1);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = shutdown(sockfd,how);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
 static duk_ret_t _js_sleep(duk_context* ctx) {
 	unsigned int seconds;
 
+	joshi_signal_run_pending(ctx);
+
 	seconds = duk_get_unsigned_int(ctx, 0);
 
-	errno = 0;
 	unsigned int ret_value;
-	ret_value = 
 
-	sleep(seconds);
+	do {
+		errno = 0;
+		ret_value = sleep(seconds);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1175,18 +1474,85 @@ static duk_ret_t _js_sleep(duk_context* ctx) {
 	return 1;
 }
 
+static duk_ret_t _js_socket(duk_context* ctx) {
+	int domain;
+	int type;
+	int protocol;
+
+	joshi_signal_run_pending(ctx);
+
+	domain = duk_get_int(ctx, 0);
+	type = duk_get_int(ctx, 1);
+	protocol = duk_get_int(ctx, 2);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = socket(domain,type,protocol);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, ret_value);
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
+static duk_ret_t _js_socketpair(duk_context* ctx) {
+	int domain;
+	int type;
+	int protocol;
+	JOSHI_MBLOCK* sv;
+
+	joshi_signal_run_pending(ctx);
+
+	domain = duk_get_int(ctx, 0);
+	type = duk_get_int(ctx, 1);
+	protocol = duk_get_int(ctx, 2);
+	sv = duk_get_int_arr(ctx, 3);
+
+	int ret_value;
+
+	do {
+		errno = 0;
+		ret_value = socketpair(domain,type,protocol,((int*)sv->data));
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
+
+	if (ret_value == -1) {
+		joshi_mblock_free_all(ctx);
+		joshi_throw_syserror(ctx);
+	}
+
+	duk_push_object(ctx);
+	duk_push_int_arr(ctx, sv);
+	duk_put_prop_string(ctx, -2, "sv");
+	duk_push_int(ctx, ret_value);
+	duk_put_prop_string(ctx, -2, "value");
+
+	joshi_mblock_free_all(ctx);
+	return 1;
+}
+
 static duk_ret_t _js_symlink(duk_context* ctx) {
 	char* path1;
 	char* path2;
 
+	joshi_signal_run_pending(ctx);
+
 	path1 = duk_get_char_pt(ctx, 0);
 	path2 = duk_get_char_pt(ctx, 1);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	symlink(path1,path2);
+	do {
+		errno = 0;
+		ret_value = symlink(path1,path2);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1202,13 +1568,16 @@ static duk_ret_t _js_symlink(duk_context* ctx) {
 static duk_ret_t _js_unlink(duk_context* ctx) {
 	char* pathname;
 
+	joshi_signal_run_pending(ctx);
+
 	pathname = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	unlink(pathname);
+	do {
+		errno = 0;
+		ret_value = unlink(pathname);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1224,13 +1593,16 @@ static duk_ret_t _js_unlink(duk_context* ctx) {
 static duk_ret_t _js_unsetenv(duk_context* ctx) {
 	char* name;
 
+	joshi_signal_run_pending(ctx);
+
 	name = duk_get_char_pt(ctx, 0);
 
-	errno = 0;
 	int ret_value;
-	ret_value = 
 
-	unsetenv(name);
+	do {
+		errno = 0;
+		ret_value = unsetenv(name);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1248,14 +1620,17 @@ static duk_ret_t _js_waitpid(duk_context* ctx) {
 	int wstatus;
 	int options;
 
+	joshi_signal_run_pending(ctx);
+
 	pid = duk_get_pid_t(ctx, 0);
 	options = duk_get_int(ctx, 1);
 
-	errno = 0;
 	pid_t ret_value;
-	ret_value = 
 
-	waitpid(pid,&(wstatus),options);
+	do {
+		errno = 0;
+		ret_value = waitpid(pid,&(wstatus),options);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1277,15 +1652,18 @@ static duk_ret_t _js_write(duk_context* ctx) {
 	void* buf;
 	size_t count;
 
+	joshi_signal_run_pending(ctx);
+
 	fd = duk_get_int(ctx, 0);
 	buf = duk_get_void_pt(ctx, 1);
 	count = duk_get_size_t(ctx, 2);
 
-	errno = 0;
 	ssize_t ret_value;
-	ret_value = 
 
-	write(fd,buf,count);
+	do {
+		errno = 0;
+		ret_value = write(fd,buf,count);
+	} while (ret_value == -1 && joshi_signal_interrupted(ctx));
 
 	if (ret_value == -1) {
 		joshi_mblock_free_all(ctx);
@@ -1299,7 +1677,8 @@ static duk_ret_t _js_write(duk_context* ctx) {
 }
 
 /* BEGIN CUSTOM USER CODE */
-static int _atexit_handler_set = 0;
+static int _atexit_registered = 0;
+static __thread int _atexit_handler_set = 0;
 
 static void _atexit_handler(void) {
 	duk_context* ctx = _joshi_duk_context;
@@ -1316,37 +1695,13 @@ static void _atexit_handler(void) {
 
 	// ... func
 
-	duk_call(ctx, 0);
-}
-
-static void _signal_handler(int sig) {
-	duk_context* ctx = _joshi_duk_context;
-
-	duk_push_heap_stash(ctx);
-
-	// ... stash
-	
-	duk_get_prop_string(ctx, -1, "signal_handlers");
-
-	// ... stash signal_handlers
-	
-	duk_get_prop_index(ctx, -1, sig);
-
-	// ... stash signal_handlers func
-	
-	duk_remove(ctx, -2);
-
-	// ... stash func
-
-	duk_remove(ctx, -2);
-
-	// ... func
-
-	duk_push_int(ctx, sig);
-
-	// ... func sig
+	// The heap of the exiting thread may not have set any handler
+	if (!duk_is_function(ctx, -1)) {
+		duk_pop(ctx);
+		return;
+	}
 
-	duk_call(ctx, 1);
+	duk_call(ctx, 0);
 }
 
 static duk_ret_t _js_atexit(duk_context* ctx) {
@@ -1369,7 +1724,12 @@ static duk_ret_t _js_atexit(duk_context* ctx) {
 	duk_put_prop_string(ctx, -2, "atexit_handler");
 	duk_pop(ctx);
 
-	int result = atexit(_atexit_handler);
+	// Each heap (worker) may set a handler, but libc only needs one
+	int result = 0;
+	
+	if (__sync_bool_compare_and_swap(&_atexit_registered, 0, 1)) {
+		result = atexit(_atexit_handler);
+	}
 	
 	if (result == -1) {
 		joshi_throw_syserror(ctx);
@@ -1417,6 +1777,341 @@ static duk_ret_t _js_compile_function(duk_context* ctx) {
 	return 1;
 }
 
+typedef struct {
+	char magic[32];
+	int64_t mtime_sec;
+	int64_t mtime_nsec;
+	int64_t size;
+	int64_t ino;
+	uint32_t path_len;
+	uint32_t args_len;
+} BYTECODE_CACHE_HEADER;
+
+static void get_bytecode_cache_magic(char magic[32]) {
+	memset(magic, 0, 32);
+	snprintf(magic, 32, "joshi-bc-%ld", (long)DUK_VERSION);
+}
+
+static int mkdirs(const char* path, mode_t mode) {
+	char dir[PATH_MAX+1];
+
+	if (strlen(path) > PATH_MAX) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+
+	strcpy(dir, path);
+
+	for (char* p = dir + 1; *p; p++) {
+		if (*p == '/') {
+			*p = 0;
+
+			if (mkdir(dir, mode) == -1 && errno != EEXIST) {
+				return -1;
+			}
+
+			*p = '/';
+		}
+	}
+
+	if (mkdir(dir, mode) == -1 && errno != EEXIST) {
+		return -1;
+	}
+
+	return 0;
+}
+
+static int read_all_bytes(int fd, void* buf, size_t count) {
+	char* p = buf;
+
+	while (count > 0) {
+		ssize_t bread = read(fd, p, count);
+
+		if (bread == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (bread <= 0) {
+			return -1;
+		}
+
+		p += bread;
+		count -= bread;
+	}
+
+	return 0;
+}
+
+static int write_all_bytes(int fd, const void* buf, size_t count) {
+	const char* p = buf;
+
+	while (count > 0) {
+		ssize_t bwritten = write(fd, p, count);
+
+		if (bwritten == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (bwritten <= 0) {
+			return -1;
+		}
+
+		p += bwritten;
+		count -= bwritten;
+	}
+
+	return 0;
+}
+
+static void get_bytecode_cache_path(
+	char* cache_path, const char* cache_dir, const char* filepath,
+	const char* args) {
+
+	// FNV-1a is enough here: headers are verified before loading anything
+	uint64_t hash = 14695981039346656037ULL;
+
+	for (const unsigned char* p = filepath; *p; p++) {
+		hash = (hash ^ *p) * 1099511628211ULL;
+	}
+
+	hash = (hash ^ '(') * 1099511628211ULL;
+
+	for (const unsigned char* p = args; *p; p++) {
+		hash = (hash ^ *p) * 1099511628211ULL;
+	}
+
+	snprintf(
+		cache_path, PATH_MAX+1, "%s/%016llx.jbc",
+		cache_dir, (unsigned long long)hash);
+}
+
+static int load_bytecode_cache(
+	duk_context* ctx, const char* cache_path, const char* filepath,
+	const char* args, struct stat* st) {
+
+	int fd = open(cache_path, O_RDONLY | O_CLOEXEC);
+
+	if (fd == -1) {
+		return 0;
+	}
+
+	struct stat cache_st;
+	BYTECODE_CACHE_HEADER hdr;
+	char magic[32];
+	size_t path_len = strlen(filepath);
+	size_t args_len = strlen(args);
+
+	get_bytecode_cache_magic(magic);
+
+	if (
+		fstat(fd, &cache_st) == -1 ||
+		read_all_bytes(fd, &hdr, sizeof(hdr)) == -1 ||
+		memcmp(hdr.magic, magic, sizeof(hdr.magic)) ||
+		hdr.mtime_sec != st->st_mtim.tv_sec ||
+		hdr.mtime_nsec != st->st_mtim.tv_nsec ||
+		hdr.size != st->st_size ||
+		hdr.ino != st->st_ino ||
+		hdr.path_len != path_len ||
+		hdr.args_len != args_len
+	) {
+		close(fd);
+		return 0;
+	}
+
+	char key[path_len + args_len];
+
+	if (
+		read_all_bytes(fd, key, path_len + args_len) == -1 ||
+		memcmp(key, filepath, path_len) ||
+		memcmp(key + path_len, args, args_len)
+	) {
+		close(fd);
+		return 0;
+	}
+
+	off_t bytecode_len =
+		cache_st.st_size - sizeof(hdr) - path_len - args_len;
+
+	if (bytecode_len <= 0) {
+		close(fd);
+		return 0;
+	}
+
+	void* bytecode = duk_push_fixed_buffer(ctx, bytecode_len);
+
+	if (read_all_bytes(fd, bytecode, bytecode_len) == -1) {
+		duk_pop(ctx);
+		close(fd);
+		return 0;
+	}
+
+	close(fd);
+
+	duk_load_function(ctx);
+
+	return 1;
+}
+
+static void store_bytecode_cache(
+	duk_context* ctx, const char* cache_dir, const char* cache_path,
+	const char* filepath, const char* args, struct stat* st) {
+
+	if (mkdirs(cache_dir, 0700) == -1) {
+		return;
+	}
+
+	char tmp_path[PATH_MAX+32];
+	snprintf(
+		tmp_path, sizeof(tmp_path), "%s.%ld", cache_path, syscall(SYS_gettid));
+
+	int fd = open(
+		tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+	if (fd == -1) {
+		return;
+	}
+
+	BYTECODE_CACHE_HEADER hdr;
+
+	memset(&hdr, 0, sizeof(hdr));
+	get_bytecode_cache_magic(hdr.magic);
+	hdr.mtime_sec = st->st_mtim.tv_sec;
+	hdr.mtime_nsec = st->st_mtim.tv_nsec;
+	hdr.size = st->st_size;
+	hdr.ino = st->st_ino;
+	hdr.path_len = strlen(filepath);
+	hdr.args_len = strlen(args);
+
+	duk_dup(ctx, -1);
+	duk_dump_function(ctx);
+
+	duk_size_t bytecode_len;
+	void* bytecode = duk_get_buffer(ctx, -1, &bytecode_len);
+
+	int failed =
+		write_all_bytes(fd, &hdr, sizeof(hdr)) == -1 ||
+		write_all_bytes(fd, filepath, hdr.path_len) == -1 ||
+		write_all_bytes(fd, args, hdr.args_len) == -1 ||
+		write_all_bytes(fd, bytecode, bytecode_len) == -1;
+
+	duk_pop(ctx);
+
+	if (close(fd) == -1 || failed || rename(tmp_path, cache_path) == -1) {
+		unlink(tmp_path);
+	}
+}
+
+static duk_ret_t _js_compile_module(duk_context* ctx) {
+	const char* filepath = duk_require_string(ctx, 0);
+	const char* args = duk_require_string(ctx, 1);
+	const char* cache_dir = duk_get_string(ctx, 2);
+
+	int fd = open(filepath, O_RDONLY | O_CLOEXEC);
+	struct stat st;
+
+	if (fd == -1 || fstat(fd, &st) == -1) {
+		if (fd != -1) {
+			close(fd);
+		}
+
+		duk_push_error_object(
+			ctx, DUK_ERR_ERROR, "Cannot read file: %s", filepath);
+		return duk_throw(ctx);
+	}
+
+	char cache_path[PATH_MAX+1];
+
+	if (cache_dir) {
+		get_bytecode_cache_path(cache_path, cache_dir, filepath, args);
+
+		if (load_bytecode_cache(ctx, cache_path, filepath, args, &st)) {
+			close(fd);
+			return 1;
+		}
+	}
+
+	// Wrap source the same way compile_function callers do so that line
+	// numbers are preserved
+	const char* prefix_fmt = "function(%s){ ";
+	const char* suffix = " ;}";
+
+	size_t prefix_len = strlen(prefix_fmt) - 2 + strlen(args);
+	size_t suffix_len = strlen(suffix);
+	char* source = malloc(prefix_len + st.st_size + suffix_len + 1);
+
+	if (!source) {
+		close(fd);
+		duk_push_error_object(
+			ctx, DUK_ERR_ERROR, "Cannot read file: %s", filepath);
+		return duk_throw(ctx);
+	}
+
+	sprintf(source, prefix_fmt, args);
+
+	if (read_all_bytes(fd, source + prefix_len, st.st_size) == -1) {
+		free(source);
+		close(fd);
+		duk_push_error_object(
+			ctx, DUK_ERR_ERROR, "Cannot read file: %s", filepath);
+		return duk_throw(ctx);
+	}
+
+	close(fd);
+
+	memcpy(source + prefix_len + st.st_size, suffix, suffix_len);
+
+	duk_push_lstring(ctx, source, prefix_len + st.st_size + suffix_len);
+	free(source);
+
+	duk_push_string(ctx, filepath);
+	duk_compile(ctx, DUK_COMPILE_FUNCTION);
+
+	if (cache_dir) {
+		store_bytecode_cache(ctx, cache_dir, cache_path, filepath, args, &st);
+	}
+
+	return 1;
+}
+
+// Offsets given as null or undefined make the syscalls use (and update) the
+// file pointer of the fd
+static loff_t* _get_loff_pt(duk_context* ctx, duk_idx_t idx, loff_t* off) {
+	if (duk_is_null_or_undefined(ctx, idx)) {
+		return NULL;
+	}
+
+	*off = duk_require_number(ctx, idx);
+	return off;
+}
+
+static duk_ret_t _js_copy_file_range(duk_context* ctx) {
+	loff_t off_in;
+	loff_t off_out;
+
+	int fd_in = duk_require_int(ctx, 0);
+	loff_t* poff_in = _get_loff_pt(ctx, 1, &off_in);
+	int fd_out = duk_require_int(ctx, 2);
+	loff_t* poff_out = _get_loff_pt(ctx, 3, &off_out);
+	size_t len = duk_require_number(ctx, 4);
+
+	errno = 0;
+	ssize_t count = copy_file_range(fd_in, poff_in, fd_out, poff_out, len, 0);
+
+	if (count == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, count);
+	return 1;
+}
+
+static duk_ret_t _js_dump_function(duk_context* ctx) {
+	duk_require_function(ctx, 0);
+	duk_dump_function(ctx);
+
+	return 1;
+}
+
 static duk_ret_t _js_printk(duk_context* ctx) {
 	const char* msg = duk_get_string(ctx, 0);
 
@@ -1426,42 +2121,250 @@ static duk_ret_t _js_printk(duk_context* ctx) {
 	return 0;
 }
 
+// Push a plain buffer with the rest of the contents of an fd and return its
+// length (or -1 with errno set). Regular files are read into a single fixed
+// buffer sized with fstat(), other files into a growing dynamic buffer.
+static ssize_t _push_fd_contents(duk_context* ctx, int fd) {
+	struct stat st;
+
+	if (fstat(fd, &st) == -1) {
+		return -1;
+	}
+
+	off_t pos = S_ISREG(st.st_mode) ? lseek(fd, 0, SEEK_CUR) : -1;
+	int sized = pos != -1 && st.st_size > pos;
+
+	size_t capacity = sized ? st.st_size - pos : 65536;
+	char* data = sized
+		? duk_push_fixed_buffer(ctx, capacity)
+		: duk_push_dynamic_buffer(ctx, capacity);
+	size_t length = 0;
+
+	while (1) {
+		if (length == capacity) {
+			// Sized files are read as they were when fstat() was called
+			if (sized) {
+				break;
+			}
+
+			capacity *= 2;
+			data = duk_resize_buffer(ctx, -1, capacity);
+		}
+
+		ssize_t count = read(fd, data + length, capacity - length);
+
+		if (count == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			duk_pop(ctx);
+			return -1;
+		}
+
+		if (count == 0) {
+			break;
+		}
+
+		length += count;
+	}
+
+	if (!sized) {
+		duk_resize_buffer(ctx, -1, length);
+	}
+
+	return length;
+}
+
+static duk_ret_t _js_read_all(duk_context* ctx) {
+	int fd = duk_require_int(ctx, 0);
+
+	ssize_t length = _push_fd_contents(ctx, fd);
+
+	if (length == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_buffer_object(ctx, -1, 0, length, DUK_BUFOBJ_UINT8ARRAY);
+
+	return 1;
+}
+
+// Buffer size for getdents64() (enough for a few hundred entries per call)
+#define READ_DIR_BUFFER_SIZE (64 * 1024)
+
+struct _linux_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+
+static duk_ret_t _js_read_dir(duk_context* ctx) {
+	const char* path = joshi_require_utf(ctx, 0, NULL);
+	int types = duk_to_boolean(ctx, 1);
+
+	int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+	if (fd == -1) {
+		joshi_mblock_free_all(ctx);
+		return joshi_throw_syserror(ctx);
+	}
+
+	char* buf = joshi_mblock_alloc(ctx, READ_DIR_BUFFER_SIZE)->data;
+	duk_uarridx_t index = 0;
+
+	duk_push_array(ctx);
+
+	while (1) {
+		long count = syscall(SYS_getdents64, fd, buf, READ_DIR_BUFFER_SIZE);
+
+		if (count == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			int err = errno;
+
+			close(fd);
+			joshi_mblock_free_all(ctx);
+
+			errno = err;
+			return joshi_throw_syserror(ctx);
+		}
+
+		if (count == 0) {
+			break;
+		}
+
+		for (long pos = 0; pos < count; ) {
+			struct _linux_dirent64* d = (struct _linux_dirent64*)(buf + pos);
+			const char* name = d->d_name;
+
+			pos += d->d_reclen;
+
+			if (name[0] == '.' &&
+				(name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+				continue;
+			}
+
+			if (types) {
+				duk_push_object(ctx);
+
+				joshi_push_utf(ctx, name);
+				duk_put_prop_string(ctx, -2, "name");
+
+				duk_push_uint(ctx, d->d_type);
+				duk_put_prop_string(ctx, -2, "type");
+
+				duk_push_number(ctx, d->d_ino);
+				duk_put_prop_string(ctx, -2, "ino");
+			}
+			else {
+				joshi_push_utf(ctx, name);
+			}
+
+			duk_put_prop_index(ctx, -2, index++);
+		}
+	}
+
+	close(fd);
+	joshi_mblock_free_all(ctx);
+
+	return 1;
+}
+
 static duk_ret_t _js_read_file(duk_context* ctx) {
-	const char* filepath = duk_get_string(ctx, 0);
-	
-	FILE *f = fopen(filepath, "rb");
+	const char* filepath = joshi_require_utf(ctx, 0, NULL);
+
+	int fd = open(filepath, O_RDONLY | O_CLOEXEC);
+	ssize_t length = fd == -1 ? -1 : _push_fd_contents(ctx, fd);
 
-	if (!f) {
+	if (fd != -1) {
+		close(fd);
+	}
+
+	if (length == -1) {
 		duk_push_error_object(
 			ctx, DUK_ERR_ERROR, "Cannot read file: %s", filepath);
 		return duk_throw(ctx);
 	}
 
-	fseek(f, 0, SEEK_END);          
-	int flen = ftell(f);            
-	rewind(f);            
+	duk_push_lstring(ctx, duk_get_buffer(ctx, -1, NULL), length);
 
-	char *contents = malloc(flen+1);
-	fread(contents, 1, flen, f); 
-	contents[flen] = 0;
-	fclose(f);
+	return 1;
+}
 
-	duk_push_string(ctx, contents);
-	free(contents);
-	
+// Fill an iovec array with the data of an array of buffers
+static struct iovec* _get_iovec_arr(
+	duk_context* ctx, duk_idx_t idx, int* iovcnt) {
+
+	if (!duk_is_array(ctx, idx)) {
+		duk_type_error(ctx, "Expected an array of buffers");
+	}
+
+	*iovcnt = duk_get_length(ctx, idx);
+
+	struct iovec* iov = (struct iovec*)
+		joshi_mblock_alloc(ctx, *iovcnt * sizeof(struct iovec))->data;
+
+	for (int i = 0; i < *iovcnt; i++) {
+		duk_size_t size;
+
+		duk_get_prop_index(ctx, idx, i);
+		iov[i].iov_base = duk_require_buffer_data(ctx, -1, &size);
+		iov[i].iov_len = size;
+		duk_pop(ctx);
+	}
+
+	return iov;
+}
+
+static duk_ret_t _js_readv(duk_context* ctx) {
+	int iovcnt;
+
+	int fd = duk_require_int(ctx, 0);
+	struct iovec* iov = _get_iovec_arr(ctx, 1, &iovcnt);
+
+	errno = 0;
+	ssize_t count = readv(fd, iov, iovcnt);
+
+	joshi_mblock_free_all(ctx);
+
+	if (count == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, count);
 	return 1;
 }
 
 // TODO: realpath may be generated, but it needs two parameters
 static duk_ret_t _js_realpath(duk_context* ctx) {
-	const char* filepath = duk_get_string(ctx, 0);
+	const char* filepath = joshi_require_utf(ctx, 0, NULL);
 
 	char resolved_name[PATH_MAX+1];
 	if (realpath(filepath, resolved_name) == NULL) {
 		joshi_throw_syserror(ctx);
 	}
 
-	duk_push_string(ctx, resolved_name);
+	joshi_push_utf(ctx, resolved_name);
+	return 1;
+}
+
+// Like realpath() but returns null instead of throwing when the path cannot be
+// resolved (to avoid creating errors for misses)
+static duk_ret_t _js_resolve_path(duk_context* ctx) {
+	const char* filepath = joshi_require_utf(ctx, 0, NULL);
+
+	char resolved_name[PATH_MAX+1];
+	if (realpath(filepath, resolved_name) == NULL) {
+		duk_push_null(ctx);
+		return 1;
+	}
+
+	joshi_push_utf(ctx, resolved_name);
 	return 1;
 }
 	
@@ -1503,6 +2406,25 @@ static duk_ret_t _js_require_so(duk_context* ctx) {
 	return 1;
 }
 	
+static duk_ret_t _js_sendfile(duk_context* ctx) {
+	loff_t offset;
+
+	int out_fd = duk_require_int(ctx, 0);
+	int in_fd = duk_require_int(ctx, 1);
+	loff_t* poffset = _get_loff_pt(ctx, 2, &offset);
+	size_t count = duk_require_number(ctx, 3);
+
+	errno = 0;
+	ssize_t sent = sendfile(out_fd, in_fd, poffset, count);
+
+	if (sent == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, sent);
+	return 1;
+}
+
 static duk_ret_t _js_set_term_mode(duk_context* ctx) {
 	static struct termios termios_modes[3];
 	static int initialized = 0;
@@ -1570,7 +2492,7 @@ static duk_ret_t _js_signal(duk_context* ctx) {
 			break;
 
 		default:
-			func = _signal_handler;
+			func = joshi_signal_handler;
 
 			duk_push_heap_stash(ctx);
 
@@ -1617,12 +2539,215 @@ static duk_ret_t _js_signal(duk_context* ctx) {
 			break;
 	}
 
-	if (signal(sig, func) == SIG_ERR) {
+	// No SA_RESTART: blocking calls fail with EINTR so that the (deferred)
+	// handler gets a chance to run before they are restarted
+	struct sigaction sa;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = func;
+	sigemptyset(&sa.sa_mask);
+
+	if (sigaction(sig, &sa, NULL) == -1) {
 		joshi_throw_syserror(ctx);
 	}
 
 	return 0;
 }
+
+static duk_ret_t _js_splice(duk_context* ctx) {
+	loff_t off_in;
+	loff_t off_out;
+
+	int fd_in = duk_require_int(ctx, 0);
+	loff_t* poff_in = _get_loff_pt(ctx, 1, &off_in);
+	int fd_out = duk_require_int(ctx, 2);
+	loff_t* poff_out = _get_loff_pt(ctx, 3, &off_out);
+	size_t len = duk_require_number(ctx, 4);
+	unsigned int flags = duk_get_uint(ctx, 5);
+
+	errno = 0;
+	ssize_t count = splice(fd_in, poff_in, fd_out, poff_out, len, flags);
+
+	if (count == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, count);
+	return 1;
+}
+
+// Push a typed array of `count` items and return its data
+static void* _push_typed_array(
+	duk_context* ctx, duk_uarridx_t count, size_t item_size, duk_uint_t type) {
+
+	void* data = duk_push_fixed_buffer(ctx, count * item_size);
+
+	duk_push_buffer_object(ctx, -1, 0, count * item_size, type);
+	duk_remove(ctx, -2);
+
+	return data;
+}
+
+// Same as statx() but falling back to fstatat() on kernels without statx
+static int _statx_compat(
+	int dirfd, const char* path, int flags, unsigned mask, struct statx* stx) {
+
+	static int has_statx = 1;
+
+	if (has_statx) {
+		if (statx(dirfd, path, flags, mask, stx) == 0) {
+			return 0;
+		}
+
+		if (errno != ENOSYS) {
+			return -1;
+		}
+
+		has_statx = 0;
+	}
+
+	struct stat st;
+
+	if (fstatat(dirfd, path, &st, flags) == -1) {
+		return -1;
+	}
+
+	memset(stx, 0, sizeof(*stx));
+
+	stx->stx_mask = STATX_BASIC_STATS;
+	stx->stx_mode = st.st_mode;
+	stx->stx_uid = st.st_uid;
+	stx->stx_gid = st.st_gid;
+	stx->stx_size = st.st_size;
+	stx->stx_ino = st.st_ino;
+	stx->stx_nlink = st.st_nlink;
+	stx->stx_atime.tv_sec = st.st_atim.tv_sec;
+	stx->stx_atime.tv_nsec = st.st_atim.tv_nsec;
+	stx->stx_mtime.tv_sec = st.st_mtim.tv_sec;
+	stx->stx_mtime.tv_nsec = st.st_mtim.tv_nsec;
+	stx->stx_ctime.tv_sec = st.st_ctim.tv_sec;
+	stx->stx_ctime.tv_nsec = st.st_ctim.tv_nsec;
+
+	return 0;
+}
+
+#define _STAT_MANY_TIME(NAME, BIT) \
+	if (mask & (BIT)) { \
+		double* secs = _push_typed_array( \
+			ctx, count, sizeof(double), DUK_BUFOBJ_FLOAT64ARRAY); \
+		duk_put_prop_string(ctx, -2, #NAME); \
+		uint32_t* nsecs = _push_typed_array( \
+			ctx, count, sizeof(uint32_t), DUK_BUFOBJ_UINT32ARRAY); \
+		duk_put_prop_string(ctx, -2, #NAME "_nsec"); \
+		for (duk_uarridx_t i = 0; i < count; i++) { \
+			secs[i] = stxs[i].stx_##NAME.tv_sec; \
+			nsecs[i] = stxs[i].stx_##NAME.tv_nsec; \
+		} \
+	}
+
+#define _STAT_MANY_COLUMN(NAME, BIT, T, TYPE) \
+	if (mask & (BIT)) { \
+		T* column = _push_typed_array(ctx, count, sizeof(T), TYPE); \
+		duk_put_prop_string(ctx, -2, #NAME); \
+		for (duk_uarridx_t i = 0; i < count; i++) { \
+			column[i] = stxs[i].stx_##NAME; \
+		} \
+	}
+
+/*
+ * Stat an array of paths (relative to dirfd) or fds with statx() and return
+ * the requested fields in columns (typed arrays with an item per file) along
+ * with an errno column.
+ */
+static duk_ret_t _js_stat_many(duk_context* ctx) {
+	if (!duk_is_array(ctx, 1)) {
+		return duk_type_error(ctx, "Expected an array of paths or fds");
+	}
+
+	int dirfd = duk_require_int(ctx, 0);
+	duk_uarridx_t count = duk_get_length(ctx, 1);
+	int flags = duk_require_int(ctx, 2);
+	unsigned mask = duk_require_uint(ctx, 3);
+
+	struct statx* stxs =
+		(struct statx*)joshi_mblock_alloc(ctx, count * sizeof(struct statx))->data;
+
+	duk_push_object(ctx);
+
+	int32_t* errnos = _push_typed_array(
+		ctx, count, sizeof(int32_t), DUK_BUFOBJ_INT32ARRAY);
+	duk_put_prop_string(ctx, -2, "errno");
+
+	for (duk_uarridx_t i = 0; i < count; i++) {
+		duk_get_prop_index(ctx, 1, i);
+
+		int ret = duk_is_number(ctx, -1)
+			? _statx_compat(
+				duk_get_int(ctx, -1), "", flags | AT_EMPTY_PATH, mask, stxs + i)
+			: _statx_compat(
+				dirfd, joshi_require_utf(ctx, -1, NULL), flags, mask, stxs + i);
+
+		duk_pop(ctx);
+
+		if (ret == -1) {
+			errnos[i] = errno;
+			memset(stxs + i, 0, sizeof(struct statx));
+		}
+		else {
+			errnos[i] = 0;
+		}
+	}
+
+	_STAT_MANY_COLUMN(mode, STATX_MODE | STATX_TYPE, uint32_t, DUK_BUFOBJ_UINT32ARRAY);
+	_STAT_MANY_COLUMN(uid, STATX_UID, uint32_t, DUK_BUFOBJ_UINT32ARRAY);
+	_STAT_MANY_COLUMN(gid, STATX_GID, uint32_t, DUK_BUFOBJ_UINT32ARRAY);
+	_STAT_MANY_COLUMN(nlink, STATX_NLINK, uint32_t, DUK_BUFOBJ_UINT32ARRAY);
+	_STAT_MANY_COLUMN(ino, STATX_INO, double, DUK_BUFOBJ_FLOAT64ARRAY);
+	_STAT_MANY_COLUMN(size, STATX_SIZE, double, DUK_BUFOBJ_FLOAT64ARRAY);
+	_STAT_MANY_TIME(atime, STATX_ATIME);
+	_STAT_MANY_TIME(btime, STATX_BTIME);
+	_STAT_MANY_TIME(ctime, STATX_CTIME);
+	_STAT_MANY_TIME(mtime, STATX_MTIME);
+
+	joshi_mblock_free_all(ctx);
+
+	return 1;
+}
+
+static duk_ret_t _js_tee(duk_context* ctx) {
+	int fd_in = duk_require_int(ctx, 0);
+	int fd_out = duk_require_int(ctx, 1);
+	size_t len = duk_require_number(ctx, 2);
+	unsigned int flags = duk_get_uint(ctx, 3);
+
+	errno = 0;
+	ssize_t count = tee(fd_in, fd_out, len, flags);
+
+	if (count == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, count);
+	return 1;
+}
+static duk_ret_t _js_writev(duk_context* ctx) {
+	int iovcnt;
+
+	int fd = duk_require_int(ctx, 0);
+	struct iovec* iov = _get_iovec_arr(ctx, 1, &iovcnt);
+
+	errno = 0;
+	ssize_t count = writev(fd, iov, iovcnt);
+
+	joshi_mblock_free_all(ctx);
+
+	if (count == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, count);
+	return 1;
+}
 /* END CUSTOM USER CODE */
 
 JOSHI_FN_DECL joshi_fn_decls[] = {
@@ -1636,6 +2761,7 @@ JOSHI_FN_DECL joshi_fn_decls[] = {
 	{ name: "execv", func: _js_execv, argc: 2 },
 	{ name: "execvp", func: _js_execvp, argc: 2 },
 	{ name: "exit", func: _js_exit, argc: 1 },
+	{ name: "fcntl", func: _js_fcntl, argc: 3 },
 	{ name: "fork", func: _js_fork, argc: 0 },
 	{ name: "getegid", func: _js_getegid, argc: 0 },
 	{ name: "getenv", func: _js_getenv, argc: 1 },
@@ -1645,8 +2771,10 @@ JOSHI_FN_DECL joshi_fn_decls[] = {
 	{ name: "getppid", func: _js_getppid, argc: 0 },
 	{ name: "getrandom", func: _js_getrandom, argc: 3 },
 	{ name: "getuid", func: _js_getuid, argc: 0 },
+	{ name: "isatty", func: _js_isatty, argc: 1 },
 	{ name: "kill", func: _js_kill, argc: 2 },
 	{ name: "lchown", func: _js_lchown, argc: 3 },
+	{ name: "listen", func: _js_listen, argc: 2 },
 	{ name: "lseek", func: _js_lseek, argc: 3 },
 	{ name: "lstat", func: _js_lstat, argc: 2 },
 	{ name: "mkdir", func: _js_mkdir, argc: 2 },
@@ -1654,7 +2782,10 @@ JOSHI_FN_DECL joshi_fn_decls[] = {
 	{ name: "open", func: _js_open, argc: 3 },
 	{ name: "opendir", func: _js_opendir, argc: 1 },
 	{ name: "pipe", func: _js_pipe, argc: 1 },
+	{ name: "pipe2", func: _js_pipe2, argc: 2 },
 	{ name: "poll", func: _js_poll, argc: 3 },
+	{ name: "pread", func: _js_pread, argc: 4 },
+	{ name: "pwrite", func: _js_pwrite, argc: 4 },
 	{ name: "read", func: _js_read, argc: 3 },
 	{ name: "readdir", func: _js_readdir, argc: 1 },
 	{ name: "readlink", func: _js_readlink, argc: 3 },
@@ -1663,7 +2794,10 @@ JOSHI_FN_DECL joshi_fn_decls[] = {
 	{ name: "rmdir", func: _js_rmdir, argc: 1 },
 	{ name: "setenv", func: _js_setenv, argc: 3 },
 	{ name: "setsid", func: _js_setsid, argc: 0 },
+	{ name: "shutdown", func: _js_shutdown, argc: 2 },
 	{ name: "sleep", func: _js_sleep, argc: 1 },
+	{ name: "socket", func: _js_socket, argc: 3 },
+	{ name: "socketpair", func: _js_socketpair, argc: 4 },
 	{ name: "symlink", func: _js_symlink, argc: 2 },
 	{ name: "unlink", func: _js_unlink, argc: 1 },
 	{ name: "unsetenv", func: _js_unsetenv, argc: 1 },
@@ -1671,13 +2805,25 @@ JOSHI_FN_DECL joshi_fn_decls[] = {
 	{ name: "write", func: _js_write, argc: 3 },
 	{ name: "atexit", func: _js_atexit, argc: 1 },
 	{ name: "compile_function", func: _js_compile_function, argc: 2 },
+	{ name: "compile_module", func: _js_compile_module, argc: 3 },
 	{ name: "connect", func: _js_connect, argc: 2 },
+	{ name: "copy_file_range", func: _js_copy_file_range, argc: 5 },
+	{ name: "dump_function", func: _js_dump_function, argc: 1 },
 	{ name: "printk", func: _js_printk, argc: 1 },
+	{ name: "read_all", func: _js_read_all, argc: 1 },
+	{ name: "read_dir", func: _js_read_dir, argc: 2 },
 	{ name: "read_file", func: _js_read_file, argc: 1 },
+	{ name: "readv", func: _js_readv, argc: 2 },
 	{ name: "require_so", func: _js_require_so, argc: 1 },
+	{ name: "resolve_path", func: _js_resolve_path, argc: 1 },
+	{ name: "sendfile", func: _js_sendfile, argc: 4 },
 	{ name: "set_term_mode", func: _js_set_term_mode, argc: 1 },
 	{ name: "sha256", func: _js_sha256, argc: 2 },
 	{ name: "signal", func: _js_signal, argc: 2 },
+	{ name: "splice", func: _js_splice, argc: 6 },
+	{ name: "stat_many", func: _js_stat_many, argc: 4 },
+	{ name: "tee", func: _js_tee, argc: 4 },
+	{ name: "writev", func: _js_writev, argc: 2 },
 };
 
-size_t joshi_fn_decls_count = 52;
+size_t joshi_fn_decls_count = 73;
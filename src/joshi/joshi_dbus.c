@@ -1,10 +1,11 @@
 #include <dbus/dbus.h>
+#include "joshi_signal.h"
 #include <errno.h>
 
 #include "joshi.h"
 
 static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx);
-#define duk_push_char_pt(ctx,value) duk_push_string((ctx),(value))
+#define duk_push_char_pt(ctx,value) joshi_push_utf((ctx),(value))
 #define duk_get_int(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_int(ctx,value) duk_push_int((ctx),(value))
 #define duk_get_short(ctx,idx) duk_require_int((ctx),(idx))
@@ -19,13 +20,7 @@ static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx) {
 		return NULL;
 	}
 
-	const char* cesu = duk_require_string(ctx, idx);
-	JOSHI_MBLOCK* blk = joshi_mblock_alloc(ctx, cnv_cesu_to_utf_length(cesu) + 1);
-	char* utf = (char*)blk->data;
-
-	cnv_cesu_to_utf(cesu, utf);
-
-	return utf;
+	return (char*)joshi_require_utf(ctx, idx, NULL);
 }
 
 static DBusConnection* duk_get_DBusConnection_pt(duk_context* ctx, duk_idx_t idx) {
@@ -84,7 +79,7 @@ static const char* dbus_get_signature(duk_context* ctx, const char* type) {
 		const char *value_signature = dbus_get_signature(ctx, value_type);
 
 		size_t signature_size = 3 + strlen(key_signature) + strlen(value_signature);
-		char* signature = (char*)joshi_mblock_alloc(ctx, signature_size);
+		char* signature = joshi_mblock_alloc(ctx, signature_size)->data;
 
 		snprintf(signature, signature_size, "%s%s%s%s",
 			DBUS_DICT_ENTRY_BEGIN_CHAR_AS_STRING, key_signature, value_signature,
@@ -114,8 +109,8 @@ static const char* dbus_get_signature(duk_context* ctx, const char* type) {
 		return DBUS_TYPE_STRING_AS_STRING;
 	}
 	if (!strcmp(type, "STRUCT<")) {
-		char* signature = (char*)joshi_mblock_alloc(ctx, 3 + strlen(type));
-		char* token = (char*)joshi_mblock_alloc(ctx, strlen(type));
+		char* signature = joshi_mblock_alloc(ctx, 3 + strlen(type))->data;
+		char* token = joshi_mblock_alloc(ctx, strlen(type))->data;
 
 		signature[0] = DBUS_STRUCT_BEGIN_CHAR;
 
@@ -0,0 +1,88 @@
+/*
+ * Duktape extensions which need its internals.
+ *
+ * The internal structures of Duktape are only visible inside duktape.c, so
+ * this file includes it (untouched) and is compiled instead of it.
+ */
+
+#include "duktape.c"
+
+#include "joshi_duktape.h"
+
+static const char* get_own_string(
+	duk_heap* heap, duk_hobject* obj, duk_small_uint_t stridx) {
+
+	duk_tval* tv = duk_hobject_find_entry_tval_ptr_stridx(heap, obj, stridx);
+
+	if (!tv || !DUK_TVAL_IS_STRING(tv)) {
+		return NULL;
+	}
+
+	return (const char*)DUK_HSTRING_GET_DATA(DUK_TVAL_GET_STRING(tv));
+}
+
+static int get_line(duk_hthread* thr, duk_activation* act) {
+#if defined(DUK_USE_PC2LINE)
+	duk_tval* tv = duk_hobject_find_entry_tval_ptr_stridx(
+		thr->heap, act->func, DUK_STRIDX_INT_PC2LINE);
+
+	if (!tv || !DUK_TVAL_IS_BUFFER(tv)) {
+		return 0;
+	}
+
+	duk_hbuffer* buf = DUK_TVAL_GET_BUFFER(tv);
+
+	if (DUK_HBUFFER_HAS_DYNAMIC(buf) || DUK_HBUFFER_HAS_EXTERNAL(buf)) {
+		return 0;
+	}
+
+	return duk__hobject_pc2line_query_raw(
+		thr, (duk_hbuffer_fixed*)buf, duk_hthread_get_act_prev_pc(thr, act));
+#else
+	return 0;
+#endif
+}
+
+/*
+ * Get the call stack of the running thread (innermost frame first) without
+ * using the API, so that it can be called from the executor interrupt: it
+ * doesn't allocate, touch the value stack or run any code.
+ *
+ * Returned strings point into the heap and are only valid until execution
+ * resumes.
+ */
+int joshi_duk_callstack(duk_context* ctx, JOSHI_DUK_FRAME* frames, int max) {
+	duk_hthread* thr = ((duk_hthread*)ctx)->heap->curr_thread;
+
+	if (!thr) {
+		return 0;
+	}
+
+	int count = 0;
+
+	for (duk_activation* act = thr->callstack_curr;
+		act && count < max;
+		act = act->parent) {
+
+		JOSHI_DUK_FRAME* frame = frames + count++;
+
+		frame->name = NULL;
+		frame->file_name = NULL;
+		frame->line = 0;
+
+		// Lightfuncs have no object
+		if (!act->func) {
+			continue;
+		}
+
+		frame->name = get_own_string(thr->heap, act->func, DUK_STRIDX_NAME);
+
+		if (DUK_HOBJECT_IS_COMPFUNC(act->func)) {
+			frame->file_name =
+				get_own_string(thr->heap, act->func, DUK_STRIDX_FILE_NAME);
+			frame->line = get_line(thr, act);
+		}
+	}
+
+	return count;
+}
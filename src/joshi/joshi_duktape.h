@@ -0,0 +1,14 @@
+#ifndef _JOSHI_DUKTAPE_H
+#define _JOSHI_DUKTAPE_H
+
+#include "duktape.h"
+
+typedef struct {
+	const char* name;
+	const char* file_name;
+	int line;
+} JOSHI_DUK_FRAME;
+
+int joshi_duk_callstack(duk_context* ctx, JOSHI_DUK_FRAME* frames, int max);
+
+#endif
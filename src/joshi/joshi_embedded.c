@@ -0,0 +1,10 @@
+#include "joshi_embedded.h"
+
+/*
+ * Default (empty) table of embedded library files. Binaries built with 
+ * `make embedded` link a generated table instead.
+ */
+size_t joshi_embedded_files_count = 0;
+JOSHI_EMBEDDED_FILE joshi_embedded_files[] = {
+	{ NULL, NULL, 0 },
+};
@@ -0,0 +1,18 @@
+#ifndef _JOSHI_EMBEDDED_H
+#define _JOSHI_EMBEDDED_H
+
+#include "joshi.h"
+
+/* A precompiled library file (see scripts/embed-library.js) */
+typedef struct {
+	const char* name;
+	const unsigned char* bytecode;
+	size_t size;
+} JOSHI_EMBEDDED_FILE;
+
+extern size_t joshi_embedded_files_count;
+extern JOSHI_EMBEDDED_FILE joshi_embedded_files[];
+
+duk_ret_t joshi_load_embedded(duk_context* ctx);
+
+#endif
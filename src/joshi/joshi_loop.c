@@ -0,0 +1,208 @@
+#include <errno.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "joshi_loop.h"
+#include "joshi_signal.h"
+
+/*
+ * Event loop primitives (backed by epoll).
+ *
+ * Each registration has an id which is stored in the epoll event data along
+ * with the file descriptor and a timer flag, so that dispatching an event
+ * just needs a lookup of the callback in the JS callbacks object.
+ *
+ * Timers are timerfds which are read before dispatching so that their
+ * callbacks receive the number of expirations.
+ *
+ * Every loop also watches the signal pipe (with the reserved id 0) so that
+ * deferred signal handlers run as soon as a signal arrives.
+ */
+
+#define SIGNAL_ID 0
+
+#define MAX_EVENTS 64
+
+#define DATA(fd, id, timer) \
+	((((uint64_t)(uint32_t)(fd)) << 32) | (((uint64_t)(id)) << 1) | (timer))
+#define DATA_FD(data) ((int)((data) >> 32))
+#define DATA_ID(data) ((uint32_t)(((data) & 0xFFFFFFFF) >> 1))
+#define DATA_TIMER(data) ((data) & 1)
+
+static int ctl(int epfd, int op, int fd, uint32_t events, uint32_t id, int timer) {
+	struct epoll_event ev;
+
+	ev.events = events;
+	ev.data.u64 = DATA(fd, id, timer);
+
+	return epoll_ctl(epfd, op, fd, &ev);
+}
+
+duk_ret_t joshi_loop_add(duk_context* ctx) {
+	int epfd = duk_require_int(ctx, 0);
+	int fd = duk_require_int(ctx, 1);
+	uint32_t events = duk_require_uint(ctx, 2);
+	uint32_t id = duk_require_uint(ctx, 3);
+
+	if (ctl(epfd, EPOLL_CTL_ADD, fd, events, id, 0) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_loop_create(duk_context* ctx) {
+	int epfd = epoll_create1(EPOLL_CLOEXEC);
+
+	if (epfd == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	int sfd = joshi_signal_pipe_fd();
+
+	if (sfd != -1 && ctl(epfd, EPOLL_CTL_ADD, sfd, EPOLLIN, SIGNAL_ID, 0) == -1) {
+		int err = errno;
+		close(epfd);
+		errno = err;
+
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, epfd);
+
+	return 1;
+}
+
+duk_ret_t joshi_loop_modify(duk_context* ctx) {
+	int epfd = duk_require_int(ctx, 0);
+	int fd = duk_require_int(ctx, 1);
+	uint32_t events = duk_require_uint(ctx, 2);
+	uint32_t id = duk_require_uint(ctx, 3);
+
+	if (ctl(epfd, EPOLL_CTL_MOD, fd, events, id, 0) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_loop_remove(duk_context* ctx) {
+	int epfd = duk_require_int(ctx, 0);
+	int fd = duk_require_int(ctx, 1);
+
+	if (epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_loop_timer(duk_context* ctx) {
+	int epfd = duk_require_int(ctx, 0);
+	double initial = duk_require_number(ctx, 1);
+	double interval = duk_require_number(ctx, 2);
+	uint32_t id = duk_require_uint(ctx, 3);
+
+	int tfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+	if (tfd == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	// A zero it_value would disarm the timer
+	if (initial <= 0) {
+		initial = 0.001;
+	}
+
+	struct itimerspec its;
+
+	its.it_value.tv_sec = (time_t)(initial / 1000);
+	its.it_value.tv_nsec = (long)((initial - its.it_value.tv_sec * 1000.0) * 1e6);
+	its.it_interval.tv_sec = (time_t)(interval / 1000);
+	its.it_interval.tv_nsec =
+		(long)((interval - its.it_interval.tv_sec * 1000.0) * 1e6);
+
+	if (timerfd_settime(tfd, 0, &its, NULL) == -1 ||
+		ctl(epfd, EPOLL_CTL_ADD, tfd, EPOLLIN, id, 1) == -1) {
+
+		int err = errno;
+		close(tfd);
+		errno = err;
+
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, tfd);
+
+	return 1;
+}
+
+duk_ret_t joshi_loop_wait(duk_context* ctx) {
+	int epfd = duk_require_int(ctx, 0);
+	duk_require_object(ctx, 1);
+	int timeout = duk_get_int_default(ctx, 2, -1);
+
+	struct epoll_event events[MAX_EVENTS];
+
+	int count = epoll_wait(epfd, events, MAX_EVENTS, timeout);
+
+	if (count == -1 && errno != EINTR) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	joshi_signal_run_pending(ctx);
+
+	if (count == -1) {
+		duk_push_int(ctx, 0);
+		return 1;
+	}
+
+	// Dispatch events
+	for (int i = 0; i < count; i++) {
+		uint64_t data = events[i].data.u64;
+		int fd = DATA_FD(data);
+
+		if (DATA_ID(data) == SIGNAL_ID) {
+			continue;
+		}
+
+		// [ epfd callbacks timeout ]
+
+		duk_get_prop_index(ctx, 1, DATA_ID(data));
+
+		// [ epfd callbacks timeout callback ]
+
+		// Removed by a previous callback of this same batch
+		if (!duk_is_function(ctx, -1)) {
+			duk_pop(ctx);
+			continue;
+		}
+
+		if (DATA_TIMER(data)) {
+			uint64_t expirations = 0;
+
+			if (read(fd, &expirations, sizeof(expirations)) == -1) {
+				duk_pop(ctx);
+				continue;
+			}
+
+			duk_push_number(ctx, expirations);
+			duk_call(ctx, 1);
+		}
+		else {
+			duk_push_int(ctx, fd);
+			duk_push_uint(ctx, events[i].events);
+			duk_call(ctx, 2);
+		}
+
+		duk_pop(ctx);
+
+		// [ epfd callbacks timeout ]
+	}
+
+	duk_push_int(ctx, count);
+
+	return 1;
+}
@@ -0,0 +1,13 @@
+#ifndef _JOSHI_LOOP_H
+#define _JOSHI_LOOP_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_loop_add(duk_context* ctx);
+duk_ret_t joshi_loop_create(duk_context* ctx);
+duk_ret_t joshi_loop_modify(duk_context* ctx);
+duk_ret_t joshi_loop_remove(duk_context* ctx);
+duk_ret_t joshi_loop_timer(duk_context* ctx);
+duk_ret_t joshi_loop_wait(duk_context* ctx);
+
+#endif
@@ -0,0 +1,172 @@
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "joshi_mmap.h"
+
+/*
+ * Memory mapped files.
+ *
+ * Mappings are returned as Uint8Array views over an external Duktape buffer
+ * pointing to the mapped memory, so no data is ever copied.
+ *
+ * Offsets don't need to be page aligned: the mapping starts at the previous
+ * page boundary and the view skips the extra bytes.
+ *
+ * Views are created over an ArrayBuffer which owns the mapping (and unmaps it
+ * when finalized). Duktape keeps that ArrayBuffer alive from every view derived
+ * from the returned one (with subarray() and friends), so the mapping outlives
+ * all of them.
+ *
+ * Duktape has no read only views, so writing to a mapping without PROT_WRITE
+ * faults. Such mappings are still allowed because, unlike private writable
+ * ones, they don't count against overcommit (which matters when mapping files
+ * bigger than RAM plus swap).
+ *
+ * Unmapped views are detached from the mapping by configuring their external
+ * buffer to be empty, so that any later access is out of bounds (instead of
+ * touching unmapped memory). Duktape reads out of bounds bytes as zero.
+ */
+
+#define PROP_BUF DUK_HIDDEN_SYMBOL("joshi_mmap_buf")
+#define PROP_PTR DUK_HIDDEN_SYMBOL("joshi_mmap_ptr")
+#define PROP_SIZE DUK_HIDDEN_SYMBOL("joshi_mmap_size")
+
+/* Push the ArrayBuffer owning the mapping of the view at `idx` */
+static void push_owner(duk_context* ctx, duk_idx_t idx) {
+	if (!duk_is_buffer_data(ctx, idx) || !duk_is_object(ctx, idx)) {
+		duk_type_error(ctx, "Invalid mapping");
+	}
+
+	duk_get_prop_string(ctx, idx, "buffer");
+
+	if (!duk_is_object(ctx, -1)) {
+		duk_type_error(ctx, "Invalid mapping");
+	}
+}
+
+/* Get the mapping of the ArrayBuffer at `idx` */
+static void* get_mapping(duk_context* ctx, duk_idx_t idx, size_t* size) {
+	duk_get_prop_string(ctx, idx, PROP_PTR);
+	void* ptr = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	duk_get_prop_string(ctx, idx, PROP_SIZE);
+	*size = duk_get_number_default(ctx, -1, 0);
+	duk_pop(ctx);
+
+	return ptr;
+}
+
+static duk_ret_t mapping_finalizer(duk_context* ctx) {
+	size_t size;
+	void* ptr = get_mapping(ctx, 0, &size);
+
+	if (ptr) {
+		munmap(ptr, size);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_madvise(duk_context* ctx) {
+	int advice = duk_require_int(ctx, 1);
+
+	push_owner(ctx, 0);
+
+	size_t size;
+	void* ptr = get_mapping(ctx, -1, &size);
+
+	if (!ptr) {
+		duk_type_error(ctx, "Mapping is not mapped");
+	}
+
+	if (madvise(ptr, size, advice) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_mmap(duk_context* ctx) {
+	int fd = duk_require_int(ctx, 0);
+	double offset = duk_require_number(ctx, 1);
+	double length = duk_require_number(ctx, 2);
+	int prot = duk_require_int(ctx, 3);
+	int flags = duk_require_int(ctx, 4);
+
+	if (offset < 0 || length < 0) {
+		return duk_range_error(ctx, "Invalid mapping offset or length");
+	}
+
+	if (length == 0) {
+		duk_push_fixed_buffer(ctx, 0);
+		duk_push_buffer_object(ctx, -1, 0, 0, DUK_BUFOBJ_UINT8ARRAY);
+		return 1;
+	}
+
+	off_t page_size = sysconf(_SC_PAGESIZE);
+	off_t delta = (off_t)offset % page_size;
+	size_t size = (size_t)length + delta;
+
+	void* ptr = mmap(NULL, size, prot, flags, fd, (off_t)offset - delta);
+
+	if (ptr == MAP_FAILED) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_external_buffer(ctx);
+	duk_config_buffer(ctx, -1, ptr, size);
+
+	// [ ... buf ]
+
+	duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_ARRAYBUFFER);
+
+	// [ ... buf ab ]
+
+	duk_pull(ctx, -2);
+	duk_put_prop_string(ctx, -2, PROP_BUF);
+
+	duk_push_pointer(ctx, ptr);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_push_number(ctx, size);
+	duk_put_prop_string(ctx, -2, PROP_SIZE);
+
+	duk_push_c_function(ctx, mapping_finalizer, 1);
+	duk_set_finalizer(ctx, -2);
+
+	// [ ... ab ]
+
+	duk_push_buffer_object(ctx, -1, delta, length, DUK_BUFOBJ_UINT8ARRAY);
+
+	// [ ... ab u8a ]
+
+	return 1;
+}
+
+duk_ret_t joshi_munmap(duk_context* ctx) {
+	push_owner(ctx, 0);
+
+	// [ ... ab ]
+
+	size_t size;
+	void* ptr = get_mapping(ctx, -1, &size);
+
+	if (!ptr) {
+		return 0;
+	}
+
+	duk_push_pointer(ctx, NULL);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_get_prop_string(ctx, -1, PROP_BUF);
+	duk_config_buffer(ctx, -1, NULL, 0);
+	duk_pop(ctx);
+
+	if (munmap(ptr, size) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef _JOSHI_MMAP_H
+#define _JOSHI_MMAP_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_madvise(duk_context* ctx);
+duk_ret_t joshi_mmap(duk_context* ctx);
+duk_ret_t joshi_munmap(duk_context* ctx);
+
+#endif
@@ -0,0 +1,334 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "joshi_duktape.h"
+#include "joshi_prof.h"
+
+/*
+ * Sampling profiler.
+ *
+ * A SIGPROF timer counts ticks of CPU time, which are attributed to the call
+ * stack when the executor is interrupted (see DUK_USE_EXEC_TIMEOUT_CHECK in
+ * duk_config.h) and when native functions finish (from joshi_mblock_free_all).
+ * The Duktape API cannot be used from the interrupt, so the stack is walked
+ * directly with joshi_duk_callstack.
+ *
+ * Only one thread may be profiled at a time (the timer is process wide), and
+ * samples are only taken in that thread.
+ *
+ * Samples are stored as folded stacks (frames separated by `;`) with the
+ * number of ticks that they account for.
+ */
+
+#define MAX_FRAMES 128
+#define MAX_FRAME_LENGTH 256
+
+typedef struct {
+	char* stack;
+	uint64_t hash;
+	uint64_t ticks;
+} SAMPLE;
+
+static int prof_busy = 0;
+static __thread int prof_running = 0;
+static volatile sig_atomic_t prof_ticks = 0;
+
+static __thread SAMPLE* samples = NULL;
+static __thread size_t samples_capacity = 0;
+static __thread size_t samples_count = 0;
+
+static const char* prof_path = NULL;
+static pid_t prof_pid;
+
+static void sigprof_handler(int sig) {
+	prof_ticks++;
+}
+
+static uint64_t hash_string(const char* str) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	for (const unsigned char* p = str; *p; p++) {
+		hash ^= *p;
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+static int grow_samples() {
+	size_t capacity = samples_capacity ? 2 * samples_capacity : 1024;
+	SAMPLE* new_samples = calloc(capacity, sizeof(SAMPLE));
+
+	if (!new_samples) {
+		return -1;
+	}
+
+	for (size_t i = 0; i < samples_capacity; i++) {
+		SAMPLE* sample = samples + i;
+
+		if (sample->stack) {
+			size_t j = sample->hash & (capacity - 1);
+
+			while (new_samples[j].stack) {
+				j = (j + 1) & (capacity - 1);
+			}
+
+			new_samples[j] = *sample;
+		}
+	}
+
+	free(samples);
+	samples = new_samples;
+	samples_capacity = capacity;
+
+	return 0;
+}
+
+static void add_sample(const char* stack, uint64_t ticks) {
+	if (2 * (samples_count + 1) > samples_capacity && grow_samples() == -1) {
+		return;
+	}
+
+	uint64_t hash = hash_string(stack);
+	size_t i = hash & (samples_capacity - 1);
+
+	while (samples[i].stack) {
+		if (samples[i].hash == hash && !strcmp(samples[i].stack, stack)) {
+			samples[i].ticks += ticks;
+			return;
+		}
+
+		i = (i + 1) & (samples_capacity - 1);
+	}
+
+	samples[i].stack = strdup(stack);
+	samples[i].hash = hash;
+	samples[i].ticks = ticks;
+
+	if (samples[i].stack) {
+		samples_count++;
+	}
+}
+
+static void clear_samples() {
+	for (size_t i = 0; i < samples_capacity; i++) {
+		free(samples[i].stack);
+	}
+
+	free(samples);
+
+	samples = NULL;
+	samples_capacity = 0;
+	samples_count = 0;
+}
+
+static void format_frame(JOSHI_DUK_FRAME* frame, char* out) {
+	const char* name = frame->name && *frame->name ? frame->name : "anon";
+
+	if (frame->file_name) {
+		snprintf(
+			out, MAX_FRAME_LENGTH, "%s (%s:%d)",
+			name, frame->file_name, frame->line);
+	}
+	else {
+		snprintf(out, MAX_FRAME_LENGTH, "%s [native]", name);
+	}
+
+	// Semicolons separate frames in folded stacks
+	for (char* p = out; *p; p++) {
+		if (*p == ';') {
+			*p = ':';
+		}
+	}
+}
+
+static void sample(duk_context* ctx, uint64_t ticks) {
+	static __thread char stack[MAX_FRAMES * MAX_FRAME_LENGTH];
+	JOSHI_DUK_FRAME frames[MAX_FRAMES];
+
+	int count = joshi_duk_callstack(ctx, frames, MAX_FRAMES);
+
+	if (count == 0) {
+		return;
+	}
+
+	// Folded stacks go from outermost to innermost frame
+	char* p = stack;
+
+	for (int i = count - 1; i >= 0; i--) {
+		format_frame(frames + i, p);
+		p += strlen(p);
+
+		*p++ = i ? ';' : 0;
+	}
+
+	add_sample(stack, ticks);
+}
+
+static void write_profile() {
+	if (!prof_running || getpid() != prof_pid) {
+		return;
+	}
+
+	FILE* f = fopen(prof_path, "w");
+
+	if (!f) {
+		fprintf(stderr, "Cannot write profile to %s\n", prof_path);
+		return;
+	}
+
+	for (size_t i = 0; i < samples_capacity; i++) {
+		if (samples[i].stack) {
+			fprintf(
+				f, "%s %llu\n",
+				samples[i].stack, (unsigned long long)samples[i].ticks);
+		}
+	}
+
+	fclose(f);
+}
+
+static int start_timer(int hz) {
+	struct sigaction sa;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = sigprof_handler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	if (sigaction(SIGPROF, &sa, NULL) == -1) {
+		return -1;
+	}
+
+	struct itimerval it;
+
+	it.it_interval.tv_sec = 0;
+	it.it_interval.tv_usec = 1000000 / hz;
+	it.it_value = it.it_interval;
+
+	return setitimer(ITIMER_PROF, &it, NULL);
+}
+
+static int start(int hz) {
+	if (hz <= 0 || hz > 1000000) {
+		hz = JOSHI_PROF_DEFAULT_HZ;
+	}
+
+	// Restarting is fine, but not while another thread is being profiled
+	if (!prof_running && __atomic_exchange_n(&prof_busy, 1, __ATOMIC_SEQ_CST)) {
+		errno = EBUSY;
+		return -1;
+	}
+
+	if (start_timer(hz) == -1) {
+		if (!prof_running) {
+			__atomic_store_n(&prof_busy, 0, __ATOMIC_SEQ_CST);
+		}
+
+		return -1;
+	}
+
+	clear_samples();
+
+	prof_ticks = 0;
+	prof_pid = getpid();
+	prof_running = 1;
+
+	return 0;
+}
+
+static void stop() {
+	struct itimerval it;
+
+	if (!prof_running) {
+		return;
+	}
+
+	memset(&it, 0, sizeof(it));
+	setitimer(ITIMER_PROF, &it, NULL);
+
+	prof_running = 0;
+	__atomic_store_n(&prof_busy, 0, __ATOMIC_SEQ_CST);
+}
+
+void joshi_prof_init(const char* path) {
+	if (!path || !*path) {
+		return;
+	}
+
+	const char* hz = getenv("JOSHI_PROF_HZ");
+
+	if (start(hz ? atoi(hz) : 0) == -1) {
+		perror("Cannot start profiler");
+		return;
+	}
+
+	prof_path = path;
+	atexit(write_profile);
+}
+
+void joshi_prof_check(duk_context* ctx) {
+	// Only the thread which started the profiler is sampled (prof_running is
+	// thread local)
+	if (!prof_ticks || !prof_running) {
+		return;
+	}
+
+	sample(ctx, __atomic_exchange_n(&prof_ticks, 0, __ATOMIC_SEQ_CST));
+}
+
+duk_bool_t joshi_exec_timeout_check(void* udata) {
+	joshi_prof_check(_joshi_duk_context);
+
+	return 0;
+}
+
+duk_ret_t joshi_prof_start(duk_context* ctx) {
+	int hz = duk_get_int_default(ctx, 0, 0);
+
+	if (prof_path) {
+		return duk_error(
+			ctx, DUK_ERR_ERROR, "Profiler already started with JOSHI_PROF");
+	}
+
+	if (start(hz) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_prof_stop(duk_context* ctx) {
+	if (prof_path) {
+		return duk_error(
+			ctx, DUK_ERR_ERROR, "Profiler already started with JOSHI_PROF");
+	}
+
+	// Attribute the ticks pending since the last sample
+	joshi_prof_check(ctx);
+
+	stop();
+
+	duk_push_array(ctx);
+
+	duk_uarridx_t n = 0;
+
+	for (size_t i = 0; i < samples_capacity; i++) {
+		if (samples[i].stack) {
+			duk_push_sprintf(
+				ctx, "%s %llu",
+				samples[i].stack, (unsigned long long)samples[i].ticks);
+			duk_put_prop_index(ctx, -2, n++);
+		}
+	}
+
+	clear_samples();
+
+	return 1;
+}
@@ -0,0 +1,14 @@
+#ifndef _JOSHI_PROF_H
+#define _JOSHI_PROF_H
+
+#include "joshi.h"
+
+#define JOSHI_PROF_DEFAULT_HZ 1000
+
+void joshi_prof_init(const char* path);
+void joshi_prof_check(duk_context* ctx);
+
+duk_ret_t joshi_prof_start(duk_context* ctx);
+duk_ret_t joshi_prof_stop(duk_context* ctx);
+
+#endif
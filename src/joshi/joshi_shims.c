@@ -0,0 +1,458 @@
+#include <math.h>
+#include <string.h>
+
+#include "joshi_shims.h"
+
+/*
+ * Native implementations of ES2015+ methods missing in Duktape.
+ *
+ * They are installed in every heap when it is created, so there's no need to
+ * load any shim module. Methods which Duktape already implements natively
+ * (String.prototype.startsWith, Array.prototype.reduce, Object.assign, ...)
+ * are not touched.
+ */
+
+typedef struct {
+	const char* object;
+	int prototype;
+	const char* name;
+	duk_c_function func;
+	duk_idx_t nargs;
+} SHIM;
+
+/*
+ * Push `this` coerced to an object and return its index and length
+ */
+static duk_idx_t push_this_object(duk_context* ctx, duk_uarridx_t* length) {
+	duk_push_this(ctx);
+	duk_to_object(ctx, -1);
+
+	*length = duk_get_length(ctx, -1);
+
+	return duk_get_top_index(ctx);
+}
+
+/*
+ * Push `this` coerced to a string (throwing for null and undefined)
+ */
+static const char* push_this_string(duk_context* ctx, duk_size_t* size) {
+	duk_push_this(ctx);
+
+	if (duk_is_null_or_undefined(ctx, -1)) {
+		duk_type_error(ctx, "Cannot convert null or undefined to string");
+	}
+
+	return duk_to_lstring(ctx, -1, size);
+}
+
+static duk_uarridx_t find_index(duk_context* ctx, duk_bool_t* found) {
+	duk_require_callable(ctx, 0);
+
+	duk_uarridx_t length;
+	duk_idx_t this_idx = push_this_object(ctx, &length);
+
+	for (duk_uarridx_t i = 0; i < length; i++) {
+		duk_dup(ctx, 0);
+		duk_dup(ctx, 1);
+		duk_get_prop_index(ctx, this_idx, i);
+		duk_push_uint(ctx, i);
+		duk_dup(ctx, this_idx);
+
+		// [ ... predicate thisArg value i this ]
+
+		duk_call_method(ctx, 3);
+
+		duk_bool_t match = duk_to_boolean(ctx, -1);
+		duk_pop(ctx);
+
+		if (match) {
+			*found = 1;
+			return i;
+		}
+	}
+
+	*found = 0;
+	return 0;
+}
+
+static duk_ret_t array_find(duk_context* ctx) {
+	duk_bool_t found;
+	duk_uarridx_t i = find_index(ctx, &found);
+
+	if (!found) {
+		return 0;
+	}
+
+	duk_push_this(ctx);
+	duk_get_prop_index(ctx, -1, i);
+
+	return 1;
+}
+
+static duk_ret_t array_find_index(duk_context* ctx) {
+	duk_bool_t found;
+	duk_uarridx_t i = find_index(ctx, &found);
+
+	if (found) {
+		duk_push_uint(ctx, i);
+	}
+	else {
+		duk_push_int(ctx, -1);
+	}
+
+	return 1;
+}
+
+static void flatten(
+	duk_context* ctx, duk_idx_t src_idx, duk_idx_t dst_idx,
+	duk_uarridx_t* n, double depth) {
+
+	duk_uarridx_t length = duk_get_length(ctx, src_idx);
+
+	for (duk_uarridx_t i = 0; i < length; i++) {
+		// Holes are skipped
+		if (!duk_has_prop_index(ctx, src_idx, i)) {
+			continue;
+		}
+
+		duk_get_prop_index(ctx, src_idx, i);
+
+		if (depth > 0 && duk_is_array(ctx, -1)) {
+			flatten(ctx, duk_get_top_index(ctx), dst_idx, n, depth - 1);
+			duk_pop(ctx);
+		}
+		else {
+			duk_put_prop_index(ctx, dst_idx, (*n)++);
+		}
+	}
+}
+
+static duk_ret_t array_flat(duk_context* ctx) {
+	double depth = duk_is_undefined(ctx, 0) ? 1 : duk_to_number(ctx, 0);
+
+	if (isnan(depth)) {
+		depth = 0;
+	}
+
+	duk_uarridx_t length;
+	duk_idx_t this_idx = push_this_object(ctx, &length);
+	duk_idx_t dst_idx = duk_push_array(ctx);
+	duk_uarridx_t n = 0;
+
+	flatten(ctx, this_idx, dst_idx, &n, depth);
+
+	return 1;
+}
+
+static duk_ret_t array_from(duk_context* ctx) {
+	duk_bool_t map = !duk_is_undefined(ctx, 1);
+
+	if (map) {
+		duk_require_callable(ctx, 1);
+	}
+
+	if (duk_is_null_or_undefined(ctx, 0)) {
+		duk_type_error(ctx, "Array.from requires an array-like object");
+	}
+
+	duk_to_object(ctx, 0);
+
+	duk_uarridx_t length = duk_get_length(ctx, 0);
+	duk_idx_t dst_idx = duk_push_array(ctx);
+
+	for (duk_uarridx_t i = 0; i < length; i++) {
+		if (map) {
+			duk_dup(ctx, 1);
+			duk_dup(ctx, 2);
+			duk_get_prop_index(ctx, 0, i);
+			duk_push_uint(ctx, i);
+
+			// [ ... dst mapFn thisArg value i ]
+
+			duk_call_method(ctx, 2);
+		}
+		else {
+			duk_get_prop_index(ctx, 0, i);
+		}
+
+		duk_put_prop_index(ctx, dst_idx, i);
+	}
+
+	return 1;
+}
+
+static duk_ret_t array_includes(duk_context* ctx) {
+	duk_uarridx_t length;
+	duk_idx_t this_idx = push_this_object(ctx, &length);
+
+	double from = duk_to_number(ctx, 1);
+
+	if (isnan(from)) {
+		from = 0;
+	}
+	else if (from < 0) {
+		from = length + from < 0 ? 0 : length + from;
+	}
+
+	// NaN is found too (SameValueZero comparison)
+	duk_bool_t find_nan = duk_is_nan(ctx, 0);
+
+	for (duk_uarridx_t i = from; i < length; i++) {
+		duk_get_prop_index(ctx, this_idx, i);
+
+		duk_bool_t match = find_nan
+			? duk_is_nan(ctx, -1)
+			: duk_strict_equals(ctx, -1, 0);
+
+		duk_pop(ctx);
+
+		if (match) {
+			duk_push_true(ctx);
+			return 1;
+		}
+	}
+
+	duk_push_false(ctx);
+	return 1;
+}
+
+static duk_ret_t object_entries_values(duk_context* ctx, int entries) {
+	duk_to_object(ctx, 0);
+
+	duk_idx_t dst_idx = duk_push_array(ctx);
+	duk_uarridx_t n = 0;
+
+	duk_enum(ctx, 0, DUK_ENUM_OWN_PROPERTIES_ONLY);
+
+	while (duk_next(ctx, -1, 1)) {
+		// [ ... dst enum key value ]
+
+		if (entries) {
+			duk_push_array(ctx);
+			duk_pull(ctx, -3);
+			duk_put_prop_index(ctx, -2, 0);
+			duk_pull(ctx, -2);
+			duk_put_prop_index(ctx, -2, 1);
+		}
+		else {
+			duk_remove(ctx, -2);
+		}
+
+		// [ ... dst enum entry ]
+
+		duk_put_prop_index(ctx, dst_idx, n++);
+	}
+
+	duk_pop(ctx);
+
+	return 1;
+}
+
+static duk_ret_t object_entries(duk_context* ctx) {
+	return object_entries_values(ctx, 1);
+}
+
+static duk_ret_t object_values(duk_context* ctx) {
+	return object_entries_values(ctx, 0);
+}
+
+static duk_ret_t string_pad(duk_context* ctx, int at_start) {
+	duk_size_t size;
+	push_this_string(ctx, &size);
+
+	// [ ... str ]
+
+	duk_idx_t str_idx = duk_get_top_index(ctx);
+	duk_size_t length = duk_get_length(ctx, str_idx);
+	double target = duk_to_number(ctx, 0);
+
+	if (isnan(target) || target <= length) {
+		return 1;
+	}
+
+	if (target > DUK_UINT32_MAX) {
+		duk_range_error(ctx, "Invalid string length");
+	}
+
+	if (duk_is_undefined(ctx, 1)) {
+		duk_push_string(ctx, " ");
+		duk_replace(ctx, 1);
+	}
+
+	duk_size_t pad_size;
+	const char* pad = duk_to_lstring(ctx, 1, &pad_size);
+
+	if (pad_size == 0) {
+		return 1;
+	}
+
+	duk_size_t fill_length = target - length;
+	duk_size_t pad_length = duk_get_length(ctx, 1);
+
+	// Repeat the pad string enough times and cut it to the needed length
+	duk_size_t times = (fill_length + pad_length - 1) / pad_length;
+	char* buf = duk_push_fixed_buffer(ctx, times * pad_size);
+
+	for (duk_size_t i = 0; i < times; i++) {
+		memcpy(buf + i * pad_size, pad, pad_size);
+	}
+
+	duk_buffer_to_string(ctx, -1);
+	duk_substring(ctx, -1, 0, fill_length);
+
+	// [ ... str fill ]
+
+	if (at_start) {
+		duk_swap_top(ctx, -2);
+	}
+
+	duk_concat(ctx, 2);
+
+	return 1;
+}
+
+static duk_ret_t string_pad_end(duk_context* ctx) {
+	return string_pad(ctx, 0);
+}
+
+static duk_ret_t string_pad_start(duk_context* ctx) {
+	return string_pad(ctx, 1);
+}
+
+/*
+ * Return the size of the white space or line terminator (as in
+ * String.prototype.trim) starting at `p` or 0 if there's none
+ */
+static size_t white_space_size(const unsigned char* p, size_t left) {
+	switch (p[0]) {
+		case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x20:
+			return 1;
+
+		case 0xC2:
+			return left >= 2 && p[1] == 0xA0 ? 2 : 0;
+	}
+
+	if (left < 3 || (p[0] & 0xF0) != 0xE0) {
+		return 0;
+	}
+
+	unsigned cp = ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+
+	switch (cp) {
+		case 0x1680: case 0x180E: case 0x2028: case 0x2029: case 0x202F:
+		case 0x205F: case 0x3000: case 0xFEFF:
+			return 3;
+	}
+
+	return cp >= 0x2000 && cp <= 0x200A ? 3 : 0;
+}
+
+static size_t char_size(unsigned char c) {
+	if (c < 0x80) {
+		return 1;
+	}
+
+	if ((c & 0xE0) == 0xC0) {
+		return 2;
+	}
+
+	if ((c & 0xF0) == 0xE0) {
+		return 3;
+	}
+
+	return 4;
+}
+
+static duk_ret_t string_trim(duk_context* ctx, int start, int end) {
+	duk_size_t size;
+	const unsigned char* str =
+		(const unsigned char*)push_this_string(ctx, &size);
+
+	size_t first = 0;
+	size_t last = size;
+
+	if (start) {
+		while (first < size) {
+			size_t ws = white_space_size(str + first, size - first);
+
+			if (!ws) {
+				break;
+			}
+
+			first += ws;
+		}
+	}
+
+	if (end) {
+		last = first;
+
+		for (size_t i = first; i < size; ) {
+			size_t ws = white_space_size(str + i, size - i);
+
+			if (ws) {
+				i += ws;
+			}
+			else {
+				i += char_size(str[i]);
+				last = i > size ? size : i;
+			}
+		}
+	}
+
+	if (first == 0 && last == size) {
+		return 1;
+	}
+
+	duk_push_lstring(ctx, (const char*)str + first, last - first);
+
+	return 1;
+}
+
+static duk_ret_t string_trim_end(duk_context* ctx) {
+	return string_trim(ctx, 0, 1);
+}
+
+static duk_ret_t string_trim_start(duk_context* ctx) {
+	return string_trim(ctx, 1, 0);
+}
+
+static const SHIM shims[] = {
+	{ "Array", 0, "from", array_from, 3 },
+	{ "Array", 1, "find", array_find, 2 },
+	{ "Array", 1, "findIndex", array_find_index, 2 },
+	{ "Array", 1, "flat", array_flat, 1 },
+	{ "Array", 1, "includes", array_includes, 2 },
+	{ "Object", 0, "entries", object_entries, 1 },
+	{ "Object", 0, "values", object_values, 1 },
+	{ "String", 1, "padEnd", string_pad_end, 2 },
+	{ "String", 1, "padStart", string_pad_start, 2 },
+	{ "String", 1, "trimEnd", string_trim_end, 0 },
+	{ "String", 1, "trimLeft", string_trim_start, 0 },
+	{ "String", 1, "trimRight", string_trim_end, 0 },
+	{ "String", 1, "trimStart", string_trim_start, 0 },
+};
+
+void joshi_shims_install(duk_context* ctx) {
+	for (int i = 0; i < sizeof(shims)/sizeof(SHIM); i++) {
+		const SHIM* shim = shims + i;
+
+		duk_get_global_string(ctx, shim->object);
+
+		if (shim->prototype) {
+			duk_get_prop_string(ctx, -1, "prototype");
+			duk_remove(ctx, -2);
+		}
+
+		// [ ... target ]
+
+		duk_push_string(ctx, shim->name);
+		duk_push_c_function(ctx, shim->func, shim->nargs);
+		duk_def_prop(
+			ctx, -3,
+			DUK_DEFPROP_HAVE_VALUE |
+			DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_CONFIGURABLE |
+			DUK_DEFPROP_CLEAR_ENUMERABLE);
+
+		duk_pop(ctx);
+	}
+}
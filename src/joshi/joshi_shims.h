@@ -0,0 +1,8 @@
+#ifndef _JOSHI_SHIMS_H
+#define _JOSHI_SHIMS_H
+
+#include "joshi.h"
+
+void joshi_shims_install(duk_context* ctx);
+
+#endif
@@ -0,0 +1,195 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include "joshi_signal.h"
+
+/*
+ * Deferred signal delivery.
+ *
+ * The signal handler just counts the signal and writes a byte to a pipe (the
+ * self-pipe trick), so it never touches the Duktape heap. JavaScript handlers
+ * are run later, at safe points where an error thrown by them cannot hide the
+ * result of a call:
+ *
+ *   - When native functions are entered, before they have any side effect.
+ *   - When blocking calls are interrupted (see joshi_signal_interrupted).
+ *   - When event loops wake up and when explicitly dispatched.
+ *
+ * Signals which arrive several times before that are coalesced into a single
+ * call which receives the number of occurrences.
+ *
+ * The real handler is installed without SA_RESTART so that blocking calls
+ * return EINTR and let the JavaScript handler run. They are then restarted by
+ * the native functions, as SA_RESTART would do.
+ *
+ * Handlers only run in the thread which called joshi_signal_init (workers
+ * block all signals anyway).
+ */
+
+static volatile sig_atomic_t pending[NSIG];
+static volatile sig_atomic_t any_pending = 0;
+static int signal_pipe[2] = { -1, -1 };
+
+static __thread int signal_thread = 0;
+static __thread int dispatching = 0;
+
+static int create_pipe() {
+	return pipe2(signal_pipe, O_NONBLOCK | O_CLOEXEC);
+}
+
+static void atfork_child() {
+	int old_pipe[2] = { signal_pipe[0], signal_pipe[1] };
+
+	// Don't share wake ups with the parent, but keep the descriptor numbers in
+	// case somebody is watching them
+	if (create_pipe() == -1) {
+		return;
+	}
+
+	dup3(signal_pipe[0], old_pipe[0], O_CLOEXEC);
+	dup3(signal_pipe[1], old_pipe[1], O_CLOEXEC);
+
+	close(signal_pipe[0]);
+	close(signal_pipe[1]);
+
+	signal_pipe[0] = old_pipe[0];
+	signal_pipe[1] = old_pipe[1];
+}
+
+static void drain_pipe() {
+	char buf[64];
+
+	while (read(signal_pipe[0], buf, sizeof(buf)) > 0)
+		;
+}
+
+void joshi_signal_init() {
+	if (create_pipe() == -1) {
+		perror("Cannot create signal pipe");
+		return;
+	}
+
+	pthread_atfork(NULL, NULL, atfork_child);
+
+	signal_thread = 1;
+}
+
+void joshi_signal_handler(int sig) {
+	int err = errno;
+
+	pending[sig]++;
+	any_pending = 1;
+
+	if (signal_pipe[1] != -1) {
+		char c = 0;
+		write(signal_pipe[1], &c, 1);
+	}
+
+	errno = err;
+}
+
+int joshi_signal_pipe_fd() {
+	return signal_thread ? signal_pipe[0] : -1;
+}
+
+int joshi_signal_run_pending(duk_context* ctx) {
+	if (!any_pending || !signal_thread || dispatching) {
+		return 0;
+	}
+
+	int err = errno;
+	int calls = 0;
+
+	any_pending = 0;
+	drain_pipe();
+
+	dispatching = 1;
+
+	duk_push_heap_stash(ctx);
+	duk_get_prop_string(ctx, -1, "signal_handlers");
+	duk_remove(ctx, -2);
+
+	// ... signal_handlers
+
+	if (!duk_is_object(ctx, -1)) {
+		duk_pop(ctx);
+		dispatching = 0;
+		errno = err;
+		return 0;
+	}
+
+	for (int sig = 1; sig < NSIG; sig++) {
+		if (!pending[sig]) {
+			continue;
+		}
+
+		int count = __atomic_exchange_n(&pending[sig], 0, __ATOMIC_SEQ_CST);
+
+		if (!duk_get_prop_index(ctx, -1, sig) || !duk_is_function(ctx, -1)) {
+			duk_pop(ctx);
+			continue;
+		}
+
+		// ... signal_handlers func
+
+		duk_push_int(ctx, sig);
+		duk_push_int(ctx, count);
+
+		// ... signal_handlers func sig count
+
+		if (duk_pcall(ctx, 2) != DUK_EXEC_SUCCESS) {
+			// Leave the rest of signals for the next safe point
+			dispatching = 0;
+			any_pending = 1;
+
+			// ... signal_handlers error
+
+			duk_remove(ctx, -2);
+			duk_throw(ctx);
+		}
+
+		duk_pop(ctx);
+		calls++;
+
+		// ... signal_handlers
+	}
+
+	duk_pop(ctx);
+
+	dispatching = 0;
+	errno = err;
+
+	return calls;
+}
+
+/*
+ * To be called when a native function fails: returns true when it was
+ * interrupted by a signal and must be restarted, once pending handlers have
+ * run. Errors thrown by handlers are propagated.
+ */
+int joshi_signal_interrupted(duk_context* ctx) {
+	if (errno != EINTR) {
+		return 0;
+	}
+
+	joshi_signal_run_pending(ctx);
+
+	return 1;
+}
+
+duk_ret_t joshi_signal_dispatch(duk_context* ctx) {
+	duk_push_int(ctx, joshi_signal_run_pending(ctx));
+
+	return 1;
+}
+
+duk_ret_t joshi_signal_fd(duk_context* ctx) {
+	duk_push_int(ctx, joshi_signal_pipe_fd());
+
+	return 1;
+}
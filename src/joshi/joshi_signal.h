@@ -0,0 +1,15 @@
+#ifndef _JOSHI_SIGNAL_H
+#define _JOSHI_SIGNAL_H
+
+#include "joshi.h"
+
+void joshi_signal_init();
+void joshi_signal_handler(int sig);
+int joshi_signal_pipe_fd();
+int joshi_signal_interrupted(duk_context* ctx);
+int joshi_signal_run_pending(duk_context* ctx);
+
+duk_ret_t joshi_signal_dispatch(duk_context* ctx);
+duk_ret_t joshi_signal_fd(duk_context* ctx);
+
+#endif
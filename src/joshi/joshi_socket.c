@@ -0,0 +1,571 @@
+#define _GNU_SOURCE
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "joshi_socket.h"
+
+/*
+ * Socket primitives which need socket addresses or message headers (the
+ * plain ones like socket() or listen() are generated in joshi_core.c).
+ *
+ * Addresses are objects with a `path` for AF_UNIX or a numeric `host` and a
+ * `port` for AF_INET/AF_INET6 (the family is inferred from the host). A string
+ * is accepted as an AF_UNIX path too.
+ *
+ * Message data can be a buffer or an array of buffers (sent or received as a
+ * scatter/gather vector).
+ *
+ * File descriptors are passed over AF_UNIX sockets as SCM_RIGHTS ancillary
+ * data, along with at least one byte of normal data (so that they are not lost
+ * on stream sockets).
+ */
+
+/* Maximum number of fds passed in a single message (SCM_MAX_FD) */
+#define MAX_FDS 253
+
+static socklen_t get_sockaddr(
+	duk_context* ctx, duk_idx_t idx, struct sockaddr_storage* ss) {
+
+	idx = duk_normalize_index(ctx, idx);
+
+	memset(ss, 0, sizeof(*ss));
+
+	const char* path = NULL;
+
+	if (duk_is_string(ctx, idx)) {
+		path = joshi_require_utf(ctx, idx, NULL);
+	}
+	else {
+		duk_require_object(ctx, idx);
+
+		if (duk_get_prop_string(ctx, idx, "path")) {
+			path = joshi_require_utf(ctx, -1, NULL);
+		}
+
+		duk_pop(ctx);
+	}
+
+	if (path) {
+		struct sockaddr_un* sun = (struct sockaddr_un*)ss;
+		size_t len = strlen(path);
+
+		if (len >= sizeof(sun->sun_path)) {
+			duk_range_error(ctx, "Socket path too long: %s", path);
+		}
+
+		sun->sun_family = AF_UNIX;
+		memcpy(sun->sun_path, path, len + 1);
+
+		return offsetof(struct sockaddr_un, sun_path) + len + 1;
+	}
+
+	duk_get_prop_string(ctx, idx, "host");
+	const char* host = duk_require_string(ctx, -1);
+	duk_pop(ctx);
+
+	duk_get_prop_string(ctx, idx, "port");
+	int port = duk_require_int(ctx, -1);
+	duk_pop(ctx);
+
+	struct sockaddr_in* sin = (struct sockaddr_in*)ss;
+
+	if (inet_pton(AF_INET, host, &sin->sin_addr) == 1) {
+		sin->sin_family = AF_INET;
+		sin->sin_port = htons(port);
+
+		return sizeof(struct sockaddr_in);
+	}
+
+	struct sockaddr_in6* sin6 = (struct sockaddr_in6*)ss;
+
+	if (inet_pton(AF_INET6, host, &sin6->sin6_addr) == 1) {
+		sin6->sin6_family = AF_INET6;
+		sin6->sin6_port = htons(port);
+
+		return sizeof(struct sockaddr_in6);
+	}
+
+	duk_range_error(ctx, "Invalid IP address: %s", host);
+	return 0;
+}
+
+static void push_sockaddr(
+	duk_context* ctx, const struct sockaddr_storage* ss, socklen_t len) {
+
+	char host[INET6_ADDRSTRLEN];
+
+	if (len == 0) {
+		duk_push_undefined(ctx);
+		return;
+	}
+
+	switch (ss->ss_family) {
+		case AF_UNIX: {
+			const struct sockaddr_un* sun = (const struct sockaddr_un*)ss;
+			size_t path_len = len - offsetof(struct sockaddr_un, sun_path);
+
+			duk_push_object(ctx);
+			joshi_push_lutf(
+				ctx, sun->sun_path, strnlen(sun->sun_path, path_len));
+			duk_put_prop_string(ctx, -2, "path");
+			break;
+		}
+
+		case AF_INET: {
+			const struct sockaddr_in* sin = (const struct sockaddr_in*)ss;
+
+			inet_ntop(AF_INET, &sin->sin_addr, host, sizeof(host));
+
+			duk_push_object(ctx);
+			duk_push_string(ctx, host);
+			duk_put_prop_string(ctx, -2, "host");
+			duk_push_int(ctx, ntohs(sin->sin_port));
+			duk_put_prop_string(ctx, -2, "port");
+			break;
+		}
+
+		case AF_INET6: {
+			const struct sockaddr_in6* sin6 = (const struct sockaddr_in6*)ss;
+
+			inet_ntop(AF_INET6, &sin6->sin6_addr, host, sizeof(host));
+
+			duk_push_object(ctx);
+			duk_push_string(ctx, host);
+			duk_put_prop_string(ctx, -2, "host");
+			duk_push_int(ctx, ntohs(sin6->sin6_port));
+			duk_put_prop_string(ctx, -2, "port");
+			break;
+		}
+
+		default:
+			duk_push_undefined(ctx);
+			break;
+	}
+}
+
+/* Get message data (a buffer or an array of buffers) as an iovec array */
+static struct iovec* get_iovecs(
+	duk_context* ctx, duk_idx_t idx, size_t* iovlen) {
+
+	idx = duk_normalize_index(ctx, idx);
+
+	if (!duk_is_array(ctx, idx)) {
+		struct iovec* iov = (struct iovec*)
+			joshi_mblock_alloc(ctx, sizeof(struct iovec))->data;
+		duk_size_t size;
+
+		iov->iov_base = duk_require_buffer_data(ctx, idx, &size);
+		iov->iov_len = size;
+		*iovlen = 1;
+
+		return iov;
+	}
+
+	*iovlen = duk_get_length(ctx, idx);
+
+	struct iovec* iov = (struct iovec*)
+		joshi_mblock_alloc(ctx, *iovlen * sizeof(struct iovec))->data;
+
+	for (size_t i = 0; i < *iovlen; i++) {
+		duk_size_t size;
+
+		duk_get_prop_index(ctx, idx, i);
+		iov[i].iov_base = duk_require_buffer_data(ctx, -1, &size);
+		iov[i].iov_len = size;
+		duk_pop(ctx);
+	}
+
+	return iov;
+}
+
+static duk_ret_t throw_syserror(duk_context* ctx) {
+	int err = errno;
+
+	joshi_mblock_free_all(ctx);
+
+	errno = err;
+	return joshi_throw_syserror(ctx);
+}
+
+duk_ret_t joshi_socket_accept(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int flags = duk_get_int_default(ctx, 1, 0);
+
+	struct sockaddr_storage ss;
+	socklen_t len = sizeof(ss);
+
+	int fd = accept4(sockfd, (struct sockaddr*)&ss, &len, flags);
+
+	if (fd == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_object(ctx);
+
+	duk_push_int(ctx, fd);
+	duk_put_prop_string(ctx, -2, "fd");
+
+	push_sockaddr(ctx, &ss, len);
+	duk_put_prop_string(ctx, -2, "address");
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_bind(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+
+	struct sockaddr_storage ss;
+	socklen_t len = get_sockaddr(ctx, 1, &ss);
+
+	if (bind(sockfd, (struct sockaddr*)&ss, len) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_socket_connect(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+
+	struct sockaddr_storage ss;
+	socklen_t len = get_sockaddr(ctx, 1, &ss);
+
+	while (connect(sockfd, (struct sockaddr*)&ss, len) == -1) {
+		if (errno != EINTR) {
+			return joshi_throw_syserror(ctx);
+		}
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_socket_getsockname(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+
+	struct sockaddr_storage ss;
+	socklen_t len = sizeof(ss);
+
+	if (getsockname(sockfd, (struct sockaddr*)&ss, &len) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	push_sockaddr(ctx, &ss, len);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_getsockopt(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int level = duk_require_int(ctx, 1);
+	int optname = duk_require_int(ctx, 2);
+
+	int value = 0;
+	socklen_t len = sizeof(value);
+
+	if (getsockopt(sockfd, level, optname, &value, &len) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, value);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_recv_fds(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int max_fds = duk_require_int(ctx, 2);
+
+	if (max_fds < 1 || max_fds > MAX_FDS) {
+		return duk_range_error(ctx, "Invalid number of fds: %d", max_fds);
+	}
+
+	struct msghdr msg;
+	char control[CMSG_SPACE(MAX_FDS * sizeof(int))];
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = get_iovecs(ctx, 1, &msg.msg_iovlen);
+	msg.msg_control = control;
+	msg.msg_controllen = CMSG_SPACE(max_fds * sizeof(int));
+
+	ssize_t count;
+
+	while ((count = recvmsg(sockfd, &msg, MSG_CMSG_CLOEXEC)) == -1) {
+		if (errno != EINTR) {
+			return throw_syserror(ctx);
+		}
+	}
+
+	duk_push_object(ctx);
+
+	duk_push_number(ctx, count);
+	duk_put_prop_string(ctx, -2, "count");
+
+	duk_push_array(ctx);
+
+	duk_uarridx_t n = 0;
+
+	for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg;
+		cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+			continue;
+		}
+
+		size_t fds_count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+		int fds[fds_count];
+
+		memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+		for (size_t i = 0; i < fds_count; i++) {
+			duk_push_int(ctx, fds[i]);
+			duk_put_prop_index(ctx, -2, n++);
+		}
+	}
+
+	duk_put_prop_string(ctx, -2, "fds");
+
+	duk_push_boolean(ctx, msg.msg_flags & MSG_CTRUNC);
+	duk_put_prop_string(ctx, -2, "truncated");
+
+	joshi_mblock_free_all(ctx);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_recvmmsg(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int flags = duk_get_int_default(ctx, 2, 0);
+
+	duk_require_object(ctx, 1);
+	size_t vlen = duk_get_length(ctx, 1);
+
+	struct mmsghdr* msgs = (struct mmsghdr*)
+		joshi_mblock_alloc(ctx, vlen * sizeof(struct mmsghdr))->data;
+	struct sockaddr_storage* addrs = (struct sockaddr_storage*)
+		joshi_mblock_alloc(ctx, vlen * sizeof(struct sockaddr_storage))->data;
+
+	memset(msgs, 0, vlen * sizeof(struct mmsghdr));
+
+	for (size_t i = 0; i < vlen; i++) {
+		struct msghdr* hdr = &msgs[i].msg_hdr;
+
+		duk_get_prop_index(ctx, 1, i);
+
+		hdr->msg_iov = get_iovecs(ctx, -1, &hdr->msg_iovlen);
+		hdr->msg_name = addrs + i;
+		hdr->msg_namelen = sizeof(struct sockaddr_storage);
+
+		duk_pop(ctx);
+	}
+
+	int count = recvmmsg(sockfd, msgs, vlen, flags, NULL);
+
+	if (count == -1) {
+		return throw_syserror(ctx);
+	}
+
+	duk_push_array(ctx);
+
+	for (int i = 0; i < count; i++) {
+		duk_push_object(ctx);
+
+		duk_push_uint(ctx, msgs[i].msg_len);
+		duk_put_prop_string(ctx, -2, "count");
+
+		push_sockaddr(ctx, addrs + i, msgs[i].msg_hdr.msg_namelen);
+		duk_put_prop_string(ctx, -2, "address");
+
+		duk_push_int(ctx, msgs[i].msg_hdr.msg_flags);
+		duk_put_prop_string(ctx, -2, "flags");
+
+		duk_put_prop_index(ctx, -2, i);
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_recvmsg(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int flags = duk_get_int_default(ctx, 2, 0);
+
+	struct sockaddr_storage ss;
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = get_iovecs(ctx, 1, &msg.msg_iovlen);
+	msg.msg_name = &ss;
+	msg.msg_namelen = sizeof(ss);
+
+	ssize_t count = recvmsg(sockfd, &msg, flags);
+
+	if (count == -1) {
+		return throw_syserror(ctx);
+	}
+
+	duk_push_object(ctx);
+
+	duk_push_number(ctx, count);
+	duk_put_prop_string(ctx, -2, "count");
+
+	push_sockaddr(ctx, &ss, msg.msg_namelen);
+	duk_put_prop_string(ctx, -2, "address");
+
+	duk_push_int(ctx, msg.msg_flags);
+	duk_put_prop_string(ctx, -2, "flags");
+
+	joshi_mblock_free_all(ctx);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_send_fds(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+
+	if (!duk_is_array(ctx, 1)) {
+		return duk_type_error(ctx, "Expected an array of fds");
+	}
+
+	size_t fds_count = duk_get_length(ctx, 1);
+
+	if (fds_count < 1 || fds_count > MAX_FDS) {
+		return duk_range_error(ctx, "Invalid number of fds: %d", (int)fds_count);
+	}
+
+	int fds[fds_count];
+
+	for (size_t i = 0; i < fds_count; i++) {
+		duk_get_prop_index(ctx, 1, i);
+		fds[i] = duk_require_int(ctx, -1);
+		duk_pop(ctx);
+	}
+
+	struct msghdr msg;
+	char control[CMSG_SPACE(sizeof(fds))];
+
+	memset(&msg, 0, sizeof(msg));
+	memset(control, 0, sizeof(control));
+
+	msg.msg_iov = get_iovecs(ctx, 2, &msg.msg_iovlen);
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+
+	memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+	ssize_t count;
+
+	while ((count = sendmsg(sockfd, &msg, MSG_NOSIGNAL)) == -1) {
+		if (errno != EINTR) {
+			return throw_syserror(ctx);
+		}
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	duk_push_number(ctx, count);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_sendmmsg(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int flags = duk_get_int_default(ctx, 2, 0);
+
+	duk_require_object(ctx, 1);
+	size_t vlen = duk_get_length(ctx, 1);
+
+	struct mmsghdr* msgs = (struct mmsghdr*)
+		joshi_mblock_alloc(ctx, vlen * sizeof(struct mmsghdr))->data;
+	struct sockaddr_storage* addrs = (struct sockaddr_storage*)
+		joshi_mblock_alloc(ctx, vlen * sizeof(struct sockaddr_storage))->data;
+
+	memset(msgs, 0, vlen * sizeof(struct mmsghdr));
+
+	for (size_t i = 0; i < vlen; i++) {
+		struct msghdr* hdr = &msgs[i].msg_hdr;
+
+		duk_get_prop_index(ctx, 1, i);
+
+		duk_get_prop_string(ctx, -1, "data");
+		hdr->msg_iov = get_iovecs(ctx, -1, &hdr->msg_iovlen);
+		duk_pop(ctx);
+
+		if (duk_get_prop_string(ctx, -1, "address")) {
+			hdr->msg_name = addrs + i;
+			hdr->msg_namelen = get_sockaddr(ctx, -1, addrs + i);
+		}
+		duk_pop(ctx);
+
+		duk_pop(ctx);
+	}
+
+	int count = sendmmsg(sockfd, msgs, vlen, flags);
+
+	if (count == -1) {
+		return throw_syserror(ctx);
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	duk_push_int(ctx, count);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_sendmsg(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int flags = duk_get_int_default(ctx, 3, 0);
+
+	struct sockaddr_storage ss;
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = get_iovecs(ctx, 1, &msg.msg_iovlen);
+
+	if (!duk_is_null_or_undefined(ctx, 2)) {
+		msg.msg_name = &ss;
+		msg.msg_namelen = get_sockaddr(ctx, 2, &ss);
+	}
+
+	ssize_t count = sendmsg(sockfd, &msg, flags);
+
+	if (count == -1) {
+		return throw_syserror(ctx);
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	duk_push_number(ctx, count);
+
+	return 1;
+}
+
+duk_ret_t joshi_socket_setsockopt(duk_context* ctx) {
+	int sockfd = duk_require_int(ctx, 0);
+	int level = duk_require_int(ctx, 1);
+	int optname = duk_require_int(ctx, 2);
+	int value = duk_to_int(ctx, 3);
+
+	if (setsockopt(sockfd, level, optname, &value, sizeof(value)) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef _JOSHI_SOCKET_H
+#define _JOSHI_SOCKET_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_socket_accept(duk_context* ctx);
+duk_ret_t joshi_socket_bind(duk_context* ctx);
+duk_ret_t joshi_socket_connect(duk_context* ctx);
+duk_ret_t joshi_socket_getsockname(duk_context* ctx);
+duk_ret_t joshi_socket_getsockopt(duk_context* ctx);
+duk_ret_t joshi_socket_recv_fds(duk_context* ctx);
+duk_ret_t joshi_socket_recvmmsg(duk_context* ctx);
+duk_ret_t joshi_socket_recvmsg(duk_context* ctx);
+duk_ret_t joshi_socket_send_fds(duk_context* ctx);
+duk_ret_t joshi_socket_sendmmsg(duk_context* ctx);
+duk_ret_t joshi_socket_sendmsg(duk_context* ctx);
+duk_ret_t joshi_socket_setsockopt(duk_context* ctx);
+
+#endif
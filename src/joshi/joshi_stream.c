@@ -0,0 +1,148 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "joshi_signal.h"
+#include "joshi_stream.h"
+
+/*
+ * Buffered stream reader.
+ *
+ * The state of a stream lives in a Duktape dynamic buffer which starts with a
+ * STREAM header followed by the data read from the file descriptor (so that
+ * it is garbage collected along with the JavaScript stream object).
+ *
+ * Pending data lies between `start` and `end` and delimiters are searched with
+ * memchr/memmem. The buffer is compacted when more room is needed and grows
+ * when a single record doesn't fit in it.
+ */
+
+typedef struct {
+	size_t start;
+	size_t end;
+} STREAM;
+
+#define STREAM_DATA(s) (((char*)(s)) + sizeof(STREAM))
+
+static STREAM* require_stream(duk_context* ctx, duk_idx_t idx, size_t* capacity) {
+	duk_size_t size;
+	STREAM* s = duk_require_buffer(ctx, idx, &size);
+
+	if (size < sizeof(STREAM) + 1) {
+		duk_type_error(ctx, "Invalid stream buffer");
+	}
+
+	*capacity = size - sizeof(STREAM);
+
+	return s;
+}
+
+/*
+ * Push a record as a string when it is plain ASCII (the common case) or as a
+ * Uint8Array to be decoded by the caller otherwise
+ */
+static void push_record(duk_context* ctx, const char* data, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		if (data[i] & 0x80) {
+			void* buf = duk_push_fixed_buffer(ctx, size);
+			memcpy(buf, data, size);
+			duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_UINT8ARRAY);
+			duk_remove(ctx, -2);
+			return;
+		}
+	}
+
+	duk_push_lstring(ctx, data, size);
+}
+
+duk_ret_t joshi_stream_create(duk_context* ctx) {
+	duk_size_t size = duk_require_uint(ctx, 0);
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	STREAM* s = duk_push_dynamic_buffer(ctx, sizeof(STREAM) + size);
+
+	s->start = 0;
+	s->end = 0;
+
+	return 1;
+}
+
+duk_ret_t joshi_stream_read_until(duk_context* ctx) {
+	int fd = duk_require_int(ctx, 0);
+	size_t capacity;
+	STREAM* s = require_stream(ctx, 1, &capacity);
+	duk_size_t delim_size;
+	const char* delim = duk_require_lstring(ctx, 2, &delim_size);
+
+	if (delim_size == 0) {
+		duk_type_error(ctx, "Empty delimiter");
+	}
+
+	// Offset (relative to start) from which to search for the delimiter
+	size_t scan_from = 0;
+
+	while (1) {
+		char* data = STREAM_DATA(s) + s->start;
+		size_t avail = s->end - s->start;
+		const char* found = NULL;
+
+		if (avail - scan_from >= delim_size) {
+			found = delim_size == 1
+				? memchr(data + scan_from, delim[0], avail - scan_from)
+				: memmem(
+					data + scan_from, avail - scan_from, delim, delim_size);
+		}
+
+		if (found) {
+			push_record(ctx, data, found - data);
+			s->start += (found - data) + delim_size;
+			joshi_mblock_free_all(ctx);
+			return 1;
+		}
+
+		// Don't scan again what has already been scanned
+		scan_from = avail >= delim_size ? avail - delim_size + 1 : 0;
+
+		// Make room for more data
+		if (s->start > 0) {
+			memmove(STREAM_DATA(s), data, avail);
+			s->start = 0;
+			s->end = avail;
+		}
+
+		if (s->end == capacity) {
+			capacity *= 2;
+			s = duk_resize_buffer(ctx, 1, sizeof(STREAM) + capacity);
+		}
+
+		ssize_t count = read(fd, STREAM_DATA(s) + s->end, capacity - s->end);
+
+		// Handlers may use the stream too, so start over
+		if (count == -1 && joshi_signal_interrupted(ctx)) {
+			s = require_stream(ctx, 1, &capacity);
+			scan_from = 0;
+			continue;
+		}
+
+		if (count == -1) {
+			joshi_mblock_free_all(ctx);
+			return joshi_throw_syserror(ctx);
+		}
+
+		// EOF before the delimiter: drop the incomplete record
+		if (count == 0) {
+			s->start = 0;
+			s->end = 0;
+			duk_push_null(ctx);
+			joshi_mblock_free_all(ctx);
+			return 1;
+		}
+
+		s->end += count;
+	}
+}
@@ -0,0 +1,9 @@
+#ifndef _JOSHI_STREAM_H
+#define _JOSHI_STREAM_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_stream_create(duk_context* ctx);
+duk_ret_t joshi_stream_read_until(duk_context* ctx);
+
+#endif
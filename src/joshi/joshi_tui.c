@@ -1,5 +1,6 @@
 #include <locale.h>
 #include <ncurses.h>
+#include "joshi_signal.h"
 #include <errno.h>
 
 #include "joshi.h"
@@ -7,7 +8,7 @@
 #define duk_get_attr_t(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_attr_t(ctx,value) duk_push_int((ctx),(value))
 static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx);
-#define duk_push_char_pt(ctx,value) duk_push_string((ctx),(value))
+#define duk_push_char_pt(ctx,value) joshi_push_utf((ctx),(value))
 #define duk_get_int(ctx,idx) duk_require_int((ctx),(idx))
 #define duk_push_int(ctx,value) duk_push_int((ctx),(value))
 #define duk_get_short(ctx,idx) duk_require_int((ctx),(idx))
@@ -20,13 +21,7 @@ static char* duk_get_char_pt(duk_context* ctx, duk_idx_t idx) {
 		return NULL;
 	}
 
-	const char* cesu = duk_require_string(ctx, idx);
-	JOSHI_MBLOCK* blk = joshi_mblock_alloc(ctx, cnv_cesu_to_utf_length(cesu) + 1);
-	char* utf = (char*)blk->data;
-
-	cnv_cesu_to_utf(cesu, utf);
-
-	return utf;
+	return (char*)joshi_require_utf(ctx, idx, NULL);
 }
 
 static WINDOW* duk_get_WINDOW_pt(duk_context* ctx, duk_idx_t idx) {
@@ -38,6 +33,8 @@ static WINDOW* duk_get_WINDOW_pt(duk_context* ctx, duk_idx_t idx) {
 static duk_ret_t _js_curs_set(duk_context* ctx) {
 	int visibility;
 
+	joshi_signal_run_pending(ctx);
+
 	visibility = duk_get_int(ctx, 0);
 
 	errno = 0;
@@ -61,6 +58,8 @@ static duk_ret_t _js_curs_set(duk_context* ctx) {
 static duk_ret_t _js_delwin(duk_context* ctx) {
 	WINDOW* win;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -83,6 +82,8 @@ static duk_ret_t _js_delwin(duk_context* ctx) {
 
 static duk_ret_t _js_endwin(duk_context* ctx) {
 
+	joshi_signal_run_pending(ctx);
+
 
 	errno = 0;
 	int ret_value;
@@ -107,6 +108,8 @@ static duk_ret_t _js_getmaxyx(duk_context* ctx) {
 	int y;
 	int x;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -138,6 +141,8 @@ static duk_ret_t _js_getyx(duk_context* ctx) {
 	int y;
 	int x;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -170,6 +175,8 @@ static duk_ret_t _js_init_color(duk_context* ctx) {
 	int g;
 	int b;
 
+	joshi_signal_run_pending(ctx);
+
 	color = duk_get_int(ctx, 0);
 	r = duk_get_int(ctx, 1);
 	g = duk_get_int(ctx, 2);
@@ -198,6 +205,8 @@ static duk_ret_t _js_init_pair(duk_context* ctx) {
 	int fg;
 	int bg;
 
+	joshi_signal_run_pending(ctx);
+
 	pair = duk_get_int(ctx, 0);
 	fg = duk_get_int(ctx, 1);
 	bg = duk_get_int(ctx, 2);
@@ -225,6 +234,8 @@ static duk_ret_t _js_mvwin(duk_context* ctx) {
 	int y;
 	int x;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	y = duk_get_int(ctx, 1);
 	x = duk_get_int(ctx, 2);
@@ -253,6 +264,8 @@ static duk_ret_t _js_newwin(duk_context* ctx) {
 	int y;
 	int x;
 
+	joshi_signal_run_pending(ctx);
+
 	nlines = duk_get_int(ctx, 0);
 	ncols = duk_get_int(ctx, 1);
 	y = duk_get_int(ctx, 2);
@@ -280,6 +293,8 @@ static duk_ret_t _js_waddstr(duk_context* ctx) {
 	WINDOW* win;
 	char* str;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	str = duk_get_char_pt(ctx, 1);
 
@@ -306,6 +321,8 @@ static duk_ret_t _js_wattr_get(duk_context* ctx) {
 	attr_t attrs;
 	short pair;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -337,6 +354,8 @@ static duk_ret_t _js_wattr_set(duk_context* ctx) {
 	attr_t attrs;
 	short pair;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	attrs = duk_get_attr_t(ctx, 1);
 	pair = duk_get_short(ctx, 2);
@@ -362,6 +381,8 @@ static duk_ret_t _js_wattr_set(duk_context* ctx) {
 static duk_ret_t _js_wclear(duk_context* ctx) {
 	WINDOW* win;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -385,6 +406,8 @@ static duk_ret_t _js_wclear(duk_context* ctx) {
 static duk_ret_t _js_werase(duk_context* ctx) {
 	WINDOW* win;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -409,6 +432,8 @@ static duk_ret_t _js_winsstr(duk_context* ctx) {
 	WINDOW* win;
 	char* str;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	str = duk_get_char_pt(ctx, 1);
 
@@ -435,6 +460,8 @@ static duk_ret_t _js_wmove(duk_context* ctx) {
 	int y;
 	int x;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	y = duk_get_int(ctx, 1);
 	x = duk_get_int(ctx, 2);
@@ -460,6 +487,8 @@ static duk_ret_t _js_wmove(duk_context* ctx) {
 static duk_ret_t _js_wrefresh(duk_context* ctx) {
 	WINDOW* win;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 
 	errno = 0;
@@ -484,6 +513,8 @@ static duk_ret_t _js_wtimeout(duk_context* ctx) {
 	WINDOW* win;
 	int delay;
 
+	joshi_signal_run_pending(ctx);
+
 	win = duk_get_WINDOW_pt(ctx, 0);
 	delay = duk_get_int(ctx, 1);
 
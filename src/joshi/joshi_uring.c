@@ -0,0 +1,767 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "joshi_uring.h"
+
+/*
+ * Batched I/O through io_uring.
+ *
+ * Rings are set up with raw syscalls (so that liburing is not needed) and
+ * operations are queued as SQEs whose user_data is the index of an OP slot.
+ * Slots own the native memory an operation needs while in flight (the UTF-8
+ * path for openat and the statx buffer) and are released when the completion
+ * is reaped. The handle object keeps references to the buffers of read and
+ * write operations for the same period.
+ *
+ * Rings can't be closed while they have operations whose completions haven't
+ * been reaped. If a handle is garbage collected with operations in flight, its
+ * finalizer waits for them to complete before releasing anything (Duktape
+ * keeps the buffers referenced by the handle alive until it has run).
+ *
+ * When the kernel lacks io_uring (or it is disabled) operations are queued in
+ * the slots and run synchronously on submit, linking included, so that scripts
+ * behave the same with both backends.
+ */
+
+#define PROP_BUFS DUK_HIDDEN_SYMBOL("joshi_uring_bufs")
+#define PROP_PTR DUK_HIDDEN_SYMBOL("joshi_uring_ptr")
+
+/* Operation codes (must match the ones in io module) */
+#define OP_READ 0
+#define OP_WRITE 1
+#define OP_OPENAT 2
+#define OP_STATX 3
+#define OP_CLOSE 4
+
+/* user_data of cancel requests (which have no slot) */
+#define CANCEL_ID ((__u64)-1)
+
+typedef struct {
+	int code;
+	int fd;
+	void* buf;
+	size_t len;
+	off_t offset;
+	int flags;
+	int link;
+	char* path;
+	struct statx* stx;
+	int busy;
+	int next_free;
+} OP;
+
+typedef struct {
+	unsigned id;
+	int res;
+} COMPLETION;
+
+typedef struct {
+	int fd;
+
+	// Kernel rings (fd != -1)
+	void* sq_ring;
+	size_t sq_ring_size;
+	unsigned* sq_head;
+	unsigned* sq_tail;
+	unsigned* sq_array;
+	unsigned sq_mask;
+	unsigned sq_entries;
+	unsigned sq_local_tail;
+	unsigned to_submit;
+	struct io_uring_sqe* sqes;
+	size_t sqes_size;
+	void* cq_ring;
+	size_t cq_ring_size;
+	unsigned* cq_head;
+	unsigned* cq_tail;
+	unsigned cq_mask;
+	struct io_uring_cqe* cqes;
+
+	// Synchronous fallback (fd == -1)
+	unsigned* queue;
+	unsigned queued;
+	COMPLETION* done;
+	unsigned done_count;
+
+	// Operation slots
+	OP* ops;
+	unsigned ops_count;
+	int free_op;
+	unsigned active;
+} URING;
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params* p) {
+	return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(
+	int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+
+	return syscall(
+		__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static void* map_ring(int fd, size_t size, off_t offset) {
+	return mmap(
+		NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+		offset);
+}
+
+static void unmap_rings(URING* r) {
+	if (r->sq_ring && r->sq_ring != MAP_FAILED) {
+		munmap(r->sq_ring, r->sq_ring_size);
+	}
+
+	if (r->cq_ring && r->cq_ring != MAP_FAILED) {
+		munmap(r->cq_ring, r->cq_ring_size);
+	}
+
+	if (r->sqes && r->sqes != MAP_FAILED) {
+		munmap(r->sqes, r->sqes_size);
+	}
+}
+
+/* Set up kernel rings (returns -1 and sets errno if io_uring is unusable) */
+static int open_rings(URING* r, unsigned entries) {
+	struct io_uring_params p;
+
+	memset(&p, 0, sizeof(p));
+
+	r->fd = sys_io_uring_setup(entries, &p);
+
+	if (r->fd == -1) {
+		return -1;
+	}
+
+	r->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	r->cq_ring_size =
+		p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+
+	r->sq_ring = map_ring(r->fd, r->sq_ring_size, IORING_OFF_SQ_RING);
+	r->cq_ring = map_ring(r->fd, r->cq_ring_size, IORING_OFF_CQ_RING);
+	r->sqes = map_ring(r->fd, r->sqes_size, IORING_OFF_SQES);
+
+	if (r->sq_ring == MAP_FAILED || r->cq_ring == MAP_FAILED ||
+		r->sqes == MAP_FAILED) {
+
+		int err = errno;
+
+		unmap_rings(r);
+		close(r->fd);
+		r->fd = -1;
+
+		errno = err;
+		return -1;
+	}
+
+	r->sq_head = r->sq_ring + p.sq_off.head;
+	r->sq_tail = r->sq_ring + p.sq_off.tail;
+	r->sq_array = r->sq_ring + p.sq_off.array;
+	r->sq_mask = *(unsigned*)(r->sq_ring + p.sq_off.ring_mask);
+	r->sq_entries = p.sq_entries;
+	r->sq_local_tail = *r->sq_tail;
+
+	r->cq_head = r->cq_ring + p.cq_off.head;
+	r->cq_tail = r->cq_ring + p.cq_off.tail;
+	r->cq_mask = *(unsigned*)(r->cq_ring + p.cq_off.ring_mask);
+	r->cqes = r->cq_ring + p.cq_off.cqes;
+
+	// No more operations than completions can be in flight
+	r->ops_count = p.cq_entries;
+
+	return 0;
+}
+
+static void free_uring(URING* r) {
+	if (r->fd != -1) {
+		unmap_rings(r);
+		close(r->fd);
+	}
+
+	if (r->ops) {
+		for (unsigned i = 0; i < r->ops_count; i++) {
+			free(r->ops[i].path);
+			free(r->ops[i].stx);
+		}
+	}
+
+	free(r->ops);
+	free(r->queue);
+	free(r->done);
+	free(r);
+}
+
+static URING* require_uring(duk_context* ctx, duk_idx_t idx) {
+	duk_get_prop_string(ctx, idx, PROP_PTR);
+	URING* r = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!r) {
+		duk_type_error(ctx, "Invalid or closed uring");
+	}
+
+	return r;
+}
+
+static int alloc_op(URING* r) {
+	int id = r->free_op;
+
+	if (id == -1) {
+		errno = EBUSY;
+		return -1;
+	}
+
+	r->free_op = r->ops[id].next_free;
+	r->ops[id].busy = 1;
+	r->active++;
+
+	return id;
+}
+
+static void release_op(URING* r, unsigned id) {
+	OP* op = r->ops + id;
+
+	free(op->path);
+	free(op->stx);
+
+	op->path = NULL;
+	op->stx = NULL;
+	op->busy = 0;
+	op->next_free = r->free_op;
+
+	r->free_op = id;
+	r->active--;
+}
+
+/* Enter the kernel to submit pending SQEs and optionally wait completions */
+static int enter(URING* r, unsigned min_complete, unsigned flags) {
+	while (1) {
+		int ret = sys_io_uring_enter(r->fd, r->to_submit, min_complete, flags);
+
+		if (ret == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return -1;
+		}
+
+		r->to_submit -= ret;
+
+		return ret;
+	}
+}
+
+/* Get an empty SQE at the tail of the ring (returns NULL on error) */
+static struct io_uring_sqe* next_sqe(URING* r) {
+	unsigned head = __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+
+	// Make room by submitting what is queued when the ring is full
+	if (r->sq_local_tail - head >= r->sq_entries) {
+		if (enter(r, 0, 0) == -1) {
+			return NULL;
+		}
+	}
+
+	struct io_uring_sqe* sqe = r->sqes + (r->sq_local_tail & r->sq_mask);
+
+	memset(sqe, 0, sizeof(*sqe));
+
+	return sqe;
+}
+
+/* Make the SQE returned by next_sqe() visible to the kernel */
+static void push_sqe(URING* r) {
+	unsigned idx = r->sq_local_tail & r->sq_mask;
+
+	r->sq_array[idx] = idx;
+	r->sq_local_tail++;
+	r->to_submit++;
+
+	__atomic_store_n(r->sq_tail, r->sq_local_tail, __ATOMIC_RELEASE);
+}
+
+static int queue_sqe(URING* r, unsigned id) {
+	OP* op = r->ops + id;
+	struct io_uring_sqe* sqe = next_sqe(r);
+
+	if (!sqe) {
+		return -1;
+	}
+
+	sqe->fd = op->fd;
+	sqe->user_data = id;
+
+	if (op->link) {
+		sqe->flags |= IOSQE_IO_LINK;
+	}
+
+	switch (op->code) {
+		case OP_READ:
+		case OP_WRITE:
+			sqe->opcode = op->code == OP_READ ? IORING_OP_READ : IORING_OP_WRITE;
+			sqe->addr = (unsigned long)op->buf;
+			sqe->len = op->len;
+			sqe->off = op->offset;
+			break;
+
+		case OP_OPENAT:
+			sqe->opcode = IORING_OP_OPENAT;
+			sqe->addr = (unsigned long)op->path;
+			sqe->len = op->offset;
+			sqe->open_flags = op->flags;
+			break;
+
+		case OP_STATX:
+			sqe->opcode = IORING_OP_STATX;
+			sqe->addr = (unsigned long)op->path;
+			sqe->len = STATX_BASIC_STATS;
+			sqe->off = (unsigned long)op->stx;
+			sqe->statx_flags = op->flags;
+			break;
+
+		case OP_CLOSE:
+			sqe->opcode = IORING_OP_CLOSE;
+			break;
+	}
+
+	push_sqe(r);
+
+	return 0;
+}
+
+/* Run an operation synchronously (fallback backend) */
+static int run_op(OP* op) {
+	int ret;
+
+	switch (op->code) {
+		case OP_READ:
+			ret = op->offset == -1
+				? read(op->fd, op->buf, op->len)
+				: pread(op->fd, op->buf, op->len, op->offset);
+			break;
+
+		case OP_WRITE:
+			ret = op->offset == -1
+				? write(op->fd, op->buf, op->len)
+				: pwrite(op->fd, op->buf, op->len, op->offset);
+			break;
+
+		case OP_OPENAT:
+			ret = openat(op->fd, op->path, op->flags, (mode_t)op->offset);
+			break;
+
+		case OP_STATX:
+			ret = statx(op->fd, op->path, op->flags, STATX_BASIC_STATS, op->stx);
+			break;
+
+		case OP_CLOSE:
+			ret = close(op->fd);
+			break;
+
+		default:
+			errno = EINVAL;
+			ret = -1;
+			break;
+	}
+
+	return ret == -1 ? -errno : ret;
+}
+
+static void push_stat(duk_context* ctx, struct statx* stx) {
+	duk_push_object(ctx);
+
+	duk_push_uint(ctx, stx->stx_gid);
+	duk_put_prop_string(ctx, -2, "gid");
+
+	duk_push_uint(ctx, stx->stx_mode);
+	duk_put_prop_string(ctx, -2, "mode");
+
+	duk_push_number(ctx, stx->stx_size);
+	duk_put_prop_string(ctx, -2, "size");
+
+	duk_push_object(ctx);
+
+	duk_push_number(ctx, stx->stx_atime.tv_sec);
+	duk_put_prop_string(ctx, -2, "access");
+
+	duk_push_number(ctx, stx->stx_ctime.tv_sec);
+	duk_put_prop_string(ctx, -2, "change");
+
+	duk_push_number(ctx, stx->stx_ctime.tv_sec);
+	duk_put_prop_string(ctx, -2, "creation");
+
+	duk_push_number(ctx, stx->stx_mtime.tv_sec);
+	duk_put_prop_string(ctx, -2, "modification");
+
+	duk_put_prop_string(ctx, -2, "time");
+
+	duk_push_uint(ctx, stx->stx_uid);
+	duk_put_prop_string(ctx, -2, "uid");
+}
+
+/*
+ * Cancel all operations and wait for them to complete (operations which can't
+ * be cancelled, like reads of regular files, just run to completion).
+ */
+static void drain(URING* r) {
+	int err = 0;
+
+	for (unsigned id = 0; id < r->ops_count && !err; id++) {
+		if (!r->ops[id].busy) {
+			continue;
+		}
+
+		struct io_uring_sqe* sqe = next_sqe(r);
+
+		if (!sqe) {
+			err = 1;
+			break;
+		}
+
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->fd = -1;
+		sqe->addr = id;
+		sqe->user_data = CANCEL_ID;
+
+		push_sqe(r);
+	}
+
+	while (!err && r->to_submit > 0) {
+		if (enter(r, 0, 0) == -1) {
+			err = 1;
+		}
+	}
+
+	// Every busy slot gets exactly one completion (the cancelled ones too)
+	while (!err && r->active > 0) {
+		unsigned head = *r->cq_head;
+		unsigned tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+
+		for (; head != tail; head++) {
+			__u64 id = r->cqes[head & r->cq_mask].user_data;
+
+			if (id != CANCEL_ID) {
+				release_op(r, id);
+			}
+		}
+
+		__atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+
+		if (r->active > 0 &&
+			sys_io_uring_enter(r->fd, 0, 1, IORING_ENTER_GETEVENTS) == -1 &&
+			errno != EINTR) {
+
+			err = 1;
+		}
+	}
+
+	// Never release memory that the kernel may still write to
+	if (err) {
+		perror("Cannot wait for io_uring operations");
+		abort();
+	}
+}
+
+static duk_ret_t uring_finalizer(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	URING* r = duk_get_pointer(ctx, -1);
+
+	if (r) {
+		if (r->fd != -1) {
+			drain(r);
+		}
+
+		free_uring(r);
+	}
+
+	return 0;
+}
+
+/* Push a completion object to the array at the top of the stack */
+static void push_completion(
+	duk_context* ctx, URING* r, unsigned id, int res, duk_uarridx_t i) {
+
+	// Drop the reference to the buffer of the operation (handle is at 0)
+	duk_get_prop_string(ctx, 0, PROP_BUFS);
+	duk_del_prop_index(ctx, -1, id);
+	duk_pop(ctx);
+
+	duk_push_object(ctx);
+
+	duk_push_uint(ctx, id);
+	duk_put_prop_string(ctx, -2, "id");
+
+	if (res < 0) {
+		duk_push_int(ctx, -1);
+		duk_put_prop_string(ctx, -2, "result");
+
+		duk_push_int(ctx, -res);
+		duk_put_prop_string(ctx, -2, "errno");
+	}
+	else {
+		duk_push_number(ctx, res);
+		duk_put_prop_string(ctx, -2, "result");
+
+		if (r->ops[id].code == OP_STATX) {
+			push_stat(ctx, r->ops[id].stx);
+			duk_put_prop_string(ctx, -2, "stat");
+		}
+	}
+
+	duk_put_prop_index(ctx, -2, i);
+
+	release_op(r, id);
+}
+
+duk_ret_t joshi_uring_close(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	URING* r = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!r) {
+		return 0;
+	}
+
+	if (r->active > 0) {
+		errno = EBUSY;
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_pointer(ctx, NULL);
+	duk_put_prop_string(ctx, 0, PROP_PTR);
+
+	free_uring(r);
+
+	return 0;
+}
+
+duk_ret_t joshi_uring_create(duk_context* ctx) {
+	unsigned entries = duk_require_uint(ctx, 0);
+	int force_fallback = duk_to_boolean(ctx, 1);
+
+	URING* r = calloc(1, sizeof(URING));
+
+	if (!r) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	r->fd = -1;
+
+	if (force_fallback || open_rings(r, entries) == -1) {
+		if (!force_fallback && errno != ENOSYS && errno != EPERM) {
+			int err = errno;
+			free(r);
+			errno = err;
+			return joshi_throw_syserror(ctx);
+		}
+
+		r->ops_count = 2 * entries;
+		r->queue = malloc(r->ops_count * sizeof(unsigned));
+		r->done = malloc(r->ops_count * sizeof(COMPLETION));
+	}
+
+	r->ops = calloc(r->ops_count, sizeof(OP));
+
+	if (!r->ops || (r->fd == -1 && (!r->queue || !r->done))) {
+		free_uring(r);
+		errno = ENOMEM;
+		return joshi_throw_syserror(ctx);
+	}
+
+	for (unsigned i = 0; i < r->ops_count; i++) {
+		r->ops[i].next_free = i + 1 < r->ops_count ? i + 1 : -1;
+	}
+
+	r->free_op = 0;
+
+	duk_push_object(ctx);
+
+	duk_push_pointer(ctx, r);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_push_boolean(ctx, r->fd != -1);
+	duk_put_prop_string(ctx, -2, "kernel");
+
+	duk_push_object(ctx);
+	duk_put_prop_string(ctx, -2, PROP_BUFS);
+
+	duk_push_c_function(ctx, uring_finalizer, 1);
+	duk_set_finalizer(ctx, -2);
+
+	return 1;
+}
+
+/*
+ * Arguments are (uring, code, fd, data, len, offset, flags, link) where data is
+ * a buffer for read/write and a path for openat/statx. For openat the mode is
+ * passed as offset.
+ */
+duk_ret_t joshi_uring_prep(duk_context* ctx) {
+	URING* r = require_uring(ctx, 0);
+	int code = duk_require_int(ctx, 1);
+
+	int id = alloc_op(r);
+
+	if (id == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	OP* op = r->ops + id;
+
+	op->code = code;
+	op->fd = duk_require_int(ctx, 2);
+	op->buf = NULL;
+	op->len = 0;
+	op->offset = duk_get_number_default(ctx, 5, -1);
+	op->flags = duk_get_int_default(ctx, 6, 0);
+	op->link = duk_to_boolean(ctx, 7);
+
+	switch (code) {
+		case OP_READ:
+		case OP_WRITE: {
+			duk_size_t size;
+			op->buf = duk_require_buffer_data(ctx, 3, &size);
+			op->len = duk_get_number_default(ctx, 4, size);
+
+			if (op->len > size) {
+				op->len = size;
+			}
+			break;
+		}
+
+		case OP_OPENAT:
+		case OP_STATX: {
+			duk_size_t cesu_size;
+			const char* cesu = duk_require_lstring(ctx, 3, &cesu_size);
+
+			// UTF-8 is never longer than CESU-8
+			op->path = malloc(cesu_size + 1);
+
+			if (code == OP_STATX) {
+				op->stx = malloc(sizeof(struct statx));
+			}
+
+			if (!op->path || (code == OP_STATX && !op->stx)) {
+				release_op(r, id);
+				errno = ENOMEM;
+				return joshi_throw_syserror(ctx);
+			}
+
+			cnv_cesu_to_utf_n(cesu, cesu_size, op->path);
+			break;
+		}
+
+		case OP_CLOSE:
+			break;
+
+		default:
+			release_op(r, id);
+			return duk_range_error(ctx, "Invalid uring operation: %d", code);
+	}
+
+	if (r->fd == -1) {
+		r->queue[r->queued++] = id;
+	}
+	else if (queue_sqe(r, id) == -1) {
+		int err = errno;
+		release_op(r, id);
+		errno = err;
+		return joshi_throw_syserror(ctx);
+	}
+
+	// Keep the buffer alive until the completion is reaped
+	if (op->buf) {
+		duk_get_prop_string(ctx, 0, PROP_BUFS);
+		duk_dup(ctx, 3);
+		duk_put_prop_index(ctx, -2, id);
+		duk_pop(ctx);
+	}
+
+	duk_push_int(ctx, id);
+
+	return 1;
+}
+
+duk_ret_t joshi_uring_submit(duk_context* ctx) {
+	URING* r = require_uring(ctx, 0);
+
+	if (r->fd != -1) {
+		int submitted = enter(r, 0, 0);
+
+		if (submitted == -1) {
+			return joshi_throw_syserror(ctx);
+		}
+
+		duk_push_int(ctx, submitted);
+		return 1;
+	}
+
+	int cancel = 0;
+
+	for (unsigned i = 0; i < r->queued; i++) {
+		OP* op = r->ops + r->queue[i];
+
+		int res = cancel ? -ECANCELED : run_op(op);
+
+		// A failure cancels the rest of the chain (like the kernel does)
+		cancel = op->link && res < 0;
+
+		r->done[r->done_count].id = r->queue[i];
+		r->done[r->done_count].res = res;
+		r->done_count++;
+	}
+
+	duk_push_int(ctx, r->queued);
+
+	r->queued = 0;
+
+	return 1;
+}
+
+duk_ret_t joshi_uring_wait(duk_context* ctx) {
+	URING* r = require_uring(ctx, 0);
+	unsigned min_complete = duk_get_uint_default(ctx, 1, 0);
+
+	duk_push_array(ctx);
+	duk_uarridx_t count = 0;
+
+	if (r->fd == -1) {
+		for (unsigned i = 0; i < r->done_count; i++) {
+			push_completion(ctx, r, r->done[i].id, r->done[i].res, count++);
+		}
+
+		r->done_count = 0;
+
+		return 1;
+	}
+
+	if (r->to_submit > 0 || min_complete > 0) {
+		if (enter(r, min_complete, IORING_ENTER_GETEVENTS) == -1) {
+			return joshi_throw_syserror(ctx);
+		}
+	}
+
+	unsigned head = *r->cq_head;
+	unsigned tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+
+	for (; head != tail; head++) {
+		struct io_uring_cqe* cqe = r->cqes + (head & r->cq_mask);
+
+		push_completion(ctx, r, cqe->user_data, cqe->res, count++);
+	}
+
+	__atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+
+	return 1;
+}
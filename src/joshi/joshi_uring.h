@@ -0,0 +1,12 @@
+#ifndef _JOSHI_URING_H
+#define _JOSHI_URING_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_uring_close(duk_context* ctx);
+duk_ret_t joshi_uring_create(duk_context* ctx);
+duk_ret_t joshi_uring_prep(duk_context* ctx);
+duk_ret_t joshi_uring_submit(duk_context* ctx);
+duk_ret_t joshi_uring_wait(duk_context* ctx);
+
+#endif
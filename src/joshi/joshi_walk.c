@@ -0,0 +1,1237 @@
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "joshi_walk.h"
+
+/*
+ * Recursive file system walker.
+ *
+ * Directories are read with getdents64 and opened with openat relative to their
+ * parent's fd (or, when too many are waiting in the queue, relative to the root
+ * fd) so that paths are never resolved from scratch. Entries are only stat'ed
+ * when their size and time are requested or the file system does not report
+ * their type.
+ *
+ * Pending directories are kept in a stack shared by a pool of threads (or
+ * walked by the calling thread if there's no pool) which deliver the entries to
+ * JavaScript in batches.
+ */
+
+#define PROP_PTR DUK_HIDDEN_SYMBOL("joshi_walk_ptr")
+
+// Buffer size for getdents64()
+#define DIRENTS_SIZE (32 * 1024)
+
+// Maximum number of queued directories holding an open fd
+#define MAX_QUEUED_FDS 256
+
+// Maximum number of ancestors kept open while removing a directory
+#define MAX_REMOVE_FDS 16
+
+// Maximum number of batches waiting to be read by JavaScript (per thread)
+#define MAX_PENDING_BATCHES 4
+
+typedef struct {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+} LINUX_DIRENT64;
+
+typedef struct DIR_ITEM {
+	struct DIR_ITEM* next;
+	int fd;
+	int depth;
+	char path[];
+} DIR_ITEM;
+
+typedef struct {
+	size_t path;
+	int type;
+	int depth;
+	int err;
+	off_t size;
+	time_t mtime;
+} ENTRY;
+
+typedef struct BATCH {
+	struct BATCH* next;
+	size_t count;
+	size_t strings_used;
+	size_t strings_size;
+	char* strings;
+	ENTRY entries[];
+} BATCH;
+
+typedef struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t dirs_cond;
+	pthread_cond_t results_cond;
+	pthread_cond_t space_cond;
+
+	pthread_t* threads;
+	int thread_count;
+	int running;
+	int stop;
+
+	DIR_ITEM* dirs;
+	int active;
+	int queued_fds;
+
+	BATCH* results;
+	BATCH* results_tail;
+	int pending;
+
+	BATCH* current;
+
+	int root_fd;
+	size_t root_len;
+	dev_t dev;
+
+	int max_depth;
+	int same_fs;
+	int stat;
+	size_t batch_size;
+	char** prune;
+	int prune_count;
+} WALKER;
+
+static BATCH* batch_create(WALKER* w) {
+	BATCH* b = malloc(sizeof(BATCH) + w->batch_size * sizeof(ENTRY));
+
+	if (!b) {
+		return NULL;
+	}
+
+	b->next = NULL;
+	b->count = 0;
+	b->strings_used = 0;
+	b->strings_size = 64 * w->batch_size;
+	b->strings = malloc(b->strings_size);
+
+	if (!b->strings) {
+		free(b);
+		return NULL;
+	}
+
+	return b;
+}
+
+static void batch_free(BATCH* b) {
+	free(b->strings);
+	free(b);
+}
+
+// Queue a batch for JavaScript (must be called with the mutex held)
+static void push_batch_locked(WALKER* w, BATCH* b) {
+	while (w->thread_count && !w->stop &&
+		w->pending >= MAX_PENDING_BATCHES * w->thread_count) {
+
+		pthread_cond_wait(&w->space_cond, &w->mutex);
+	}
+
+	if (w->stop) {
+		batch_free(b);
+		return;
+	}
+
+	if (w->results_tail) {
+		w->results_tail->next = b;
+	}
+	else {
+		w->results = b;
+	}
+
+	w->results_tail = b;
+	w->pending++;
+
+	pthread_cond_signal(&w->results_cond);
+}
+
+static void push_batch(WALKER* w, BATCH* b) {
+	pthread_mutex_lock(&w->mutex);
+	push_batch_locked(w, b);
+	pthread_mutex_unlock(&w->mutex);
+}
+
+/*
+ * Add an entry to a batch, pushing it when full. Returns the batch to use next
+ * time (which is NULL if memory is exhausted).
+ */
+static BATCH* add_entry(
+	WALKER* w, BATCH* b, const char* dir, const char* name, int type, int depth,
+	int err, const struct stat* st) {
+
+	if (!b) {
+		b = batch_create(w);
+
+		if (!b) {
+			return NULL;
+		}
+	}
+
+	size_t dir_len = strlen(dir);
+	size_t name_len = strlen(name);
+	int slash = name_len && dir_len && dir[dir_len - 1] != '/';
+	size_t path_size = dir_len + slash + name_len + 1;
+
+	if (b->strings_used + path_size > b->strings_size) {
+		size_t size = 2 * b->strings_size + path_size;
+		char* strings = realloc(b->strings, size);
+
+		if (!strings) {
+			return b;
+		}
+
+		b->strings = strings;
+		b->strings_size = size;
+	}
+
+	char* path = b->strings + b->strings_used;
+
+	memcpy(path, dir, dir_len);
+	path[dir_len] = '/';
+	memcpy(path + dir_len + slash, name, name_len + 1);
+
+	ENTRY* e = b->entries + b->count++;
+
+	e->path = b->strings_used;
+	e->type = type;
+	e->depth = depth;
+	e->err = err;
+	e->size = st ? st->st_size : 0;
+	e->mtime = st ? st->st_mtim.tv_sec : 0;
+
+	b->strings_used += path_size;
+
+	if (b->count == w->batch_size) {
+		push_batch(w, b);
+		return NULL;
+	}
+
+	return b;
+}
+
+static int is_pruned(WALKER* w, const char* name) {
+	for (int i = 0; i < w->prune_count; i++) {
+		if (fnmatch(w->prune[i], name, 0) == 0) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static DIR_ITEM* dir_item_create(const char* dir, const char* name, int depth) {
+	size_t dir_len = strlen(dir);
+	size_t name_len = name ? strlen(name) : 0;
+	int slash = name && dir_len && dir[dir_len - 1] != '/';
+
+	DIR_ITEM* item = malloc(sizeof(DIR_ITEM) + dir_len + slash + name_len + 1);
+
+	if (!item) {
+		return NULL;
+	}
+
+	item->next = NULL;
+	item->fd = -1;
+	item->depth = depth;
+
+	memcpy(item->path, dir, dir_len);
+	item->path[dir_len] = '/';
+
+	if (name) {
+		memcpy(item->path + dir_len + slash, name, name_len + 1);
+	}
+	else {
+		item->path[dir_len] = 0;
+	}
+
+	return item;
+}
+
+static void dir_item_free(DIR_ITEM* item) {
+	if (item->fd != -1) {
+		close(item->fd);
+	}
+
+	free(item);
+}
+
+/*
+ * Read a directory, adding its entries to the batch and its subdirectories to
+ * the stack. Returns the batch to use next time.
+ */
+static BATCH* walk_dir(WALKER* w, DIR_ITEM* item, BATCH* b) {
+	int fd = item->fd;
+
+	if (fd == -1) {
+		const char* relpath = item->path + w->root_len;
+
+		while (*relpath == '/') {
+			relpath++;
+		}
+
+		if (!*relpath) {
+			relpath = ".";
+		}
+
+		fd = openat(
+			w->root_fd, relpath, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+		if (fd == -1) {
+			b = add_entry(w, b, item->path, "", DT_DIR, item->depth, errno, NULL);
+			free(item);
+			return b;
+		}
+	}
+	else {
+		pthread_mutex_lock(&w->mutex);
+		w->queued_fds--;
+		pthread_mutex_unlock(&w->mutex);
+	}
+
+	item->fd = -1;
+
+	if (w->same_fs && item->depth > 0) {
+		struct stat st;
+
+		if (fstat(fd, &st) == 0 && st.st_dev != w->dev) {
+			close(fd);
+			free(item);
+			return b;
+		}
+	}
+
+	char dirents[DIRENTS_SIZE];
+	DIR_ITEM* subdirs = NULL;
+	int depth = item->depth + 1;
+	int descend = w->max_depth < 0 || depth < w->max_depth;
+
+	while (!w->stop) {
+		long count = syscall(SYS_getdents64, fd, dirents, sizeof(dirents));
+
+		if (count == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (count <= 0) {
+			if (count == -1) {
+				b = add_entry(w, b, item->path, "", DT_DIR, item->depth, errno, NULL);
+			}
+
+			break;
+		}
+
+		for (long pos = 0; pos < count; ) {
+			LINUX_DIRENT64* d = (LINUX_DIRENT64*)(dirents + pos);
+			const char* name = d->d_name;
+
+			pos += d->d_reclen;
+
+			if (name[0] == '.' &&
+				(name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+				continue;
+			}
+
+			if (w->prune_count && is_pruned(w, name)) {
+				continue;
+			}
+
+			int type = d->d_type;
+			struct stat st;
+			int has_st = 0;
+
+			if (w->stat || type == DT_UNKNOWN) {
+				if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) == -1) {
+					b = add_entry(
+						w, b, item->path, name, type, depth, errno, NULL);
+					continue;
+				}
+
+				type = IFTODT(st.st_mode);
+				has_st = w->stat;
+			}
+
+			b = add_entry(
+				w, b, item->path, name, type, depth, 0, has_st ? &st : NULL);
+
+			if (type != DT_DIR || !descend) {
+				continue;
+			}
+
+			DIR_ITEM* subdir = dir_item_create(item->path, name, depth);
+
+			if (!subdir) {
+				continue;
+			}
+
+			pthread_mutex_lock(&w->mutex);
+			int may_open = w->queued_fds < MAX_QUEUED_FDS;
+			w->queued_fds += may_open;
+			pthread_mutex_unlock(&w->mutex);
+
+			if (may_open) {
+				subdir->fd = openat(
+					fd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+				if (subdir->fd == -1) {
+					pthread_mutex_lock(&w->mutex);
+					w->queued_fds--;
+					pthread_mutex_unlock(&w->mutex);
+				}
+			}
+
+			subdir->next = subdirs;
+			subdirs = subdir;
+		}
+	}
+
+	close(fd);
+	free(item);
+
+	if (subdirs) {
+		DIR_ITEM* last = subdirs;
+
+		while (last->next) {
+			last = last->next;
+		}
+
+		pthread_mutex_lock(&w->mutex);
+		last->next = w->dirs;
+		w->dirs = subdirs;
+		pthread_cond_broadcast(&w->dirs_cond);
+		pthread_mutex_unlock(&w->mutex);
+	}
+
+	return b;
+}
+
+static void* worker_main(void* arg) {
+	WALKER* w = arg;
+	BATCH* b = NULL;
+
+	pthread_mutex_lock(&w->mutex);
+
+	while (!w->stop) {
+		DIR_ITEM* item = w->dirs;
+
+		if (!item) {
+			// Deliver what we have before waiting for more work
+			if (b) {
+				push_batch_locked(w, b);
+				b = NULL;
+				continue;
+			}
+
+			if (w->active == 0) {
+				break;
+			}
+
+			pthread_cond_wait(&w->dirs_cond, &w->mutex);
+			continue;
+		}
+
+		w->dirs = item->next;
+		w->active++;
+		pthread_mutex_unlock(&w->mutex);
+
+		b = walk_dir(w, item, b);
+
+		pthread_mutex_lock(&w->mutex);
+		w->active--;
+
+		if (!w->dirs && w->active == 0) {
+			pthread_cond_broadcast(&w->dirs_cond);
+		}
+	}
+
+	w->running--;
+	pthread_cond_broadcast(&w->dirs_cond);
+	pthread_cond_signal(&w->results_cond);
+	pthread_mutex_unlock(&w->mutex);
+
+	if (b) {
+		batch_free(b);
+	}
+
+	return NULL;
+}
+
+static void release(WALKER* w) {
+	pthread_mutex_lock(&w->mutex);
+	w->stop = 1;
+	pthread_cond_broadcast(&w->dirs_cond);
+	pthread_cond_broadcast(&w->space_cond);
+	pthread_mutex_unlock(&w->mutex);
+
+	for (int i = 0; i < w->thread_count; i++) {
+		pthread_join(w->threads[i], NULL);
+	}
+
+	while (w->dirs) {
+		DIR_ITEM* item = w->dirs;
+		w->dirs = item->next;
+		dir_item_free(item);
+	}
+
+	while (w->results) {
+		BATCH* b = w->results;
+		w->results = b->next;
+		batch_free(b);
+	}
+
+	if (w->current) {
+		batch_free(w->current);
+	}
+
+	for (int i = 0; i < w->prune_count; i++) {
+		free(w->prune[i]);
+	}
+
+	close(w->root_fd);
+
+	pthread_mutex_destroy(&w->mutex);
+	pthread_cond_destroy(&w->dirs_cond);
+	pthread_cond_destroy(&w->results_cond);
+	pthread_cond_destroy(&w->space_cond);
+
+	free(w->prune);
+	free(w->threads);
+	free(w);
+}
+
+static WALKER* require_walker(duk_context* ctx, duk_idx_t idx) {
+	duk_get_prop_string(ctx, idx, PROP_PTR);
+	WALKER* w = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!w) {
+		duk_type_error(ctx, "Invalid or closed walker");
+	}
+
+	return w;
+}
+
+static duk_ret_t walk_finalizer(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	WALKER* w = duk_get_pointer(ctx, -1);
+
+	if (w) {
+		release(w);
+	}
+
+	return 0;
+}
+
+/*
+ * Get the next batch of results: from the pool if there is one, or walking
+ * directories in this thread until a batch fills up otherwise
+ */
+static BATCH* next_batch(WALKER* w) {
+	pthread_mutex_lock(&w->mutex);
+
+	if (w->thread_count) {
+		while (!w->results && w->running) {
+			pthread_cond_wait(&w->results_cond, &w->mutex);
+		}
+	}
+	else {
+		while (!w->results && w->dirs) {
+			DIR_ITEM* item = w->dirs;
+			w->dirs = item->next;
+			pthread_mutex_unlock(&w->mutex);
+
+			w->current = walk_dir(w, item, w->current);
+
+			pthread_mutex_lock(&w->mutex);
+		}
+
+		if (!w->results && w->current) {
+			push_batch_locked(w, w->current);
+			w->current = NULL;
+		}
+	}
+
+	BATCH* b = w->results;
+
+	if (b) {
+		w->results = b->next;
+
+		if (!w->results) {
+			w->results_tail = NULL;
+		}
+
+		w->pending--;
+		pthread_cond_signal(&w->space_cond);
+	}
+
+	pthread_mutex_unlock(&w->mutex);
+
+	return b;
+}
+
+duk_ret_t joshi_walk_close(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	WALKER* w = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!w) {
+		return 0;
+	}
+
+	duk_push_pointer(ctx, NULL);
+	duk_put_prop_string(ctx, 0, PROP_PTR);
+
+	release(w);
+
+	return 0;
+}
+
+duk_ret_t joshi_walk_next(duk_context* ctx) {
+	WALKER* w = require_walker(ctx, 0);
+	BATCH* b = next_batch(w);
+
+	if (!b) {
+		duk_push_null(ctx);
+		return 1;
+	}
+
+	duk_push_array(ctx);
+
+	for (size_t i = 0; i < b->count; i++) {
+		ENTRY* e = b->entries + i;
+
+		duk_push_object(ctx);
+
+		joshi_push_utf(ctx, b->strings + e->path);
+		duk_put_prop_string(ctx, -2, "path");
+
+		duk_push_int(ctx, e->type);
+		duk_put_prop_string(ctx, -2, "type");
+
+		duk_push_int(ctx, e->depth);
+		duk_put_prop_string(ctx, -2, "depth");
+
+		if (e->err) {
+			duk_push_int(ctx, e->err);
+			duk_put_prop_string(ctx, -2, "errno");
+		}
+		else if (w->stat) {
+			duk_push_number(ctx, e->size);
+			duk_put_prop_string(ctx, -2, "size");
+
+			duk_push_number(ctx, e->mtime);
+			duk_put_prop_string(ctx, -2, "mtime");
+		}
+
+		duk_put_prop_index(ctx, -2, i);
+	}
+
+	batch_free(b);
+
+	return 1;
+}
+
+duk_ret_t joshi_walk_open(duk_context* ctx) {
+	const char* root = joshi_require_utf(ctx, 0, NULL);
+	int thread_count = duk_require_int(ctx, 1);
+	int max_depth = duk_require_int(ctx, 2);
+	int same_fs = duk_to_boolean(ctx, 4);
+	int stat = duk_to_boolean(ctx, 5);
+	int batch_size = duk_require_int(ctx, 6);
+
+	if (!duk_is_array(ctx, 3)) {
+		return duk_type_error(ctx, "Expected an array of prune patterns");
+	}
+
+	if (thread_count < 0 || batch_size < 1) {
+		return duk_range_error(ctx, "Invalid walk options");
+	}
+
+	int root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+	if (root_fd == -1) {
+		joshi_mblock_free_all(ctx);
+		return joshi_throw_syserror(ctx);
+	}
+
+	struct stat st;
+
+	if (fstat(root_fd, &st) == -1) {
+		close(root_fd);
+		joshi_mblock_free_all(ctx);
+		return joshi_throw_syserror(ctx);
+	}
+
+	WALKER* w = calloc(1, sizeof(WALKER));
+	DIR_ITEM* item = dir_item_create(root, NULL, 0);
+
+	if (!w || !item) {
+		free(w);
+		free(item);
+		close(root_fd);
+		joshi_mblock_free_all(ctx);
+		errno = ENOMEM;
+		return joshi_throw_syserror(ctx);
+	}
+
+	// Strip trailing slashes (but keep "/") to build entry paths
+	size_t root_len = strlen(item->path);
+
+	while (root_len > 1 && item->path[root_len - 1] == '/') {
+		item->path[--root_len] = 0;
+	}
+
+	item->fd = fcntl(root_fd, F_DUPFD_CLOEXEC, 0);
+
+	pthread_mutex_init(&w->mutex, NULL);
+	pthread_cond_init(&w->dirs_cond, NULL);
+	pthread_cond_init(&w->results_cond, NULL);
+	pthread_cond_init(&w->space_cond, NULL);
+
+	w->dirs = item;
+	w->queued_fds = item->fd != -1;
+	w->root_fd = root_fd;
+	w->root_len = root_len;
+	w->dev = st.st_dev;
+	w->max_depth = max_depth;
+	w->same_fs = same_fs;
+	w->stat = stat;
+	w->batch_size = batch_size;
+
+	w->prune_count = duk_get_length(ctx, 3);
+	w->prune = calloc(w->prune_count ? w->prune_count : 1, sizeof(char*));
+
+	if (!w->prune) {
+		w->prune_count = 0;
+	}
+
+	for (int i = 0; i < w->prune_count; i++) {
+		duk_get_prop_index(ctx, 3, i);
+		w->prune[i] = strdup(joshi_require_utf(ctx, -1, NULL));
+		duk_pop(ctx);
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	duk_push_object(ctx);
+
+	duk_push_pointer(ctx, w);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_push_c_function(ctx, walk_finalizer, 1);
+	duk_set_finalizer(ctx, -2);
+
+	if (thread_count) {
+		w->threads = calloc(thread_count, sizeof(pthread_t));
+
+		if (!w->threads) {
+			errno = ENOMEM;
+			return joshi_throw_syserror(ctx);
+		}
+
+		pthread_mutex_lock(&w->mutex);
+
+		for (int i = 0; i < thread_count; i++) {
+			int err = pthread_create(w->threads + i, NULL, worker_main, w);
+
+			if (err) {
+				pthread_mutex_unlock(&w->mutex);
+				errno = err;
+				return joshi_throw_syserror(ctx);
+			}
+
+			w->thread_count++;
+			w->running++;
+		}
+
+		pthread_mutex_unlock(&w->mutex);
+	}
+
+	return 1;
+}
+
+/*
+ * Recursive removal.
+ *
+ * Entries are removed with unlinkat relative to their parent's fd and
+ * directories are opened with O_NOFOLLOW so that symbolic links are removed but
+ * never followed. Directories are read again after each pass that removed
+ * something, because file systems may skip entries when a directory changes
+ * while it is being read.
+ *
+ * Trees are descended iteratively (so that depth is not limited by the stack)
+ * and only the innermost MAX_REMOVE_FDS ancestors are kept open. The rest are
+ * reopened through `..` on the way up, checking that they are still the same
+ * directory (otherwise the tree was moved and the removal is aborted).
+ *
+ * To remove in parallel, the root's subdirectories are handed to a pool of
+ * threads.
+ */
+
+typedef struct {
+	pthread_mutex_t mutex;
+	int root_fd;
+	char** names;
+	size_t count;
+	size_t next;
+	int err;
+} REMOVER;
+
+typedef struct {
+	char* name; // Name in the parent directory (NULL for the top one)
+	dev_t dev;
+	ino_t ino;
+	int fd; // -1 when closed to bound the number of open fds
+	off_t offset; // Where to go on reading after removing a subdirectory
+	int removed; // Entries removed in the current pass
+	int err;
+} REMOVE_LEVEL;
+
+static int remove_contents(int fd);
+
+/*
+ * Open a subdirectory to remove its contents. Returns its fd, -1 if it is gone
+ * (because it was removed, or replaced by something else which is removed
+ * instead) or -2 on error (with errno set).
+ */
+static int open_subdir(int dir_fd, const char* name) {
+	int fd = openat(dir_fd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+	if (fd != -1) {
+		return fd;
+	}
+
+	// Not a directory after all (it was replaced or d_type was wrong)
+	if (errno == ENOTDIR || errno == ELOOP) {
+		return unlinkat(dir_fd, name, 0) == 0 || errno == ENOENT ? -1 : -2;
+	}
+
+	return errno == ENOENT ? -1 : -2;
+}
+
+// Remove a directory entry and return 0 or an errno
+static int remove_entry(int dir_fd, const char* name, int type) {
+	if (type != DT_DIR) {
+		if (unlinkat(dir_fd, name, 0) == 0) {
+			return 0;
+		}
+
+		if (errno != EISDIR) {
+			return errno == ENOENT ? 0 : errno;
+		}
+	}
+
+	int fd = open_subdir(dir_fd, name);
+
+	if (fd < 0) {
+		return fd == -1 ? 0 : errno;
+	}
+
+	int err = remove_contents(fd);
+
+	if (unlinkat(dir_fd, name, AT_REMOVEDIR) == -1 && !err && errno != ENOENT) {
+		err = errno;
+	}
+
+	return err;
+}
+
+static int push_level(
+	REMOVE_LEVEL** levels, size_t* capacity, size_t depth, int fd,
+	const char* name) {
+
+	struct stat st;
+
+	if (depth == *capacity) {
+		size_t new_capacity = *capacity ? 2 * *capacity : 64;
+		REMOVE_LEVEL* new_levels =
+			realloc(*levels, new_capacity * sizeof(REMOVE_LEVEL));
+
+		if (!new_levels) {
+			return ENOMEM;
+		}
+
+		*levels = new_levels;
+		*capacity = new_capacity;
+	}
+
+	if (fstat(fd, &st) == -1) {
+		return errno;
+	}
+
+	REMOVE_LEVEL* level = *levels + depth;
+
+	level->name = NULL;
+
+	if (name && !(level->name = strdup(name))) {
+		return ENOMEM;
+	}
+
+	level->dev = st.st_dev;
+	level->ino = st.st_ino;
+	level->fd = fd;
+	level->offset = 0;
+	level->removed = 0;
+	level->err = 0;
+
+	return 0;
+}
+
+// Reopen a level which was closed through the fd of its child
+static int reopen_level(REMOVE_LEVEL* level, int child_fd) {
+	struct stat st;
+
+	level->fd = openat(
+		child_fd, "..", O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+	if (level->fd == -1) {
+		return errno;
+	}
+
+	if (fstat(level->fd, &st) == -1) {
+		return errno;
+	}
+
+	if (st.st_dev != level->dev || st.st_ino != level->ino) {
+		return ESTALE;
+	}
+
+	return 0;
+}
+
+/*
+ * Remove the entries of a level from its offset on, until a subdirectory is
+ * found. Returns the subdirectory's fd (with its name in `dirents`, and the
+ * level's offset pointing past it) or -1 at the end of the directory.
+ */
+static int remove_files(REMOVE_LEVEL* level, char* dirents, char** sub_name) {
+	if (lseek(level->fd, level->offset, SEEK_SET) == -1) {
+		level->err = level->err ? level->err : errno;
+		level->removed = 0;
+		return -1;
+	}
+
+	while (1) {
+		long count = syscall(SYS_getdents64, level->fd, dirents, DIRENTS_SIZE);
+
+		if (count == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (count <= 0) {
+			if (count == -1) {
+				level->err = level->err ? level->err : errno;
+			}
+
+			return -1;
+		}
+
+		for (long pos = 0; pos < count; ) {
+			LINUX_DIRENT64* d = (LINUX_DIRENT64*)(dirents + pos);
+			char* name = d->d_name;
+
+			pos += d->d_reclen;
+
+			if (name[0] == '.' &&
+				(name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+				continue;
+			}
+
+			if (d->d_type != DT_DIR) {
+				if (unlinkat(level->fd, name, 0) == 0 || errno == ENOENT) {
+					level->removed++;
+					continue;
+				}
+
+				if (errno != EISDIR) {
+					level->err = level->err ? level->err : errno;
+					continue;
+				}
+			}
+
+			int fd = open_subdir(level->fd, name);
+
+			if (fd == -2) {
+				level->err = level->err ? level->err : errno;
+				continue;
+			}
+
+			if (fd == -1) {
+				level->removed++;
+				continue;
+			}
+
+			level->offset = d->d_off;
+			*sub_name = name;
+
+			return fd;
+		}
+	}
+}
+
+/*
+ * Remove the contents of a directory and close its fd. Returns 0 or the errno
+ * of the first failure (but keeps removing as much as possible).
+ */
+static int remove_contents(int fd) {
+	char* dirents = malloc(DIRENTS_SIZE);
+	REMOVE_LEVEL* levels = NULL;
+	size_t capacity = 0;
+	size_t depth = 0;
+	int err = dirents ? push_level(&levels, &capacity, 0, fd, NULL) : ENOMEM;
+
+	if (err) {
+		free(dirents);
+		free(levels);
+		close(fd);
+		return err;
+	}
+
+	while (1) {
+		REMOVE_LEVEL* level = levels + depth;
+		char* sub_name;
+		int sub_fd = remove_files(level, dirents, &sub_name);
+
+		// Go down
+		if (sub_fd != -1) {
+			err = push_level(&levels, &capacity, depth + 1, sub_fd, sub_name);
+
+			if (err) {
+				close(sub_fd);
+				break;
+			}
+
+			depth++;
+
+			if (depth > MAX_REMOVE_FDS) {
+				REMOVE_LEVEL* ancestor = levels + depth - MAX_REMOVE_FDS;
+
+				close(ancestor->fd);
+				ancestor->fd = -1;
+			}
+
+			continue;
+		}
+
+		// Read again after a pass which removed something
+		if (level->removed) {
+			level->removed = 0;
+			level->offset = 0;
+			continue;
+		}
+
+		if (depth == 0) {
+			err = level->err;
+			break;
+		}
+
+		// Go up removing the directory
+		REMOVE_LEVEL* parent = level - 1;
+
+		if (parent->fd == -1 && (err = reopen_level(parent, level->fd))) {
+			break;
+		}
+
+		close(level->fd);
+		depth--;
+
+		if (unlinkat(parent->fd, level->name, AT_REMOVEDIR) == -1 &&
+			!level->err && errno != ENOENT) {
+
+			level->err = errno;
+		}
+
+		free(level->name);
+
+		if (level->err) {
+			parent->err = parent->err ? parent->err : level->err;
+		}
+		else {
+			parent->removed++;
+		}
+	}
+
+	for (size_t i = 0; i <= depth; i++) {
+		if (levels[i].fd != -1) {
+			close(levels[i].fd);
+		}
+
+		free(levels[i].name);
+	}
+
+	free(levels);
+	free(dirents);
+
+	return err;
+}
+
+static void* remover_main(void* arg) {
+	REMOVER* r = arg;
+
+	while (1) {
+		pthread_mutex_lock(&r->mutex);
+		size_t i = r->next++;
+		pthread_mutex_unlock(&r->mutex);
+
+		if (i >= r->count) {
+			break;
+		}
+
+		int err = remove_entry(r->root_fd, r->names[i], DT_DIR);
+
+		if (err) {
+			pthread_mutex_lock(&r->mutex);
+			r->err = r->err ? r->err : err;
+			pthread_mutex_unlock(&r->mutex);
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Remove the root's files and hand its subdirectories to a pool of threads.
+ * Anything left (like entries created meanwhile) is removed afterwards by the
+ * caller.
+ */
+static int remove_subtrees_parallel(int root_fd, int thread_count) {
+	REMOVER r = { .root_fd = root_fd };
+	size_t capacity = 0;
+	char dirents[DIRENTS_SIZE];
+	int reading = 1;
+
+	while (reading) {
+		long count = syscall(SYS_getdents64, root_fd, dirents, sizeof(dirents));
+
+		if (count == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (count <= 0) {
+			if (count == -1) {
+				r.err = r.err ? r.err : errno;
+			}
+
+			break;
+		}
+
+		for (long pos = 0; pos < count; ) {
+			LINUX_DIRENT64* d = (LINUX_DIRENT64*)(dirents + pos);
+			const char* name = d->d_name;
+
+			pos += d->d_reclen;
+
+			if (name[0] == '.' &&
+				(name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+				continue;
+			}
+
+			if (d->d_type != DT_DIR) {
+				int err = remove_entry(root_fd, name, d->d_type);
+
+				if (err && !r.err) {
+					r.err = err;
+				}
+
+				continue;
+			}
+
+			if (r.count == capacity) {
+				capacity = capacity ? 2 * capacity : 64;
+				char** names = realloc(r.names, capacity * sizeof(char*));
+
+				if (!names) {
+					r.err = ENOMEM;
+					reading = 0;
+					break;
+				}
+
+				r.names = names;
+			}
+
+			if (!(r.names[r.count] = strdup(name))) {
+				r.err = ENOMEM;
+				reading = 0;
+				break;
+			}
+
+			r.count++;
+		}
+	}
+
+	if (thread_count > r.count) {
+		thread_count = r.count;
+	}
+
+	if (thread_count == 0) {
+		free(r.names);
+		return r.err;
+	}
+
+	pthread_t threads[thread_count];
+	int started = 0;
+
+	pthread_mutex_init(&r.mutex, NULL);
+
+	while (started < thread_count &&
+		pthread_create(threads + started, NULL, remover_main, &r) == 0) {
+
+		started++;
+	}
+
+	// Help the pool (or do everything if no thread could be started)
+	remover_main(&r);
+
+	for (int i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	pthread_mutex_destroy(&r.mutex);
+
+	for (size_t i = 0; i < r.count; i++) {
+		free(r.names[i]);
+	}
+
+	free(r.names);
+
+	return r.err;
+}
+
+duk_ret_t joshi_walk_remove_contents(duk_context* ctx) {
+	const char* path = joshi_require_utf(ctx, 0, NULL);
+	int thread_count = duk_require_int(ctx, 1);
+
+	int fd = open(path, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+	if (fd == -1) {
+		joshi_mblock_free_all(ctx);
+		return joshi_throw_syserror(ctx);
+	}
+
+	joshi_mblock_free_all(ctx);
+
+	int err = thread_count > 0 ? remove_subtrees_parallel(fd, thread_count) : 0;
+	int rest_err = remove_contents(fd);
+
+	errno = err ? err : rest_err;
+
+	if (errno) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
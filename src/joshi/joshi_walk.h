@@ -0,0 +1,11 @@
+#ifndef _JOSHI_WALK_H
+#define _JOSHI_WALK_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_walk_close(duk_context* ctx);
+duk_ret_t joshi_walk_next(duk_context* ctx);
+duk_ret_t joshi_walk_open(duk_context* ctx);
+duk_ret_t joshi_walk_remove_contents(duk_context* ctx);
+
+#endif
@@ -0,0 +1,628 @@
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "joshi_worker.h"
+
+/*
+ * Worker threads.
+ *
+ * Each worker runs a script in its own Duktape heap and native thread and
+ * communicates with its parent through two message queues (one per
+ * direction).
+ *
+ * Queues are protected by a mutex and have an eventfd in semaphore mode which
+ * counts pending messages so that receivers can block on it (or poll() it).
+ * Closing a queue posts an extra token which is never consumed, so that
+ * receivers wake up and notice that the queue is closed once it is empty.
+ *
+ * Messages own a malloc'd copy of the data, which is handed over to the
+ * receiver as an external buffer. Buffers allocated with worker_alloc() (or
+ * received from a queue) are transferred without copying: the sender's view
+ * is detached (set to zero length) instead.
+ */
+
+#define MSG_STRING 0
+#define MSG_BUFFER 1
+
+#define PROP_PTR DUK_HIDDEN_SYMBOL("joshi_worker_ptr")
+#define PROP_BUF DUK_HIDDEN_SYMBOL("joshi_worker_buf")
+
+typedef struct MESSAGE {
+	struct MESSAGE* next;
+	int type;
+	size_t size;
+	void* data;
+} MESSAGE;
+
+typedef struct {
+	pthread_mutex_t mutex;
+	MESSAGE* head;
+	MESSAGE* tail;
+	int closed;
+	int fd;
+} QUEUE;
+
+typedef struct {
+	pthread_t thread;
+	int joined;
+	int retval;
+
+	QUEUE inbox;
+	QUEUE outbox;
+
+	int argc;
+	char** argv;
+} WORKER;
+
+static pthread_mutex_t workers_mutex = PTHREAD_MUTEX_INITIALIZER;
+static WORKER** workers = NULL;
+static size_t workers_count = 0;
+
+static __thread WORKER* self = NULL;
+
+/*
+ * Queues
+ */
+static int queue_init(QUEUE* q) {
+	memset(q, 0, sizeof(QUEUE));
+
+	q->fd = eventfd(0, EFD_SEMAPHORE | EFD_CLOEXEC);
+
+	if (q->fd == -1) {
+		return -1;
+	}
+
+	pthread_mutex_init(&q->mutex, NULL);
+
+	return 0;
+}
+
+static void queue_destroy(QUEUE* q) {
+	MESSAGE* msg = q->head;
+
+	while (msg) {
+		MESSAGE* next = msg->next;
+
+		free(msg->data);
+		free(msg);
+
+		msg = next;
+	}
+
+	close(q->fd);
+	pthread_mutex_destroy(&q->mutex);
+}
+
+static void queue_post(QUEUE* q) {
+	uint64_t one = 1;
+
+	while (write(q->fd, &one, sizeof(one)) == -1 && errno == EINTR) {
+	}
+}
+
+static int queue_push(QUEUE* q, MESSAGE* msg) {
+	pthread_mutex_lock(&q->mutex);
+
+	if (q->closed) {
+		pthread_mutex_unlock(&q->mutex);
+		errno = EPIPE;
+		return -1;
+	}
+
+	msg->next = NULL;
+
+	if (q->tail) {
+		q->tail->next = msg;
+	}
+	else {
+		q->head = msg;
+	}
+
+	q->tail = msg;
+
+	pthread_mutex_unlock(&q->mutex);
+
+	queue_post(q);
+
+	return 0;
+}
+
+static void queue_close(QUEUE* q) {
+	pthread_mutex_lock(&q->mutex);
+
+	if (!q->closed) {
+		q->closed = 1;
+		queue_post(q);
+	}
+
+	pthread_mutex_unlock(&q->mutex);
+}
+
+/* Returns 1 on success (msg is NULL if queue is closed), 0 on timeout */
+static int queue_pop(QUEUE* q, int timeout, MESSAGE** msg) {
+	if (timeout >= 0) {
+		struct pollfd pfd = { q->fd, POLLIN, 0 };
+		int ret;
+
+		do {
+			ret = poll(&pfd, 1, timeout);
+		} while (ret == -1 && errno == EINTR);
+
+		if (ret == -1) {
+			return -1;
+		}
+
+		if (ret == 0) {
+			return 0;
+		}
+	}
+
+	uint64_t count;
+
+	while (read(q->fd, &count, sizeof(count)) == -1) {
+		if (errno != EINTR) {
+			return -1;
+		}
+	}
+
+	pthread_mutex_lock(&q->mutex);
+
+	*msg = q->head;
+
+	if (*msg) {
+		q->head = (*msg)->next;
+
+		if (!q->head) {
+			q->tail = NULL;
+		}
+	}
+	else {
+		// Closed: leave the token for next receivers
+		queue_post(q);
+	}
+
+	pthread_mutex_unlock(&q->mutex);
+
+	return 1;
+}
+
+/*
+ * Workers registry
+ */
+static int register_worker(WORKER* w) {
+	pthread_mutex_lock(&workers_mutex);
+
+	int id = -1;
+
+	for (size_t i = 0; i < workers_count; i++) {
+		if (!workers[i]) {
+			id = i;
+			break;
+		}
+	}
+
+	if (id == -1) {
+		WORKER** new_workers =
+			realloc(workers, (workers_count + 1) * sizeof(WORKER*));
+
+		if (new_workers) {
+			workers = new_workers;
+			id = workers_count++;
+		}
+	}
+
+	if (id != -1) {
+		workers[id] = w;
+	}
+
+	pthread_mutex_unlock(&workers_mutex);
+
+	return id;
+}
+
+static WORKER* get_worker(duk_context* ctx, int id) {
+	WORKER* w = NULL;
+
+	pthread_mutex_lock(&workers_mutex);
+
+	if (id >= 0 && id < workers_count) {
+		w = workers[id];
+	}
+
+	pthread_mutex_unlock(&workers_mutex);
+
+	if (!w) {
+		errno = ESRCH;
+		joshi_throw_syserror(ctx);
+	}
+
+	return w;
+}
+
+static void unregister_worker(int id) {
+	pthread_mutex_lock(&workers_mutex);
+	workers[id] = NULL;
+	pthread_mutex_unlock(&workers_mutex);
+}
+
+static void free_worker(WORKER* w) {
+	queue_destroy(&w->inbox);
+	queue_destroy(&w->outbox);
+
+	for (int i = 0; i < w->argc; i++) {
+		free(w->argv[i]);
+	}
+
+	free(w->argv);
+	free(w);
+}
+
+/* Get the queues to send to and receive from for a given channel id */
+static QUEUE* get_queue(duk_context* ctx, int id, int send) {
+	if (id == -1) {
+		if (!self) {
+			errno = EINVAL;
+			joshi_throw_syserror(ctx);
+		}
+
+		return send ? &self->outbox : &self->inbox;
+	}
+
+	WORKER* w = get_worker(ctx, id);
+
+	return send ? &w->inbox : &w->outbox;
+}
+
+static void run_atexit_handler(duk_context* ctx) {
+	duk_push_heap_stash(ctx);
+	duk_get_prop_string(ctx, -1, "atexit_handler");
+
+	if (duk_is_function(ctx, -1)) {
+		duk_pcall(ctx, 0);
+	}
+
+	duk_pop_2(ctx);
+}
+
+static void* worker_main(void* arg) {
+	WORKER* w = arg;
+
+	// Let the main thread handle all signals
+	sigset_t set;
+
+	sigfillset(&set);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+	self = w;
+
+	duk_context* ctx = joshi_create_context();
+
+	if (ctx) {
+		w->retval = joshi_run_js(
+			ctx, w->argv[1], w->argc, (const char**)w->argv);
+
+		run_atexit_handler(ctx);
+		joshi_destroy_context(ctx);
+	}
+	else {
+		w->retval = -1;
+	}
+
+	queue_close(&w->outbox);
+
+	return NULL;
+}
+
+/*
+ * Buffers
+ *
+ * Transferable buffers are Uint8Array views over an ArrayBuffer which owns the
+ * data (and frees it when finalized). Every view derived from them keeps that
+ * ArrayBuffer alive, so the data outlives all of them.
+ */
+static duk_ret_t buffer_finalizer(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	free(duk_get_pointer(ctx, -1));
+
+	return 0;
+}
+
+static void push_transferable_buffer(duk_context* ctx, void* data, size_t size) {
+	duk_push_external_buffer(ctx);
+	duk_config_buffer(ctx, -1, data, size);
+
+	// [ ... buf ]
+
+	duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_ARRAYBUFFER);
+
+	// [ ... buf ab ]
+
+	duk_pull(ctx, -2);
+	duk_put_prop_string(ctx, -2, PROP_BUF);
+
+	duk_push_pointer(ctx, data);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_push_c_function(ctx, buffer_finalizer, 1);
+	duk_set_finalizer(ctx, -2);
+
+	// [ ... ab ]
+
+	duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_UINT8ARRAY);
+	duk_remove(ctx, -2);
+
+	// [ ... u8a ]
+}
+
+/*
+ * Detach data of a transferable buffer (returns NULL if not transferable).
+ *
+ * Only views covering the whole buffer are transferable: all views of it are
+ * detached.
+ */
+static void* detach_transferable_buffer(
+	duk_context* ctx, duk_idx_t idx, size_t* size) {
+
+	if (!duk_is_object(ctx, idx)) {
+		return NULL;
+	}
+
+	duk_size_t view_size;
+	void* view_data = duk_get_buffer_data(ctx, idx, &view_size);
+
+	duk_get_prop_string(ctx, idx, "buffer");
+
+	// [ ... ab ]
+
+	if (!duk_is_object(ctx, -1) || !duk_get_prop_string(ctx, -1, PROP_PTR)) {
+		duk_pop_2(ctx);
+		return NULL;
+	}
+
+	// [ ... ab ptr ]
+
+	void* data = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	duk_get_prop_string(ctx, -1, PROP_BUF);
+	duk_get_buffer(ctx, -1, size);
+
+	// [ ... ab buf ]
+
+	if (!data || data != view_data || *size != view_size) {
+		duk_pop_2(ctx);
+		return NULL;
+	}
+
+	duk_config_buffer(ctx, -1, NULL, 0);
+	duk_pop(ctx);
+
+	duk_push_pointer(ctx, NULL);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+	duk_pop(ctx);
+
+	return data;
+}
+
+/*
+ * Native functions
+ */
+duk_ret_t joshi_worker_alloc(duk_context* ctx) {
+	duk_size_t size = duk_require_uint(ctx, 0);
+	void* data = calloc(1, size ? size : 1);
+
+	if (!data) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	push_transferable_buffer(ctx, data, size);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_close(duk_context* ctx) {
+	int id = duk_require_int(ctx, 0);
+
+	queue_close(get_queue(ctx, id, 1));
+
+	return 0;
+}
+
+duk_ret_t joshi_worker_create(duk_context* ctx) {
+	duk_require_string(ctx, 0);
+	duk_require_object(ctx, 1);
+
+	WORKER* w = calloc(1, sizeof(WORKER));
+
+	if (!w) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	if (queue_init(&w->inbox) == -1) {
+		free(w);
+		return joshi_throw_syserror(ctx);
+	}
+
+	if (queue_init(&w->outbox) == -1) {
+		queue_destroy(&w->inbox);
+		free(w);
+		return joshi_throw_syserror(ctx);
+	}
+
+	// argv = [ joshi, script, args... ]
+	duk_size_t nargs = duk_get_length(ctx, 1);
+
+	w->argc = 2 + nargs;
+	w->argv = calloc(w->argc, sizeof(char*));
+
+	if (w->argv) {
+		w->argv[0] = strdup("joshi");
+		w->argv[1] = strdup(duk_get_string(ctx, 0));
+
+		for (duk_size_t i = 0; i < nargs; i++) {
+			duk_get_prop_index(ctx, 1, i);
+			w->argv[2 + i] = strdup(duk_safe_to_string(ctx, -1));
+			duk_pop(ctx);
+		}
+	}
+	else {
+		w->argc = 0;
+	}
+
+	int id = register_worker(w);
+
+	if (!w->argv || id == -1) {
+		if (id != -1) {
+			unregister_worker(id);
+		}
+
+		free_worker(w);
+		errno = ENOMEM;
+		return joshi_throw_syserror(ctx);
+	}
+
+	int err = pthread_create(&w->thread, NULL, worker_main, w);
+
+	if (err) {
+		unregister_worker(id);
+		free_worker(w);
+		errno = err;
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_int(ctx, id);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_fd(duk_context* ctx) {
+	int id = duk_require_int(ctx, 0);
+
+	duk_push_int(ctx, get_queue(ctx, id, 0)->fd);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_is_child(duk_context* ctx) {
+	duk_push_boolean(ctx, self != NULL);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_join(duk_context* ctx) {
+	int id = duk_require_int(ctx, 0);
+	WORKER* w = get_worker(ctx, id);
+
+	int err = pthread_join(w->thread, NULL);
+
+	if (err) {
+		errno = err;
+		return joshi_throw_syserror(ctx);
+	}
+
+	int retval = w->retval;
+
+	unregister_worker(id);
+	free_worker(w);
+
+	duk_push_int(ctx, retval);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_recv(duk_context* ctx) {
+	int id = duk_require_int(ctx, 0);
+	int timeout = duk_get_int_default(ctx, 1, -1);
+
+	MESSAGE* msg;
+	int ret = queue_pop(get_queue(ctx, id, 0), timeout, &msg);
+
+	if (ret == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	if (ret == 0) {
+		duk_push_undefined(ctx);
+		return 1;
+	}
+
+	if (!msg) {
+		duk_push_null(ctx);
+		return 1;
+	}
+
+	if (msg->type == MSG_STRING) {
+		duk_push_lstring(ctx, msg->data, msg->size);
+		free(msg->data);
+	}
+	else {
+		push_transferable_buffer(ctx, msg->data, msg->size);
+	}
+
+	free(msg);
+
+	return 1;
+}
+
+duk_ret_t joshi_worker_send(duk_context* ctx) {
+	int id = duk_require_int(ctx, 0);
+	QUEUE* q = get_queue(ctx, id, 1);
+
+	MESSAGE* msg = calloc(1, sizeof(MESSAGE));
+
+	if (!msg) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	if (duk_is_string(ctx, 1)) {
+		duk_size_t size;
+		const char* str = duk_get_lstring(ctx, 1, &size);
+
+		msg->type = MSG_STRING;
+		msg->size = size;
+		msg->data = malloc(size ? size : 1);
+
+		if (msg->data) {
+			memcpy(msg->data, str, size);
+		}
+	}
+	else if (duk_is_buffer_data(ctx, 1)) {
+		msg->type = MSG_BUFFER;
+		msg->data = detach_transferable_buffer(ctx, 1, &msg->size);
+
+		if (!msg->data) {
+			duk_size_t size;
+			void* data = duk_get_buffer_data(ctx, 1, &size);
+
+			msg->size = size;
+			msg->data = malloc(size ? size : 1);
+
+			if (msg->data) {
+				memcpy(msg->data, data, size);
+			}
+		}
+	}
+	else {
+		free(msg);
+		return duk_type_error(ctx, "Message must be a string or a buffer");
+	}
+
+	if (!msg->data) {
+		free(msg);
+		return joshi_throw_syserror(ctx);
+	}
+
+	if (queue_push(q, msg) == -1) {
+		free(msg->data);
+		free(msg);
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef _JOSHI_WORKER_H
+#define _JOSHI_WORKER_H
+
+#include "joshi.h"
+
+duk_ret_t joshi_worker_alloc(duk_context* ctx);
+duk_ret_t joshi_worker_close(duk_context* ctx);
+duk_ret_t joshi_worker_create(duk_context* ctx);
+duk_ret_t joshi_worker_fd(duk_context* ctx);
+duk_ret_t joshi_worker_is_child(duk_context* ctx);
+duk_ret_t joshi_worker_join(duk_context* ctx);
+duk_ret_t joshi_worker_recv(duk_context* ctx);
+duk_ret_t joshi_worker_send(duk_context* ctx);
+
+#endif
@@ -0,0 +1,285 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "joshi_writer.h"
+
+/*
+ * Buffered writers.
+ *
+ * Writers accumulate output in a native buffer and write it with a single
+ * syscall when it fills up (or on every line feed for line buffered writers).
+ *
+ * All writers are kept in a process wide registry so that they can be flushed
+ * before the process exits or forks (so that children don't inherit pending
+ * output). Before exec they are flushed by proc.exec.
+ */
+
+#define PROP_PTR DUK_HIDDEN_SYMBOL("joshi_writer_ptr")
+
+typedef struct WRITER {
+	struct WRITER* prev;
+	struct WRITER* next;
+	int fd;
+	int line_buffered;
+	size_t size;
+	size_t used;
+	char data[];
+} WRITER;
+
+static WRITER* writers = NULL;
+static pthread_mutex_t writers_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int write_fully(int fd, const char* data, size_t size) {
+	while (size > 0) {
+		ssize_t count = write(fd, data, size);
+
+		if (count == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return -1;
+		}
+
+		data += count;
+		size -= count;
+	}
+
+	return 0;
+}
+
+static int flush(WRITER* w) {
+	if (w->used == 0) {
+		return 0;
+	}
+
+	int result = write_fully(w->fd, w->data, w->used);
+
+	// Data is dropped on errors so that they are not reported forever
+	w->used = 0;
+
+	return result;
+}
+
+static void flush_all() {
+	pthread_mutex_lock(&writers_lock);
+
+	for (WRITER* w = writers; w; w = w->next) {
+		flush(w);
+	}
+
+	pthread_mutex_unlock(&writers_lock);
+}
+
+static void atfork_prepare() {
+	flush_all();
+}
+
+static WRITER* require_writer(duk_context* ctx, duk_idx_t idx) {
+	duk_get_prop_string(ctx, idx, PROP_PTR);
+	WRITER* w = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!w) {
+		duk_type_error(ctx, "Invalid or closed writer");
+	}
+
+	return w;
+}
+
+static int release(WRITER* w) {
+	pthread_mutex_lock(&writers_lock);
+
+	int result = flush(w);
+
+	if (w->prev) {
+		w->prev->next = w->next;
+	}
+	else {
+		writers = w->next;
+	}
+
+	if (w->next) {
+		w->next->prev = w->prev;
+	}
+
+	pthread_mutex_unlock(&writers_lock);
+
+	free(w);
+
+	return result;
+}
+
+static duk_ret_t writer_finalizer(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	WRITER* w = duk_get_pointer(ctx, -1);
+
+	if (w) {
+		release(w);
+	}
+
+	return 0;
+}
+
+/*
+ * Get the bytes to write: buffers are taken as is and strings are converted
+ * from Duktape's internal CESU-8 to UTF-8
+ */
+static const char* get_data(duk_context* ctx, duk_idx_t idx, size_t* size) {
+	if (!duk_is_string(ctx, idx)) {
+		duk_size_t buf_size;
+		const char* data = duk_require_buffer_data(ctx, idx, &buf_size);
+
+		*size = buf_size;
+
+		if (!duk_is_undefined(ctx, idx + 1)) {
+			size_t count = duk_require_number(ctx, idx + 1);
+
+			if (count < *size) {
+				*size = count;
+			}
+		}
+
+		return data;
+	}
+
+	duk_size_t str_size;
+	const char* str = joshi_require_utf(ctx, idx, &str_size);
+
+	*size = str_size;
+
+	return str;
+}
+
+void joshi_writer_init() {
+	// Registered before any script runs so that output written from other exit
+	// handlers is flushed too (they run in reverse order)
+	atexit(flush_all);
+	pthread_atfork(atfork_prepare, NULL, NULL);
+}
+
+duk_ret_t joshi_writer_close(duk_context* ctx) {
+	duk_get_prop_string(ctx, 0, PROP_PTR);
+	WRITER* w = duk_get_pointer(ctx, -1);
+	duk_pop(ctx);
+
+	if (!w) {
+		return 0;
+	}
+
+	duk_push_pointer(ctx, NULL);
+	duk_put_prop_string(ctx, 0, PROP_PTR);
+
+	if (release(w) == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_writer_create(duk_context* ctx) {
+	int fd = duk_require_int(ctx, 0);
+	size_t size = duk_require_uint(ctx, 1);
+	int line_buffered = duk_to_boolean(ctx, 2);
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	WRITER* w = malloc(sizeof(WRITER) + size);
+
+	if (!w) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	w->prev = NULL;
+	w->fd = fd;
+	w->line_buffered = line_buffered;
+	w->size = size;
+	w->used = 0;
+
+	pthread_mutex_lock(&writers_lock);
+
+	w->next = writers;
+
+	if (writers) {
+		writers->prev = w;
+	}
+
+	writers = w;
+
+	pthread_mutex_unlock(&writers_lock);
+
+	duk_push_object(ctx);
+
+	duk_push_pointer(ctx, w);
+	duk_put_prop_string(ctx, -2, PROP_PTR);
+
+	duk_push_c_function(ctx, writer_finalizer, 1);
+	duk_set_finalizer(ctx, -2);
+
+	return 1;
+}
+
+duk_ret_t joshi_writer_flush(duk_context* ctx) {
+	WRITER* w = require_writer(ctx, 0);
+
+	pthread_mutex_lock(&writers_lock);
+	int result = flush(w);
+	pthread_mutex_unlock(&writers_lock);
+
+	if (result == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	return 0;
+}
+
+duk_ret_t joshi_writer_flush_all(duk_context* ctx) {
+	flush_all();
+
+	return 0;
+}
+
+duk_ret_t joshi_writer_write(duk_context* ctx) {
+	WRITER* w = require_writer(ctx, 0);
+	size_t size;
+	const char* data = get_data(ctx, 1, &size);
+	int result = 0;
+
+	pthread_mutex_lock(&writers_lock);
+
+	if (size > w->size - w->used) {
+		result = flush(w);
+	}
+
+	if (result == 0) {
+		// Big chunks go straight to the file descriptor
+		if (size >= w->size) {
+			result = write_fully(w->fd, data, size);
+		}
+		else {
+			memcpy(w->data + w->used, data, size);
+			w->used += size;
+
+			if (w->line_buffered && memchr(data, '\n', size)) {
+				result = flush(w);
+			}
+		}
+	}
+
+	pthread_mutex_unlock(&writers_lock);
+
+	joshi_mblock_free_all(ctx);
+
+	if (result == -1) {
+		return joshi_throw_syserror(ctx);
+	}
+
+	duk_push_number(ctx, size);
+
+	return 1;
+}
@@ -0,0 +1,14 @@
+#ifndef _JOSHI_WRITER_H
+#define _JOSHI_WRITER_H
+
+#include "joshi.h"
+
+void joshi_writer_init();
+
+duk_ret_t joshi_writer_close(duk_context* ctx);
+duk_ret_t joshi_writer_create(duk_context* ctx);
+duk_ret_t joshi_writer_flush(duk_context* ctx);
+duk_ret_t joshi_writer_flush_all(duk_context* ctx);
+duk_ret_t joshi_writer_write(duk_context* ctx);
+
+#endif
@@ -2,6 +2,54 @@ const generate = {
 	FN_NAME_PREFIX: '_js_',
 };
 
+generate.call = function (fn, FN, throws, types) {
+	const retVar = fn.returns;
+	const chk_ret = retVar && throws[fn.throws];
+
+	const CALL =
+		FN +
+		'(' +
+		fn.args
+			.map(function (arg) {
+				return generate.reference_variable(
+					arg,
+					types,
+					arg.ref ? '&' : null
+				);
+			})
+			.join(',') +
+		');';
+
+	if (!retVar) {
+		return ['	errno = 0;', '', '	' + CALL];
+	}
+
+	const DECL = generate.declare_variable(retVar, types, retVar.ref);
+	const RET = generate.reference_variable(retVar, types);
+
+	if (!chk_ret || !chk_ret.failed) {
+		return [
+			'	errno = 0;',
+			'	' + DECL,
+			'	' + RET + ' = ',
+			'',
+			'	' + CALL,
+		];
+	}
+
+	// Calls interrupted by a signal are restarted once its handler has run
+	return [
+		'	' + DECL,
+		'',
+		'	do {',
+		'		errno = 0;',
+		'		' + RET + ' = ' + CALL,
+		'	} while (' +
+			chk_ret.failed(retVar) +
+			' && joshi_signal_interrupted(ctx));',
+	];
+};
+
 generate.check_return = function (fn, throws, types, cleanup_code) {
 	if (!fn.returns) {
 		return [];
@@ -155,6 +203,8 @@ generate.stub = function (fnName, functions, throws, types) {
 			}, [])
 		),
 		'',
+		'	joshi_signal_run_pending(ctx);',
+		'',
 		generate.tabify(
 			1,
 			inArgs.reduce(function (lines, arg, idx) {
@@ -162,27 +212,7 @@ generate.stub = function (fnName, functions, throws, types) {
 			}, [])
 		),
 		'',
-		'	errno = 0;',
-		retVar
-			? [
-					'	' + generate.declare_variable(retVar, types, retVar.ref),
-					'	' + generate.reference_variable(retVar, types) + ' = ',
-			  ]
-			: [],
-		'',
-		'	' +
-			FN +
-			'(' +
-			args
-				.map(function (arg) {
-					return generate.reference_variable(
-						arg,
-						types,
-						arg.ref ? '&' : null
-					);
-				})
-				.join(',') +
-			');',
+		generate.call(fn, FN, throws, types),
 		'',
 		generate.tabify(
 			1,
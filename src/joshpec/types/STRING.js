@@ -32,8 +32,7 @@ return function STRING() {
 
 	def.push_decl = function (type_name, types) {
 		return [
-			// TODO: UTF to CES conversion ?
-			'#define duk_push_char_arr(ctx,value) duk_push_string((ctx),(value))',
+			'#define duk_push_char_arr(ctx,value) joshi_push_utf((ctx),(value))',
 		];
 	};
 
@@ -73,8 +72,7 @@ return function STRING() {
 		}
 
 		return [
-			// TODO: UTF to CES conversion ?
-			'duk_push_string(ctx, ' + VAR + ');',
+			'joshi_push_utf(ctx, ' + VAR + ');',
 		];
 	};
 
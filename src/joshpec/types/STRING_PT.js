@@ -30,13 +30,7 @@ return function STRING_PT() {
 			'		return NULL;',
 			'	}',
 			'',
-			'	const char* cesu = duk_require_string(ctx, idx);',
-			'	JOSHI_MBLOCK* blk = joshi_mblock_alloc(ctx, cnv_cesu_to_utf_length(cesu) + 1);',
-			'	char* utf = (char*)blk->data;',
-			'',
-			'	cnv_cesu_to_utf(cesu, utf);',
-			'',
-			'	return utf;',
+			'	return (' + T + ')joshi_require_utf(ctx, idx, NULL);',
 			'}',
 		];
 	};
@@ -48,7 +42,7 @@ return function STRING_PT() {
 		return [
 			'#define duk_push_' +
 				ST +
-				'(ctx,value) duk_push_string((ctx),(value))',
+				'(ctx,value) joshi_push_utf((ctx),(value))',
 		];
 	};
 
@@ -0,0 +1,14 @@
+const bundle = require('bundle');
+const fs = require('fs');
+const term = require('term');
+
+if (argv.length < 3 || argv.length > 4) {
+	term.println2('Usage: joshi bundle <script> [<output file>]');
+	return 1;
+}
+
+const script = argv[2];
+const output =
+	argv.length > 3 ? argv[3] : script.replace(/\.js$/, '') + '.bundle.js';
+
+fs.write_file(output, bundle.script(script), 0755);
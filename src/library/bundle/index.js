@@ -0,0 +1,234 @@
+const fs = require('fs');
+const kern = require('kern');
+
+const REQUIRE_REGEXP = /\brequire\s*\(\s*(['"])([^'"]+)\1\s*\)/g;
+
+/**
+ * @exports bundle
+ */
+const bundle = {};
+
+/**
+ * Pack a script and all the modules it requires (transitively) into a single
+ * self-contained script.
+ *
+ * Modules are discovered statically by looking for `require()` calls with a
+ * string literal argument. Core library modules, native (`.so`) modules and
+ * modules that cannot be found at bundle time are left to be resolved at run
+ * time by the regular `require()` function.
+ *
+ * @param {string} script Path to main script
+ * @returns {string} The source code of the bundled script
+ * @throws {SysError}
+ */
+bundle.script = function (script) {
+	const main_path = fs.realpath(script);
+
+	const ids = {};
+	const paths = [];
+	const deps = [];
+
+	function add(path) {
+		if (ids[path] !== undefined) {
+			return ids[path];
+		}
+
+		const id = paths.length;
+
+		ids[path] = id;
+		paths.push(path);
+		deps.push({});
+
+		const source = fs.read_file(path);
+		var match;
+
+		REQUIRE_REGEXP.lastIndex = 0;
+
+		const modules = [];
+
+		while ((match = REQUIRE_REGEXP.exec(source)) !== null) {
+			modules.push(match[2]);
+		}
+
+		modules.forEach(function (module) {
+			const dep_path = resolve(path, module);
+
+			if (dep_path !== null) {
+				deps[id][module] = add(dep_path);
+			}
+		});
+
+		return id;
+	}
+
+	add(main_path);
+
+	const lines = [];
+
+	lines.push('#!/usr/bin/env joshi');
+	lines.push('// Generated by `joshi bundle ' + fs.basename(script) + '`');
+	lines.push('const __modules = [');
+
+	paths.forEach(function (path, id) {
+		var source = fs.read_file(path);
+
+		if (id === 0) {
+			if (source.startsWith('#!')) {
+				source = '//' + source;
+			}
+
+			lines.push('function (argv, require) {');
+		} else {
+			lines.push('function (require) {');
+		}
+
+		lines.push(source);
+		lines.push('},');
+	});
+
+	lines.push('];');
+	lines.push('const __deps = ' + JSON.stringify(deps) + ';');
+	lines.push('const __cache = [];');
+	lines.push('function __require(id) {');
+	lines.push('\treturn function (module) {');
+	lines.push('\t\tconst dep = __deps[id][module];');
+	lines.push('\t\tif (dep === undefined) return require(module);');
+	lines.push('\t\tif (!(dep in __cache))');
+	lines.push('\t\t\t__cache[dep] = __modules[dep](__require(dep));');
+	lines.push('\t\treturn __cache[dep];');
+	lines.push('\t};');
+	lines.push('}');
+	lines.push('return __modules[0](argv, __require(0));');
+	lines.push('');
+
+	return lines.join('\n');
+};
+
+/**
+ * Precompile a library folder to bytecode and generate the C source file
+ * containing it, so that it can be linked inside the `joshi` binary.
+ *
+ * This is used by `make embedded` and is probably not very useful otherwise.
+ *
+ * @param {string} lib_dir Path to library folder
+ * @returns {string} C source code defining the `joshi_embedded_files` table
+ * @throws {SysError}
+ */
+bundle.library = function (lib_dir) {
+	const names = list_js_files(lib_dir, '').sort();
+
+	const lines = [];
+
+	lines.push('/* Generated by `make embedded` from library sources */');
+	lines.push('#include "joshi_embedded.h"');
+	lines.push('');
+
+	names.forEach(function (name, i) {
+		var source = fs.read_file(lib_dir + '/' + name);
+
+		if (name === 'init.js') {
+			// init() is already a function
+		} else if (name.indexOf('/') === -1) {
+			if (source.startsWith('#!')) {
+				source = '//' + source;
+			}
+
+			source = 'function(argv, require){ ' + source + ' ;}';
+		} else {
+			source = 'function(require, j){ ' + source + ' ;}';
+		}
+
+		const bytecode = j.dump_function(j.compile_function(source, name));
+
+		lines.push('static const unsigned char file_' + i + '[] = {');
+
+		for (var off = 0; off < bytecode.length; off += 16) {
+			const hex = [];
+
+			for (var k = off; k < off + 16 && k < bytecode.length; k++) {
+				const byte = bytecode[k];
+
+				hex.push('0x' + (byte < 16 ? '0' : '') + byte.toString(16));
+			}
+
+			lines.push('\t' + hex.join(', ') + ',');
+		}
+
+		lines.push('};');
+		lines.push('');
+	});
+
+	lines.push('size_t joshi_embedded_files_count = ' + names.length + ';');
+	lines.push('JOSHI_EMBEDDED_FILE joshi_embedded_files[] = {');
+
+	names.forEach(function (name, i) {
+		lines.push(
+			'\t{ "' + name + '", file_' + i + ', sizeof(file_' + i + ') },'
+		);
+	});
+
+	lines.push('};');
+	lines.push('');
+
+	return lines.join('\n');
+};
+
+function list_js_files(dir, prefix) {
+	var names = [];
+
+	fs.list_dir(dir).forEach(function (item) {
+		const path = dir + '/' + item;
+
+		if (fs.is_directory(path)) {
+			names = names.concat(list_js_files(path, prefix + item + '/'));
+		} else if (item.endsWith('.js')) {
+			names.push(prefix + item);
+		}
+	});
+
+	return names;
+}
+
+function resolve(owner_path, module) {
+	if (!module.endsWith('.js') && !module.endsWith('.so')) {
+		module += '/index.js';
+	}
+
+	if (module.endsWith('.so')) {
+		return null;
+	}
+
+	var path;
+
+	if (module[0] === '.') {
+		path = fs.normalize_path(fs.dirname(owner_path) + '/' + module);
+	} else if (module[0] === '/') {
+		path = fs.normalize_path(module);
+	} else {
+		const is_core_module =
+			(j.embedded && j.embedded[module]) ||
+			is_file(j.dir + '/' + module);
+
+		if (is_core_module) {
+			return null;
+		}
+
+		for (var i = 0; i < kern.search_path.length; i++) {
+			const candidate = kern.search_path[i] + '/' + module;
+
+			if (is_file(candidate)) {
+				return fs.realpath(candidate);
+			}
+		}
+
+		return null;
+	}
+
+	return is_file(path) ? path : null;
+}
+
+function is_file(path) {
+	return fs.exists(path) && fs.is_file(path);
+}
+
+return bundle;
@@ -42,8 +42,92 @@ const proc = require('proc');
  * @returns {boolean|undefined} Return `false` to stop listing
  */
 
+/**
+ * Directory entry returned by {@link module:fs.read_dir} when asked for types
+ *
+ * @typedef {object} DirEntry
+ * @property {string} name Entry name
+ * @property {number} ino Inode number
+ *
+ * @property {number} type
+ * Entry type (one of the fs.DT_* constants, {@link module:fs.DT_UNKNOWN} if
+ * the file system does not provide it)
+ */
+
+/**
+ * Entry returned by {@link module:fs.walk}
+ *
+ * @typedef {object} WalkEntry
+ * @property {string} path Path of the entry (starting with the walked root)
+ * @property {number} type Entry type (one of the fs.DT_* constants)
+ * @property {number} depth Depth of the entry (1 for the root's children)
+ * @property {number} [size] Size in bytes (if `stat` option was given)
+ *
+ * @property {number} [mtime]
+ * Last modification time in seconds (if `stat` option was given)
+ *
+ * @property {number} [errno]
+ * Set if the entry could not be stat'ed, or (for directories) read
+ */
+
+/**
+ * Callback for {@link module:fs.walk} method
+ *
+ * @callback WalkCallback
+ * @param {WalkEntry[]} entries A batch of entries
+ * @returns {boolean|undefined} Return `false` to stop walking
+ */
+
+/**
+ * Columns returned by {@link module:fs.stat_many} and
+ * {@link module:fs.fstat_many}, with one item per file. Only the requested
+ * fields are present (except `errno`, which is always there).
+ *
+ * Times are given in whole seconds plus a `_nsec` column with nanoseconds.
+ *
+ * @typedef {object} StatColumns
+ * @property {Int32Array} errno Error of each file (0 if it could be stat'ed)
+ * @property {Uint32Array} [mode] File type and access mode
+ * @property {Uint32Array} [uid] Owner user id
+ * @property {Uint32Array} [gid] Owner group id
+ * @property {Uint32Array} [nlink] Number of hard links
+ * @property {Float64Array} [ino] Inode number
+ * @property {Float64Array} [size] Size in bytes
+ * @property {Float64Array} [atime] Last access time
+ * @property {Uint32Array} [atime_nsec] Nanoseconds of last access time
+ *
+ * @property {Float64Array} [btime]
+ * Creation time (0 if the file system does not provide it)
+ *
+ * @property {Uint32Array} [btime_nsec] Nanoseconds of creation time
+ * @property {Float64Array} [ctime] Change time
+ * @property {Uint32Array} [ctime_nsec] Nanoseconds of change time
+ * @property {Float64Array} [mtime] Last modification time
+ * @property {Uint32Array} [mtime_nsec] Nanoseconds of last modification time
+ */
+
+// Chunk size for copies done through user space
+const COPY_CHUNK_SIZE = 1024 * 1024;
+
 const decoder = new TextDecoder();
 
+// statx() mask bits of the fields supported by fs.stat_many()
+const STATX_FIELDS = {
+	mode: 0x3,
+	nlink: 0x4,
+	uid: 0x8,
+	gid: 0x10,
+	atime: 0x20,
+	mtime: 0x40,
+	ctime: 0x80,
+	ino: 0x100,
+	size: 0x200,
+	btime: 0x800,
+};
+
+const AT_FDCWD = -100;
+const AT_SYMLINK_NOFOLLOW = 0x100;
+
 /**
  * @exports fs
  * @readonly
@@ -68,6 +152,25 @@ const fs = {
 	S_IFREG: 0100000,
 	/** File node type: socket */
 	S_IFSOC: 0140000,
+
+	/* directory entry types */
+
+	/** Directory entry type: unknown (use {@link module:fs.stat}) */
+	DT_UNKNOWN: 0,
+	/** Directory entry type: FIFO */
+	DT_FIFO: 1,
+	/** Directory entry type: char device */
+	DT_CHR: 2,
+	/** Directory entry type: directory */
+	DT_DIR: 4,
+	/** Directory entry type: block device */
+	DT_BLK: 6,
+	/** Directory entry type: regular file */
+	DT_REG: 8,
+	/** Directory entry type: symbolic link */
+	DT_LNK: 10,
+	/** Directory entry type: socket */
+	DT_SOCK: 12,
 };
 
 /**
@@ -99,6 +202,9 @@ fs.chown = function (path, uid, gid) {
 /**
  * Copy file.
  *
+ * Data is copied inside the kernel whenever possible (sharing data blocks on
+ * filesystems with reflink support) and through a big buffer otherwise.
+ *
  * Note that if the copy fails, the target file is left in an undefined state.
  *
  * @param {string} from Source file path
@@ -124,7 +230,15 @@ fs.copy_file = function (from, to, mode) {
 		fdFrom = io.open(from, 'r');
 		fdTo = io.truncate(to, mode);
 
-		const buf = new Uint8Array(4096);
+		if (copy_in_kernel(copy_file_range, fdFrom, fdTo)) {
+			return;
+		}
+
+		if (copy_in_kernel(sendfile, fdFrom, fdTo)) {
+			return;
+		}
+
+		const buf = new Uint8Array(COPY_CHUNK_SIZE);
 
 		var count;
 		while ((count = io.read(fdFrom, buf, buf.length)) !== 0) {
@@ -209,6 +323,22 @@ fs.exists = function (pathname) {
 	}
 };
 
+/**
+ * Obtain information of several open files with a single native call.
+ *
+ * @param {number[]} fds File descriptors
+ *
+ * @param {string[]} [fields=['mode', 'size', 'mtime']]
+ * Fields to return (see {@link StatColumns})
+ *
+ * @returns {StatColumns} The information in columns
+ * @throws {Error} If a field is unknown
+ * @see {module:fs.stat_many}
+ */
+fs.fstat_many = function (fds, fields) {
+	return j.stat_many(AT_FDCWD, fds.map(Number), 0, statx_mask(fields));
+};
+
 /**
  * Check if a path points to a block device
  *
@@ -366,18 +496,15 @@ fs.join = function () {
  * @throws {SysError}
  */
 fs.list_dir = function (name, callback) {
-	const items = callback ? undefined : [];
+	if (!callback) {
+		return fs.read_dir(name);
+	}
+
 	var finished = false;
 
 	var dirp;
 
 	try {
-		const cb = callback
-			? callback
-			: function (item) {
-					items.push(item);
-			  };
-
 		dirp = j.opendir(name);
 
 		var index = 0;
@@ -389,7 +516,7 @@ fs.list_dir = function (name, callback) {
 				continue;
 			}
 
-			if (cb(name, index++) === false) {
+			if (callback(name, index++) === false) {
 				break;
 			}
 		}
@@ -406,7 +533,7 @@ fs.list_dir = function (name, callback) {
 		}
 	}
 
-	return callback ? finished : items;
+	return finished;
 };
 
 /**
@@ -547,6 +674,61 @@ fs.read_link = function (path, dereference) {
 	return (dir === '/' ? '' : dir) + '/' + val;
 };
 
+/**
+ * Read the contents of a file as bytes.
+ *
+ * @param {string} path Path of file to read
+ * @returns {Uint8Array} The contents of the file
+ * @throws {SysError}
+ * @see {module:io.read_all}
+ */
+fs.read_bytes = function (path) {
+	const fd = io.open(path, 'r');
+
+	try {
+		return io.read_all(fd);
+	} finally {
+		io.close(fd);
+	}
+};
+
+/**
+ * Read all entries of a directory (except `.` and `..`) at once.
+ *
+ * Entries are read in big batches with the getdents64 syscall, so this is much
+ * faster than {@link module:fs.list_dir} with a callback for big directories.
+ *
+ * @example
+ * const dirs = fs
+ *   .read_dir('/tmp', { types: true })
+ *   .filter(function (entry) {
+ *     return entry.type === fs.DT_DIR;
+ *   });
+ *
+ * @param {string} path Path of directory
+ *
+ * @param {object} [opts]
+ * @param {boolean} [opts.types=false]
+ * Return {@link DirEntry} objects with the type and inode of the entries
+ * instead of just their names
+ *
+ * @returns {string[]|DirEntry[]} The entries in directory order
+ * @throws {SysError}
+ */
+fs.read_dir = function (path, opts) {
+	const types = opts && opts.types ? true : false;
+
+	try {
+		return j.read_dir(path, types);
+	} catch (err) {
+		if (err.errno) {
+			err.message += ' (' + path + ')';
+		}
+
+		throw err;
+	}
+};
+
 /**
  * Read the contents of a file as an UTF-8 string.
  *
@@ -595,12 +777,26 @@ fs.rename = function (oldpath, newpath) {
 /**
  * Delete a directory
  *
+ * Recursive deletion is done natively, removing entries relative to their
+ * parent directory. Symbolic links inside the directory are deleted, never
+ * followed.
+ *
+ * @example
+ * // Clean a big cache directory using 4 threads
+ * fs.rmdir('cache', true, { threads: 4 });
+ *
  * @param {string} path Path of directory
  * @param {boolean} [recursive=false] Delete even if not empty
+ *
+ * @param {object} [opts]
+ * @param {number} [opts.threads=0]
+ * Number of threads deleting the subdirectories of `path` in parallel (when
+ * `recursive` is true)
+ *
  * @returns {0}
  * @throws {SysError}
  */
-fs.rmdir = function (path, recursive) {
+fs.rmdir = function (path, recursive, opts) {
 	if (recursive === undefined) {
 		recursive = false;
 	}
@@ -610,15 +806,17 @@ fs.rmdir = function (path, recursive) {
 	}
 
 	if (recursive) {
-		fs.list_dir(path, function (item) {
-			const item_path = path + '/' + item;
+		const threads = opts && opts.threads ? Number(opts.threads) : 0;
 
-			if (fs.is_directory(item_path)) {
-				fs.rmdir(item_path, true);
-			} else {
-				fs.unlink(item_path);
+		try {
+			j.walk_remove_contents(path, threads);
+		} catch (err) {
+			if (err.errno) {
+				err.message += ' (' + path + ')';
 			}
-		});
+
+			throw err;
+		}
 	}
 
 	return j.rmdir(path);
@@ -648,6 +846,53 @@ fs.stat = function (pathname) {
 	};
 };
 
+/**
+ * Obtain information of many files with a single native call (using statx).
+ *
+ * Results are returned in columns (typed arrays) instead of an object per file,
+ * and include full nanosecond precision times.
+ *
+ * @example
+ * // Find files modified after a given instant
+ * const st = fs.stat_many(paths, ['mtime']);
+ *
+ * const modified = paths.filter(function (path, i) {
+ *   return (
+ *     st.mtime[i] > since.sec ||
+ *     (st.mtime[i] === since.sec && st.mtime_nsec[i] > since.nsec)
+ *   );
+ * });
+ *
+ * @param {string[]} paths Paths of files
+ *
+ * @param {string[]} [fields=['mode', 'size', 'mtime']]
+ * Fields to return (see {@link StatColumns})
+ *
+ * @param {object} [opts]
+ *
+ * @param {number} [opts.dir]
+ * Directory fd to resolve relative paths from (instead of the current
+ * directory)
+ *
+ * @param {boolean} [opts.follow=false]
+ * Return information of symbolic links' targets instead of the links
+ *
+ * @returns {StatColumns}
+ * The information in columns (failures are reported in the `errno` column)
+ *
+ * @throws {Error} If a field is unknown
+ */
+fs.stat_many = function (paths, fields, opts) {
+	opts = opts || {};
+
+	return j.stat_many(
+		opts.dir === undefined ? AT_FDCWD : Number(opts.dir),
+		paths.map(String),
+		opts.follow ? 0 : AT_SYMLINK_NOFOLLOW,
+		statx_mask(fields)
+	);
+};
+
 /**
  * Create a symbolic link at path2 pointing to path1
  *
@@ -688,6 +933,101 @@ fs.unlink = function (pathname, fail_if_not_found) {
 	}
 };
 
+/**
+ * Walk a directory tree recursively, passing its entries (but not the root
+ * itself) to a callback in batches.
+ *
+ * Directories are read in bulk and opened relative to their parents, and
+ * entries are only stat'ed when `stat` is requested (or when the file system
+ * doesn't report their type). Symbolic links are never followed.
+ *
+ * With `threads` several directories are read in parallel (which pays off in
+ * big trees, especially on network or cold storage). Entries are then delivered
+ * in no particular order.
+ *
+ * Directories that cannot be read are delivered again with their `errno`, but
+ * don't stop the walk.
+ *
+ * @example
+ * // Find big log files
+ * fs.walk('/var', { prune: ['.git'], stat: true }, function (entries) {
+ *   entries.forEach(function (entry) {
+ *     if (entry.size > 1024 * 1024 && entry.path.endsWith('.log')) {
+ *       term.println(entry.path);
+ *     }
+ *   });
+ * });
+ *
+ * @param {string} root Path of directory to walk
+ *
+ * @param {object} [opts]
+ *
+ * @param {number} [opts.max_depth]
+ * Don't descend below this depth (unlimited by default)
+ *
+ * @param {string[]} [opts.prune=[]]
+ * Glob patterns of entry names to skip (along with their contents)
+ *
+ * @param {boolean} [opts.same_fs=false]
+ * Don't descend into directories of other file systems
+ *
+ * @param {boolean} [opts.stat=false] Return entries' size and mtime
+ *
+ * @param {number} [opts.threads=0]
+ * Number of threads reading directories (0 means walking in the calling thread)
+ *
+ * @param {number} [opts.batch_size=1024] Number of entries per batch
+ *
+ * @param {WalkCallback} callback A callback receiving the batches of entries
+ *
+ * @returns {boolean}
+ * True if the walk finished or false if it was cancelled by the callback
+ *
+ * @throws {SysError} If the root cannot be opened
+ */
+fs.walk = function (root, opts, callback) {
+	if (typeof opts === 'function') {
+		callback = opts;
+		opts = {};
+	}
+
+	opts = opts || {};
+
+	var walker;
+
+	try {
+		walker = j.walk_open(
+			root,
+			Number(opts.threads || 0),
+			opts.max_depth === undefined ? -1 : Number(opts.max_depth),
+			(opts.prune || []).map(String),
+			opts.same_fs ? true : false,
+			opts.stat ? true : false,
+			Number(opts.batch_size || 1024)
+		);
+	} catch (err) {
+		if (err.errno) {
+			err.message += ' (' + root + ')';
+		}
+
+		throw err;
+	}
+
+	try {
+		var entries;
+
+		while ((entries = j.walk_next(walker))) {
+			if (callback(entries) === false) {
+				return false;
+			}
+		}
+
+		return true;
+	} finally {
+		j.walk_close(walker);
+	}
+};
+
 /**
  * Write a string in UTF-8 format to a file
  *
@@ -719,6 +1059,66 @@ fs.write_file = function (path, contents, mode) {
 	}
 };
 
+/**
+ * Copy the contents of a file to another with a kernel-side transfer function.
+ *
+ * Returns `false` when the function fails or reaches end of file before copying
+ * anything (because it is not supported for the given files, or because they
+ * live in pseudo filesystems like /proc that report a size of 0) so that the
+ * caller can fall back to some other method.
+ *
+ * @param {function} transfer One of {@link copy_file_range} or {@link sendfile}
+ * @param {number} fdFrom Source file descriptor
+ * @param {number} fdTo Destination file descriptor
+ * @returns {boolean} Whether the file was copied
+ * @throws {SysError} If the copy fails once started
+ * @private
+ */
+function copy_in_kernel(transfer, fdFrom, fdTo) {
+	var copied = 0;
+
+	try {
+		var count;
+		while ((count = transfer(fdFrom, fdTo)) !== 0) {
+			copied += count;
+		}
+	} catch (err) {
+		if (copied > 0 || err.errno === undefined) {
+			throw err;
+		}
+
+		return false;
+	}
+
+	return copied > 0;
+}
+
+/**
+ * Transfer function for {@link copy_in_kernel} using copy_file_range()
+ *
+ * @param {number} fdFrom Source file descriptor
+ * @param {number} fdTo Destination file descriptor
+ * @returns {number} The number of bytes copied
+ * @throws {SysError}
+ * @private
+ */
+function copy_file_range(fdFrom, fdTo) {
+	return io.copy_file_range(fdFrom, null, fdTo, null, 0x40000000);
+}
+
+/**
+ * Transfer function for {@link copy_in_kernel} using sendfile()
+ *
+ * @param {number} fdFrom Source file descriptor
+ * @param {number} fdTo Destination file descriptor
+ * @returns {number} The number of bytes copied
+ * @throws {SysError}
+ * @private
+ */
+function sendfile(fdFrom, fdTo) {
+	return io.sendfile(fdTo, fdFrom, null, 0x40000000);
+}
+
 /**
  * Check if a file matches a mode bit given current process' effective gid and
  * uid.
@@ -768,4 +1168,25 @@ function matches_mode(pathname, modebit) {
 	return false;
 }
 
+/**
+ * Get the statx() mask for a list of field names
+ *
+ * @param {string[]} [fields=['mode', 'size', 'mtime']]
+ * @returns {number}
+ * @private
+ */
+function statx_mask(fields) {
+	if (fields === undefined) {
+		fields = ['mode', 'size', 'mtime'];
+	}
+
+	return fields.reduce(function (mask, field) {
+		if (!STATX_FIELDS.hasOwnProperty(field)) {
+			throw new Error('Unknown stat field: ' + field);
+		}
+
+		return mask | STATX_FIELDS[field];
+	}, 0);
+}
+
 return fs;
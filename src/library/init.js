@@ -1,7 +1,44 @@
 function init(global, j, filepath) {
 	const modules_cache = {};
+	const resolve_cache = {};
+	const bytecode_cache_dir = get_bytecode_cache_dir();
 	var kern = undefined;
 
+	// Compute directory where compiled modules are cached (or null to disable)
+	function get_bytecode_cache_dir() {
+		var dir = j.getenv('JOSHI_CACHE_DIR');
+
+		if (dir === '') {
+			return null;
+		}
+
+		if (dir === null) {
+			const xdg_cache_home = j.getenv('XDG_CACHE_HOME');
+			const home = j.getenv('HOME');
+
+			if (xdg_cache_home) {
+				dir = xdg_cache_home + '/joshi';
+			} else if (home) {
+				dir = home + '/.cache/joshi';
+			} else {
+				return null;
+			}
+		}
+
+		return dir + '/' + j.version;
+	}
+
+	// Get name of embedded library file for a path (or null if not embedded)
+	function get_embedded_name(path) {
+		if (!j.embedded || !path.startsWith(j.dir + '/')) {
+			return null;
+		}
+
+		const name = path.substr(j.dir.length + 1);
+
+		return j.embedded[name] ? name : null;
+	}
+
 	// Create anchored require() function
 	function create_require(owner_path) {
 		const normalize = function (path) {
@@ -38,24 +75,40 @@ function init(global, j, filepath) {
 				return normalize(module);
 			}
 
+			if (j.embedded && j.embedded[module]) {
+				return j.dir + '/' + module;
+			}
+
 			if (!kern || !kern.search_path.length) {
 				return normalize(j.dir + '/' + module);
 			}
 
+			// Searching hits the file system, so results (misses included) are
+			// remembered for as long as the search path doesn't change
+			const cache_key = kern.search_path.join(':') + ':' + module;
+			var resolved = resolve_cache[cache_key];
+
+			if (resolved !== undefined) {
+				return resolved;
+			}
+
 			const dirs = [j.dir].concat(kern.search_path);
-			var foundModule;
 
 			for (var k = 0; k < dirs.length; k++) {
-				try {
-					const candidate = dirs[k] + '/' + module;
+				resolved = j.resolve_path(dirs[k] + '/' + module);
 
-					return j.realpath(candidate);
-				} catch (err) {
-					// ignore
+				if (resolved !== null) {
+					break;
 				}
 			}
 
-			return normalize(j.dir + '/' + module);
+			if (resolved === null) {
+				resolved = normalize(j.dir + '/' + module);
+			}
+
+			resolve_cache[cache_key] = resolved;
+
+			return resolved;
 		};
 
 		const anchored_require = function (module) {
@@ -70,14 +123,11 @@ function init(global, j, filepath) {
 					const is_core_module = filepath.startsWith(j.dir);
 					const args = is_core_module ? 'require, j' : 'require';
 
-					const source =
-						'function(' +
-						args +
-						'){ ' +
-						j.read_file(filepath) +
-						' ;}';
+					const embedded_name = get_embedded_name(filepath);
 
-					const fn = j.compile_function(source, filepath);
+					const fn = embedded_name
+						? j.load_embedded(embedded_name)
+						: j.compile_module(filepath, args, bytecode_cache_dir);
 
 					modules_cache[filepath] = is_core_module
 						? fn(create_require(filepath), j)
@@ -114,33 +164,50 @@ function init(global, j, filepath) {
 		filepath = j.dir + '/repl.js';
 	}
 
-	var main_source;
+	var main_path;
+	var main;
 
 	try {
-		// Resolve filepath
-		const main_path = j.realpath(filepath);
+		const embedded_name = get_embedded_name(filepath);
 
-		// Read and compile main
-		var main_lines = j.read_file(main_path).split('\n');
-
-		if (main_lines[0].startsWith('#!')) {
-			main_lines[0] = '//' + main_lines[0];
+		if (embedded_name) {
+			main_path = filepath;
+			main = j.load_embedded(embedded_name);
 		}
-
-		main_source =
-			'function(argv, require){ ' + main_lines.join('\n') + ' ;}';
 	} catch (err) {
-		j.printk('Script ' + filepath + ' cannot be read: ' + err + '\n');
+		j.printk('Script ' + filepath + ' cannot be loaded: ' + err + '\n');
 		return -1;
 	}
 
-	var main;
+	if (!main) {
+		var main_source;
 
-	try {
-		main = j.compile_function(main_source, main_path);
-	} catch (err) {
-		j.printk('Compilation error in script ' + filepath + ': ' + err + '\n');
-		return -1;
+		try {
+			// Resolve filepath
+			main_path = j.realpath(filepath);
+
+			// Read and compile main
+			var main_lines = j.read_file(main_path).split('\n');
+
+			if (main_lines[0].startsWith('#!')) {
+				main_lines[0] = '//' + main_lines[0];
+			}
+
+			main_source =
+				'function(argv, require){ ' + main_lines.join('\n') + ' ;}';
+		} catch (err) {
+			j.printk('Script ' + filepath + ' cannot be read: ' + err + '\n');
+			return -1;
+		}
+
+		try {
+			main = j.compile_function(main_source, main_path);
+		} catch (err) {
+			j.printk(
+				'Compilation error in script ' + filepath + ': ' + err + '\n'
+			);
+			return -1;
+		}
 	}
 
 	// Invoke main
@@ -153,7 +220,6 @@ function init(global, j, filepath) {
 
 		const require = create_require(main_path);
 
-		require('shims');
 		kern = require('kern');
 
 		const retval = main(argv, require);
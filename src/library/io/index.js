@@ -31,6 +31,318 @@ const encoder = new TextEncoder();
  * @see {@link module:io.POLLRDHUP}
  */
 
+/**
+ * Buffered writer options
+ *
+ * @typedef {object} WriterOptions
+ *
+ * @property {number} [size=65536] Size of the buffer in bytes
+ *
+ * @property {boolean} [line_buffered=false]
+ * Whether to flush the buffer whenever a line feed is written
+ */
+
+/**
+ * A buffered writer.
+ *
+ * Pending output is flushed when the buffer fills up, when the writer is
+ * closed or garbage collected and before the process exits, forks or execs
+ * (through {@link module:proc.exec}).
+ *
+ * @param {number} fd File descriptor to write to
+ * @param {WriterOptions} opts Options
+ *
+ * @class
+ * @hideconstructor
+ * @memberof module:io
+ */
+function Writer(fd, opts) {
+	this.fd = fd;
+	this._w = j.writer_create(
+		fd,
+		opts.size === undefined ? 65536 : opts.size,
+		!!opts.line_buffered
+	);
+}
+
+Writer.prototype = {
+	/**
+	 * Flush pending output and release the buffer. The file descriptor is not
+	 * closed.
+	 *
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	close: function () {
+		j.writer_close(this._w);
+	},
+
+	/**
+	 * Write pending output to the file descriptor
+	 *
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	flush: function () {
+		j.writer_flush(this._w);
+	},
+
+	/**
+	 * Write bytes
+	 *
+	 * @param {Uint8Array} buf Buffer containing the bytes
+	 * @param {number} [count] Number of bytes to write (all if not given)
+	 * @returns {number} The number of bytes written
+	 * @throws {SysError}
+	 */
+	write: function (buf, count) {
+		return j.writer_write(this._w, buf, count);
+	},
+
+	/**
+	 * Write a string encoded as UTF-8
+	 *
+	 * @param {string} str The string
+	 * @returns {number} The number of bytes written
+	 * @throws {SysError}
+	 */
+	write_string: function (str) {
+		return j.writer_write(this._w, String(str));
+	},
+};
+
+/**
+ * Completion of an operation queued in a {@link module:io.Uring}
+ *
+ * @typedef {object} UringCompletion
+ *
+ * @property {number} id Id of the operation (as returned when queued)
+ *
+ * @property {number} result
+ * Result of the operation (like the one of the equivalent syscall): bytes
+ * transferred for reads and writes, the file descriptor for opens, or `-1` if
+ * the operation failed.
+ *
+ * @property {number} [errno] Error number if the operation failed
+ *
+ * @property {StatBuf} [stat] File information for stat operations
+ */
+
+/**
+ * Options for operations queued in a {@link module:io.Uring}
+ *
+ * @typedef {object} UringOptions
+ *
+ * @property {boolean} [link=false]
+ * Link the operation with the next one queued, so that the next one does not
+ * start until this one completes (and is cancelled if this one fails)
+ */
+
+/**
+ * Options for {@link module:io.Uring#open} operations
+ *
+ * @typedef {object} UringOpenOptions
+ *
+ * @property {boolean} [create=false] Create the file if it does not exist
+ * @property {boolean} [truncate=false] Empty the file
+ * @property {number} [mode=0644] File mode bits if the file is created
+ *
+ * @property {boolean} [link=false]
+ * See {@link UringOptions}
+ */
+
+/**
+ * A queue of I/O operations submitted to the kernel in batches.
+ *
+ * Operations are queued with the methods of this object, which return an id
+ * for each one. They are sent to the kernel with {@link module:io.Uring#submit}
+ * (or {@link module:io.Uring#wait}) and their completions reaped with
+ * {@link module:io.Uring#wait}.
+ *
+ * Buffers given to read and write operations must not be modified until their
+ * completion has been reaped.
+ *
+ * @param {number} entries Size of the submission queue
+ * @param {boolean} fallback Whether to force the synchronous backend
+ *
+ * @class
+ * @hideconstructor
+ * @memberof module:io
+ */
+function Uring(entries, fallback) {
+	this._u = j.uring_create(entries, fallback);
+
+	/**
+	 * Whether operations are run by io_uring (`true`) or synchronously on
+	 * submit (`false`) because the kernel does not support it
+	 *
+	 * @type {boolean}
+	 */
+	this.kernel = this._u.kernel;
+}
+
+Uring.prototype = {
+	/**
+	 * Release the queues. All completions must have been reaped before calling
+	 * this.
+	 *
+	 * If the object is garbage collected instead, operations in flight are
+	 * waited for before releasing it.
+	 *
+	 * @returns {void}
+	 * @throws {SysError} `EBUSY` if there are operations not reaped yet
+	 */
+	close: function () {
+		j.uring_close(this._u);
+	},
+
+	/**
+	 * Queue the close of a file descriptor
+	 *
+	 * @param {number} fd The file descriptor
+	 * @param {UringOptions} [opts={}] Options
+	 * @returns {number} The id of the operation
+	 * @throws {SysError}
+	 */
+	close_fd: function (fd, opts) {
+		return this._prep(URING_OP_CLOSE, fd, undefined, 0, 0, 0, opts);
+	},
+
+	/**
+	 * Queue the opening of a file
+	 *
+	 * @param {string} pathname Path to file
+	 * @param {string} [access='r'] Access mode of file ('r', 'w', or 'rw')
+	 * @param {UringOpenOptions} [opts={}] Options
+	 * @returns {number} The id of the operation
+	 * @throws {SysError}
+	 */
+	open: function (pathname, access, opts) {
+		opts = opts || {};
+
+		var flags = ACCESS_FLAG[access || 'r'];
+
+		if (opts.create) {
+			flags |= O_CREAT;
+		}
+
+		if (opts.truncate) {
+			flags |= O_TRUNC;
+		}
+
+		return this._prep(
+			URING_OP_OPENAT,
+			AT_FDCWD,
+			String(pathname),
+			0,
+			opts.mode === undefined ? 0644 : opts.mode,
+			flags,
+			opts
+		);
+	},
+
+	/**
+	 * Queue a read
+	 *
+	 * @param {number} fd An open file descriptor
+	 * @param {Uint8Array} buf Buffer to fill with read bytes
+	 *
+	 * @param {number} [offset=-1]
+	 * Position of the file to read from or `-1` to use (and advance) its file
+	 * pointer
+	 *
+	 * @param {UringOptions} [opts={}] Options
+	 * @returns {number} The id of the operation
+	 * @throws {SysError}
+	 */
+	read: function (fd, buf, offset, opts) {
+		return this._prep(URING_OP_READ, fd, buf, buf.length, offset, 0, opts);
+	},
+
+	/**
+	 * Queue a stat of a file node (symbolic links are not followed)
+	 *
+	 * @param {string} pathname Path of file node
+	 * @param {UringOptions} [opts={}] Options
+	 * @returns {number} The id of the operation
+	 * @throws {SysError}
+	 */
+	stat: function (pathname, opts) {
+		return this._prep(
+			URING_OP_STATX,
+			AT_FDCWD,
+			String(pathname),
+			0,
+			0,
+			AT_SYMLINK_NOFOLLOW,
+			opts
+		);
+	},
+
+	/**
+	 * Send queued operations to the kernel without waiting for them
+	 *
+	 * @returns {number} The number of operations submitted
+	 * @throws {SysError}
+	 */
+	submit: function () {
+		return j.uring_submit(this._u);
+	},
+
+	/**
+	 * Submit queued operations and reap completions
+	 *
+	 * @param {number} [min_complete=0]
+	 * Minimum number of completions to wait for
+	 *
+	 * @returns {UringCompletion[]} Completions of finished operations
+	 * @throws {SysError}
+	 */
+	wait: function (min_complete) {
+		if (!this.kernel) {
+			this.submit();
+		}
+
+		return j.uring_wait(this._u, min_complete || 0);
+	},
+
+	/**
+	 * Queue a write
+	 *
+	 * @param {number} fd An open file descriptor
+	 * @param {Uint8Array} buf Buffer containing bytes to write
+	 *
+	 * @param {number} [offset=-1]
+	 * Position of the file to write to or `-1` to use (and advance) its file
+	 * pointer
+	 *
+	 * @param {UringOptions} [opts={}] Options
+	 * @returns {number} The id of the operation
+	 * @throws {SysError}
+	 */
+	write: function (fd, buf, offset, opts) {
+		return this._prep(URING_OP_WRITE, fd, buf, buf.length, offset, 0, opts);
+	},
+
+	/**
+	 * Queue an operation
+	 *
+	 * @private
+	 */
+	_prep: function (code, fd, data, len, offset, flags, opts) {
+		return j.uring_prep(
+			this._u,
+			code,
+			Number(fd),
+			data,
+			len,
+			offset === undefined ? -1 : Number(offset),
+			flags,
+			!!(opts && opts.link)
+		);
+	},
+};
+
 /**
  * @exports io
  * @readonly
@@ -42,6 +354,46 @@ const io = {
 	/** Unix socket (AF_UNIX) of type SOCK_STREAM */
 	AF_UNIX_STREAM: 0,
 
+	/* fcntl() commands */
+
+	/** Get file descriptor flags */
+	F_GETFD: 1,
+	/** Set file descriptor flags */
+	F_SETFD: 2,
+	/** Get file status flags */
+	F_GETFL: 3,
+	/** Set file status flags */
+	F_SETFL: 4,
+	/** Set the capacity of a pipe */
+	F_SETPIPE_SZ: 1031,
+	/** Get the capacity of a pipe */
+	F_GETPIPE_SZ: 1032,
+
+	/* File descriptor flags */
+
+	/** Close the file descriptor on exec */
+	FD_CLOEXEC: 1,
+
+	/* madvise() hints */
+
+	/** Expect page references in random order */
+	MADV_RANDOM: 1,
+	/** Expect page references in sequential order */
+	MADV_SEQUENTIAL: 2,
+	/** Expect access in the near future */
+	MADV_WILLNEED: 3,
+	/** Do not expect access in the near future */
+	MADV_DONTNEED: 4,
+
+	/* open() and pipe() flags */
+
+	/** Close the file descriptor on exec */
+	O_CLOEXEC: 02000000,
+	/** Bypass the page cache (buffers must be suitably aligned) */
+	O_DIRECT: 040000,
+	/** Don't block on reads or writes */
+	O_NONBLOCK: 04000,
+
 	/* Poll flags */
 	POLLIN: 0x1,
 	POLLPRI: 0x2,
@@ -57,6 +409,29 @@ const io = {
 	POLLREMOVE: 0x1000,
 	POLLRDHUP: 0x2000,
 
+	/* mmap() protection flags */
+
+	/** Pages may be read */
+	PROT_READ: 0x1,
+	/** Pages may be written */
+	PROT_WRITE: 0x2,
+
+	/* mmap() flags */
+
+	/** Changes are written back to the file */
+	MAP_SHARED: 0x1,
+	/** Changes are private to the mapping (copy on write) */
+	MAP_PRIVATE: 0x2,
+
+	/* splice() and tee() flags */
+
+	/** Try to move pages instead of copying them */
+	SPLICE_F_MOVE: 1,
+	/** Don't block on pipe I/O */
+	SPLICE_F_NONBLOCK: 2,
+	/** More data will be coming in a subsequent splice */
+	SPLICE_F_MORE: 4,
+
 	/* seek flags */
 
 	/** Seek from start of file */
@@ -74,6 +449,15 @@ const O_RDWR = 2;
 const O_TRUNC = 01000;
 const O_WRONLY = 1;
 
+const AT_FDCWD = -100;
+const AT_SYMLINK_NOFOLLOW = 0x100;
+
+const URING_OP_READ = 0;
+const URING_OP_WRITE = 1;
+const URING_OP_OPENAT = 2;
+const URING_OP_STATX = 3;
+const URING_OP_CLOSE = 4;
+
 const ACCESS_FLAG = {
 	r: O_RDONLY,
 	w: O_WRONLY,
@@ -126,6 +510,32 @@ io.close = function (fd, fail_if_closed) {
 	}
 };
 
+/**
+ * Copy a range of bytes from one file to another without passing them through
+ * user space. Filesystems supporting reflinks (like Btrfs or XFS) may share the
+ * data blocks instead of copying them.
+ *
+ * @param {number} fdIn File descriptor to copy from
+ *
+ * @param {number|null} offIn
+ * Offset to read from or `null` to use (and advance) the file pointer of `fdIn`
+ *
+ * @param {number} fdOut File descriptor to copy to
+ *
+ * @param {number|null} offOut
+ * Offset to write to or `null` to use (and advance) the file pointer of `fdOut`
+ *
+ * @param {number} length Maximum number of bytes to copy
+ *
+ * @returns {number}
+ * The number of bytes copied (with 0 meaning end of file)
+ *
+ * @throws {SysError}
+ */
+io.copy_file_range = function (fdIn, offIn, fdOut, offOut, length) {
+	return j.copy_file_range(fdIn, offIn, fdOut, offOut, length);
+};
+
 /**
  * Create a socket and connect it to a specific address.
  *
@@ -216,25 +626,147 @@ io.dup2 = function (openFd, changedFd) {
 	return j.dup2(Number(openFd), Number(changedFd));
 };
 
+/**
+ * Manipulate a file descriptor
+ *
+ * @example
+ * // Make a file descriptor non blocking
+ * io.fcntl(fd, io.F_SETFL, io.fcntl(fd, io.F_GETFL) | io.O_NONBLOCK);
+ *
+ * @param {number} fd An open file descriptor
+ *
+ * @param {number} cmd
+ * One of the io.F_* constants (the "See" section lists possible values)
+ *
+ * @param {number} [arg=0] Argument of the command
+ * @returns {number} The result of the command
+ * @throws {SysError}
+ * @see {@link module:io.F_GETFD}
+ * @see {@link module:io.F_SETFD}
+ * @see {@link module:io.F_GETFL}
+ * @see {@link module:io.F_SETFL}
+ * @see {@link module:io.F_SETPIPE_SZ}
+ * @see {@link module:io.F_GETPIPE_SZ}
+ */
+io.fcntl = function (fd, cmd, arg) {
+	return j.fcntl(Number(fd), Number(cmd), Number(arg || 0));
+};
+
+/**
+ * Test whether a file descriptor refers to a terminal
+ *
+ * @param {number} fd An open file descriptor
+ * @returns {boolean}
+ */
+io.isatty = function (fd) {
+	return j.isatty(fd) === 1;
+};
+
+/**
+ * Give the kernel a hint about how a memory mapping will be accessed
+ *
+ * @param {Uint8Array} buf A buffer returned by {@link module:io.mmap}
+ *
+ * @param {number} advice
+ * One of {@link module:io.MADV_RANDOM}, {@link module:io.MADV_SEQUENTIAL},
+ * {@link module:io.MADV_WILLNEED} or {@link module:io.MADV_DONTNEED}
+ *
+ * @returns {void}
+ * @throws {SysError}
+ */
+io.madvise = function (buf, advice) {
+	if (buf.length > 0) {
+		j.madvise(buf, advice);
+	}
+};
+
+/**
+ * Map a region of a file in memory.
+ *
+ * The returned buffer accesses the file contents directly, without copying
+ * them. When mapped with {@link module:io.PROT_WRITE} and
+ * {@link module:io.MAP_SHARED} changes are written back to the file (which must
+ * be open for reading and writing). With {@link module:io.MAP_PRIVATE} they
+ * are private to the mapping, so files open only for reading may be written
+ * too (but private writable mappings count against the memory available to the
+ * system, so they are not suitable for very big files).
+ *
+ * The mapping is released by {@link module:io.munmap} or when the buffer and
+ * all views derived from it (for example, with `subarray()`) are garbage
+ * collected.
+ *
+ * Note that writing to a buffer mapped without {@link module:io.PROT_WRITE}
+ * kills the process with SIGSEGV and accessing a region of the mapping that
+ * lies beyond the end of the file kills it with SIGBUS.
+ *
+ * @param {number} fd An open file descriptor
+ * @param {number} offset Offset of the region in the file
+ * @param {number} length Length of the region in bytes
+ *
+ * @param {number} [prot=io.PROT_READ]
+ * Bitwise or of {@link module:io.PROT_READ} and {@link module:io.PROT_WRITE}
+ *
+ * @param {number} [flags=io.MAP_SHARED]
+ * One of {@link module:io.MAP_SHARED} or {@link module:io.MAP_PRIVATE}
+ *
+ * @returns {Uint8Array} A buffer backed by the mapped region
+ * @throws {SysError|RangeError}
+ */
+io.mmap = function (fd, offset, length, prot, flags) {
+	if (prot === undefined) {
+		prot = io.PROT_READ;
+	}
+
+	if (flags === undefined) {
+		flags = io.MAP_SHARED;
+	}
+
+	return j.mmap(
+		Number(fd),
+		Number(offset),
+		Number(length),
+		Number(prot),
+		Number(flags)
+	);
+};
+
+/**
+ * Release a memory mapping. After this call the buffer is no longer backed by
+ * the file and reads as zeroes.
+ *
+ * @param {Uint8Array} buf A buffer returned by {@link module:io.mmap}
+ * @returns {void}
+ * @throws {SysError}
+ */
+io.munmap = function (buf) {
+	if (buf.length > 0) {
+		j.munmap(buf);
+	}
+};
+
 /**
  * Open an existing file.
  *
  * @param {string} pathname Path to file
  * @param {string} [access='rw'] Access mode ('r', 'w', or 'rw')
  *
+ * @param {number} [flags=0]
+ * Bitwise or of {@link module:io.O_CLOEXEC}, {@link module:io.O_DIRECT} and
+ * {@link module:io.O_NONBLOCK}
+ *
  * @returns {number} The file descriptor
  * @throws {SysError}
  * @see {module:io.append}
  * @see {module:io.create}
  * @see {module:io.truncate}
  */
-io.open = function (pathname, access) {
+io.open = function (pathname, access, flags) {
 	if (access === undefined) {
 		access = 'rw';
 	}
 
 	try {
-		return j.open(pathname, ACCESS_FLAG[access], 0);
+		return j.open(pathname, ACCESS_FLAG[access] | Number(flags || 0), 0);
 	} catch (err) {
 		err.message += ' (' + pathname + ')';
 		throw err;
@@ -244,15 +776,23 @@ io.open = function (pathname, access) {
 /**
  * Create a pipe
  *
+ * @param {number} [flags=0]
+ * Bitwise or of {@link module:io.O_CLOEXEC}, {@link module:io.O_DIRECT} (for
+ * packet mode) and {@link module:io.O_NONBLOCK}
+ *
  * @returns {number[]}
  * An array with two file descriptors where `[0]` item is the read end of the
  * pipe and `[1]` is the write end.
  *
  * @throws {SysError}
  */
-io.pipe = function () {
+io.pipe = function (flags) {
 	const fildes = [-1, -1];
 
+	if (flags) {
+		return j.pipe2(fildes, Number(flags)).fildes;
+	}
+
 	return j.pipe(fildes).fildes;
 };
 
@@ -288,6 +828,67 @@ io.poll = function (fds, timeout) {
 	return result.value;
 };
 
+/**
+ * Read bytes from a given position of an open file without moving its file
+ * pointer.
+ *
+ * @param {number} fd An open file desriptor
+ * @param {Uint8Array} buf Buffer to fill with read bytes
+ * @param {number} offset Position of the file to read from
+ *
+ * @param {number} [count=buf.length]
+ * Maximum number of bytes to read
+ *
+ * @returns {number}
+ * The number of bytes read (with 0 meaning end of file).
+ *
+ * @throws {SysError}
+ */
+io.pread = function (fd, buf, offset, count) {
+	if (count === undefined || count > buf.length) {
+		count = buf.length;
+	}
+
+	return j.pread(Number(fd), buf, Number(count), Number(offset));
+};
+
+/**
+ * Write bytes to a given position of an open file without moving its file
+ * pointer.
+ *
+ * @param {number} fd An open file desriptor
+ * @param {Uint8Array} buf Buffer containing bytes to write
+ * @param {number} offset Position of the file to write to
+ *
+ * @param {number} [count=-1]
+ * Maximum number of bytes to write or -1 to keep writing until all buffer has
+ * been written.
+ *
+ * @returns {number} The number of bytes written
+ * @throws {SysError}
+ */
+io.pwrite = function (fd, buf, offset, count) {
+	fd = Number(fd);
+	offset = Number(offset);
+
+	if (count !== undefined && count !== -1) {
+		return j.pwrite(fd, buf, Math.min(Number(count), buf.length), offset);
+	}
+
+	var bwritten = 0;
+
+	while (bwritten < buf.length) {
+		bwritten += j.pwrite(
+			fd,
+			buf.subarray(bwritten),
+			buf.length - bwritten,
+			offset + bwritten
+		);
+	}
+
+	return bwritten;
+};
+
 /**
  * Read bytes from an open file
  *
@@ -350,6 +951,20 @@ io.read = function (fd, buf, count) {
 	}
 };
 
+/**
+ * Read contents of a fd until it is exhausted and return them as an Uint8Array.
+ *
+ * Regular files are read into a buffer sized after the file with a single
+ * allocation. Other files (like pipes) are read into a growing buffer.
+ *
+ * @param {number} fd An open file desriptor
+ * @returns {Uint8Array} The bytes contained by the file
+ * @throws {SysError}
+ */
+io.read_all = function (fd) {
+	return j.read_all(Number(fd));
+};
+
 /**
  * Read as many bytes as possible from an open file up to a maximum of buffer
  * size.
@@ -372,45 +987,35 @@ io.read_available = function (fd, buf) {
  * @param {number} fd An open file desriptor
  * @returns {Uint8Array} The bytes contained by the file
  * @throws {SysError}
+ * @see {module:io.read_all}
  */
 io.read_fully = function (fd) {
-	const buf = new Uint8Array(4096);
-
-	var bytes = new Uint8Array(buf.length);
-	var count = 0;
-
-	while (true) {
-		const bread = io.read(fd, buf);
-
-		if (bytes.length < count + bread) {
-			const new_bytes =
-				count > 0x100000
-					? new Uint8Array(count + 0x100000)
-					: new Uint8Array(count * 2);
-
-			new_bytes.set(bytes);
-
-			bytes = new_bytes;
-		}
-
-		bytes.set(buf, count);
-
-		count += bread;
+	return io.read_all(fd);
+};
 
-		if (bread < buf.length) {
-			break;
+/**
+ * Read as many bytes as available from a non blocking file descriptor, up to a
+ * maximum of buffer size.
+ *
+ * @param {number} fd An open file desriptor with {@link module:io.O_NONBLOCK}
+ * @param {Uint8Array} buf Buffer to fill with read bytes
+ *
+ * @returns {number|null}
+ * The number of bytes read (with 0 meaning end of file) or `null` if no data is
+ * available yet.
+ *
+ * @throws {SysError}
+ */
+io.read_nonblock = function (fd, buf) {
+	try {
+		return j.read(Number(fd), buf, buf.length);
+	} catch (err) {
+		if (err.errno === errno.EAGAIN) {
+			return null;
 		}
-	}
 
-	if (bytes.length !== count) {
-		const new_bytes = new Uint8Array(count);
-
-		new_bytes.set(bytes.subarray(0, count));
-
-		bytes = new_bytes;
+		throw err;
 	}
-
-	return bytes;
 };
 
 /**
@@ -426,6 +1031,115 @@ io.read_string = function (fd) {
 	return decoder.decode(io.read_fully(fd));
 };
 
+/**
+ * Read bytes from an open file into several buffers with a single syscall.
+ *
+ * Buffers are filled in order, and each one is completely filled before going
+ * on with the next.
+ *
+ * @param {number} fd An open file desriptor
+ * @param {Uint8Array[]} bufs Buffers to fill with read bytes
+ *
+ * @returns {number}
+ * The total number of bytes read (with 0 meaning end of file).
+ *
+ * @throws {SysError}
+ */
+io.readv = function (fd, bufs) {
+	return j.readv(Number(fd), bufs);
+};
+
+/**
+ * Receive file descriptors sent by {@link module:io.send_fds} over an AF_UNIX
+ * socket.
+ *
+ * The received descriptors are new descriptors of this process (referring to
+ * the same open files as the sender's) and have the close-on-exec flag set.
+ *
+ * @example
+ * // Worker side of a pre-forked server
+ * const msg = io.recv_fds(channel);
+ * const conn = msg.fds[0];
+ *
+ * @param {number} sock An AF_UNIX socket
+ *
+ * @param {Uint8Array|Uint8Array[]} [buf]
+ * Buffer(s) to receive the data sent along with the descriptors (by default a
+ * one byte buffer, enough for messages sent without data)
+ *
+ * @param {number} [max_fds=16] Maximum number of descriptors to receive
+ *
+ * @returns {{count: number, fds: number[], truncated: boolean}}
+ * The number of data bytes received (with 0 meaning end of stream), the received
+ * descriptors and whether some descriptors were discarded because there were
+ * more than `max_fds`.
+ *
+ * @throws {SysError}
+ */
+io.recv_fds = function (sock, buf, max_fds) {
+	if (buf === undefined) {
+		buf = new Uint8Array(1);
+	}
+
+	return j.socket_recv_fds(
+		Number(sock),
+		buf,
+		max_fds === undefined ? 16 : Number(max_fds)
+	);
+};
+
+/**
+ * Send file descriptors to another process over an AF_UNIX socket (as
+ * SCM_RIGHTS ancillary data).
+ *
+ * This lets, for example, an accepting process hand connections over to a pool
+ * of pre-forked workers that share a socket pair with it. The descriptors stay
+ * open in the sending process, which usually closes them after sending.
+ *
+ * @example
+ * const conn = socket.accept(server);
+ * io.send_fds(channel, [conn.fd]);
+ * io.close(conn.fd);
+ *
+ * @param {number} sock A connected AF_UNIX socket
+ * @param {number[]} fds The file descriptors to send (at most 253)
+ *
+ * @param {Uint8Array|Uint8Array[]} [data]
+ * Bytes to send along with the descriptors (by default a single zero byte, as
+ * at least one byte must be sent)
+ *
+ * @returns {number} The number of data bytes sent
+ * @throws {SysError}
+ * @see {module:io.recv_fds}
+ */
+io.send_fds = function (sock, fds, data) {
+	if (data === undefined) {
+		data = new Uint8Array(1);
+	}
+
+	return j.socket_send_fds(Number(sock), fds.map(Number), data);
+};
+
+/**
+ * Copy bytes from a file descriptor to another inside the kernel
+ *
+ * @param {number} fdOut File descriptor to write to
+ * @param {number} fdIn File descriptor to read from (must support mmap)
+ *
+ * @param {number|null} offset
+ * Offset to read from or `null` to use (and advance) the file pointer of `fdIn`
+ *
+ * @param {number} count Maximum number of bytes to copy
+ *
+ * @returns {number}
+ * The number of bytes copied (with 0 meaning end of file)
+ *
+ * @throws {SysError}
+ */
+io.sendfile = function (fdOut, fdIn, offset, count) {
+	return j.sendfile(fdOut, fdIn, offset, count);
+};
+
 /**
  * Set the pointer of a file descriptor to a given value
  *
@@ -443,6 +1157,55 @@ io.seek = function (fd, offset, whence) {
 	return j.lseek(fd, offset, whence);
 };
 
+/**
+ * Move bytes between a pipe and another file descriptor without passing them
+ * through user space. At least one of the file descriptors must be a pipe.
+ *
+ * @param {number} fdIn File descriptor to read from
+ *
+ * @param {number|null} offIn
+ * Offset to read from or `null` to use the file pointer of `fdIn` (must be
+ * `null` for pipes)
+ *
+ * @param {number} fdOut File descriptor to write to
+ *
+ * @param {number|null} offOut
+ * Offset to write to or `null` to use the file pointer of `fdOut` (must be
+ * `null` for pipes)
+ *
+ * @param {number} length Maximum number of bytes to move
+ *
+ * @param {number} [flags=0]
+ * Bitwise or of {@link module:io.SPLICE_F_MOVE},
+ * {@link module:io.SPLICE_F_NONBLOCK} and {@link module:io.SPLICE_F_MORE}
+ *
+ * @returns {number}
+ * The number of bytes moved (with 0 meaning end of input)
+ *
+ * @throws {SysError}
+ */
+io.splice = function (fdIn, offIn, fdOut, offOut, length, flags) {
+	return j.splice(fdIn, offIn, fdOut, offOut, length, flags || 0);
+};
+
+/**
+ * Duplicate bytes from a pipe to another pipe without consuming them, so that
+ * they can still be read (or spliced) from `fdIn`.
+ *
+ * @param {number} fdIn Pipe to read from
+ * @param {number} fdOut Pipe to write to
+ * @param {number} length Maximum number of bytes to duplicate
+ *
+ * @param {number} [flags=0]
+ * See {@link module:io.splice}
+ *
+ * @returns {number} The number of bytes duplicated
+ * @throws {SysError}
+ */
+io.tee = function (fdIn, fdOut, length, flags) {
+	return j.tee(fdIn, fdOut, length, flags || 0);
+};
+
 /**
  * Retrieve the current offset of the file pointer from the start of the file.
  *
@@ -488,6 +1251,34 @@ io.truncate = function (pathname, mode, access) {
 	return j.open(pathname, O_CREAT | O_TRUNC | ACCESS_FLAG[access], mode);
 };
 
+/**
+ * Create an io_uring to batch I/O operations.
+ *
+ * If the kernel does not support io_uring, a synchronous backend running the
+ * operations on submit is used instead.
+ *
+ * @example
+ * // Stat lots of files with a single syscall
+ * const ring = io.uring(paths.length);
+ *
+ * paths.forEach(function (path) {
+ *   ring.stat(path);
+ * });
+ *
+ * const completions = ring.wait(paths.length);
+ *
+ * @param {number} [entries=64] Size of the submission queue
+ *
+ * @param {object} [opts={}] Options
+ * @param {boolean} [opts.fallback=false] Force the synchronous backend
+ *
+ * @returns {module:io.Uring}
+ * @throws {SysError}
+ */
+io.uring = function (entries, opts) {
+	return new Uring(entries || 64, !!(opts && opts.fallback));
+};
+
 /**
  * Write bytes to an open file
  *
@@ -535,6 +1326,29 @@ io.write = function (fd, buf, count) {
 	}
 };
 
+/**
+ * Write as many bytes as possible to a non blocking file descriptor
+ *
+ * @param {number} fd An open file desriptor with {@link module:io.O_NONBLOCK}
+ * @param {Uint8Array} buf Buffer containing bytes to write
+ *
+ * @returns {number|null}
+ * The number of bytes written or `null` if the file cannot accept data yet.
+ *
+ * @throws {SysError}
+ */
+io.write_nonblock = function (fd, buf) {
+	try {
+		return j.write(Number(fd), buf, buf.length);
+	} catch (err) {
+		if (err.errno === errno.EAGAIN) {
+			return null;
+		}
+
+		throw err;
+	}
+};
+
 /**
  * Write a string as UTF-8 bytes to an open file
  *
@@ -550,4 +1364,32 @@ io.write_string = function (fd, str) {
 	return io.write(fd, encoder.encode(str.toString()));
 };
 
+/**
+ * Write the contents of several buffers to an open file with a single syscall.
+ *
+ * @param {number} fd An open file desriptor
+ * @param {Uint8Array[]} bufs Buffers containing bytes to write
+ *
+ * @returns {number}
+ * The total number of bytes written (which may be less than the sum of the
+ * lengths of the buffers)
+ *
+ * @throws {SysError}
+ */
+io.writev = function (fd, bufs) {
+	return j.writev(Number(fd), bufs);
+};
+
+/**
+ * Create a buffered writer to save syscalls when doing lots of small writes
+ *
+ * @param {number} fd An open file descriptor
+ * @param {WriterOptions} [opts={}] Options
+ * @returns {module:io.Writer}
+ * @throws {SysError}
+ */
+io.writer = function (fd, opts) {
+	return new Writer(fd, opts || {});
+};
+
 return io;
@@ -19,6 +19,9 @@ kern.printk = j.printk;
 /**
  * Array of dirs to search for modules
  *
+ * Modules found (or not found) in these dirs are cached until the array
+ * contents change.
+ *
  * @type {string[]}
  */
 kern.search_path = [];
@@ -0,0 +1,260 @@
+/**
+ * An event loop which watches file descriptors and timers.
+ *
+ * Registrations are persistent: they are added to the kernel once and stay
+ * there until removed, so the cost of each iteration depends on the number of
+ * descriptors which are ready, not on the number of descriptors watched.
+ *
+ * Callbacks are invoked from inside {@link module:loop.Loop#run} or
+ * {@link module:loop.Loop#run_once}.
+ *
+ * @param {number} epfd The epoll file descriptor
+ *
+ * @class
+ * @hideconstructor
+ * @memberof module:loop
+ */
+function Loop(epfd) {
+	this._epfd = epfd;
+	this._callbacks = {};
+	this._registrations = {};
+	this._count = 0;
+	this._next_id = 1;
+	this._stopped = false;
+}
+
+Loop.prototype = {
+	/**
+	 * Watch a file descriptor
+	 *
+	 * @param {number} fd File descriptor
+	 *
+	 * @param {number} events
+	 * Events to watch (a combination of {@link module:loop.READ},
+	 * {@link module:loop.WRITE} and {@link module:loop.EDGE})
+	 *
+	 * @param {module:loop.WatchCallback} callback
+	 * Function called when the descriptor is ready
+	 *
+	 * @returns {number} The id of the registration
+	 * @throws {SysError}
+	 */
+	add: function (fd, events, callback) {
+		const id = this._next_id++;
+
+		j.loop_add(this._epfd, fd, events, id);
+
+		this._register(id, fd, false, callback);
+
+		return id;
+	},
+
+	/**
+	 * Stop the loop and close it, releasing all its registrations.
+	 *
+	 * Watched descriptors are not closed.
+	 *
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	close: function () {
+		for (var id in this._registrations) {
+			const reg = this._registrations[id];
+
+			if (reg.timer) {
+				j.close(reg.fd);
+			}
+		}
+
+		this._callbacks = {};
+		this._registrations = {};
+		this._count = 0;
+		this._stopped = true;
+
+		j.close(this._epfd);
+	},
+
+	/**
+	 * Change the events watched by a registration
+	 *
+	 * @param {number} id Id of the registration
+	 * @param {number} events See {@link module:loop.Loop#add}
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	modify: function (id, events) {
+		const reg = this._registrations[id];
+
+		if (!reg || reg.timer) {
+			throw new Error('Invalid watch id: ' + id);
+		}
+
+		j.loop_modify(this._epfd, reg.fd, events, id);
+	},
+
+	/**
+	 * Remove a registration (watch or timer).
+	 *
+	 * Removing an unknown (or already removed) registration does nothing.
+	 *
+	 * @param {number} id Id of the registration
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	remove: function (id) {
+		const reg = this._registrations[id];
+
+		if (!reg) {
+			return;
+		}
+
+		delete this._callbacks[id];
+		delete this._registrations[id];
+		this._count--;
+
+		if (reg.timer) {
+			// Closing the timer also removes it from the epoll set
+			j.close(reg.fd);
+		} else {
+			j.loop_remove(this._epfd, reg.fd);
+		}
+	},
+
+	/**
+	 * Run the loop until there are no registrations left or
+	 * {@link module:loop.Loop#stop} is called.
+	 *
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	run: function () {
+		this._stopped = false;
+
+		while (this._count > 0 && !this._stopped) {
+			j.loop_wait(this._epfd, this._callbacks, -1);
+		}
+	},
+
+	/**
+	 * Wait for events once and dispatch them
+	 *
+	 * @param {number} [timeout]
+	 * Maximum time to wait in milliseconds (wait forever if not given)
+	 *
+	 * @returns {number} The number of events dispatched
+	 * @throws {SysError}
+	 */
+	run_once: function (timeout) {
+		return j.loop_wait(
+			this._epfd,
+			this._callbacks,
+			timeout === undefined ? -1 : timeout
+		);
+	},
+
+	/**
+	 * Call a function repeatedly
+	 *
+	 * @param {number} ms Interval in milliseconds
+	 * @param {module:loop.TimerCallback} callback
+	 * @returns {number} The id of the registration
+	 * @throws {SysError}
+	 */
+	set_interval: function (ms, callback) {
+		return this._timer(ms, ms, callback);
+	},
+
+	/**
+	 * Call a function once after some time
+	 *
+	 * @param {number} ms Delay in milliseconds
+	 * @param {module:loop.TimerCallback} callback
+	 * @returns {number} The id of the registration
+	 * @throws {SysError}
+	 */
+	set_timeout: function (ms, callback) {
+		const self = this;
+		const id = this._timer(ms, 0, function (expirations) {
+			self.remove(id);
+			callback(expirations);
+		});
+
+		return id;
+	},
+
+	/**
+	 * Make {@link module:loop.Loop#run} return after the current batch of
+	 * events has been dispatched.
+	 *
+	 * @returns {void}
+	 */
+	stop: function () {
+		this._stopped = true;
+	},
+
+	_register: function (id, fd, timer, callback) {
+		this._callbacks[id] = callback;
+		this._registrations[id] = { fd: fd, timer: timer };
+		this._count++;
+	},
+
+	_timer: function (initial, interval, callback) {
+		const id = this._next_id++;
+		const tfd = j.loop_timer(this._epfd, initial, interval, id);
+
+		this._register(id, tfd, true, callback);
+
+		return id;
+	},
+};
+
+/**
+ * @exports loop
+ */
+const loop = {};
+
+/**
+ * Callback for file descriptor watches
+ *
+ * @callback module:loop.WatchCallback
+ * @param {number} fd The file descriptor
+ * @param {number} events The events which are ready
+ * @returns {void}
+ */
+
+/**
+ * Callback for timers
+ *
+ * @callback module:loop.TimerCallback
+ * @param {number} expirations
+ * Number of times the timer expired since the last call
+ *
+ * @returns {void}
+ */
+
+/** Descriptor is readable */
+loop.READ = 0x1;
+
+/** Descriptor is writable */
+loop.WRITE = 0x4;
+
+/** Error condition (always reported) */
+loop.ERROR = 0x8;
+
+/** Hang up (always reported) */
+loop.HANGUP = 0x10;
+
+/** Edge triggered notification */
+loop.EDGE = 0x80000000;
+
+/**
+ * Create an event loop
+ *
+ * @returns {module:loop.Loop}
+ * @throws {SysError}
+ */
+loop.create = function () {
+	return new Loop(j.loop_create());
+};
+
+return loop;
@@ -1,3 +1,19 @@
+/**
+ * Allocation statistics of the JavaScript heap
+ *
+ * @typedef {object} AllocStats
+ * @property {string} allocator
+ * Name of the allocator in use (`malloc`, `slab` or `arena`), as selected with
+ * the `JOSHI_ALLOC` environment variable
+ *
+ * @property {number} allocs Number of allocations
+ * @property {number} reallocs Number of reallocations
+ * @property {number} frees Number of deallocations
+ * @property {number} live_bytes Bytes currently allocated
+ * @property {number} peak_bytes Maximum value reached by `live_bytes`
+ * @property {number} reserved_bytes Bytes currently requested to the system
+ */
+
 /**
  * @exports perf
  */
@@ -56,6 +72,53 @@ PerfData.prototype = {
 	},
 };
 
+/**
+ * Get allocation statistics of the JavaScript heap
+ *
+ * @returns {AllocStats}
+ */
+perf.alloc_stats = function () {
+	return j.alloc_stats();
+};
+
+/**
+ * Start the sampling profiler.
+ *
+ * The profiler periodically samples the JavaScript call stack while the
+ * process is using CPU. Samples are returned by {@link module:perf.profile_stop}.
+ *
+ * The profiler can also be enabled for a whole script run by setting the
+ * `JOSHI_PROF` environment variable to the path of the output file (and,
+ * optionally, `JOSHI_PROF_HZ` to the sampling frequency). In that case this
+ * function cannot be used.
+ *
+ * Only one thread can be profiled at a time: trying to start the profiler in a
+ * worker while another thread is being profiled fails with `EBUSY`.
+ *
+ * @param {number} [hz=1000] Sampling frequency
+ * @returns {void}
+ * @throws {SysError}
+ */
+perf.profile_start = function (hz) {
+	j.profile_start(hz);
+};
+
+/**
+ * Stop the sampling profiler and return the collected samples as folded stacks
+ * (one line per distinct stack, with frames separated by `;` and followed by
+ * the number of samples), suitable for `flamegraph.pl` and similar tools.
+ *
+ * Note that time spent in native functions is only attributed to them when it
+ * is accounted before they return, which may not be precise for short calls.
+ *
+ * @returns {string}
+ */
+perf.profile_stop = function () {
+	const lines = j.profile_stop();
+
+	return lines.length ? lines.join('\n') + '\n' : '';
+};
+
 /**
  * Start a performance data collection with a resolution of milliseconds.
  *
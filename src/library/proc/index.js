@@ -15,6 +15,18 @@ const io = require('io');
  * @private
  */
 
+/**
+ * A signal handler
+ *
+ * @callback module:proc.SignalHandler
+ * @param {number} sig The signal number
+ *
+ * @param {number} count
+ * Number of times the signal was received since the handler was last called
+ *
+ * @returns {void}
+ */
+
 /**
  * Process execution options.
  *
@@ -243,6 +255,9 @@ proc.exec = function (executable, args, opts) {
 		});
 	}
 
+	// Buffered output would be lost otherwise
+	j.writer_flush_all();
+
 	try {
 		if (opts.search_path !== false) {
 			j.execvp(executable, argv);
@@ -539,6 +554,9 @@ proc.getuid = function () {
  * are still performed; this can be used to check for the existence of a process
  * ID or process group ID that the caller is permitted to signal.
  *
+ * If the signal is sent to the calling process, its handler (if any) is called
+ * before returning.
+ *
  * @returns {0}
  * @throws {SysError}
  */
@@ -547,7 +565,11 @@ proc.kill = function (pid, sig) {
 		sig = proc.SIGKILL;
 	}
 
-	return j.kill(pid, sig);
+	const result = j.kill(pid, sig);
+
+	j.signal_dispatch();
+
+	return result;
 };
 
 /**
@@ -602,7 +624,7 @@ proc.setsid = function () {
  *
  * @param {number} sig The signal number
  *
- * @param {undefined|null|function} func
+ * @param {undefined|null|module:proc.SignalHandler} func
  * If the value of `func` is `undefined`, default handling for that signal shall
  * occur.
  *
@@ -611,6 +633,15 @@ proc.setsid = function () {
  * Otherwise, the application shall ensure that `func` points to a function to
  * be called when that signal occurs.
  *
+ * Handlers are not called from inside the real (asynchronous) signal handler
+ * but deferred to a safe point: the next call to a native function, the wake
+ * up of a {@link module:loop.Loop} or a call to
+ * {@link module:proc.signal_dispatch}. A signal arriving several times before
+ * that results in a single call. Blocking calls interrupted by a signal with a
+ * handler are restarted after calling it.
+ *
+ * Handlers are only called in the main thread (never in workers).
+ *
  * @returns {void}
  * @throws SysError
  */
@@ -618,6 +649,31 @@ proc.signal = function (sig, func) {
 	j.signal(sig, func);
 };
 
+/**
+ * Run pending signal handlers now (see {@link module:proc.signal}).
+ *
+ * This is only needed to run them without calling other native functions, for
+ * example after waiting on {@link module:proc.signal_fd} with
+ * {@link module:io.poll}.
+ *
+ * @returns {number} The number of handlers called
+ */
+proc.signal_dispatch = function () {
+	return j.signal_dispatch();
+};
+
+/**
+ * Get a file descriptor which becomes readable when there are pending signal
+ * handlers, so that it can be waited for with {@link module:io.poll}.
+ *
+ * The descriptor must not be read or closed.
+ *
+ * @returns {number} The descriptor or `-1` when called from a worker
+ */
+proc.signal_fd = function () {
+	return j.signal_fd();
+};
+
 /**
  * Pause execution of the running process for a given number of seconds.
  *
@@ -5,6 +5,9 @@ const term = require('term');
 const println = term.println;
 const println2 = term.println2;
 
+// Capacity of pipes connecting Procs
+const PIPE_SIZE = 1024 * 1024;
+
 /**
  * Interface for generic objects implementing redirections (other than Proc).
  *
@@ -418,7 +421,16 @@ Proc.prototype = {
 						);
 					}
 
-					const pipe = io.pipe();
+					// Close on exec so that pipes don't leak to other children
+					const pipe = io.pipe(io.O_CLOEXEC);
+
+					// Bigger pipes mean less context switches in pipelines
+					// (may fail if over /proc/sys/fs/pipe-max-size)
+					try {
+						io.fcntl(pipe[1], io.F_SETPIPE_SZ, PIPE_SIZE);
+					} catch (err) {
+						// ignore
+					}
 
 					this._redir[fd] = pipe[1];
 					openFds.push(this._redir[fd]);
@@ -0,0 +1,363 @@
+/**
+ * A socket address.
+ *
+ * For AF_UNIX sockets it has a `path` property, while for AF_INET and AF_INET6
+ * sockets it has a numeric `host` and a `port` (the family is inferred from the
+ * host). A string may be given instead of an object for AF_UNIX addresses.
+ *
+ * @typedef {object|string} SocketAddress
+ *
+ * @property {string} [path] Socket path (AF_UNIX)
+ * @property {string} [host] IPv4 or IPv6 address (AF_INET/AF_INET6)
+ * @property {number} [port] Port number (AF_INET/AF_INET6)
+ */
+
+/**
+ * A message to send with {@link module:socket.sendmmsg}
+ *
+ * @typedef {object} SocketMessage
+ *
+ * @property {Uint8Array|Uint8Array[]} data Bytes to send
+ *
+ * @property {SocketAddress} [address]
+ * Destination address (for unconnected datagram sockets)
+ */
+
+/**
+ * A message received with {@link module:socket.recvmsg} or
+ * {@link module:socket.recvmmsg}
+ *
+ * @typedef {object} SocketReceived
+ *
+ * @property {number} count Number of bytes received
+ *
+ * @property {SocketAddress} [address]
+ * Source address (for datagram sockets)
+ *
+ * @property {number} flags
+ * Message flags (like {@link module:socket.MSG_TRUNC})
+ */
+
+/**
+ * @exports socket
+ * @readonly
+ * @enum {number}
+ */
+const socket = {
+	/* Address families */
+
+	/** Local communication */
+	AF_UNIX: 1,
+	/** IPv4 */
+	AF_INET: 2,
+	/** IPv6 */
+	AF_INET6: 10,
+
+	/* Socket types */
+
+	/** Connection oriented byte streams */
+	SOCK_STREAM: 1,
+	/** Connectionless datagrams */
+	SOCK_DGRAM: 2,
+
+	/* Socket flags */
+
+	/** Open the socket in non blocking mode */
+	SOCK_NONBLOCK: 04000,
+	/** Close the socket on exec */
+	SOCK_CLOEXEC: 02000000,
+
+	/* Option levels */
+
+	/** Socket level options */
+	SOL_SOCKET: 1,
+	/** TCP level options */
+	IPPROTO_TCP: 6,
+
+	/* Socket level options */
+
+	/** Allow reuse of local addresses */
+	SO_REUSEADDR: 2,
+	/** Size of the send buffer */
+	SO_SNDBUF: 7,
+	/** Size of the receive buffer */
+	SO_RCVBUF: 8,
+	/** Send keep alive probes */
+	SO_KEEPALIVE: 9,
+	/** Allow several sockets to bind the same port (load balancing them) */
+	SO_REUSEPORT: 15,
+
+	/* TCP level options */
+
+	/** Disable the Nagle algorithm */
+	TCP_NODELAY: 1,
+
+	/* Shutdown modes */
+
+	/** Disallow further receptions */
+	SHUT_RD: 0,
+	/** Disallow further transmissions */
+	SHUT_WR: 1,
+	/** Disallow further receptions and transmissions */
+	SHUT_RDWR: 2,
+
+	/* Message flags */
+
+	/** Return data without removing it from the queue */
+	MSG_PEEK: 0x2,
+	/** The datagram was bigger than the buffer */
+	MSG_TRUNC: 0x20,
+	/** Don't block */
+	MSG_DONTWAIT: 0x40,
+	/** Wait for the full request to be satisfied */
+	MSG_WAITALL: 0x100,
+	/** Don't raise SIGPIPE on broken stream sockets */
+	MSG_NOSIGNAL: 0x4000,
+	/** Block until at least one message is received (recvmmsg) */
+	MSG_WAITFORONE: 0x10000,
+};
+
+/**
+ * Accept a connection on a listening socket
+ *
+ * @param {number} fd A listening socket
+ *
+ * @param {number} [flags=socket.SOCK_CLOEXEC]
+ * Flags for the new socket ({@link module:socket.SOCK_NONBLOCK} and
+ * {@link module:socket.SOCK_CLOEXEC})
+ *
+ * @returns {{fd: number, address: SocketAddress}}
+ * The connected socket and the address of the peer
+ *
+ * @throws {SysError}
+ */
+socket.accept = function (fd, flags) {
+	if (flags === undefined) {
+		flags = socket.SOCK_CLOEXEC;
+	}
+
+	return j.socket_accept(Number(fd), Number(flags));
+};
+
+/**
+ * Bind a socket to an address
+ *
+ * @param {number} fd A socket
+ * @param {SocketAddress} address The address
+ * @returns {void}
+ * @throws {SysError}
+ */
+socket.bind = function (fd, address) {
+	j.socket_bind(Number(fd), address);
+};
+
+/**
+ * Connect a socket to an address
+ *
+ * @param {number} fd A socket
+ * @param {SocketAddress} address The address
+ * @returns {void}
+ * @throws {SysError}
+ */
+socket.connect = function (fd, address) {
+	j.socket_connect(Number(fd), address);
+};
+
+/**
+ * Create a socket
+ *
+ * @param {number} domain One of the socket.AF_* constants
+ * @param {number} type One of the socket.SOCK_* types
+ *
+ * @param {number} [flags=socket.SOCK_CLOEXEC]
+ * Bitwise or of {@link module:socket.SOCK_NONBLOCK} and
+ * {@link module:socket.SOCK_CLOEXEC}
+ *
+ * @returns {number} The socket's file descriptor
+ * @throws {SysError}
+ */
+socket.create = function (domain, type, flags) {
+	if (flags === undefined) {
+		flags = socket.SOCK_CLOEXEC;
+	}
+
+	return j.socket(Number(domain), Number(type) | Number(flags), 0);
+};
+
+/**
+ * Get the address a socket is bound to (useful to get the port assigned by the
+ * kernel when binding to port 0).
+ *
+ * @param {number} fd A socket
+ * @returns {SocketAddress} The address
+ * @throws {SysError}
+ */
+socket.getsockname = function (fd) {
+	return j.socket_getsockname(Number(fd));
+};
+
+/**
+ * Get the value of an integer socket option
+ *
+ * @param {number} fd A socket
+ * @param {number} level Option level (like {@link module:socket.SOL_SOCKET})
+ * @param {number} name Option name (like {@link module:socket.SO_RCVBUF})
+ * @returns {number} The value of the option
+ * @throws {SysError}
+ */
+socket.getsockopt = function (fd, level, name) {
+	return j.socket_getsockopt(Number(fd), Number(level), Number(name));
+};
+
+/**
+ * Mark a socket as accepting connections
+ *
+ * @param {number} fd A bound socket
+ * @param {number} [backlog=128] Maximum length of the pending connections queue
+ * @returns {void}
+ * @throws {SysError}
+ */
+socket.listen = function (fd, backlog) {
+	j.listen(Number(fd), backlog === undefined ? 128 : Number(backlog));
+};
+
+/**
+ * Receive several messages with a single syscall
+ *
+ * @param {number} fd A socket
+ *
+ * @param {Array<Uint8Array|Uint8Array[]>} bufs
+ * Buffers to receive the messages (one item per message)
+ *
+ * @param {number} [flags=socket.MSG_WAITFORONE]
+ * Bitwise or of the socket.MSG_* flags
+ *
+ * @returns {SocketReceived[]} One item per received message
+ * @throws {SysError}
+ */
+socket.recvmmsg = function (fd, bufs, flags) {
+	if (flags === undefined) {
+		flags = socket.MSG_WAITFORONE;
+	}
+
+	return j.socket_recvmmsg(Number(fd), bufs, Number(flags));
+};
+
+/**
+ * Receive a message
+ *
+ * @param {number} fd A socket
+ * @param {Uint8Array|Uint8Array[]} bufs Buffer(s) to receive the message
+ * @param {number} [flags=0] Bitwise or of the socket.MSG_* flags
+ *
+ * @returns {SocketReceived}
+ * The received message (with a count of 0 meaning end of stream)
+ *
+ * @throws {SysError}
+ */
+socket.recvmsg = function (fd, bufs, flags) {
+	return j.socket_recvmsg(Number(fd), bufs, Number(flags || 0));
+};
+
+/**
+ * Send several messages with a single syscall
+ *
+ * @param {number} fd A socket
+ * @param {SocketMessage[]} msgs The messages
+ * @param {number} [flags=0] Bitwise or of the socket.MSG_* flags
+ * @returns {number} The number of messages sent
+ * @throws {SysError}
+ */
+socket.sendmmsg = function (fd, msgs, flags) {
+	return j.socket_sendmmsg(Number(fd), msgs, Number(flags || 0));
+};
+
+/**
+ * Send a message
+ *
+ * @param {number} fd A socket
+ * @param {Uint8Array|Uint8Array[]} data Bytes to send
+ *
+ * @param {SocketAddress} [address]
+ * Destination address (for unconnected datagram sockets)
+ *
+ * @param {number} [flags=0] Bitwise or of the socket.MSG_* flags
+ * @returns {number} The number of bytes sent
+ * @throws {SysError}
+ */
+socket.sendmsg = function (fd, data, address, flags) {
+	return j.socket_sendmsg(Number(fd), data, address, Number(flags || 0));
+};
+
+/**
+ * Set the value of an integer socket option
+ *
+ * @example
+ * // Let several processes accept connections on the same port
+ * socket.setsockopt(fd, socket.SOL_SOCKET, socket.SO_REUSEPORT, 1);
+ *
+ * @param {number} fd A socket
+ * @param {number} level Option level (like {@link module:socket.SOL_SOCKET})
+ * @param {number} name Option name (like {@link module:socket.SO_REUSEPORT})
+ * @param {number|boolean} value The value of the option
+ * @returns {void}
+ * @throws {SysError}
+ */
+socket.setsockopt = function (fd, level, name, value) {
+	j.socket_setsockopt(Number(fd), Number(level), Number(name), Number(value));
+};
+
+/**
+ * Shut down part of a full duplex connection
+ *
+ * @param {number} fd A connected socket
+ *
+ * @param {number} [how=socket.SHUT_RDWR]
+ * One of {@link module:socket.SHUT_RD}, {@link module:socket.SHUT_WR} or
+ * {@link module:socket.SHUT_RDWR}
+ *
+ * @returns {void}
+ * @throws {SysError}
+ */
+socket.shutdown = function (fd, how) {
+	j.shutdown(Number(fd), how === undefined ? socket.SHUT_RDWR : Number(how));
+};
+
+/**
+ * Create a pair of connected sockets.
+ *
+ * An AF_UNIX pair is a convenient channel between a parent and its forked
+ * children, able to carry file descriptors with {@link module:io.send_fds}.
+ *
+ * @param {number} [domain=socket.AF_UNIX] One of the socket.AF_* constants
+ * @param {number} [type=socket.SOCK_STREAM] One of the socket.SOCK_* types
+ *
+ * @param {number} [flags=socket.SOCK_CLOEXEC]
+ * Bitwise or of {@link module:socket.SOCK_NONBLOCK} and
+ * {@link module:socket.SOCK_CLOEXEC}
+ *
+ * @returns {number[]} The two connected sockets
+ * @throws {SysError}
+ */
+socket.socketpair = function (domain, type, flags) {
+	if (domain === undefined) {
+		domain = socket.AF_UNIX;
+	}
+
+	if (type === undefined) {
+		type = socket.SOCK_STREAM;
+	}
+
+	if (flags === undefined) {
+		flags = socket.SOCK_CLOEXEC;
+	}
+
+	return j.socketpair(
+		Number(domain),
+		Number(type) | Number(flags),
+		0,
+		[-1, -1]
+	).sv;
+};
+
+return socket;
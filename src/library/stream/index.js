@@ -7,6 +7,13 @@ const decoder = new TextDecoder();
  */
 const stream = {};
 
+/**
+ * Default size of stream buffers
+ *
+ * @private
+ */
+const DEFAULT_BUFFER_SIZE = 64 * 1024;
+
 /**
  * Create an stream from a file descriptor.
  *
@@ -17,13 +24,19 @@ const stream = {};
  * descriptor or you may get into trouble because reads may look incoherent.
  *
  * @param {number} fd A valid file descriptor
+ *
+ * @param {number} [buffer_size]
+ * Initial size of the read buffer (64 KiB by default). The buffer grows when
+ * a record doesn't fit in it.
+ *
  * @returns {object} An opaque stream descriptor
  */
-stream.create = function (fd) {
+stream.create = function (fd, buffer_size) {
 	return {
-		_buffer: new Uint8Array(256),
+		_buffer: j.stream_create(
+			buffer_size === undefined ? DEFAULT_BUFFER_SIZE : buffer_size
+		),
 		_fd: fd,
-		_pushback: [],
 	};
 };
 
@@ -44,74 +57,20 @@ stream.read_line = function (sd) {
  * Read available characters until a delimiter is found.
  *
  * @param {object} sd An opaque stream descriptor
- * @param {string} delim A one-char string containing the delimiter
+ * @param {string} delim The delimiter (one or more chars)
  *
  * @returns {string}
  * A string without the delimiter or null if EOF was found before the delimiter.
  */
 stream.read_until = function (sd, delim) {
-	const delim_bytes = [];
+	const record = j.stream_read_until(sd._fd, sd._buffer, delim);
 
-	for (var i = 0; i < delim.length; i++) {
-		delim_bytes.push(delim.charCodeAt(i));
+	// Non ASCII records are returned as bytes
+	if (record !== null && typeof record !== 'string') {
+		return decoder.decode(record);
 	}
 
-	const bytes = [];
-
-	while (true) {
-		while (sd._pushback.length) {
-			bytes.push(sd._pushback.shift());
-
-			if (bytes.length < delim_bytes.length) {
-				continue;
-			}
-
-			var found = true;
-
-			for (var i = 0; i < delim_bytes.length; i++) {
-				if (
-					bytes[bytes.length - delim_bytes.length + i] !==
-					delim_bytes[i]
-				) {
-					found = false;
-					break;
-				}
-			}
-
-			if (found) {
-				return decoder.decode(
-					new Uint8Array(
-						bytes.slice(0, bytes.length - delim_bytes.length)
-					)
-				);
-			}
-		}
-
-		if (!feed(sd)) {
-			return null;
-		}
-	}
+	return record;
 };
 
-/**
- * Feed a stream's buffer with more bytes
- *
- * @param {object} sd An opaque stream descriptor
- * @returns {boolean} The value `true` if anything was read, `false` on EOF
- * @private
- */
-function feed(sd) {
-	const bread = j.read(sd._fd, sd._buffer, sd._buffer.length);
-
-	if (bread === 0) {
-		return false;
-	}
-
-	for (var i = 0; i < bread; i++) {
-		sd._pushback.push(sd._buffer[i]);
-	}
-
-	return true;
-}
-
 return stream;
@@ -19,6 +19,11 @@ const term = {
 const CSI = String.fromCharCode(0x1b) + '[';
 const stdin = stream.create(0);
 
+// Output is line buffered on terminals and fully buffered otherwise (but
+// errors are always line buffered so that they are seen soon)
+const stdout = io.writer(1, { line_buffered: io.isatty(1) });
+const stderr = io.writer(2, { line_buffered: true });
+
 /**
  * Set text background color to RGB value
  *
@@ -43,6 +48,20 @@ term.clear = function () {
 	term.move_to(1, 1);
 };
 
+/**
+ * Write pending output to stdout and stderr.
+ *
+ * Output is flushed automatically on line feeds when printing to a terminal,
+ * before reading from stdin and before the process exits, forks or execs.
+ *
+ * @returns {void}
+ * @throws {SysError}
+ */
+term.flush = function () {
+	stdout.flush();
+	stderr.flush();
+};
+
 /**
  * Set text foreground color to RGB value
  *
@@ -86,7 +105,7 @@ term.move_to = function (row, column) {
  * @throws {SysError}
  */
 term.print2 = function () {
-	_print(2, arguments, false);
+	_print(stderr, arguments, false);
 };
 
 /**
@@ -97,7 +116,7 @@ term.print2 = function () {
  * @throws {SysError}
  */
 term.print = function () {
-	_print(1, arguments, false);
+	_print(stdout, arguments, false);
 };
 
 /**
@@ -108,7 +127,7 @@ term.print = function () {
  * @throws {SysError}
  */
 term.println = function () {
-	_print(1, arguments, true);
+	_print(stdout, arguments, true);
 };
 
 /**
@@ -119,7 +138,7 @@ term.println = function () {
  * @throws {SysError}
  */
 term.println2 = function () {
-	_print(2, arguments, true);
+	_print(stderr, arguments, true);
 };
 
 /**
@@ -132,6 +151,8 @@ term.println2 = function () {
  * @throws {SysError}
  */
 term.read_line = function () {
+	term.flush();
+
 	return stream.read_line(stdin);
 };
 
@@ -156,6 +177,7 @@ term.reset = function () {
  * @throws {SysError}
  */
 term.set_mode = function (mode) {
+	term.flush();
 	j.set_term_mode(mode);
 };
 
@@ -221,14 +243,14 @@ term.to_string = function (thing) {
 /**
  * Internal print logic
  *
- * @param {number} fd File descriptor to print to
+ * @param {module:io.Writer} writer Writer to print to
  * @param {Arguments|Array} things Items to print
  * @param {boolean} [lf=false] Whether to print a trailing line feed
  * @returns {void}
  * @throws {SysError}
  * @private
  */
-function _print(fd, things, lf) {
+function _print(writer, things, lf) {
 	var str = '';
 
 	for (var i = 0; i < things.length; i++) {
@@ -243,7 +265,7 @@ function _print(fd, things, lf) {
 		str += '\n';
 	}
 
-	io.write_string(fd, str);
+	writer.write_string(str);
 }
 
 return term;
@@ -0,0 +1,146 @@
+/**
+ * A channel to exchange messages with a worker (or its parent).
+ *
+ * Messages can be strings or buffers (`Uint8Array` or similar). Buffers are
+ * copied unless they have been created with {@link module:worker.alloc} or
+ * received from a channel, in which case they are transferred without copying
+ * and detached in the sender (reads return 0 and writes are ignored). Views
+ * of a part of such buffers (for example, from `subarray()`) are copied.
+ *
+ * @param {number} id Channel id
+ *
+ * @class
+ * @hideconstructor
+ * @memberof module:worker
+ */
+function Channel(id) {
+	this._id = id;
+}
+
+Channel.prototype = {
+	/**
+	 * Close the sending side of the channel. The receiver will get `null` once
+	 * it has read all pending messages.
+	 *
+	 * @returns {void}
+	 * @throws {SysError}
+	 */
+	close: function () {
+		j.worker_close(this._id);
+	},
+
+	/**
+	 * Get a file descriptor which becomes readable when there are messages to
+	 * receive (so that it can be used with {@link module:io.poll}).
+	 *
+	 * Note that the descriptor must not be read or closed.
+	 *
+	 * @returns {number}
+	 * @throws {SysError}
+	 */
+	fd: function () {
+		return j.worker_fd(this._id);
+	},
+
+	/**
+	 * Receive a message
+	 *
+	 * @param {number} [timeout]
+	 * Maximum time to wait in milliseconds (wait forever if not given)
+	 *
+	 * @returns {string|Uint8Array|null|undefined}
+	 * The message, `null` if the channel has been closed by the other side or
+	 * `undefined` if the timeout expired.
+	 *
+	 * @throws {SysError}
+	 */
+	recv: function (timeout) {
+		return j.worker_recv(this._id, timeout === undefined ? -1 : timeout);
+	},
+
+	/**
+	 * Send a message
+	 *
+	 * @param {string|Uint8Array} msg
+	 * @returns {void}
+	 * @throws {SysError} EPIPE if the other side has closed the channel
+	 */
+	send: function (msg) {
+		j.worker_send(this._id, msg);
+	},
+};
+
+/**
+ * A running worker: a script which runs in its own thread and JavaScript heap.
+ *
+ * @param {number} id Worker id
+ *
+ * @class
+ * @extends module:worker.Channel
+ * @hideconstructor
+ * @memberof module:worker
+ */
+function Worker(id) {
+	Channel.call(this, id);
+}
+
+Worker.prototype = Object.assign(Object.create(Channel.prototype), {
+	/**
+	 * Wait for the worker to finish and release its resources
+	 *
+	 * @returns {number} The worker's exit value (like a process' exit status)
+	 * @throws {SysError}
+	 */
+	join: function () {
+		return j.worker_join(this._id);
+	},
+});
+
+/**
+ * @exports worker
+ */
+const worker = {};
+
+/**
+ * Channel to communicate with the parent when running inside a worker, or
+ * `null` otherwise.
+ *
+ * @type {module:worker.Channel|null}
+ */
+worker.parent = j.worker_is_child() ? new Channel(-1) : null;
+
+/**
+ * Allocate a zero filled buffer which can be transferred to other workers
+ * without copying it.
+ *
+ * @param {number} size Size in bytes
+ * @returns {Uint8Array}
+ * @throws {SysError}
+ */
+worker.alloc = function (size) {
+	return j.worker_alloc(size);
+};
+
+/**
+ * Start a worker.
+ *
+ * The worker script is run like a joshi main script (it receives `argv` and
+ * `require` and may return an exit value) but in a separate thread with its
+ * own heap, so nothing is shared with the parent apart from the messages sent
+ * through {@link module:worker.parent}.
+ *
+ * Note that calling {@link module:proc.exit} from a worker ends the whole
+ * process.
+ *
+ * @param {string} script Path to the worker script
+ * @param {...string} args Arguments to pass to the script (in `argv[2...]`)
+ * @returns {module:worker.Worker}
+ * @throws {SysError}
+ */
+worker.create = function (script) {
+	const args = Array.prototype.slice.call(arguments, 1);
+
+	return new Worker(j.worker_create(script, args));
+};
+
+return worker;
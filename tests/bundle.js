@@ -0,0 +1,40 @@
+const bundle = require('bundle');
+const fs = require('fs');
+const $ = require('shell');
+
+const expect = require('./test.js').expect;
+const fail = require('./test.js').fail;
+const log = require('./test.js').log;
+const test = require('./test.js').run;
+const tmp = require('./test.js').tmp;
+
+test('script', function () {
+	const DIR = tmp('bundle');
+	const OUT = tmp('bundle.out') + '/main.js';
+
+	fs.mkdirp(DIR + '/lib');
+	fs.mkdirp(fs.dirname(OUT));
+
+	fs.write_file(
+		DIR + '/main.js',
+		'#!/usr/bin/env joshi\n' +
+			"const fs = require('fs');\n" +
+			"const a = require('./a.js');\n" +
+			"require('io').write_string(1, a.name + fs.basename('/x/y'));\n"
+	);
+	fs.write_file(DIR + '/a.js', "return { name: require('./lib').name };");
+	fs.write_file(DIR + '/lib/index.js', "return { name: 'lib' };");
+
+	fs.write_file(OUT, bundle.script(DIR + '/main.js'));
+
+	// Remove sources to make sure the bundle is self-contained
+	fs.rmdir(DIR, true);
+
+	const x = {};
+
+	$('/proc/self/exe', OUT).pipe(1, x).do();
+
+	log(x.out);
+
+	expect.is('liby', x.out);
+});
@@ -1,4 +1,6 @@
+const errno = require('errno');
 const fs = require('fs');
+const io = require('io');
 const proc = require('proc');
 
 const expect = require('./test.js').expect;
@@ -66,6 +68,29 @@ test('copy_file', function () {
 	expect.is(0600, st.mode & 0777);
 });
 
+test('copy_file > with big file', function () {
+	const SRC = tmp('copy_file_big_src');
+	const DEST = tmp('copy_file_big_dest');
+
+	const data = new Uint8Array(3 * 1024 * 1024 + 7);
+
+	for (var i = 0; i < data.length; i++) {
+		data[i] = i % 251;
+	}
+
+	var fd = io.truncate(SRC);
+	io.write(fd, data);
+	io.close(fd);
+
+	fs.copy_file(SRC, DEST);
+
+	fd = io.open(DEST);
+	const copy = io.read_fully(fd);
+	io.close(fd);
+
+	expect.array_equals(data, copy);
+});
+
 test('create_temp_file', function () {
 	const CONTENT = 'holi';
 
@@ -88,6 +113,23 @@ test('exists', function () {
 	expect.is(true, fs.exists(FILE));
 });
 
+test('fstat_many', function () {
+	const FILE = tmp('fstat_many');
+
+	fs.write_file(FILE, 'holi');
+
+	const fd = io.open(FILE);
+	const st = fs.fstat_many([fd, 0x7fffffff], ['size', 'ino']);
+
+	io.close(fd);
+
+	expect.is(0, st.errno[0]);
+	expect.is(4, st.size[0]);
+	expect.is(true, st.ino[0] > 0);
+	expect.is(errno.EBADF, st.errno[1]);
+	expect.is(undefined, st.mode);
+});
+
 test('is_block_device', function () {
 	// TODO: uncomment test - var DEV = '/dev/loop0';
 
@@ -297,6 +339,63 @@ test('normalize_path', function () {
 	expect.is('/tmp', fs.normalize_path('/dev/block/../../tmp/./../tmp'));
 });
 
+test('read_bytes', function () {
+	const FILE = tmp('read_bytes');
+
+	fs.write_file(FILE, 'holi');
+
+	expect.array_equals([0x68, 0x6f, 0x6c, 0x69], fs.read_bytes(FILE));
+});
+
+test('read_dir', function () {
+	const DIR = tmp('read_dir');
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR + '/dir');
+
+	for (var i = 0; i < 1000; i++) {
+		fs.write_file(DIR + '/file' + i, '', 0600);
+	}
+
+	const items = fs.read_dir(DIR);
+
+	expect.is(1001, items.length);
+	expect.is(-1, items.indexOf('.'));
+	expect.is(-1, items.indexOf('..'));
+	expect.is(true, items.indexOf('file999') !== -1);
+});
+
+test('read_dir > with types', function () {
+	const DIR = tmp('read_dir_types');
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR + '/dir');
+	fs.write_file(DIR + '/file', '', 0600);
+	fs.symlink('file', DIR + '/link');
+
+	const entries = fs.read_dir(DIR, { types: true }).sort(function (a, b) {
+		return a.name < b.name ? -1 : 1;
+	});
+
+	expect.is(3, entries.length);
+	expect.is('dir', entries[0].name);
+	expect.is(fs.DT_DIR, entries[0].type);
+	expect.is('file', entries[1].name);
+	expect.is(fs.DT_REG, entries[1].type);
+	expect.is(true, entries[1].ino > 0);
+	expect.is('link', entries[2].name);
+	expect.is(fs.DT_LNK, entries[2].type);
+});
+
+test('read_dir > not found', function () {
+	try {
+		fs.read_dir(tmp('read_dir_not_found'));
+		fail('Did not throw');
+	} catch (err) {
+		expect.is(errno.ENOENT, err.errno);
+	}
+});
+
 test('read_file', function () {
 	const FILE = tmp('read_file');
 
@@ -351,6 +450,56 @@ test('rmdir', function () {
 	expect.is(false, fs.exists(DIR));
 });
 
+test('rmdir > recursive', function () {
+	const DIR = tmp('rmdir_recursive');
+	const TARGET = tmp('rmdir_recursive_target');
+
+	fs.rmdir(TARGET, true);
+	fs.mkdirp(TARGET);
+	fs.write_file(TARGET + '/keep', 'holi');
+
+	make_walk_tree(DIR);
+	fs.symlink(TARGET, DIR + '/d0/target');
+
+	fs.rmdir(DIR, true);
+
+	expect.is(false, fs.exists(DIR));
+	expect.is(true, fs.exists(TARGET + '/keep'));
+
+	// Missing directories are ignored
+	fs.rmdir(DIR, true);
+});
+
+test('rmdir > recursive, deep tree', function () {
+	const DIR = tmp('rmdir_deep');
+
+	fs.rmdir(DIR, true);
+
+	// Deeper than the number of ancestors kept open
+	var path = DIR;
+
+	for (var i = 0; i < 300; i++) {
+		path += '/d';
+		fs.mkdirp(path);
+		fs.write_file(path + '/file', 'holi');
+	}
+
+	fs.rmdir(DIR, true);
+
+	expect.is(false, fs.exists(DIR));
+});
+
+test('rmdir > recursive, with threads', function () {
+	const DIR = tmp('rmdir_threads');
+
+	make_walk_tree(DIR);
+	fs.write_file(DIR + '/file', 'holi');
+
+	fs.rmdir(DIR, true, { threads: 4 });
+
+	expect.is(false, fs.exists(DIR));
+});
+
 test('stat', function () {
 	const FILE = tmp('stat');
 	const NOW = Math.floor(new Date().getTime() / 1000);
@@ -373,6 +522,57 @@ test('stat', function () {
 	expect.is(true, t.modification >= NOW);
 });
 
+test('stat_many', function () {
+	const DIR = tmp('stat_many');
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR);
+	fs.write_file(DIR + '/file', 'holi');
+	fs.symlink('file', DIR + '/link');
+
+	const paths = [DIR + '/file', DIR + '/link', DIR + '/missing'];
+	const st = fs.stat_many(paths);
+
+	expect.is(true, st.size instanceof Float64Array);
+	expect.is(0, st.errno[0]);
+	expect.is(fs.S_IFREG, st.mode[0] & fs.S_IFMT);
+	expect.is(4, st.size[0]);
+	expect.is(fs.stat(paths[0]).time.modification, st.mtime[0]);
+	expect.is(true, st.mtime_nsec[0] < 1000000000);
+	expect.is(fs.S_IFLNK, st.mode[1] & fs.S_IFMT);
+	expect.is(errno.ENOENT, st.errno[2]);
+	expect.is(undefined, st.atime);
+});
+
+test('stat_many > with options', function () {
+	const DIR = tmp('stat_many_options');
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR);
+	fs.write_file(DIR + '/file', 'holi');
+	fs.symlink('file', DIR + '/link');
+
+	const dir = io.open(DIR, 'r');
+	const st = fs.stat_many(['file', 'link'], ['mode', 'uid', 'ctime'], {
+		dir: dir,
+		follow: true,
+	});
+
+	io.close(dir);
+
+	expect.is(fs.S_IFREG, st.mode[1] & fs.S_IFMT);
+	expect.is(proc.geteuid(), st.uid[0]);
+	expect.is(true, st.ctime[0] > 0);
+	expect.is(undefined, st.size);
+
+	try {
+		fs.stat_many([], ['color']);
+		fail('Did not throw');
+	} catch (err) {
+		expect.is('Unknown stat field: color', err.message);
+	}
+});
+
 test('symlink', function () {
 	const LINK = tmp('symlink');
 
@@ -400,6 +600,113 @@ test('unlink', function () {
 	fs.unlink(FILE, false);
 });
 
+function make_walk_tree(dir) {
+	fs.rmdir(dir, true);
+
+	for (var i = 0; i < 10; i++) {
+		fs.mkdirp(dir + '/d' + i + '/sub');
+		fs.mkdirp(dir + '/d' + i + '/.git');
+		fs.write_file(dir + '/d' + i + '/file', 'holi');
+		fs.write_file(dir + '/d' + i + '/sub/file', 'caracoli');
+		fs.write_file(dir + '/d' + i + '/.git/HEAD', '');
+	}
+
+	fs.symlink('d0', dir + '/link');
+}
+
+function walk_all(dir, opts) {
+	var all = [];
+
+	expect.is(
+		true,
+		fs.walk(dir, opts, function (entries) {
+			all = all.concat(entries);
+		})
+	);
+
+	return all.sort(function (a, b) {
+		return a.path < b.path ? -1 : 1;
+	});
+}
+
+test('walk', function () {
+	const DIR = tmp('walk');
+
+	make_walk_tree(DIR);
+
+	const entries = walk_all(DIR);
+
+	expect.is(61, entries.length);
+	expect.is(DIR + '/d0', entries[0].path);
+	expect.is(fs.DT_DIR, entries[0].type);
+	expect.is(1, entries[0].depth);
+	expect.is(DIR + '/d0/.git/HEAD', entries[2].path);
+	expect.is(3, entries[2].depth);
+	expect.is(DIR + '/link', entries[60].path);
+	expect.is(fs.DT_LNK, entries[60].type);
+	expect.is(undefined, entries[0].size);
+});
+
+test('walk > with options', function () {
+	const DIR = tmp('walk_options');
+
+	make_walk_tree(DIR);
+
+	const entries = walk_all(DIR + '/', {
+		max_depth: 2,
+		prune: ['.git', 'l*'],
+		same_fs: true,
+		stat: true,
+	});
+
+	expect.is(30, entries.length);
+	expect.is(DIR + '/d0', entries[0].path);
+	expect.is(DIR + '/d0/file', entries[1].path);
+	expect.is(4, entries[1].size);
+	expect.is(true, entries[1].mtime > 0);
+	expect.is(DIR + '/d0/sub', entries[2].path);
+});
+
+test('walk > with threads', function () {
+	const DIR = tmp('walk_threads');
+
+	make_walk_tree(DIR);
+
+	const entries = walk_all(DIR, { threads: 4, batch_size: 7 });
+
+	expect.is(61, entries.length);
+
+	for (var i = 1; i < entries.length; i++) {
+		expect.is(true, entries[i - 1].path !== entries[i].path);
+	}
+});
+
+test('walk > cancelling', function () {
+	const DIR = tmp('walk_cancelling');
+
+	make_walk_tree(DIR);
+
+	var count = 0;
+
+	expect.is(
+		false,
+		fs.walk(DIR, { threads: 2, batch_size: 1 }, function (entries) {
+			count += entries.length;
+			return false;
+		})
+	);
+	expect.is(1, count);
+});
+
+test('walk > not found', function () {
+	try {
+		fs.walk(tmp('walk_not_found'), function () {});
+		fail('Did not throw');
+	} catch (err) {
+		expect.is(errno.ENOENT, err.errno);
+	}
+});
+
 test('write_file', function () {
 	const FILE = tmp('write_file');
 
@@ -407,3 +714,60 @@ test('write_file', function () {
 
 	expect.is('holi', fs.read_file(FILE));
 });
+
+test('write_file > with non ASCII path', function () {
+	const DIR = tmp('write_file_non_ascii');
+	const NAME = '퀀 😀';
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR);
+
+	fs.write_file(DIR + '/' + NAME, NAME);
+
+	expect.is(true, fs.exists(DIR + '/' + NAME));
+	expect.is(NAME, fs.read_file(DIR + '/' + NAME));
+
+	// Names coming from the kernel are converted back to CESU-8
+	const items = fs.list_dir(DIR);
+
+	expect.is(1, items.length);
+	expect.is(NAME, items[0]);
+
+	fs.list_dir(DIR, function (name) {
+		expect.is(NAME, name);
+	});
+
+	expect.is(NAME, fs.read_dir(DIR, { types: true })[0].name);
+	expect.is(DIR + '/' + NAME, fs.realpath(DIR + '/' + NAME));
+
+	fs.walk(DIR, function (entries) {
+		expect.is(DIR + '/' + NAME, entries[0].path);
+	});
+});
+
+test('list_dir > with invalid UTF-8 name', function () {
+	const DIR = tmp('list_dir_invalid_utf8');
+
+	fs.rmdir(DIR, true);
+	fs.mkdirp(DIR);
+
+	// A 4 byte sequence lead with invalid continuation bytes
+	proc.fork(true, function () {
+		proc.exec('sh', ['-c', 'touch "$1/$(printf "\\360AAAB")"', 'sh', DIR]);
+	});
+
+	// Names which aren't valid UTF-8 are returned as is, so they can be reused
+	const names = fs.list_dir(DIR);
+
+	expect.is(1, names.length);
+	expect.is(5, names[0].length);
+	expect.is(true, fs.stat(DIR + '/' + names[0]) !== undefined);
+
+	const entries = fs.read_dir(DIR, { types: true });
+	expect.is(names[0], entries[0].name);
+
+	fs.walk(DIR, function (entries) {
+		expect.is(DIR + '/' + names[0], entries[0].path);
+		expect.is(true, fs.stat(entries[0].path) !== undefined);
+	});
+});
@@ -4,6 +4,8 @@ test.start();
 
 require('./errno.js');
 require('./kern.js');
+require('./shims.js');
+require('./bundle.js');
 require('./crypto.js');
 require('./perf.js');
 require('./io.js');
@@ -12,5 +14,8 @@ require('./term.js');
 require('./fs.js');
 require('./proc.js');
 require('./shell.js');
+require('./worker.js');
+require('./loop.js');
+require('./socket.js');
 
 test.finish();
@@ -1,3 +1,4 @@
+const errno = require('errno');
 const fs = require('fs');
 const io = require('io');
 const proc = require('proc');
@@ -67,6 +68,25 @@ test('connect', function () {
 });
 */
 
+test('copy_file_range', function () {
+	const SRC = tmp('copy_file_range_src');
+	const DEST = tmp('copy_file_range_dest');
+
+	fs.write_file(SRC, 'holi caracoli');
+
+	const fdIn = io.open(SRC, 'r');
+	const fdOut = io.truncate(DEST);
+
+	expect.is(8, io.copy_file_range(fdIn, 5, fdOut, null, 100));
+	expect.is(4, io.copy_file_range(fdIn, null, fdOut, null, 4));
+	expect.is(4, io.tell(fdIn));
+
+	io.close(fdIn);
+	io.close(fdOut);
+
+	expect.is('caracoliholi', fs.read_file(DEST));
+});
+
 test('create', function () {
 	const FILE = tmp('create');
 
@@ -127,6 +147,108 @@ test('dup2', function () {
 	expect.is('holi', str);
 });
 
+test('fcntl', function () {
+	const fds = io.pipe();
+
+	expect.is(0, io.fcntl(fds[0], io.F_GETFD) & io.FD_CLOEXEC);
+	io.fcntl(fds[0], io.F_SETFD, io.FD_CLOEXEC);
+	expect.is(io.FD_CLOEXEC, io.fcntl(fds[0], io.F_GETFD) & io.FD_CLOEXEC);
+
+	io.fcntl(fds[1], io.F_SETPIPE_SZ, 256 * 1024);
+	expect.is(256 * 1024, io.fcntl(fds[1], io.F_GETPIPE_SZ));
+
+	io.close(fds[0]);
+	io.close(fds[1]);
+});
+
+test('mmap', function () {
+	const FILE = tmp('mmap');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE);
+	const buf = io.mmap(fd, 5, 8);
+	io.close(fd);
+
+	io.madvise(buf, io.MADV_SEQUENTIAL);
+
+	expect.is(8, buf.length);
+	expect.is('caracoli', new TextDecoder().decode(buf));
+
+	io.munmap(buf);
+
+	expect.is(0, buf[0]);
+});
+
+test('mmap > with MAP_SHARED', function () {
+	const FILE = tmp('mmap_write');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE, 'rw');
+	const buf = io.mmap(fd, 0, 4, io.PROT_READ | io.PROT_WRITE, io.MAP_SHARED);
+	io.close(fd);
+
+	buf.set([0x48, 0x4f, 0x4c, 0x49]);
+	io.munmap(buf);
+
+	expect.is('HOLI caracoli', fs.read_file(FILE));
+});
+
+test('mmap > with MAP_PRIVATE', function () {
+	const FILE = tmp('mmap_private');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE);
+	const buf = io.mmap(fd, 0, 4, io.PROT_READ | io.PROT_WRITE, io.MAP_PRIVATE);
+	io.close(fd);
+
+	// Changes are not carried to the file
+	buf[0] = 0x48;
+	expect.is('Holi', new TextDecoder().decode(buf));
+	expect.is('holi caracoli', fs.read_file(FILE));
+
+	io.munmap(buf);
+});
+
+test('mmap > with negative offset', function () {
+	const FILE = tmp('mmap_negative');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE);
+
+	try {
+		io.mmap(fd, -1, 4);
+		fail('Did not throw');
+	} catch (err) {
+		expect.is(true, err instanceof RangeError);
+	} finally {
+		io.close(fd);
+	}
+});
+
+test('mmap > subarray outlives buffer', function () {
+	const FILE = tmp('mmap_subarray');
+
+	fs.write_file(FILE, new Array(10001).join('holi caracoli '));
+
+	const fd = io.open(FILE);
+	const view = io.mmap(fd, 0, 100000).subarray(5, 13);
+	io.close(fd);
+
+	Duktape.gc();
+	Duktape.gc();
+
+	expect.is('caracoli', new TextDecoder().decode(view));
+
+	io.madvise(view, io.MADV_WILLNEED);
+	io.munmap(view);
+
+	expect.is(0, view[0]);
+});
+
 test('open', function () {
 	const FILE = tmp('open');
 
@@ -203,6 +325,16 @@ test('pipe', function () {
 	expect.array_equals(DATA, buf);
 });
 
+test('pipe > with flags', function () {
+	const fds = io.pipe(io.O_CLOEXEC | io.O_NONBLOCK);
+
+	expect.is(io.FD_CLOEXEC, io.fcntl(fds[1], io.F_GETFD) & io.FD_CLOEXEC);
+	expect.is(io.O_NONBLOCK, io.fcntl(fds[0], io.F_GETFL) & io.O_NONBLOCK);
+
+	io.close(fds[0]);
+	io.close(fds[1]);
+});
+
 test('poll', function () {
 	const DATA = new Uint8Array([32, 33, 34, 35, 36, 37, 38, 38, 40, 41, 42]);
 
@@ -227,6 +359,28 @@ test('poll', function () {
 	expect.is(io.POLLIN, fds[0].revents);
 });
 
+test('pread/pwrite', function () {
+	const FILE = tmp('pread_pwrite');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE, 'rw');
+
+	expect.is(4, io.pwrite(fd, new Uint8Array([0x43, 0x41, 0x52, 0x41]), 5));
+
+	const buf = new Uint8Array(6);
+	expect.is(6, io.pread(fd, buf, 7));
+	expect.is('RAcoli', new TextDecoder().decode(buf));
+
+	expect.is(2, io.pread(fd, buf, 11));
+	expect.is(0, io.pread(fd, buf, 13));
+	expect.is(0, io.tell(fd));
+
+	io.close(fd);
+
+	expect.is('holi CARAcoli', fs.read_file(FILE));
+});
+
 test('read', function () {
 	const FILE = tmp('read');
 	const DATA = new Uint8Array([32, 33, 34, 35, 36, 37, 38, 38, 40, 41, 42]);
@@ -284,6 +438,40 @@ test('read_available', function () {
 	io.close(fd[1]);
 });
 
+test('read_all', function () {
+	const FILE = tmp('read_all');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fd = io.open(FILE);
+	io.seek(fd, 5, io.SEEK_SET);
+	const bytes = io.read_all(fd);
+	io.close(fd);
+
+	expect.is('caracoli', new TextDecoder().decode(bytes));
+});
+
+test('read_all > from pipe', function () {
+	const fds = io.pipe();
+	const data = new Uint8Array(100000);
+
+	for (var i = 0; i < data.length; i++) {
+		data[i] = i % 256;
+	}
+
+	const pid = proc.fork(function () {
+		io.close(fds[0]);
+		io.write(fds[1], data);
+	});
+
+	io.close(fds[1]);
+	const bytes = io.read_all(fds[0]);
+	io.close(fds[0]);
+	proc.waitpid(pid);
+
+	expect.array_equals(data, bytes);
+});
+
 test('read_fully', function () {
 	const FILE = tmp('read_fully');
 
@@ -306,6 +494,32 @@ test('read_fully', function () {
 	expect.array_equals(data, buf);
 });
 
+test('read_nonblock/write_nonblock', function () {
+	const fds = io.pipe(io.O_NONBLOCK);
+	const buf = new Uint8Array(4096);
+
+	expect.is(null, io.read_nonblock(fds[0], buf));
+
+	// Fill the pipe
+	var total = 0;
+	var count;
+	while ((count = io.write_nonblock(fds[1], buf)) !== null) {
+		total += count;
+	}
+
+	expect.is(io.fcntl(fds[1], io.F_GETPIPE_SZ), total);
+
+	expect.is(4096, io.read_nonblock(fds[0], buf));
+
+	io.close(fds[1]);
+
+	while ((count = io.read_nonblock(fds[0], buf)) !== 0) {
+		expect.is(4096, count);
+	}
+
+	io.close(fds[0]);
+});
+
 test('read_string', function () {
 	const FILE = tmp('read_string');
 	const DATA = new Uint8Array([
@@ -323,6 +537,52 @@ test('read_string', function () {
 	expect.is('holi🔊', str);
 });
 
+test('readv/writev', function () {
+	const FILE = tmp('readv_writev');
+
+	var fd = io.truncate(FILE);
+
+	const encoder = new TextEncoder();
+	expect.is(
+		13,
+		io.writev(fd, [encoder.encode('holi '), encoder.encode('caracoli')])
+	);
+
+	io.close(fd);
+
+	expect.is('holi caracoli', fs.read_file(FILE));
+
+	fd = io.open(FILE);
+
+	const head = new Uint8Array(5);
+	const tail = new Uint8Array(20);
+	expect.is(13, io.readv(fd, [head, tail]));
+
+	io.close(fd);
+
+	const decoder = new TextDecoder();
+	expect.is('holi ', decoder.decode(head));
+	expect.is('caracoli', decoder.decode(tail.subarray(0, 8)));
+});
+
+test('sendfile', function () {
+	const SRC = tmp('sendfile_src');
+	const DEST = tmp('sendfile_dest');
+
+	fs.write_file(SRC, 'holi caracoli');
+
+	const fdIn = io.open(SRC, 'r');
+	const fdOut = io.truncate(DEST);
+
+	expect.is(8, io.sendfile(fdOut, fdIn, 5, 100));
+	expect.is(0, io.tell(fdIn));
+
+	io.close(fdIn);
+	io.close(fdOut);
+
+	expect.is('caracoli', fs.read_file(DEST));
+});
+
 test('seek', function () {
 	const FILE = tmp('seek');
 	const DATA = new Uint8Array([
@@ -340,6 +600,40 @@ test('seek', function () {
 	expect.array_equals(DATA, buf);
 });
 
+test('splice', function () {
+	const FILE = tmp('splice');
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	const fds = io.pipe();
+	const fd = io.open(FILE);
+
+	expect.is(4, io.splice(fd, 5, fds[1], null, 4));
+	io.close(fds[1]);
+
+	expect.is('cara', io.read_string(fds[0]));
+
+	io.close(fds[0]);
+	io.close(fd);
+});
+
+test('tee', function () {
+	const fds1 = io.pipe();
+	const fds2 = io.pipe();
+
+	io.write_string(fds1[1], 'holi');
+	io.close(fds1[1]);
+
+	expect.is(4, io.tee(fds1[0], fds2[1], 100));
+	io.close(fds2[1]);
+
+	expect.is('holi', io.read_string(fds1[0]));
+	expect.is('holi', io.read_string(fds2[0]));
+
+	io.close(fds1[0]);
+	io.close(fds2[0]);
+});
+
 test('tell', function () {
 	const FILE = tmp('tell');
 	const DATA = new Uint8Array([
@@ -379,6 +673,45 @@ test('truncate', function () {
 	expect.is(0, p);
 });
 
+test('uring', function () {
+	test_uring(false);
+});
+
+test('uring > fallback', function () {
+	test_uring(true);
+});
+
+test('uring > garbage collected after reaping', function () {
+	(function () {
+		const ring = io.uring(8);
+
+		ring.stat('/etc/passwd');
+		expect.is(1, ring.wait(1).length);
+	})();
+
+	Duktape.gc();
+});
+
+test('uring > garbage collected with operations in flight', function () {
+	const fds = io.pipe();
+
+	// The finalizer cancels the read (which would block forever) and waits
+	// for it to complete before freeing anything
+	(function () {
+		const ring = io.uring(8);
+
+		ring.read(fds[0], new Uint8Array(1 << 16));
+		ring.read(fds[0], new Uint8Array(1 << 16));
+		ring.submit();
+		ring.read(fds[0], new Uint8Array(1 << 16));
+	})();
+
+	Duktape.gc();
+
+	io.close(fds[0]);
+	io.close(fds[1]);
+});
+
 test('write > with given count', function () {
 	const FILE = tmp('write_with_given_count');
 	const DATA = new Uint8Array([32, 33, 34, 35, 36, 37]);
@@ -411,3 +744,113 @@ test('write_string', function () {
 
 	expect.array_equals(DATA, buf);
 });
+
+test('writer', function () {
+	const FILE = tmp('writer');
+
+	const fd = io.truncate(FILE);
+	const w = io.writer(fd, { size: 16 });
+
+	w.write_string('holi🔊');
+	w.write(new Uint8Array([0x21, 0x21, 0x21]), 2);
+	expect.is('', fs.read_file(FILE));
+
+	// Pending output is flushed before forking
+	proc.fork(true, function () {
+		proc.exit(0);
+	});
+	expect.is('holi🔊!!', fs.read_file(FILE));
+
+	// Big writes bypass the buffer
+	w.write_string('0123456789abcdefghij');
+	expect.is('holi🔊!!0123456789abcdefghij', fs.read_file(FILE));
+
+	w.write_string('\n');
+	w.close();
+	io.close(fd);
+
+	expect.is('holi🔊!!0123456789abcdefghij\n', fs.read_file(FILE));
+});
+
+test('writer > line buffered', function () {
+	const FILE = tmp('writer_line');
+
+	const fd = io.truncate(FILE);
+	const w = io.writer(fd, { line_buffered: true });
+
+	w.write_string('a');
+	expect.is('', fs.read_file(FILE));
+
+	w.write_string('b\nc');
+	expect.is('ab\nc', fs.read_file(FILE));
+
+	w.close();
+	io.close(fd);
+});
+
+function test_uring(fallback) {
+	const FILE = tmp('uring');
+	const ring = io.uring(8, { fallback: fallback });
+
+	fs.write_file(FILE, 'holi caracoli');
+
+	function wait(count) {
+		const completions = {};
+
+		while (count > 0) {
+			ring.wait(1).forEach(function (completion) {
+				completions[completion.id] = completion;
+				count--;
+			});
+		}
+
+		return completions;
+	}
+
+	var id = ring.open(FILE);
+	const fd = wait(1)[id].result;
+
+	const buf1 = new Uint8Array(4);
+	const buf2 = new Uint8Array(8);
+
+	const read1 = ring.read(fd, buf1, 0);
+	const read2 = ring.read(fd, buf2, 5);
+	const stat = ring.stat(FILE);
+	const missing = ring.stat(FILE + '.missing');
+
+	expect.is(4, ring.submit());
+
+	var completions = wait(4);
+
+	const decoder = new TextDecoder();
+	expect.is(4, completions[read1].result);
+	expect.is('holi', decoder.decode(buf1));
+	expect.is(8, completions[read2].result);
+	expect.is('caracoli', decoder.decode(buf2));
+	expect.is(13, completions[stat].stat.size);
+	expect.is(-1, completions[missing].result);
+	expect.is(errno.ENOENT, completions[missing].errno);
+
+	// Writing to a read only fd fails and cancels the linked close
+	const write = ring.write(fd, buf1, 0, { link: true });
+	const close = ring.close_fd(fd);
+
+	completions = wait(2);
+
+	expect.is(errno.EBADF, completions[write].errno);
+	expect.is(125 /* ECANCELED */, completions[close].errno);
+
+	id = ring.close_fd(fd);
+
+	// Rings with completions not reaped can't be closed
+	try {
+		ring.close();
+		fail('Did not throw');
+	} catch (err) {
+		expect.is(errno.EBUSY, err.errno);
+	}
+
+	expect.is(0, wait(1)[id].result);
+
+	ring.close();
+}
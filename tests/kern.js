@@ -2,6 +2,7 @@ const fs = require('fs');
 const io = require('io');
 const kern = require('kern');
 const proc = require('proc');
+const $ = require('shell');
 
 const expect = require('./test.js').expect;
 const fail = require('./test.js').fail;
@@ -24,6 +25,44 @@ test('printk', function () {
 	expect.is('holi', fs.read_file(FILE));
 });
 
+test('require > bytecode cache', function () {
+	const DIR = tmp('bytecode_cache');
+	const CACHE_DIR = DIR + '/cache';
+	const MODULE = DIR + '/module.js';
+	const SCRIPT = DIR + '/script.js';
+
+	fs.mkdirp(DIR);
+	fs.write_file(MODULE, "return 'holi';");
+	fs.write_file(
+		SCRIPT,
+		"require('io').write_string(1, require('./module.js'));"
+	);
+
+	function run() {
+		const x = {};
+
+		$('/proc/self/exe', SCRIPT)
+			.env({ JOSHI_CACHE_DIR: CACHE_DIR })
+			.pipe(1, x)
+			.do();
+
+		return x.out;
+	}
+
+	expect.is('holi', run());
+
+	const cached = fs.list_dir(CACHE_DIR + '/' + kern.version);
+
+	log('cached files', cached.length);
+	expect.is(true, cached.length > 0);
+
+	expect.is('holi', run());
+
+	fs.write_file(MODULE, "return 'adios';");
+
+	expect.is('adios', run());
+});
+
 test('search_path', function () {
 	try {
 		const mydir = fs.dirname(require.owner_path);
@@ -38,6 +77,35 @@ test('search_path', function () {
 	}
 });
 
+test('search_path > cache', function () {
+	const dir1 = tmp('search_path_1');
+	const dir2 = tmp('search_path_2');
+
+	fs.mkdirp(dir1);
+	fs.mkdirp(dir2);
+	fs.write_file(dir2 + '/mod.js', "return 'two';");
+
+	try {
+		kern.search_path = [dir1, dir2];
+		expect.is(dir2 + '/mod.js', require.resolve('mod.js'));
+
+		// Cached until the search path changes
+		fs.write_file(dir1 + '/mod.js', "return 'one';");
+		expect.is(dir2 + '/mod.js', require.resolve('mod.js'));
+
+		kern.search_path = [dir1, dir2, '/'];
+		expect.is(dir1 + '/mod.js', require.resolve('mod.js'));
+
+		// Misses resolve to the library dir
+		const miss = require.resolve('nope.js');
+
+		expect.is(true, miss.endsWith('/nope.js'));
+		expect.is(miss, require.resolve('nope.js'));
+	} finally {
+		kern.search_path = [];
+	}
+});
+
 test('version', function () {
 	const v = kern.version.split('.');
 
@@ -0,0 +1,109 @@
+const io = require('io');
+const loop = require('loop');
+const proc = require('proc');
+
+const expect = require('./test.js').expect;
+const test = require('./test.js').run;
+
+test('add/remove', function () {
+	const l = loop.create();
+	const fds = io.pipe();
+	const got = [];
+
+	const id = l.add(fds[0], loop.READ, function (fd, events) {
+		expect.is(fds[0], fd);
+		expect.is(true, (events & (loop.READ | loop.HANGUP)) !== 0);
+
+		const buf = new Uint8Array(16);
+		const count = io.read(fd, buf, buf.length);
+
+		if (count === 0) {
+			l.remove(id);
+			return;
+		}
+
+		got.push(String.fromCharCode.apply(null, buf.subarray(0, count)));
+	});
+
+	io.write_string(fds[1], 'hola');
+	expect.is(1, l.run_once(1000));
+	expect.array_equals(['hola'], got);
+
+	io.close(fds[1]);
+	l.run();
+	expect.array_equals(['hola'], got);
+
+	io.close(fds[0]);
+	l.close();
+});
+
+test('set_timeout/set_interval', function () {
+	const l = loop.create();
+	const calls = [];
+
+	const interval = l.set_interval(5, function (expirations) {
+		calls.push('interval');
+
+		if (calls.length >= 3) {
+			l.remove(interval);
+		}
+	});
+
+	l.set_timeout(0, function (expirations) {
+		expect.is(1, expirations);
+		calls.push('timeout');
+	});
+
+	l.run();
+
+	expect.array_equals(['timeout', 'interval', 'interval'], calls);
+	expect.is(3, calls.length);
+
+	l.close();
+});
+
+test('stop', function () {
+	const l = loop.create();
+	const fds = io.pipe();
+	var calls = 0;
+
+	l.add(fds[1], loop.WRITE, function () {
+		calls++;
+		l.stop();
+	});
+
+	l.run();
+	expect.is(1, calls);
+
+	l.close();
+	io.close(fds[0]);
+	io.close(fds[1]);
+});
+
+test('signal', function () {
+	const l = loop.create();
+	var received = 0;
+
+	proc.signal(proc.SIGUSR2, function (sig, count) {
+		received += count;
+		l.stop();
+	});
+
+	// Guard against hanging the tests
+	const timeout = l.set_timeout(5000, function () {});
+
+	const pid = proc.fork(function () {
+		proc.kill(proc.getppid(), proc.SIGUSR2);
+		proc.exit(0);
+	});
+
+	l.run();
+
+	proc.signal(proc.SIGUSR2, undefined);
+	proc.waitpid(pid);
+
+	expect.is(true, received > 0);
+
+	l.remove(timeout);
+	l.close();
+});
@@ -24,3 +24,58 @@ test('perf', function () {
 	expect.is(true, r.includes('test'));
 	expect.is(true, r.includes('sleep'));
 });
+
+test('alloc_stats', function () {
+	const before = perf.alloc_stats();
+
+	const objs = [];
+	for (var i = 0; i < 1000; i++) {
+		objs.push({ i: i });
+	}
+
+	const after = perf.alloc_stats();
+
+	log(after);
+
+	expect.is(true, after.allocs >= before.allocs + 1000);
+	expect.is(true, after.live_bytes > before.live_bytes);
+	expect.is(true, after.peak_bytes >= after.live_bytes);
+	expect.is(true, after.reserved_bytes > 0);
+});
+
+test('profile_start/stop', function () {
+	function busy_loop() {
+		var a = 0;
+		for (var i = 0; i < 1000 * 1000; i++) {
+			a = a + (i % 7);
+		}
+		return a;
+	}
+
+	perf.profile_start();
+	busy_loop();
+	const folded = perf.profile_stop();
+
+	log(folded);
+
+	expect.is(true, folded.includes('busy_loop'));
+	expect.is(true, /^\S.* \d+$/m.test(folded));
+});
+
+test('native string arguments', function () {
+	const ascii = new Array(64).join('/usr/lib/x86_64-linux-gnu');
+	const non_bmp = new Array(64).join('/usr/lib/😀/gnu');
+	const p = perf.start('native string arguments');
+
+	for (var i = 0; i < 100 * 1000; i++) {
+		proc.getenv(ascii);
+	}
+	p.lap('ascii');
+
+	for (var i = 0; i < 100 * 1000; i++) {
+		proc.getenv(non_bmp);
+	}
+	p.lap('non-BMP');
+
+	log(p.end().report());
+});
@@ -268,6 +268,91 @@ test('kill, signal', function () {
 	expect.is(false, called);
 });
 
+test('signal > handler arguments', function () {
+	const calls = [];
+
+	proc.signal(proc.SIGUSR2, function (sig, count) {
+		calls.push([sig, count]);
+	});
+
+	proc.kill(proc.getpid(), proc.SIGUSR2);
+
+	proc.signal(proc.SIGUSR2, undefined);
+
+	expect.is(1, calls.length);
+	expect.array_equals([proc.SIGUSR2, 1], calls[0]);
+	expect.is(0, proc.signal_dispatch());
+	expect.is(true, proc.signal_fd() >= 0);
+});
+
+test('signal > blocking calls are restarted', function () {
+	const fds = io.pipe();
+	var called = false;
+
+	proc.signal(proc.SIGUSR2, function () {
+		called = true;
+	});
+
+	const pid = proc.fork(function () {
+		io.close(fds[0]);
+		io.poll([], 100);
+		proc.kill(proc.getppid(), proc.SIGUSR2);
+		io.poll([], 100);
+		io.write(fds[1], new Uint8Array([42]));
+		proc.exit(0);
+	});
+
+	io.close(fds[1]);
+
+	const buf = new Uint8Array(1);
+
+	expect.is(1, io.read(fds[0], buf));
+	expect.is(42, buf[0]);
+	expect.is(true, called);
+
+	io.close(fds[0]);
+	proc.waitpid(pid);
+
+	proc.signal(proc.SIGUSR2, undefined);
+});
+
+test('signal > handler errors', function () {
+	const fds = io.pipe();
+
+	proc.signal(proc.SIGUSR2, function () {
+		throw new Error('Handler error');
+	});
+
+	const pid = proc.fork(function () {
+		io.close(fds[0]);
+		io.poll([], 100);
+		proc.kill(proc.getppid(), proc.SIGUSR2);
+		io.poll([], 100);
+		io.write(fds[1], new Uint8Array([42]));
+		proc.exit(0);
+	});
+
+	io.close(fds[1]);
+
+	const buf = new Uint8Array(1);
+
+	// The interrupted call throws before having any effect
+	try {
+		io.read(fds[0], buf);
+		fail('Did not throw');
+	} catch (err) {
+		expect.is('Handler error', err.message);
+	}
+
+	expect.is(1, io.read(fds[0], buf));
+	expect.is(42, buf[0]);
+
+	io.close(fds[0]);
+	proc.waitpid(pid);
+
+	proc.signal(proc.SIGUSR2, undefined);
+});
+
 test('setenv', function () {
 	proc.setenv('perico', 'holi', true);
 	expect.is('holi', proc.getenv('perico'));
@@ -0,0 +1,61 @@
+const expect = require('./test.js').expect;
+const test = require('./test.js').run;
+
+test('Array.from', function () {
+	expect.array_equals(['a', 'b'], Array.from({ length: 2, 0: 'a', 1: 'b' }));
+	expect.array_equals(
+		[0, 2, 4],
+		Array.from([0, 1, 2], function (x) {
+			return 2 * x;
+		})
+	);
+});
+
+test('Array.prototype.find/findIndex', function () {
+	const arr = [1, 5, 7];
+	const gt4 = function (x) {
+		return x > 4;
+	};
+
+	expect.is(5, arr.find(gt4));
+	expect.is(1, arr.findIndex(gt4));
+	expect.is(undefined, [].find(gt4));
+	expect.is(-1, [].findIndex(gt4));
+});
+
+test('Array.prototype.flat', function () {
+	const flat = [1, [2, [3, [4]]]].flat(2);
+
+	expect.array_equals([1, 2, 3], flat.slice(0, 3));
+	expect.array_equals([4], flat[3]);
+	expect.array_equals([1, 2, 3], [1, [2], 3].flat());
+});
+
+test('Array.prototype.includes', function () {
+	expect.is(true, [1, NaN].includes(NaN));
+	expect.is(false, [1, 2].includes('1'));
+	expect.is(false, [1, 2].includes(1, 1));
+});
+
+test('Object.entries/values', function () {
+	const entries = Object.entries({ a: 1, b: 2 });
+
+	expect.is(2, entries.length);
+	expect.array_equals(['a', 1], entries[0]);
+	expect.array_equals(['b', 2], entries[1]);
+	expect.array_equals([1, 2], Object.values({ a: 1, b: 2 }));
+});
+
+test('String.prototype.padStart/padEnd', function () {
+	expect.is('007', '7'.padStart(3, '0'));
+	expect.is('abcab7', '7'.padStart(6, 'abc'));
+	expect.is('7  ', '7'.padEnd(3));
+	expect.is('ñoño', 'ñoño'.padEnd(2));
+	expect.is('😀😀x', 'x'.padStart(5, '😀'));
+});
+
+test('String.prototype.trimStart/trimEnd', function () {
+	expect.is('a b 　', ' \t a b 　'.trimStart());
+	expect.is(' \t a b', ' \t a b 　'.trimEnd());
+	expect.is('', ' \n '.trimEnd());
+});
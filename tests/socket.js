@@ -0,0 +1,183 @@
+const fs = require('fs');
+const io = require('io');
+const proc = require('proc');
+const socket = require('socket');
+
+const expect = require('./test.js').expect;
+const test = require('./test.js').run;
+const tmp = require('./test.js').tmp;
+
+const decoder = new TextDecoder();
+const encoder = new TextEncoder();
+
+test('AF_INET stream', function () {
+	const server = socket.create(socket.AF_INET, socket.SOCK_STREAM);
+
+	socket.setsockopt(server, socket.SOL_SOCKET, socket.SO_REUSEADDR, 1);
+	socket.bind(server, { host: '127.0.0.1', port: 0 });
+	socket.listen(server);
+
+	const address = socket.getsockname(server);
+	expect.is('127.0.0.1', address.host);
+	expect.is(true, address.port > 0);
+
+	const pid = proc.fork(function () {
+		const client = socket.create(socket.AF_INET, socket.SOCK_STREAM);
+
+		socket.connect(client, address);
+		io.write_string(client, 'holi');
+		socket.shutdown(client, socket.SHUT_WR);
+		io.close(client);
+	});
+
+	const conn = socket.accept(server);
+	expect.is('127.0.0.1', conn.address.host);
+
+	expect.is('holi', io.read_string(conn.fd));
+
+	io.close(conn.fd);
+	io.close(server);
+	proc.waitpid(pid);
+});
+
+test('AF_INET6 datagram', function () {
+	const server = socket.create(socket.AF_INET6, socket.SOCK_DGRAM);
+	const client = socket.create(socket.AF_INET6, socket.SOCK_DGRAM);
+
+	socket.bind(server, { host: '::1', port: 0 });
+	const address = socket.getsockname(server);
+
+	expect.is(
+		2,
+		socket.sendmmsg(client, [
+			{ data: encoder.encode('holi'), address: address },
+			{
+				data: [encoder.encode('cara'), encoder.encode('coli')],
+				address: address,
+			},
+		])
+	);
+
+	const bufs = [new Uint8Array(16), new Uint8Array(16), new Uint8Array(16)];
+	var msgs = [];
+
+	while (msgs.length < 2) {
+		msgs = msgs.concat(socket.recvmmsg(server, bufs.slice(msgs.length)));
+	}
+
+	expect.is(4, msgs[0].count);
+	expect.is('holi', decoder.decode(bufs[0].subarray(0, 4)));
+	expect.is(8, msgs[1].count);
+	expect.is('caracoli', decoder.decode(bufs[1].subarray(0, 8)));
+	expect.is('::1', msgs[0].address.host);
+	expect.is(socket.getsockname(client).port, msgs[0].address.port);
+
+	io.close(client);
+	io.close(server);
+});
+
+test('AF_UNIX sendmsg/recvmsg', function () {
+	const PATH = tmp('socket.sock');
+
+	fs.unlink(PATH, false);
+
+	const server = socket.create(socket.AF_UNIX, socket.SOCK_DGRAM);
+	const client = socket.create(socket.AF_UNIX, socket.SOCK_DGRAM);
+
+	socket.bind(server, PATH);
+	expect.is(PATH, socket.getsockname(server).path);
+
+	const head = encoder.encode('holi ');
+	const body = encoder.encode('caracoli');
+	expect.is(13, socket.sendmsg(client, [head, body], { path: PATH }));
+
+	const buf = new Uint8Array(8);
+	const msg = socket.recvmsg(server, buf);
+
+	expect.is(8, msg.count);
+	expect.is(socket.MSG_TRUNC, msg.flags & socket.MSG_TRUNC);
+	expect.is('holi car', decoder.decode(buf));
+
+	io.close(client);
+	io.close(server);
+	fs.unlink(PATH);
+});
+
+test('SO_REUSEPORT', function () {
+	const fd1 = socket.create(socket.AF_INET, socket.SOCK_STREAM);
+	const fd2 = socket.create(socket.AF_INET, socket.SOCK_STREAM);
+
+	socket.setsockopt(fd1, socket.SOL_SOCKET, socket.SO_REUSEPORT, true);
+	socket.setsockopt(fd2, socket.SOL_SOCKET, socket.SO_REUSEPORT, true);
+
+	expect.is(
+		1,
+		socket.getsockopt(fd1, socket.SOL_SOCKET, socket.SO_REUSEPORT)
+	);
+
+	socket.bind(fd1, { host: '127.0.0.1', port: 0 });
+	socket.bind(fd2, socket.getsockname(fd1));
+	socket.listen(fd1);
+	socket.listen(fd2);
+
+	io.close(fd1);
+	io.close(fd2);
+});
+
+test('socketpair > send_fds/recv_fds', function () {
+	const PATH = tmp('socket.fds');
+	const channel = socket.socketpair();
+
+	fs.write_file(PATH, 'holi');
+
+	const pid = proc.fork(function () {
+		io.close(channel[0]);
+
+		const msg = io.recv_fds(channel[1]);
+
+		io.write_string(channel[1], io.read_string(msg.fds[0]));
+		io.close(msg.fds[0]);
+		io.close(channel[1]);
+	});
+
+	io.close(channel[1]);
+
+	const fd = io.open(PATH);
+	expect.is(1, io.send_fds(channel[0], [fd]));
+	io.close(fd);
+
+	expect.is('holi', io.read_string(channel[0]));
+
+	io.close(channel[0]);
+	proc.waitpid(pid);
+	fs.unlink(PATH);
+});
+
+test('socketpair > send_fds/recv_fds with data', function () {
+	const channel = socket.socketpair(socket.AF_UNIX, socket.SOCK_DGRAM);
+	const pipe = io.pipe();
+
+	io.send_fds(channel[0], pipe, encoder.encode('pipe'));
+
+	const buf = new Uint8Array(8);
+	const msg = io.recv_fds(channel[1], buf);
+
+	expect.is(4, msg.count);
+	expect.is('pipe', decoder.decode(buf.subarray(0, 4)));
+	expect.is(2, msg.fds.length);
+	expect.is(false, msg.truncated);
+	expect.is(
+		io.FD_CLOEXEC,
+		io.fcntl(msg.fds[0], io.F_GETFD) & io.FD_CLOEXEC
+	);
+
+	io.write_string(msg.fds[1], 'caracoli');
+	io.close(msg.fds[1]);
+	io.close(pipe[1]);
+	expect.is('caracoli', io.read_string(pipe[0]));
+
+	io.close(msg.fds[0]);
+	io.close(pipe[0]);
+	io.close(channel[0]);
+	io.close(channel[1]);
+});
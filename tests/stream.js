@@ -56,3 +56,22 @@ test('read_until > string delimiter', function () {
 
 	io.close(fd);
 });
+
+test('read_line > long lines, non ASCII', function () {
+	const FILE = tmp('read_line_long');
+	const long = new Array(1000).join('x');
+
+	const fd = io.truncate(FILE);
+	io.write_string(fd, long + '\nñoño 😀\n' + long + long + '\n');
+	io.seek(fd, 0);
+
+	// A tiny buffer must grow to fit long lines
+	const sd = stream.create(fd, 16);
+
+	expect.is(long, stream.read_line(sd));
+	expect.is('ñoño 😀', stream.read_line(sd));
+	expect.is(long + long, stream.read_line(sd));
+	expect.is(null, stream.read_line(sd));
+
+	io.close(fd);
+});
@@ -0,0 +1,134 @@
+const fs = require('fs');
+const io = require('io');
+const worker = require('worker');
+
+const expect = require('./test.js').expect;
+const fail = require('./test.js').fail;
+const log = require('./test.js').log;
+const test = require('./test.js').run;
+const tmp = require('./test.js').tmp;
+
+const ECHO_SCRIPT = tmp('worker') + '/echo.js';
+
+fs.mkdirp(fs.dirname(ECHO_SCRIPT));
+fs.write_file(
+	ECHO_SCRIPT,
+	"const worker = require('worker');\n" +
+		'var msg;\n' +
+		'while ((msg = worker.parent.recv()) !== null) {\n' +
+		"	if (typeof msg === 'string') {\n" +
+		"		worker.parent.send(argv[2] + ':' + msg);\n" +
+		'	} else {\n' +
+		'		msg[0]++;\n' +
+		'		worker.parent.send(msg);\n' +
+		'	}\n' +
+		'}\n' +
+		'return 42;\n'
+);
+
+test('parent', function () {
+	expect.is(null, worker.parent);
+});
+
+test('create/send/recv/join', function () {
+	const w = worker.create(ECHO_SCRIPT, 'w');
+
+	w.send('hola 😀');
+	expect.is('w:hola 😀', w.recv());
+
+	const buf = new Uint8Array([1, 2, 3]);
+	w.send(buf);
+
+	const echo = w.recv();
+	expect.array_equals([2, 2, 3], Array.prototype.slice.call(echo));
+	expect.array_equals([1, 2, 3], Array.prototype.slice.call(buf));
+
+	w.close();
+
+	expect.is(null, w.recv());
+	expect.is(42, w.join());
+});
+
+test('alloc (transfer)', function () {
+	const w = worker.create(ECHO_SCRIPT, 'w');
+
+	const buf = worker.alloc(2);
+	buf[0] = 7;
+
+	w.send(buf);
+
+	// Transferred buffers are detached
+	expect.is(0, buf[0]);
+
+	const echo = w.recv();
+	expect.is(8, echo[0]);
+
+	w.close();
+	w.join();
+});
+
+test('alloc > subarray', function () {
+	const w = worker.create(ECHO_SCRIPT, 'w');
+
+	var view = worker.alloc(1 << 20).subarray(10, 20);
+
+	Duktape.gc();
+	for (var i = 0; i < 8; i++) {
+		worker.alloc(1 << 20);
+	}
+	Duktape.gc();
+
+	view[0] = 7;
+	expect.is(7, view[0]);
+
+	// Partial views are copied instead of transferred
+	w.send(view);
+
+	expect.is(7, view[0]);
+
+	const echo = w.recv();
+	expect.is(10, echo.length);
+	expect.is(8, echo[0]);
+
+	w.close();
+	w.join();
+});
+
+test('fd/recv timeout', function () {
+	const w = worker.create(ECHO_SCRIPT, 'w');
+
+	expect.is(undefined, w.recv(0));
+
+	const fds = [{ fd: w.fd(), events: io.POLLIN, revents: 0 }];
+
+	expect.is(0, io.poll(fds, 0));
+
+	w.send('x');
+
+	fds[0].revents = 0;
+
+	expect.is(1, io.poll(fds, 5000));
+	expect.is('w:x', w.recv(0));
+
+	w.close();
+	w.join();
+});
+
+test('parallel workers', function () {
+	const workers = [];
+
+	for (var i = 0; i < 4; i++) {
+		workers.push(worker.create(ECHO_SCRIPT, 'w' + i));
+	}
+
+	workers.forEach(function (w, i) {
+		w.send(String(i));
+		w.close();
+	});
+
+	workers.forEach(function (w, i) {
+		expect.is('w' + i + ':' + i, w.recv());
+		expect.is(null, w.recv());
+		expect.is(42, w.join());
+	});
+});